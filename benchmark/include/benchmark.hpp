@@ -94,6 +94,10 @@ using zmat = etl::dyn_matrix<std::complex<double>>;
 using zmat3 = etl::dyn_matrix<std::complex<double>, 3>;
 using ezvec = etl::dyn_vector<etl::complex<double>>;
 
+using bvec = etl::dyn_vector<etl::bfloat16>;
+using bmat = etl::dyn_matrix<etl::bfloat16>;
+using hvec = etl::dyn_vector<etl::half>;
+
 using smat_cm = etl::dyn_matrix_cm<float>;
 using dmat_cm = etl::dyn_matrix_cm<double>;
 using cmat_cm = etl::dyn_matrix_cm<std::complex<float>>;
@@ -125,6 +129,7 @@ using fast_policy = VALUES_POLICY(1);
 using fft_1d_policy = VALUES_POLICY(100, 1000, 10000, 100000, 1000000);
 using fft_1d_policy_2 = VALUES_POLICY(16, 64, 256, 1024, 16384, 131072, 1048576, 2097152);
 using fft_1d_many_policy = VALUES_POLICY(10, 50, 100, 500, 1000, 5000, 10000, 50000);
+using stft_policy = VALUES_POLICY(16384, 65536, 262144, 1048576, 4194304);
 
 using fft_2d_policy = NARY_POLICY(
     VALUES_POLICY(8, 16, 32, 64, 128, 256, 512, 1024, 2048),
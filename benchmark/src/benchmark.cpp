@@ -49,6 +49,40 @@ CPM_BENCH() {
         );
 }
 
+//Bench 16-bit floating point conversions
+CPM_BENCH() {
+    CPM_TWO_PASS_NS(
+        "r = a (s -> bf16) [std][convert][s]",
+        [](size_t d){ return std::make_tuple(svec(d), bvec(d)); },
+        [](svec& a, bvec& r){ r = a; }
+        );
+
+    CPM_TWO_PASS_NS(
+        "r = a (bf16 -> s) [std][convert][s]",
+        [](size_t d){ return std::make_tuple(bvec(d), svec(d)); },
+        [](bvec& a, svec& r){ r = a; }
+        );
+
+    CPM_TWO_PASS_NS(
+        "r = a (s -> h) [std][convert][s]",
+        [](size_t d){ return std::make_tuple(svec(d), hvec(d)); },
+        [](svec& a, hvec& r){ r = a; }
+        );
+
+    CPM_TWO_PASS_NS(
+        "r = a (h -> s) [std][convert][s]",
+        [](size_t d){ return std::make_tuple(hvec(d), svec(d)); },
+        [](hvec& a, svec& r){ r = a; }
+        );
+
+    CPM_TWO_PASS_NS_P(
+        mat_policy_2d,
+        "R = A * B (bf16) [gemm][convert][s]",
+        [](auto d1, auto d2){ return std::make_tuple(bmat(d1, d2), bmat(d2, d1), smat(d1, d1)); },
+        [](bmat& A, bmat& B, smat& R){ R = A * B; }
+        );
+}
+
 //Bench addition
 CPM_BENCH() {
 
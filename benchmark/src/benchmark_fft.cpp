@@ -106,6 +106,25 @@ CPM_DIRECT_SECTION_TWO_PASS_NS_PF("zfft_2d(2^b) [fft]", fft_2d_policy,
 )
 #endif
 
+CPM_DIRECT_SECTION_TWO_PASS_NS_PF("stft_power(512, 128) (s) [fft]", stft_policy,
+    FLOPS([](size_t d){ return 2 * ((d - 512) / 128 + 1) * 512 * std::log2(512); }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(svec(d), svec(512UL), smat((d - 512) / 128 + 1, 257UL), smat((d - 512) / 128 + 1, 512UL), cmat((d - 512) / 128 + 1, 512UL)); }),
+    CPM_SECTION_FUNCTOR("stft", [](svec& a, svec& w, smat& r, smat& /*f*/, cmat& /*s*/){ r = etl::stft_power(a, w, 512, 128); }),
+    CPM_SECTION_FUNCTOR("framed", [](svec& a, svec& w, smat& r, smat& f, cmat& s){
+        for (size_t i = 0; i < etl::dim<0>(f); ++i) {
+            f(i) = etl::slice(a, i * 128, i * 128 + 512) >> w;
+        }
+
+        s = etl::fft_1d_many(f);
+
+        for (size_t i = 0; i < etl::dim<0>(r); ++i) {
+            for (size_t k = 0; k < 257; ++k) {
+                r(i, k) = std::norm(s(i, k));
+            }
+        }
+    })
+)
+
 CPM_DIRECT_SECTION_TWO_PASS_NS_PF("cfft_2d_many (512) [fft]", fft_2d_many_policy,
     FLOPS([](size_t d1, size_t d2){ return 2 * 512 * d1 * d2 * std::log2(d1 * d2); }),
     CPM_SECTION_INIT([](size_t d1, size_t d2){ return std::make_tuple(cmat3(512UL, d1,d2), cmat3(512UL, d1,d2)); }),
@@ -146,3 +146,47 @@ CPM_TWO_PASS_NS_P(
         [](size_t d){ return 2 * d * d * 4 * 4; }
         );
 }
+
+CPM_DIRECT_SECTION_TWO_PASS_NS_PF("mp<2x2>(d=4) [mp][impl][s]", mp_policy,
+    FLOPS([](size_t d){ return 50 * 8 * d * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat4(50, 8, d, d), smat4(50, 8, d / 2, d / 2)); }),
+    CPM_SECTION_FUNCTOR("default", [](smat4& a, smat4& r){ r = etl::ml::max_pool_forward<2, 2>(a); }),
+    CPM_SECTION_FUNCTOR("std", [](smat4& a, smat4& r){ r = selected_helper(etl::pool_impl::STD, (etl::ml::max_pool_forward<2, 2>(a))); })
+    VEC_SECTION_FUNCTOR("vec", [](smat4& a, smat4& r){ r = selected_helper(etl::pool_impl::VEC, (etl::ml::max_pool_forward<2, 2>(a))); })
+    CUDNN_SECTION_FUNCTOR("cudnn", [](smat4& a, smat4& r){ r = selected_helper(etl::pool_impl::CUDNN, (etl::ml::max_pool_forward<2, 2>(a))); })
+)
+
+CPM_DIRECT_SECTION_TWO_PASS_NS_PF("mp(d=4, 3, 3, 2, 2) [mp][impl][s]", mp_policy,
+    FLOPS([](size_t d){ return 50 * 8 * d * d * 9 / 4; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat4(50, 8, d, d), smat4(50, 8, (d - 3) / 2 + 1, (d - 3) / 2 + 1)); }),
+    CPM_SECTION_FUNCTOR("default", [](smat4& a, smat4& r){ r = etl::ml::max_pool_forward(a, 3, 3, 2, 2); }),
+    CPM_SECTION_FUNCTOR("std", [](smat4& a, smat4& r){ r = selected_helper(etl::pool_impl::STD, etl::ml::max_pool_forward(a, 3, 3, 2, 2)); })
+    VEC_SECTION_FUNCTOR("vec", [](smat4& a, smat4& r){ r = selected_helper(etl::pool_impl::VEC, etl::ml::max_pool_forward(a, 3, 3, 2, 2)); })
+    CUDNN_SECTION_FUNCTOR("cudnn", [](smat4& a, smat4& r){ r = selected_helper(etl::pool_impl::CUDNN, etl::ml::max_pool_forward(a, 3, 3, 2, 2)); })
+)
+
+CPM_DIRECT_SECTION_TWO_PASS_NS_PF("ap<2x2>(d=4) [ap][impl][s]", mp_policy,
+    FLOPS([](size_t d){ return 50 * 8 * d * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat4(50, 8, d, d), smat4(50, 8, d / 2, d / 2)); }),
+    CPM_SECTION_FUNCTOR("default", [](smat4& a, smat4& r){ r = etl::ml::avg_pool_forward<2, 2>(a); }),
+    CPM_SECTION_FUNCTOR("std", [](smat4& a, smat4& r){ r = selected_helper(etl::pool_impl::STD, (etl::ml::avg_pool_forward<2, 2>(a))); })
+    VEC_SECTION_FUNCTOR("vec", [](smat4& a, smat4& r){ r = selected_helper(etl::pool_impl::VEC, (etl::ml::avg_pool_forward<2, 2>(a))); })
+    CUDNN_SECTION_FUNCTOR("cudnn", [](smat4& a, smat4& r){ r = selected_helper(etl::pool_impl::CUDNN, (etl::ml::avg_pool_forward<2, 2>(a))); })
+)
+
+CPM_DIRECT_SECTION_TWO_PASS_NS_PF("mp_backward<2x2>(d=4) [mp][impl][s]", mp_policy,
+    FLOPS([](size_t d){ return 50 * 8 * d * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat4(50, 8, d, d), smat4(50, 8, d / 2, d / 2), smat4(50, 8, d / 2, d / 2), smat4(50, 8, d, d)); }),
+    CPM_SECTION_FUNCTOR("default", [](smat4& a, smat4& b, smat4& e, smat4& r){ r = etl::ml::max_pool_backward<2, 2, 2, 2, 0, 0>(a, b, e); }),
+    CPM_SECTION_FUNCTOR("std", [](smat4& a, smat4& b, smat4& e, smat4& r){ r = selected_helper(etl::pool_impl::STD, (etl::ml::max_pool_backward<2, 2, 2, 2, 0, 0>(a, b, e))); })
+    VEC_SECTION_FUNCTOR("vec", [](smat4& a, smat4& b, smat4& e, smat4& r){ r = selected_helper(etl::pool_impl::VEC, (etl::ml::max_pool_backward<2, 2, 2, 2, 0, 0>(a, b, e))); })
+    CUDNN_SECTION_FUNCTOR("cudnn", [](smat4& a, smat4& b, smat4& e, smat4& r){ r = selected_helper(etl::pool_impl::CUDNN, (etl::ml::max_pool_backward<2, 2, 2, 2, 0, 0>(a, b, e))); })
+)
+
+CPM_DIRECT_SECTION_TWO_PASS_NS_PF("mp_derivative<2x2>(d=4) [mp][impl][s]", mp_policy,
+    FLOPS([](size_t d){ return 50 * 8 * d * d; }),
+    CPM_SECTION_INIT([](size_t d){ return std::make_tuple(smat4(50, 8, d, d), smat4(50, 8, d / 2, d / 2), smat4(50, 8, d, d)); }),
+    CPM_SECTION_FUNCTOR("default", [](smat4& a, smat4& b, smat4& r){ r = etl::max_pool_derivative_2d<2, 2>(a, b); }),
+    CPM_SECTION_FUNCTOR("std", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::pool_impl::STD, (etl::max_pool_derivative_2d<2, 2>(a, b))); })
+    VEC_SECTION_FUNCTOR("vec", [](smat4& a, smat4& b, smat4& r){ r = selected_helper(etl::pool_impl::VEC, (etl::max_pool_derivative_2d<2, 2>(a, b))); })
+)
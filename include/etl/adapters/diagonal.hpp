@@ -116,6 +116,9 @@ public:
      */
     template <typename E, cpp_enable_iff(std::is_convertible_v<value_t<E>, value_type> && is_etl_expr<E>)>
     diagonal_matrix& operator=(E&& e) noexcept(false) {
+        // The temporaries must be evaluated before being checked
+        force(e);
+
         // Make sure the other matrix is diagonal
         if (!is_diagonal(e)) {
             throw diagonal_exception();
@@ -116,6 +116,9 @@ public:
      */
     template <typename E, cpp_enable_iff(std::is_convertible_v<value_t<E>, value_type> && is_etl_expr<E>)>
     strictly_lower_matrix& operator=(E&& e) noexcept(false) {
+        // The temporaries must be evaluated before being checked
+        force(e);
+
         // Make sure the other matrix is strictly lower triangular
         if (!is_strictly_lower_triangular(e)) {
             throw strictly_lower_exception();
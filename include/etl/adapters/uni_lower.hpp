@@ -111,6 +111,9 @@ public:
      */
     template <typename E, cpp_enable_iff(std::is_convertible_v<value_t<E>, value_type> && is_etl_expr<E>)>
     uni_lower_matrix& operator=(E&& e) noexcept(false) {
+        // The temporaries must be evaluated before being checked
+        force(e);
+
         // Make sure the other matrix is uni lower triangular
         if (!is_uni_lower_triangular(e)) {
             throw uni_lower_exception();
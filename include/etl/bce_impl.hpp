@@ -19,6 +19,7 @@ namespace etl {
  */
 enum class bce_impl {
     STD,   ///< Standard implementation
+    VEC,   ///< Vectorized implementation
     EGBLAS ///< GPU implementation
 };
 
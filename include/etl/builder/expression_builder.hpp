@@ -116,6 +116,45 @@ auto clip(E&& value, T min, T max) {
     return detail::make_stateful_unary_expr<E, clip_scalar_op<value_t<E>, value_t<E>>>(value, value_t<E>(min), value_t<E>(max));
 }
 
+/*!
+ * \brief Quantize each value of the ETL expression
+ *
+ * Each value x is quantized as round(x / scale) + zero_point, saturated to
+ * the range of the quantized type.
+ *
+ * \param value The ETL expression
+ * \param scale The quantization scale
+ * \param zero_point The quantization zero point
+ * \tparam Q The quantized type
+ * \return an expression representing the quantized values of the ETL expression
+ */
+template <typename Q = int8_t, typename E, typename T>
+auto quantize(E&& value, T scale, int32_t zero_point = 0) {
+    static_assert(is_etl_expr<E>, "etl::quantize can only be used on ETL expressions");
+    static_assert(std::is_floating_point_v<value_t<E>>, "etl::quantize can only be used on floating point expressions");
+    static_assert(std::is_integral_v<Q>, "etl::quantize can only quantize into integers");
+    return unary_expr<Q, detail::build_type<E>, stateful_op<quantize_op<value_t<E>, Q>>>(value, value_t<E>(scale), zero_point);
+}
+
+/*!
+ * \brief Dequantize each value of the ETL expression
+ *
+ * Each quantized value q is converted as scale * (q - zero_point).
+ *
+ * \param value The ETL expression
+ * \param scale The quantization scale
+ * \param zero_point The quantization zero point
+ * \tparam T The floating point type
+ * \return an expression representing the dequantized values of the ETL expression
+ */
+template <typename T = float, typename E, typename S>
+auto dequantize(E&& value, S scale, int32_t zero_point = 0) {
+    static_assert(is_etl_expr<E>, "etl::dequantize can only be used on ETL expressions");
+    static_assert(std::is_integral_v<value_t<E>>, "etl::dequantize can only be used on integer expressions");
+    static_assert(std::is_floating_point_v<T>, "etl::dequantize can only dequantize into floating points");
+    return unary_expr<T, detail::build_type<E>, stateful_op<dequantize_op<value_t<E>, T>>>(value, T(scale), zero_point);
+}
+
 /*!
  * \brief Apply pow(x, v) on each element x of the ETL expression.
  *
@@ -684,10 +723,15 @@ template <typename E>
 value_t<E> sum(E&& values) {
     static_assert(is_etl_expr<E>, "etl::sum can only be used on ETL expressions");
 
-    //Reduction force evaluation
-    force(values);
+    if constexpr (is_sparse_structural<E>) {
+        // Only the non-zeros of the sparse operands are reduced
+        return sparse_detail::structural_sum(values);
+    } else {
+        //Reduction force evaluation
+        force(values);
 
-    return detail::sum_impl::apply(values);
+        return detail::sum_impl::apply(values);
+    }
 }
 
 /*!
@@ -699,10 +743,15 @@ template <typename E>
 value_t<E> asum(E&& values) {
     static_assert(is_etl_expr<E>, "etl::asum can only be used on ETL expressions");
 
-    //Reduction force evaluation
-    force(values);
+    if constexpr (is_sparse_structural<E>) {
+        // Only the non-zeros of the sparse operands are reduced
+        return sparse_detail::structural_asum(values);
+    } else {
+        //Reduction force evaluation
+        force(values);
 
-    return detail::asum_impl::apply(values);
+        return detail::asum_impl::apply(values);
+    }
 }
 
 /*!
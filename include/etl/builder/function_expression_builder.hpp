@@ -272,12 +272,7 @@ auto hard_sigmoid(E&& x) -> decltype(etl::clip(x * 0.2 + 0.5, 0.0, 1.0)) {
 template <typename E>
 auto softmax(E&& e) {
     static_assert(is_etl_expr<E>, "etl::softmax can only be used on ETL expressions");
-
-    if constexpr (etl::is_1d<E>) {
-        return exp(e) / sum(exp(e));
-    } else {
-        return batch_softmax_expr<detail::build_type<E>, false>{e};
-    }
+    return batch_softmax_expr<detail::build_type<E>, false>{e};
 }
 
 /*!
@@ -289,13 +284,7 @@ auto softmax(E&& e) {
 template <typename E>
 auto stable_softmax(E&& e) {
     static_assert(is_etl_expr<E>, "etl::softmax can only be used on ETL expressions");
-
-    if constexpr (etl::is_1d<E>) {
-        auto m = max(e);
-        return exp(e - m) / sum(exp(e - m));
-    } else {
-        return batch_softmax_expr<detail::build_type<E>, true>{e};
-    }
+    return batch_softmax_expr<detail::build_type<E>, true>{e};
 }
 
 /*!
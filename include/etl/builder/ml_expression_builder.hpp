@@ -649,6 +649,26 @@ std::pair<value_t<O>, value_t<O>> cce(O&& output, L&& labels, value_t<O> alpha,
     return detail::cce_impl::apply(output, labels, alpha, beta);
 }
 
+/*!
+ * \brief Computes the softmax of the logits, its Categorical Cross Entropy
+ * Loss and the gradients of the loss in a single pass.
+ *
+ * The loss is computed as cce_loss(softmax(logits), labels, scale) and the
+ * gradients are set to softmax(logits) - labels.
+ *
+ * \param logits The logits
+ * \param labels The labels
+ * \param gradients The output gradients
+ * \param scale The scale to apply to the loss
+ * \return The CCE Loss of the softmax of the logits and labels
+ */
+template <typename O, typename L, typename G>
+value_t<O> softmax_cross_entropy(O&& logits, L&& labels, G&& gradients, value_t<O> scale) {
+    static_assert(all_etl_expr<O, L, G>, "etl::softmax_cross_entropy can only be used on ETL expressions");
+
+    return detail::softmax_cross_entropy_impl::apply(logits, labels, gradients, scale);
+}
+
 /*!
  * \brief Returns the Binary Cross Entropy Loss
  * \param output The outputs
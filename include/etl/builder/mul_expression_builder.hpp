@@ -28,4 +28,111 @@ auto lazy_mul(A&& a, B&& b) -> detail::stable_transform_binary_helper<A, B, mm_m
     return detail::stable_transform_binary_helper<A, B, mm_mul_transformer>{mm_mul_transformer<detail::build_type<A>, detail::build_type<B>>(a, b)};
 }
 
+namespace detail {
+
+/*!
+ * \brief Build the sparse product of a and b, unwrapping the transposition
+ * of the sparse matrix so that its transposition is never computed.
+ * \param a The left hand side
+ * \param b The right hand side
+ * \return An expression representing the product of a and b
+ */
+template <typename A, typename B>
+auto sparse_mul(A&& a, B&& b) {
+    if constexpr (traits_detail::is_transposed_sparse_matrix_impl<std::decay_t<A>>::value) {
+        return sparse_mul_expr<decltype(a.a()), build_type<B>, true>{a.a(), b};
+    } else if constexpr (traits_detail::is_transposed_sparse_matrix_impl<std::decay_t<B>>::value) {
+        return sparse_mul_expr<build_type<A>, decltype(b.a()), true>{a, b.a()};
+    } else {
+        return sparse_mul_expr<build_type<A>, build_type<B>, false>{a, b};
+    }
+}
+
+/*!
+ * \brief Build the product of a and b exploiting the structure of one of the
+ * operands, unwrapping the transposition of the structured matrix so that
+ * its transposition is never computed.
+ *
+ * Symmetric matrices are stored in full, their transposition is simply
+ * dropped and their products are computed by the dense kernels (SYMM).
+ *
+ * \param a The left hand side
+ * \param b The right hand side
+ * \return An expression representing the product of a and b
+ */
+template <typename A, typename B>
+auto structured_mul(A&& a, B&& b) {
+    if constexpr (is_symmetric_matrix<transposed_t<A>>) {
+        return a.a() * std::forward<B>(b);
+    } else if constexpr (is_symmetric_matrix<transposed_t<B>>) {
+        return std::forward<A>(a) * b.a();
+    } else if constexpr (is_structured_operand<A> && is_transpose_expr<A>) {
+        return structured_mul_expr<decltype(a.a()), build_type<B>, true>{a.a(), b};
+    } else if constexpr (is_structured_operand<A>) {
+        return structured_mul_expr<build_type<A>, build_type<B>, false>{a, b};
+    } else if constexpr (is_transpose_expr<B>) {
+        return structured_mul_expr<build_type<A>, decltype(b.a()), true>{a, b.a()};
+    } else {
+        return structured_mul_expr<build_type<A>, build_type<B>, false>{a, b};
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Multiply a sparse matrix and a dense matrix or vector together.
+ *
+ * Either operand can be the sparse matrix, possibly transposed. Only the
+ * non-zeros of the sparse matrix are used.
+ *
+ * \param a The left hand side
+ * \param b The right hand side
+ * \return An expression representing the product of a and b
+ */
+template <typename A, typename B, cpp_enable_iff(is_sparse_mul<A, B> && (all_2d<A, B> || (is_2d<A> && is_1d<B>) || (is_1d<A> && is_2d<B>)))>
+auto operator*(A&& a, B&& b) {
+    static_assert(all_etl_expr<A, B>, "Sparse multiplication only supported for ETL expressions");
+
+    return detail::sparse_mul(std::forward<A>(a), std::forward<B>(b));
+}
+
+/*!
+ * \copydoc operator*(A&& a, B&& b)
+ */
+template <typename A, typename B, cpp_enable_iff(is_sparse_mul<A, B> && (all_2d<A, B> || (is_2d<A> && is_1d<B>) || (is_1d<A> && is_2d<B>)))>
+auto mul(A&& a, B&& b) {
+    static_assert(all_etl_expr<A, B>, "Sparse multiplication only supported for ETL expressions");
+
+    return detail::sparse_mul(std::forward<A>(a), std::forward<B>(b));
+}
+
+/*!
+ * \brief Multiply a diagonal, triangular or symmetric matrix and a dense
+ * matrix together.
+ *
+ * Either operand can be the structured matrix, possibly transposed. The
+ * diagonal products are computed in O(N^2) and the triangular products only
+ * use the non-zero half of the triangular matrix.
+ *
+ * \param a The left hand side
+ * \param b The right hand side
+ * \return An expression representing the product of a and b
+ */
+template <typename A, typename B, cpp_enable_iff(all_2d<A, B> && is_structured_mul<A, B>)>
+auto operator*(A&& a, B&& b) {
+    static_assert(all_etl_expr<A, B>, "Matrix multiplication only supported for ETL expressions");
+
+    return detail::structured_mul(std::forward<A>(a), std::forward<B>(b));
+}
+
+/*!
+ * \copydoc operator*(A&& a, B&& b)
+ */
+template <typename A, typename B, cpp_enable_iff(all_2d<A, B> && is_structured_mul<A, B>)>
+auto mul(A&& a, B&& b) {
+    static_assert(all_etl_expr<A, B>, "Matrix multiplication only supported for ETL expressions");
+
+    return detail::structured_mul(std::forward<A>(a), std::forward<B>(b));
+}
+
 } //end of namespace etl
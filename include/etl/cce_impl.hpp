@@ -19,6 +19,7 @@ namespace etl {
  */
 enum class cce_impl {
     STD,   ///< Standard implementation
+    VEC,   ///< Vectorized implementation
     EGBLAS ///< GPU implementation
 };
 
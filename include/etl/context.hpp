@@ -29,17 +29,18 @@ struct context {
     bool cpu      = false; ///< Force CPU evaluation
 
 #ifdef ETL_MANUAL_SELECT
-    forced_impl<sum_impl> sum_selector;               ///< Forced selector for sum
-    forced_impl<pool_impl> pool_selector;             ///< Forced selector for pooling
-    forced_impl<transpose_impl> transpose_selector;   ///< Forced selector for transpose
-    forced_impl<dot_impl> dot_selector;               ///< Forced selector for dot
-    forced_impl<conv_impl> conv_selector;             ///< Forced selector for conv
-    forced_impl<conv_multi_impl> conv_multi_selector; ///< Forced selector for conv_multi
-    forced_impl<conv4_impl> conv4_selector;           ///< Forced selector for conv4
-    forced_impl<gemm_impl> gemm_selector;             ///< Forced selector for gemm
-    forced_impl<outer_impl> outer_selector;           ///< Forced selector for outer product
-    forced_impl<bias_add_impl> bias_add_selector;     ///< Forced selector for bias_add product
-    forced_impl<fft_impl> fft_selector;               ///< Forced selector for fft
+    forced_impl<sum_impl> sum_selector;                     ///< Forced selector for sum
+    forced_impl<pool_impl> pool_selector;                   ///< Forced selector for pooling
+    forced_impl<transpose_impl> transpose_selector;         ///< Forced selector for transpose
+    forced_impl<dot_impl> dot_selector;                     ///< Forced selector for dot
+    forced_impl<conv_impl> conv_selector;                   ///< Forced selector for conv
+    forced_impl<conv_multi_impl> conv_multi_selector;       ///< Forced selector for conv_multi
+    forced_impl<conv4_impl> conv4_selector;                 ///< Forced selector for conv4
+    forced_impl<gemm_impl> gemm_selector;                   ///< Forced selector for gemm
+    forced_impl<outer_impl> outer_selector;                 ///< Forced selector for outer product
+    forced_impl<bias_add_impl> bias_add_selector;           ///< Forced selector for bias_add product
+    forced_impl<fft_impl> fft_selector;                     ///< Forced selector for fft
+    forced_impl<batch_softmax_impl> batch_softmax_selector; ///< Forced selector for batch_softmax
 #endif
 };
 
@@ -62,7 +63,7 @@ inline bool is_something_forced() {
     auto& c = local_context();
     return c.sum_selector.forced || c.pool_selector.forced || c.transpose_selector.forced || c.dot_selector.forced || c.conv_selector.forced
            || c.conv_multi_selector.forced || c.conv4_selector.forced || c.gemm_selector.forced || c.outer_selector.forced || c.bias_add_selector.forced
-           || c.fft_selector.forced;
+           || c.fft_selector.forced || c.batch_softmax_selector.forced;
 #else
     return false;
 #endif
@@ -168,6 +169,14 @@ inline forced_impl<fft_impl>& get_forced_impl() {
     return local_context().fft_selector;
 }
 
+/*!
+ * \copydoc get_forced_impl
+ */
+template <>
+inline forced_impl<batch_softmax_impl>& get_forced_impl() {
+    return local_context().batch_softmax_selector;
+}
+
 #endif
 
 /*!
@@ -38,7 +38,8 @@ enum class conv4_impl {
     FFT_MKL,   ///< FFT reduction (with MKL impl)
     FFT_CUFFT, ///< FFT reduction (with CUFFT impl)
     BLAS_VEC,  ///< BLAS reduction
-    BLAS_MKL   ///< BLAS reduction
+    BLAS_MKL,  ///< BLAS reduction
+    WINOGRAD   ///< Winograd minimal filtering (3x3 kernels, unit strides)
 };
 
 /*!
@@ -0,0 +1,108 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Eigendecomposition of symmetric matrices
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Compute the eigenvalues, and optionally the eigenvectors, of a
+ * symmetric matrix.
+ *
+ * \param A The symmetric matrix, only its lower part is used [N, N]
+ * \param w The eigenvalues, in ascending order [N]
+ * \param V The eigenvectors, in columns, or nullptr [N, N]
+ *
+ * \return true if the decomposition suceeded, false otherwise
+ */
+template <typename AT, typename WT, typename VT>
+bool eigh_apply(const AT& A, WT& w, VT* V) {
+    static_assert(is_etl_expr<AT> && is_etl_expr<WT>, "eigh only supported for ETL expressions");
+    static_assert(is_2d<AT> && is_1d<WT>, "eigh computes the eigenvalues of a matrix in a vector");
+
+    using T = value_t<AT>;
+
+    static_assert(std::is_floating_point_v<T>, "eigh is only implemented for floating point types");
+
+    const size_t n = etl::dim<0>(A);
+
+    if (etl::dim<1>(A) != n || etl::size(w) != n) {
+        return false;
+    }
+
+    if (V && (etl::dim(*V, 0) != n || etl::dim(*V, 1) != n)) {
+        return false;
+    }
+
+    dyn_matrix<T, 2> a(n, n);
+    dyn_vector<T> values(n);
+
+    a = A;
+
+    bool converged;
+
+    if (V) {
+        dyn_matrix<T, 2> vectors(n, n);
+
+        converged = detail::eigh(a.memory_start(), values.memory_start(), vectors.memory_start(), n);
+
+        *V = vectors;
+    } else {
+        converged = detail::eigh(a.memory_start(), values.memory_start(), static_cast<T*>(nullptr), n);
+    }
+
+    w = values;
+
+    return converged;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the eigenvalues of a symmetric matrix
+ *
+ * The matrix is reduced to tridiagonal form with Householder reflectors and
+ * the eigenvalues are computed with the implicit QL algorithm. Only the
+ * lower part of A is used, A can also be a symmetric matrix adapter.
+ *
+ * \param A The symmetric matrix [N, N]
+ * \param w The eigenvalues, in ascending order [N]
+ * \return true if the decomposition suceeded, false otherwise
+ */
+template <typename AT, typename WT>
+bool eigh(const AT& A, WT& w) {
+    return detail::eigh_apply(A, w, static_cast<dyn_matrix<value_t<AT>, 2>*>(nullptr));
+}
+
+/*!
+ * \brief Compute the eigenvalues and the eigenvectors of a symmetric matrix,
+ * A = V * diag(w) * V^T
+ *
+ * The matrix is reduced to tridiagonal form with Householder reflectors and
+ * the eigenvalues are computed with the implicit QL algorithm. Only the
+ * lower part of A is used, A can also be a symmetric matrix adapter.
+ *
+ * \param A The symmetric matrix [N, N]
+ * \param w The eigenvalues, in ascending order [N]
+ * \param V The orthonormal eigenvectors, in columns [N, N]
+ * \return true if the decomposition suceeded, false otherwise
+ */
+template <typename AT, typename WT, typename VT>
+bool eigh(const AT& A, WT& w, VT& V) {
+    static_assert(is_etl_expr<VT> && is_2d<VT>, "eigh computes the eigenvectors in a matrix");
+
+    return detail::eigh_apply(A, w, &V);
+}
+
+} //end of namespace etl
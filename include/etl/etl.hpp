@@ -26,6 +26,7 @@
 #include "etl/context.hpp"
 #include "etl/parallel_session.hpp"
 #include "etl/complex.hpp"
+#include "etl/float16.hpp"
 #include "etl/vectorization.hpp"
 #include "etl/random.hpp"
 #include "etl/duration.hpp"
@@ -64,12 +65,23 @@
 #include "etl/checks.hpp"
 #include "etl/expression_helpers.hpp"
 
+// Structural evaluation of sparse expressions
+#include "etl/sparse_structural.hpp"
+
 // The simple views
 #include "etl/op/memory_slice_view.hpp"
 
 // The parallel utilies
 #include "etl/parallel_support.hpp"
 
+// The dense factorizations and triangular solves kernels
+#include "etl/impl/trsm.hpp"
+#include "etl/impl/lu.hpp"
+#include "etl/impl/cholesky.hpp"
+#include "etl/impl/qr.hpp"
+#include "etl/impl/eigh.hpp"
+#include "etl/impl/svd.hpp"
+
 // The evaluator
 #include "etl/evaluator.hpp"
 
@@ -87,6 +99,8 @@
 #include "etl/expr/bias_batch_mean_4d_expr.hpp"
 #include "etl/expr/bias_batch_var_2d_expr.hpp"
 #include "etl/expr/bias_batch_var_4d_expr.hpp"
+#include "etl/expr/batch_norm_forward_expr.hpp"
+#include "etl/expr/batch_norm_backward_expr.hpp"
 #include "etl/expr/bias_add_2d_expr.hpp"
 #include "etl/expr/bias_add_4d_expr.hpp"
 #include "etl/expr/pool_upsample_2d_expr.hpp"
@@ -107,12 +121,26 @@
 #include "etl/expr/dyn_prob_pool_2d_expr.hpp"
 #include "etl/expr/convmtx_2d_expr.hpp"
 #include "etl/expr/fft_expr.hpp"
+#include "etl/expr/stft_expr.hpp"
 #include "etl/expr/gemm_expr.hpp"
+#include "etl/expr/gemm_bias_expr.hpp"
+#include "etl/expr/qgemm_expr.hpp"
 #include "etl/expr/gemv_expr.hpp"
 #include "etl/expr/gevm_expr.hpp"
+#include "etl/expr/sparse_mul_expr.hpp"
+#include "etl/expr/structured_mul_expr.hpp"
 #include "etl/expr/outer_product_expr.hpp"
 #include "etl/expr/batch_outer_product_expr.hpp"
+#include "etl/expr/lstm_forward_expr.hpp"
+#include "etl/expr/lstm_backward_expr.hpp"
+#include "etl/expr/gru_forward_expr.hpp"
+#include "etl/expr/gru_backward_expr.hpp"
+#include "etl/expr/attention_expr.hpp"
 #include "etl/expr/inv_expr.hpp"
+#include "etl/expr/cholesky_expr.hpp"
+#include "etl/expr/trsm_expr.hpp"
+#include "etl/expr/solve_expr.hpp"
+#include "etl/expr/solve_spd_expr.hpp"
 #include "etl/expr/conv_1d_valid_expr.hpp"
 #include "etl/expr/conv_1d_same_expr.hpp"
 #include "etl/expr/conv_1d_full_expr.hpp"
@@ -120,6 +148,7 @@
 #include "etl/expr/conv_2d_same_expr.hpp"
 #include "etl/expr/conv_2d_full_expr.hpp"
 #include "etl/expr/dyn_conv_2d_valid_expr.hpp"
+#include "etl/expr/dyn_conv_2d_valid_dilated_expr.hpp"
 #include "etl/expr/conv_2d_valid_multi_expr.hpp"
 #include "etl/expr/conv_2d_same_multi_expr.hpp"
 #include "etl/expr/conv_2d_full_multi_expr.hpp"
@@ -133,6 +162,16 @@
 #include "etl/expr/dyn_conv_4d_valid_expr.hpp"
 #include "etl/expr/dyn_conv_4d_valid_filter_expr.hpp"
 #include "etl/expr/dyn_conv_4d_valid_back_expr.hpp"
+#include "etl/expr/dyn_conv_4d_valid_grouped_expr.hpp"
+#include "etl/expr/dyn_conv_4d_valid_grouped_back_expr.hpp"
+#include "etl/expr/dyn_conv_4d_valid_grouped_filter_expr.hpp"
+#include "etl/expr/dyn_conv_4d_valid_dilated_expr.hpp"
+#include "etl/expr/dyn_conv_4d_valid_back_dilated_expr.hpp"
+#include "etl/expr/dyn_conv_4d_valid_filter_dilated_expr.hpp"
+#include "etl/expr/dyn_conv_3d_expr.hpp"
+#include "etl/expr/dyn_conv_5d_valid_expr.hpp"
+#include "etl/expr/dyn_conv_5d_valid_back_expr.hpp"
+#include "etl/expr/dyn_conv_5d_valid_filter_expr.hpp"
 #include "etl/expr/conv_2d_full_deep_expr.hpp"
 #include "etl/expr/conv_2d_same_deep_expr.hpp"
 #include "etl/expr/conv_2d_valid_deep_expr.hpp"
@@ -183,9 +222,12 @@
 #include "etl/fast.hpp"
 #include "etl/dyn.hpp"
 #include "etl/sparse.hpp"
+#include "etl/sparse_compressed.hpp"
+#include "etl/sparse_builder.hpp"
 #include "etl/custom_dyn.hpp"
 #include "etl/custom_fast.hpp"
 #include "etl/gpu_dyn.hpp"
+#include "etl/sparse_gradients.hpp"
 
 // The adapters
 #include "etl/adapters/symmetric.hpp"
@@ -198,6 +240,13 @@
 #include "etl/adapters/strictly_upper.hpp"
 #include "etl/adapters/uni_upper.hpp"
 
+// The QR decomposition
+#include "etl/qr_decomposition.hpp"
+
+// The eigen and singular value decompositions
+#include "etl/eigen_decomposition.hpp"
+#include "etl/svd_decomposition.hpp"
+
 // Serialization support
 #include "etl/serializer.hpp"
 #include "etl/deserializer.hpp"
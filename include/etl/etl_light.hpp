@@ -26,6 +26,7 @@
 #include "etl/context.hpp"
 #include "etl/parallel_session.hpp"
 #include "etl/complex.hpp"
+#include "etl/float16.hpp"
 #include "etl/vectorization.hpp"
 #include "etl/random.hpp"
 #include "etl/duration.hpp"
@@ -64,12 +65,23 @@
 #include "etl/checks.hpp"
 #include "etl/expression_helpers.hpp"
 
+// Structural evaluation of sparse expressions
+#include "etl/sparse_structural.hpp"
+
 // The simple views
 #include "etl/op/memory_slice_view.hpp"
 
 // The parallel utilies
 #include "etl/parallel_support.hpp"
 
+// The dense factorizations and triangular solves kernels
+#include "etl/impl/trsm.hpp"
+#include "etl/impl/lu.hpp"
+#include "etl/impl/cholesky.hpp"
+#include "etl/impl/qr.hpp"
+#include "etl/impl/eigh.hpp"
+#include "etl/impl/svd.hpp"
+
 // The evaluator
 #include "etl/evaluator.hpp"
 
@@ -113,6 +125,8 @@
 #include "etl/fast.hpp"
 #include "etl/dyn.hpp"
 #include "etl/sparse.hpp"
+#include "etl/sparse_compressed.hpp"
+#include "etl/sparse_builder.hpp"
 #include "etl/custom_dyn.hpp"
 #include "etl/custom_fast.hpp"
 #include "etl/gpu_dyn.hpp"
@@ -128,6 +142,13 @@
 #include "etl/adapters/strictly_upper.hpp"
 #include "etl/adapters/uni_upper.hpp"
 
+// The QR decomposition
+#include "etl/qr_decomposition.hpp"
+
+// The eigen and singular value decompositions
+#include "etl/eigen_decomposition.hpp"
+#include "etl/svd_decomposition.hpp"
+
 // Serialization support
 #include "etl/serializer.hpp"
 #include "etl/deserializer.hpp"
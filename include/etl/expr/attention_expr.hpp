@@ -0,0 +1,333 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Scaled dot-product attention.
+ *
+ * This computes softmax(scale * Q * trans(K)) * V without storing the
+ * matrix of scores: the keys are processed by tiles with an online softmax,
+ * so that only one tile of scores exists at a time for each block of
+ * queries.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+#include "etl/impl/std/attention.hpp"
+#include "etl/impl/vec/attention.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the scaled dot-product attention of
+ * 2D [S, D] inputs, 3D [N, S, D] inputs (batches or heads) or 4D
+ * [B, H, S, D] inputs (batches and heads).
+ *
+ * \tparam Q The queries type
+ * \tparam K The keys type
+ * \tparam V The values type
+ */
+template <typename Q, typename K, typename V>
+struct attention_expr : base_temporary_expr_tern<attention_expr<Q, K, V>, Q, K, V> {
+    using value_type = value_t<Q>;                                   ///< The type of value of the expression
+    using this_type  = attention_expr<Q, K, V>;                      ///< The type of this expression
+    using base_type  = base_temporary_expr_tern<this_type, Q, K, V>; ///< The base type
+    using sub_traits = decay_traits<Q>;                              ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    const value_type scale; ///< The scale of the scores
+    const bool causal;      ///< Indicates if the causal mask is applied
+
+    /*!
+     * \brief Construct a new expression
+     * \param q The queries
+     * \param k The keys
+     * \param v The values
+     * \param scale The scale of the scores
+     * \param causal Indicates if the causal mask is applied
+     */
+    attention_expr(Q q, K k, V v, value_type scale, bool causal) : base_type(q, k, v), scale(scale), causal(causal) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the dimensions of the attention
+     * \param q The queries
+     * \param k The keys
+     * \param v The values
+     * \param c The output
+     */
+    template <typename C>
+    static void check([[maybe_unused]] const Q& q, [[maybe_unused]] const K& k, [[maybe_unused]] const V& v, [[maybe_unused]] const C& c) {
+        static constexpr size_t D = etl::dimensions<Q>();
+
+        static_assert(D >= 2 && D <= 4, "The inputs of attention are 2D, 3D or 4D matrices");
+        static_assert(etl::dimensions<K>() == D, "The keys of attention have the dimensions of the queries");
+        static_assert(etl::dimensions<V>() == D, "The values of attention have the dimensions of the queries");
+        static_assert(etl::dimensions<C>() == D, "The output of attention has the dimensions of the queries");
+
+        for (size_t d = 0; d < D - 2; ++d) {
+            cpp_assert(etl::dim(q, d) == etl::dim(k, d), "Invalid dimensions for attention");
+            cpp_assert(etl::dim(q, d) == etl::dim(v, d), "Invalid dimensions for attention");
+            cpp_assert(etl::dim(q, d) == etl::dim(c, d), "Invalid dimensions for attention");
+        }
+
+        cpp_assert(etl::dim(q, D - 1) == etl::dim(k, D - 1), "Invalid dimensions for attention");
+        cpp_assert(etl::dim(k, D - 2) == etl::dim(v, D - 2), "Invalid dimensions for attention");
+        cpp_assert(etl::dim(k, D - 2) > 0, "Invalid dimensions for attention");
+        cpp_assert(etl::dim(c, D - 2) == etl::dim(q, D - 2), "Invalid dimensions for attention");
+        cpp_assert(etl::dim(c, D - 1) == etl::dim(v, D - 1), "Invalid dimensions for attention");
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_to(L&& lhs) const {
+        static_assert(all_etl_expr<Q, K, V, L>, "attention only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        auto& q = this->a();
+        auto& k = this->b();
+        auto& v = this->c();
+
+        check(q, k, v, lhs);
+
+        standard_evaluator::pre_assign_rhs(q);
+        standard_evaluator::pre_assign_rhs(k);
+        standard_evaluator::pre_assign_rhs(v);
+
+        decltype(auto) qq = smart_forward(q);
+        decltype(auto) kk = smart_forward(k);
+        decltype(auto) vv = smart_forward(v);
+
+        qq.ensure_cpu_up_to_date();
+        kk.ensure_cpu_up_to_date();
+        vv.ensure_cpu_up_to_date();
+
+        static constexpr size_t D = etl::dimensions<Q>();
+
+        const size_t Sq = etl::dim(qq, D - 2);
+        const size_t Sk = etl::dim(kk, D - 2);
+        const size_t Dq = etl::dim(qq, D - 1);
+        const size_t Dv = etl::dim(vv, D - 1);
+
+        cpp_assert(Sq > 0 && Dq > 0, "Invalid dimensions for attention");
+
+        const size_t N = etl::size(qq) / (Sq * Dq);
+
+        if constexpr (impl::vec::attention_possible<vector_mode, decltype(qq), decltype(kk), decltype(vv), L>) {
+            inc_counter("impl:vec");
+            impl::vec::attention(qq.memory_start(), kk.memory_start(), vv.memory_start(), lhs.memory_start(), N, Sq, Sk, Dq, Dv, scale, causal);
+        } else {
+            inc_counter("impl:std");
+            impl::standard::attention(qq.memory_start(), kk.memory_start(), vv.memory_start(), lhs.memory_start(), N, Sq, Sk, Dq, Dv, scale, causal);
+        }
+
+        lhs.validate_cpu();
+        lhs.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const attention_expr& expr) {
+        return os << "attention(" << expr._a << ", " << expr._b << ", " << expr._c << ")";
+    }
+};
+
+/*!
+ * \brief Traits for an attention expression
+ * \tparam Q The queries type
+ * \tparam K The keys type
+ * \tparam V The values type
+ */
+template <typename Q, typename K, typename V>
+struct etl_traits<etl::attention_expr<Q, K, V>> {
+    using expr_t     = etl::attention_expr<Q, K, V>; ///< The expression type
+    using sub_expr_t = std::decay_t<Q>;              ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;       ///< The sub traits
+    using value_type = value_t<Q>;                   ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                      ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                     ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                     ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                     ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = all_fast<Q, V>;            ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                     ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                      ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                     ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                      ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                     ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                     ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                      ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                      ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                     ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam VV The vector mode
+     */
+    template <vector_mode_t VV>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        if constexpr (DD == sub_traits::dimensions() - 1) {
+            return decay_traits<V>::template dim<DD>();
+        } else {
+            return sub_traits::template dim<DD>();
+        }
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        if (d == sub_traits::dimensions() - 1) {
+            return etl::dim(e._c, d);
+        } else {
+            return sub_traits::dim(e._a, d);
+        }
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        constexpr size_t D = sub_traits::dimensions();
+
+        return (sub_traits::size(e._a) / etl::dim(e._a, D - 1)) * etl::dim(e._c, D - 1);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        constexpr size_t D = sub_traits::dimensions();
+
+        return (sub_traits::size() / sub_traits::template dim<D - 1>()) * decay_traits<V>::template dim<D - 1>();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return sub_traits::dimensions();
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+/*!
+ * \brief Returns the scaled dot-product attention softmax(scale * q * trans(k)) * v.
+ *
+ * The inputs can be 2D [S, D] matrices, 3D [N, S, D] matrices (batches or
+ * heads) or 4D [B, H, S, D] matrices (batches and heads), in which case the
+ * attention of each [S, D] matrix is computed independently. The softmax is
+ * computed over the keys and the matrix of scores is never stored.
+ *
+ * With causal masking, the query i only attends to the keys j <= i.
+ *
+ * \param q The [.., Sq, D] queries
+ * \param k The [.., Sk, D] keys
+ * \param v The [.., Sk, Dv] values
+ * \param scale The scale of the scores, usually 1 / sqrt(D)
+ * \param causal Indicates if the causal mask is applied
+ * \return An expression representing the [.., Sq, Dv] attention
+ */
+template <typename Q, typename K, typename V>
+attention_expr<detail::build_type<Q>, detail::build_type<K>, detail::build_type<V>> attention(const Q& q, const K& k, const V& v, value_t<Q> scale, bool causal = false) {
+    static_assert(all_etl_expr<Q, K, V>, "etl::attention can only be used on ETL expressions");
+    static_assert(decay_traits<Q>::dimensions() >= 2 && decay_traits<Q>::dimensions() <= 4, "etl::attention is only defined for 2D, 3D and 4D inputs");
+    static_assert(all_row_major<Q, K, V>, "etl::attention is only defined for row-major expressions");
+    static_assert(all_floating<Q, K, V>, "etl::attention is only defined for floating point expressions");
+
+    return {q, k, v, scale, causal};
+}
+
+} //end of namespace etl
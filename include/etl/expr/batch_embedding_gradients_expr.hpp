@@ -8,6 +8,7 @@
 #pragma once
 
 #include "etl/expr/base_temporary_expr.hpp"
+#include "etl/impl/std/embedding.hpp"
 
 namespace etl {
 
@@ -78,19 +79,19 @@ struct batch_embedding_gradients_expr : base_temporary_expr_tern<batch_embedding
 
         check(a, b, c, lhs);
 
-        const auto BB = etl::dim<0>(a);
-        const auto I  = etl::dim<1>(a);
-
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
-        lhs = 0;
+        decltype(auto) ids    = smart_forward(a);
+        decltype(auto) errors = smart_forward(b);
 
-        for (size_t bb = 0; bb < BB; ++bb) {
-            for (size_t i = 0; i < I; ++i) {
-                lhs(a(bb, i)) += b(bb)(i);
-            }
-        }
+        ids.ensure_cpu_up_to_date();
+        errors.ensure_cpu_up_to_date();
+
+        impl::standard::embedding_gradients(ids, errors, lhs);
+
+        lhs.validate_cpu();
+        lhs.invalidate_gpu();
     }
 
     /*!
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "etl/expr/base_temporary_expr.hpp"
+#include "etl/impl/std/embedding.hpp"
 
 namespace etl {
 
@@ -80,14 +81,16 @@ struct batch_embedding_lookup_expr : base_temporary_expr_bin<batch_embedding_loo
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
-        const auto BB = etl::dim<0>(a);
-        const auto I  = etl::dim<1>(a);
+        decltype(auto) ids   = smart_forward(a);
+        decltype(auto) vocab = smart_forward(b);
 
-        for (size_t bb = 0; bb < BB; ++bb) {
-            for (size_t i = 0; i < I; ++i) {
-                lhs(bb)(i) = b(a(bb, i));
-            }
-        }
+        ids.ensure_cpu_up_to_date();
+        vocab.ensure_cpu_up_to_date();
+
+        impl::standard::embedding_lookup(ids, vocab, lhs);
+
+        lhs.validate_cpu();
+        lhs.invalidate_gpu();
     }
 
     /*!
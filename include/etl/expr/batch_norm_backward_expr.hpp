@@ -0,0 +1,353 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Backward pass of the batch normalization.
+ *
+ * The sums needed for the gradients of the parameters are computed in a
+ * single pass over the input and the errors, and the gradients of the input
+ * are then computed in a second pass, for each channel independently.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+#include "etl/impl/std/batch_norm.hpp"
+#include "etl/impl/vec/batch_norm.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the gradients of the input of a batch
+ * normalization of a 2D [N, K] or a 4D [N, K, W, H] input.
+ *
+ * The gradients of gamma and beta are stored in the given vectors when the
+ * expression is evaluated.
+ *
+ * \tparam A The input type
+ * \tparam E The errors type
+ * \tparam G The scale (gamma) type
+ * \tparam M The mean type
+ * \tparam V The variance type
+ * \tparam DG The gradients of gamma type
+ * \tparam DB The gradients of beta type
+ */
+template <typename A, typename E, typename G, typename M, typename V, typename DG, typename DB>
+struct batch_norm_backward_expr : base_temporary_expr_tern<batch_norm_backward_expr<A, E, G, M, V, DG, DB>, A, E, G> {
+    using value_type = value_t<A>;                                        ///< The type of value of the expression
+    using this_type  = batch_norm_backward_expr<A, E, G, M, V, DG, DB>;     ///< The type of this expression
+    using base_type  = base_temporary_expr_tern<this_type, A, E, G>;        ///< The base type
+    using sub_traits = decay_traits<A>;                                   ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    M _mean;              ///< The mean of each channel
+    V _var;               ///< The variance of each channel
+    DG _dgamma;           ///< The gradients of gamma
+    DB _dbeta;            ///< The gradients of beta
+    const value_type eps; ///< The epsilon added to the variance
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The input
+     * \param dy The errors
+     * \param gamma The scale parameters
+     * \param mean The mean of each channel
+     * \param var The variance of each channel
+     * \param dgamma The gradients of gamma
+     * \param dbeta The gradients of beta
+     * \param eps The epsilon added to the variance
+     */
+    batch_norm_backward_expr(A a, E dy, G gamma, M mean, V var, DG dgamma, DB dbeta, value_type eps)
+            : base_type(a, dy, gamma), _mean(mean), _var(var), _dgamma(dgamma), _dbeta(dbeta), eps(eps) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the dimensions of the batch normalization
+     * \param a The input
+     * \param dy The errors
+     * \param gamma The scale parameters
+     * \param mean The mean of each channel
+     * \param var The variance of each channel
+     * \param dgamma The gradients of gamma
+     * \param dbeta The gradients of beta
+     * \param c The output
+     */
+    template <typename C>
+    static void check([[maybe_unused]] const A& a,
+                      [[maybe_unused]] const E& dy,
+                      [[maybe_unused]] const G& gamma,
+                      [[maybe_unused]] const M& mean,
+                      [[maybe_unused]] const V& var,
+                      [[maybe_unused]] const DG& dgamma,
+                      [[maybe_unused]] const DB& dbeta,
+                      [[maybe_unused]] const C& c) {
+        static_assert(etl::dimensions<A>() == 2 || etl::dimensions<A>() == 4, "The input of batch_norm_backward is a 2D or 4D matrix");
+        static_assert(etl::dimensions<A>() == etl::dimensions<E>(), "The errors of batch_norm_backward have the dimensions of the input");
+        static_assert(etl::dimensions<A>() == etl::dimensions<C>(), "The output of batch_norm_backward has the dimensions of the input");
+        static_assert(all_1d<G, M, V, DG, DB>, "The parameters of batch_norm_backward are vectors");
+
+        if constexpr (all_fast<A, E, G, M, V, DG, DB, C>) {
+            static_assert(decay_traits<A>::size() == decay_traits<E>::size(), "Invalid dimensions for batch_norm_backward");
+            static_assert(decay_traits<A>::size() == decay_traits<C>::size(), "Invalid dimensions for batch_norm_backward");
+            static_assert(etl::dim<1, A>() == etl::dim<0, G>(), "Invalid dimensions for batch_norm_backward");
+            static_assert(etl::dim<1, A>() == etl::dim<0, M>(), "Invalid dimensions for batch_norm_backward");
+            static_assert(etl::dim<1, A>() == etl::dim<0, V>(), "Invalid dimensions for batch_norm_backward");
+            static_assert(etl::dim<1, A>() == etl::dim<0, DG>(), "Invalid dimensions for batch_norm_backward");
+            static_assert(etl::dim<1, A>() == etl::dim<0, DB>(), "Invalid dimensions for batch_norm_backward");
+        } else {
+            cpp_assert(etl::size(a) == etl::size(dy), "Invalid dimensions for batch_norm_backward");
+            cpp_assert(etl::size(a) == etl::size(c), "Invalid dimensions for batch_norm_backward");
+            cpp_assert(etl::dim<1>(a) == etl::dim<0>(gamma), "Invalid dimensions for batch_norm_backward");
+            cpp_assert(etl::dim<1>(a) == etl::dim<0>(mean), "Invalid dimensions for batch_norm_backward");
+            cpp_assert(etl::dim<1>(a) == etl::dim<0>(var), "Invalid dimensions for batch_norm_backward");
+            cpp_assert(etl::dim<1>(a) == etl::dim<0>(dgamma), "Invalid dimensions for batch_norm_backward");
+            cpp_assert(etl::dim<1>(a) == etl::dim<0>(dbeta), "Invalid dimensions for batch_norm_backward");
+        }
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_to(L&& lhs) const {
+        static_assert(all_etl_expr<A, E, G, M, V, DG, DB, L>, "batch_norm_backward only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        auto& a     = this->a();
+        auto& dy    = this->b();
+        auto& gamma = this->c();
+
+        check(a, dy, gamma, _mean, _var, _dgamma, _dbeta, lhs);
+
+        standard_evaluator::pre_assign_rhs(a);
+        standard_evaluator::pre_assign_rhs(dy);
+        standard_evaluator::pre_assign_rhs(gamma);
+        standard_evaluator::pre_assign_rhs(_mean);
+        standard_evaluator::pre_assign_rhs(_var);
+
+        decltype(auto) x = smart_forward(a);
+        decltype(auto) e = smart_forward(dy);
+        decltype(auto) g = smart_forward(gamma);
+        decltype(auto) m = smart_forward(_mean);
+        decltype(auto) v = smart_forward(_var);
+
+        x.ensure_cpu_up_to_date();
+        e.ensure_cpu_up_to_date();
+        g.ensure_cpu_up_to_date();
+        m.ensure_cpu_up_to_date();
+        v.ensure_cpu_up_to_date();
+
+        if constexpr (impl::vec::batch_norm_backward_possible<vector_mode, decltype(x), decltype(e), L>) {
+            inc_counter("impl:vec");
+            impl::vec::batch_norm_backward(x, e, g, m, v, lhs, _dgamma, _dbeta, eps);
+        } else {
+            inc_counter("impl:std");
+            impl::standard::batch_norm_backward(x, e, g, m, v, lhs, _dgamma, _dbeta, eps);
+        }
+
+        _dgamma.validate_cpu();
+        _dgamma.invalidate_gpu();
+        _dbeta.validate_cpu();
+        _dbeta.invalidate_gpu();
+
+        lhs.validate_cpu();
+        lhs.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const batch_norm_backward_expr& expr) {
+        return os << "batch_norm_backward(" << expr._a << ", " << expr._b << ", " << expr._c << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a batch normalization backward expression
+ * \tparam A The input type
+ * \tparam E The errors type
+ * \tparam G The scale (gamma) type
+ * \tparam M The mean type
+ * \tparam V The variance type
+ * \tparam DG The gradients of gamma type
+ * \tparam DB The gradients of beta type
+ */
+template <typename A, typename E, typename G, typename M, typename V, typename DG, typename DB>
+struct etl_traits<etl::batch_norm_backward_expr<A, E, G, M, V, DG, DB>> {
+    using expr_t     = etl::batch_norm_backward_expr<A, E, G, M, V, DG, DB>; ///< The expression type
+    using sub_expr_t = std::decay_t<A>;                                    ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;                             ///< The sub traits
+    using value_type = value_t<A>;                                         ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                     ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                    ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                    ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                    ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = all_fast<A, E, G, M, V>;  ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                    ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                     ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                    ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                     ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                    ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                    ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                     ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                     ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                    ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam VV The vector mode
+     */
+    template <vector_mode_t VV>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return sub_traits::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return sub_traits::dim(e._a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return sub_traits::size(e._a);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return sub_traits::size();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return sub_traits::dimensions();
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+/*!
+ * \brief Returns the gradients of the input of a batch normalization of a 2D
+ * [N, K] or 4D [N, K, W, H] matrix in training mode.
+ *
+ * The gradients of gamma and beta are stored in dgamma and dbeta when the
+ * expression is evaluated.
+ *
+ * \param x The input of the batch normalization
+ * \param dy The errors at the output of the batch normalization
+ * \param gamma The scale parameters
+ * \param mean The mean computed by the forward pass
+ * \param var The variance computed by the forward pass
+ * \param dgamma The vector in which the gradients of gamma are stored
+ * \param dbeta The vector in which the gradients of beta are stored
+ * \param eps The epsilon added to the variance
+ * \return An expression representing the gradients of the input
+ */
+template <typename A, typename E, typename G, typename M, typename V, typename DG, typename DB>
+batch_norm_backward_expr<detail::build_type<A>, detail::build_type<E>, detail::build_type<G>, detail::build_type<M>, detail::build_type<V>, DG&, DB&>
+batch_norm_backward(const A& x, const E& dy, const G& gamma, const M& mean, const V& var, DG& dgamma, DB& dbeta, value_t<A> eps) {
+    static_assert(all_etl_expr<A, E, G, M, V, DG, DB>, "etl::batch_norm_backward can only be used on ETL expressions");
+    static_assert(is_2d<A> || is_4d<A>, "etl::batch_norm_backward is only defined for 2D and 4D input");
+    static_assert(all_row_major<A, E, G, M, V, DG, DB>, "etl::batch_norm_backward is only defined for row-major expressions");
+    static_assert(all_dma<DG, DB>, "etl::batch_norm_backward needs direct access to the gradients of gamma and beta");
+
+    return {x, dy, gamma, mean, var, dgamma, dbeta, eps};
+}
+
+} //end of namespace etl
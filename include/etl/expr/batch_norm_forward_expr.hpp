@@ -0,0 +1,418 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Forward pass of the batch normalization.
+ *
+ * In training mode, the mean and the variance of each channel are computed
+ * with a single-pass Welford reduction and stored in the given vectors, and
+ * the input is then normalized, scaled and shifted in a single pass. In
+ * inference mode, the given mean and variance are used directly.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+#include "etl/impl/std/batch_norm.hpp"
+#include "etl/impl/vec/batch_norm.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the batch normalization of a 2D [N, K]
+ * or a 4D [N, K, W, H] input, for each of the K channels.
+ *
+ * \tparam A The input type
+ * \tparam G The scale (gamma) type
+ * \tparam B The shift (beta) type
+ * \tparam M The mean type
+ * \tparam V The variance type
+ * \tparam Train Indicates if the mean and the variance are computed (training) or used (inference)
+ */
+template <typename A, typename G, typename B, typename M, typename V, bool Train>
+struct batch_norm_forward_expr : base_temporary_expr_tern<batch_norm_forward_expr<A, G, B, M, V, Train>, A, G, B> {
+    using value_type = value_t<A>;                                  ///< The type of value of the expression
+    using this_type  = batch_norm_forward_expr<A, G, B, M, V, Train>; ///< The type of this expression
+    using base_type  = base_temporary_expr_tern<this_type, A, G, B>;  ///< The base type
+    using sub_traits = decay_traits<A>;                             ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    M _mean;              ///< The mean of each channel
+    V _var;               ///< The variance of each channel
+    const value_type eps; ///< The epsilon added to the variance
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The input
+     * \param gamma The scale parameters
+     * \param beta The shift parameters
+     * \param mean The mean of each channel
+     * \param var The variance of each channel
+     * \param eps The epsilon added to the variance
+     */
+    batch_norm_forward_expr(A a, G gamma, B beta, M mean, V var, value_type eps) : base_type(a, gamma, beta), _mean(mean), _var(var), eps(eps) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the dimensions of the batch normalization
+     * \param a The input
+     * \param gamma The scale parameters
+     * \param beta The shift parameters
+     * \param mean The mean of each channel
+     * \param var The variance of each channel
+     * \param c The output
+     */
+    template <typename C>
+    static void check([[maybe_unused]] const A& a,
+                      [[maybe_unused]] const G& gamma,
+                      [[maybe_unused]] const B& beta,
+                      [[maybe_unused]] const M& mean,
+                      [[maybe_unused]] const V& var,
+                      [[maybe_unused]] const C& c) {
+        static_assert(etl::dimensions<A>() == 2 || etl::dimensions<A>() == 4, "The input of batch_norm is a 2D or 4D matrix");
+        static_assert(etl::dimensions<A>() == etl::dimensions<C>(), "The output of batch_norm has the dimensions of the input");
+        static_assert(all_1d<G, B, M, V>, "The parameters of batch_norm are vectors");
+
+        if constexpr (all_fast<A, G, B, M, V, C>) {
+            static_assert(decay_traits<A>::size() == decay_traits<C>::size(), "Invalid dimensions for batch_norm");
+            static_assert(etl::dim<1, A>() == etl::dim<0, G>(), "Invalid dimensions for batch_norm");
+            static_assert(etl::dim<1, A>() == etl::dim<0, B>(), "Invalid dimensions for batch_norm");
+            static_assert(etl::dim<1, A>() == etl::dim<0, M>(), "Invalid dimensions for batch_norm");
+            static_assert(etl::dim<1, A>() == etl::dim<0, V>(), "Invalid dimensions for batch_norm");
+        } else {
+            cpp_assert(etl::size(a) == etl::size(c), "Invalid dimensions for batch_norm");
+            cpp_assert(etl::dim<1>(a) == etl::dim<0>(gamma), "Invalid dimensions for batch_norm");
+            cpp_assert(etl::dim<1>(a) == etl::dim<0>(beta), "Invalid dimensions for batch_norm");
+            cpp_assert(etl::dim<1>(a) == etl::dim<0>(mean), "Invalid dimensions for batch_norm");
+            cpp_assert(etl::dim<1>(a) == etl::dim<0>(var), "Invalid dimensions for batch_norm");
+        }
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_to(L&& lhs) const {
+        static_assert(all_etl_expr<A, G, B, M, V, L>, "batch_norm only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        auto& a     = this->a();
+        auto& gamma = this->b();
+        auto& beta  = this->c();
+
+        check(a, gamma, beta, _mean, _var, lhs);
+
+        standard_evaluator::pre_assign_rhs(a);
+        standard_evaluator::pre_assign_rhs(gamma);
+        standard_evaluator::pre_assign_rhs(beta);
+
+        decltype(auto) x = smart_forward(a);
+        decltype(auto) g = smart_forward(gamma);
+        decltype(auto) b = smart_forward(beta);
+
+        x.ensure_cpu_up_to_date();
+        g.ensure_cpu_up_to_date();
+        b.ensure_cpu_up_to_date();
+
+        if constexpr (Train) {
+            if constexpr (impl::vec::batch_norm_possible<vector_mode, decltype(x), L>) {
+                inc_counter("impl:vec");
+                impl::vec::batch_norm_forward(x, g, b, lhs, _mean, _var, eps);
+            } else {
+                inc_counter("impl:std");
+                impl::standard::batch_norm_forward(x, g, b, lhs, _mean, _var, eps);
+            }
+
+            _mean.validate_cpu();
+            _mean.invalidate_gpu();
+            _var.validate_cpu();
+            _var.invalidate_gpu();
+        } else {
+            standard_evaluator::pre_assign_rhs(_mean);
+            standard_evaluator::pre_assign_rhs(_var);
+
+            decltype(auto) m = smart_forward(_mean);
+            decltype(auto) v = smart_forward(_var);
+
+            m.ensure_cpu_up_to_date();
+            v.ensure_cpu_up_to_date();
+
+            if constexpr (impl::vec::batch_norm_possible<vector_mode, decltype(x), L>) {
+                inc_counter("impl:vec");
+                impl::vec::batch_norm_inference(x, g, b, m, v, lhs, eps);
+            } else {
+                inc_counter("impl:std");
+                impl::standard::batch_norm_inference(x, g, b, m, v, lhs, eps);
+            }
+        }
+
+        lhs.validate_cpu();
+        lhs.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const batch_norm_forward_expr& expr) {
+        return os << "batch_norm(" << expr._a << ", " << expr._b << ", " << expr._c << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a batch normalization expression
+ * \tparam A The input type
+ * \tparam G The scale (gamma) type
+ * \tparam B The shift (beta) type
+ * \tparam M The mean type
+ * \tparam V The variance type
+ * \tparam Train Indicates if the mean and the variance are computed (training) or used (inference)
+ */
+template <typename A, typename G, typename B, typename M, typename V, bool Train>
+struct etl_traits<etl::batch_norm_forward_expr<A, G, B, M, V, Train>> {
+    using expr_t     = etl::batch_norm_forward_expr<A, G, B, M, V, Train>; ///< The expression type
+    using sub_expr_t = std::decay_t<A>;                                  ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;                           ///< The sub traits
+    using value_type = value_t<A>;                                       ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                     ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                    ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                    ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                    ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = all_fast<A, G, B, M, V>;  ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                    ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                     ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                    ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                     ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                    ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                    ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                     ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                     ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                    ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam VV The vector mode
+     */
+    template <vector_mode_t VV>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return sub_traits::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return sub_traits::dim(e._a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return sub_traits::size(e._a);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return sub_traits::size();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return sub_traits::dimensions();
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+/*!
+ * \brief Returns the batch normalization of the 2D matrix [N, K] in training
+ * mode.
+ *
+ * The mean and the variance of each of the K features over the batch are
+ * computed and stored in mean and var, which are then used to normalize x.
+ *
+ * \param x The 2D matrix
+ * \param gamma The scale parameters
+ * \param beta The shift parameters
+ * \param mean The vector in which the mean is stored
+ * \param var The vector in which the (biased) variance is stored
+ * \param eps The epsilon added to the variance
+ * \return An expression representing gamma * (x - mean) / sqrt(var + eps) + beta
+ */
+template <typename A, typename G, typename B, typename M, typename V>
+batch_norm_forward_expr<detail::build_type<A>, detail::build_type<G>, detail::build_type<B>, M&, V&, true> batch_norm_forward_2d(
+        const A& x, const G& gamma, const B& beta, M& mean, V& var, value_t<A> eps) {
+    static_assert(all_etl_expr<A, G, B, M, V>, "etl::batch_norm_forward_2d can only be used on ETL expressions");
+    static_assert(is_2d<A>, "etl::batch_norm_forward_2d is only defined for 2D input");
+    static_assert(all_row_major<A, G, B, M, V>, "etl::batch_norm_forward_2d is only defined for row-major expressions");
+    static_assert(all_dma<M, V>, "etl::batch_norm_forward_2d needs direct access to the mean and the variance");
+
+    return {x, gamma, beta, mean, var, eps};
+}
+
+/*!
+ * \brief Returns the batch normalization of the 4D matrix [N, K, W, H] in
+ * training mode.
+ *
+ * The mean and the variance of each of the K channels over the batch and the
+ * spatial dimensions are computed and stored in mean and var, which are then
+ * used to normalize x.
+ *
+ * \param x The 4D matrix
+ * \param gamma The scale parameters
+ * \param beta The shift parameters
+ * \param mean The vector in which the mean is stored
+ * \param var The vector in which the (biased) variance is stored
+ * \param eps The epsilon added to the variance
+ * \return An expression representing gamma * (x - mean) / sqrt(var + eps) + beta
+ */
+template <typename A, typename G, typename B, typename M, typename V>
+batch_norm_forward_expr<detail::build_type<A>, detail::build_type<G>, detail::build_type<B>, M&, V&, true> batch_norm_forward_4d(
+        const A& x, const G& gamma, const B& beta, M& mean, V& var, value_t<A> eps) {
+    static_assert(all_etl_expr<A, G, B, M, V>, "etl::batch_norm_forward_4d can only be used on ETL expressions");
+    static_assert(is_4d<A>, "etl::batch_norm_forward_4d is only defined for 4D input");
+    static_assert(all_row_major<A, G, B, M, V>, "etl::batch_norm_forward_4d is only defined for row-major expressions");
+    static_assert(all_dma<M, V>, "etl::batch_norm_forward_4d needs direct access to the mean and the variance");
+
+    return {x, gamma, beta, mean, var, eps};
+}
+
+/*!
+ * \brief Returns the batch normalization of the 2D matrix [N, K] in inference
+ * mode, using the given mean and variance of each of the K features.
+ *
+ * \param x The 2D matrix
+ * \param gamma The scale parameters
+ * \param beta The shift parameters
+ * \param mean The mean of each feature
+ * \param var The variance of each feature
+ * \param eps The epsilon added to the variance
+ * \return An expression representing gamma * (x - mean) / sqrt(var + eps) + beta
+ */
+template <typename A, typename G, typename B, typename M, typename V>
+batch_norm_forward_expr<detail::build_type<A>, detail::build_type<G>, detail::build_type<B>, detail::build_type<M>, detail::build_type<V>, false>
+batch_norm_inference_2d(const A& x, const G& gamma, const B& beta, const M& mean, const V& var, value_t<A> eps) {
+    static_assert(all_etl_expr<A, G, B, M, V>, "etl::batch_norm_inference_2d can only be used on ETL expressions");
+    static_assert(is_2d<A>, "etl::batch_norm_inference_2d is only defined for 2D input");
+    static_assert(all_row_major<A, G, B, M, V>, "etl::batch_norm_inference_2d is only defined for row-major expressions");
+
+    return {x, gamma, beta, mean, var, eps};
+}
+
+/*!
+ * \brief Returns the batch normalization of the 4D matrix [N, K, W, H] in
+ * inference mode, using the given mean and variance of each of the K
+ * channels.
+ *
+ * \param x The 4D matrix
+ * \param gamma The scale parameters
+ * \param beta The shift parameters
+ * \param mean The mean of each channel
+ * \param var The variance of each channel
+ * \param eps The epsilon added to the variance
+ * \return An expression representing gamma * (x - mean) / sqrt(var + eps) + beta
+ */
+template <typename A, typename G, typename B, typename M, typename V>
+batch_norm_forward_expr<detail::build_type<A>, detail::build_type<G>, detail::build_type<B>, detail::build_type<M>, detail::build_type<V>, false>
+batch_norm_inference_4d(const A& x, const G& gamma, const B& beta, const M& mean, const V& var, value_t<A> eps) {
+    static_assert(all_etl_expr<A, G, B, M, V>, "etl::batch_norm_inference_4d can only be used on ETL expressions");
+    static_assert(is_4d<A>, "etl::batch_norm_inference_4d is only defined for 4D input");
+    static_assert(all_row_major<A, G, B, M, V>, "etl::batch_norm_inference_4d is only defined for row-major expressions");
+
+    return {x, gamma, beta, mean, var, eps};
+}
+
+} //end of namespace etl
@@ -9,11 +9,16 @@
 
 #include "etl/expr/base_temporary_expr.hpp"
 
+#include "etl/impl/vec/softmax.hpp"
+
 namespace etl {
 
 /*!
  * \brief A batch softmax function expression
  *
+ * The softmax is computed independently for each sub view of the first
+ * dimension. A vector is handled as a single row.
+ *
  * \tparam A The unary sub type
  */
 template <typename A, bool Stable>
@@ -62,10 +67,14 @@ struct batch_softmax_expr : base_temporary_expr_un<batch_softmax_expr<A, Stable>
      */
     template <typename C>
     constexpr static batch_softmax_impl select_default_impl(bool no_gpu) {
-        if (cudnn_enabled && all_homogeneous<A, C> && all_floating<A, C> && !no_gpu) {
+        if (cudnn_enabled && all_homogeneous<A, C> && all_floating<A, C> && !is_1d<A> && !no_gpu) {
             return batch_softmax_impl::CUDNN;
         }
 
+        if (impl::vec::softmax_possible<vector_mode, A, C>) {
+            return batch_softmax_impl::VEC;
+        }
+
         return batch_softmax_impl::STD;
     }
 
@@ -76,6 +85,34 @@ struct batch_softmax_expr : base_temporary_expr_un<batch_softmax_expr<A, Stable>
      */
     template <typename C>
     static batch_softmax_impl select_impl() {
+        if (local_context().batch_softmax_selector.forced) {
+            auto forced = local_context().batch_softmax_selector.impl;
+
+            switch (forced) {
+                // CUDNN cannot always be used
+                case batch_softmax_impl::CUDNN:
+                    if (!cudnn_enabled || !all_homogeneous<A, C> || !all_floating<A, C> || is_1d<A> || local_context().cpu) {                     //COVERAGE_EXCLUDE_LINE
+                        std::cerr << "Forced selection to CUDNN batch_softmax implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
+                        return select_default_impl<C>(local_context().cpu);                                                                       //COVERAGE_EXCLUDE_LINE
+                    }                                                                                                                             //COVERAGE_EXCLUDE_LINE
+
+                    return forced;
+
+                // VEC cannot always be used
+                case batch_softmax_impl::VEC:
+                    if (!impl::vec::softmax_possible<vector_mode, A, C>) {                                                                      //COVERAGE_EXCLUDE_LINE
+                        std::cerr << "Forced selection to VEC batch_softmax implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
+                        return select_default_impl<C>(local_context().cpu);                                                                     //COVERAGE_EXCLUDE_LINE
+                    }                                                                                                                           //COVERAGE_EXCLUDE_LINE
+
+                    return forced;
+
+                //In other cases, simply use the forced impl
+                default:
+                    return forced;
+            }
+        }
+
         return select_default_impl<C>(local_context().cpu);
     }
 
@@ -121,11 +158,24 @@ struct batch_softmax_expr : base_temporary_expr_un<batch_softmax_expr<A, Stable>
                     impl::cudnn::softmax(a_gpu, c);
                 }
             }
+        else if
+            constexpr_select(impl == batch_softmax_impl::VEC) {
+                inc_counter("impl:vec");
+
+                impl::vec::softmax(smart_forward(a), c);
+            }
         else if
             constexpr_select(impl == batch_softmax_impl::STD) {
                 inc_counter("impl:std");
 
-                if constexpr (Stable) {
+                if constexpr (is_1d<A>) {
+                    if constexpr (Stable) {
+                        auto m = max(a);
+                        c      = exp(a - m) / sum(exp(a - m));
+                    } else {
+                        c = exp(a) / sum(exp(a));
+                    }
+                } else if constexpr (Stable) {
                     for (size_t i = 0; i < etl::dim<0>(c); ++i) {
                         c(i) = exp(a(i)) / sum(exp(a(i)));
                     }
@@ -239,7 +289,7 @@ struct etl_traits<etl::batch_softmax_expr<A, Stable>> {
      * \tparam V The vector mode
      */
     template <vector_mode_t V>
-    using vectorizable = std::true_type;
+    static constexpr bool vectorizable = true;
 
     /*!
      * \brief Returns the DDth dimension of the expression
@@ -212,7 +212,12 @@ public:
      */
     template <typename L>
     void assign_to(L&& lhs) const {
-        std_assign_evaluate(*this, lhs);
+        if constexpr (is_sparse_structural<this_type> && is_dma<L> && decay_traits<L>::dimensions() == 2) {
+            // Only compute the non-zeros of the sparse operands
+            sparse_detail::structural_scatter(*this, lhs);
+        } else {
+            std_assign_evaluate(*this, lhs);
+        }
     }
 
     /*!
@@ -0,0 +1,248 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Cholesky decomposition of symmetric positive definite matrices.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the lower triangular factor L of the
+ * Cholesky decomposition A = L * L^T of a symmetric positive definite matrix.
+ *
+ * Only the lower part of A is used.
+ *
+ * \tparam A The type of the decomposed matrix
+ */
+template <typename A>
+struct cholesky_expr : base_temporary_expr_un<cholesky_expr<A>, A> {
+    using value_type = value_t<A>;                           ///< The type of value of the expression
+    using this_type  = cholesky_expr<A>;                     ///< The type of this expression
+    using base_type  = base_temporary_expr_un<this_type, A>; ///< The base type
+    using sub_traits = decay_traits<A>;                      ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The sub expression
+     */
+    explicit cholesky_expr(A a) : base_type(a) {
+        //Nothing else to init
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, C>, "cholesky only supported for ETL expressions");
+        static_assert(is_2d<A> && is_2d<C>, "cholesky is only defined for matrices");
+
+        inc_counter("temp:assign");
+
+        auto& a = this->a();
+
+        const size_t n = etl::dim<0>(a);
+
+        cpp_assert(etl::dim<1>(a) == n, "cholesky is only defined for square matrices");
+
+        // An adapter of c could reject the upper part of A
+        if constexpr (is_dma<C> && is_row_major<C> && std::is_same_v<value_t<C>, value_type> && !is_adapter<C>) {
+            c = a;
+
+            detail::cholesky_factor(c.memory_start(), n);
+
+            c.validate_cpu();
+            c.invalidate_gpu();
+        } else {
+            dyn_matrix<value_type, 2> tmp(n, n);
+            tmp = a;
+
+            detail::cholesky_factor(tmp.memory_start(), n);
+
+            c = tmp;
+        }
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const cholesky_expr& expr) {
+        return os << "cholesky(" << expr._a << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a Cholesky expression
+ * \tparam A The decomposed sub type
+ */
+template <typename A>
+struct etl_traits<etl::cholesky_expr<A>> {
+    using expr_t     = etl::cholesky_expr<A>;  ///< The expression type
+    using sub_expr_t = std::decay_t<A>;        ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>; ///< The sub traits
+    using value_type = value_t<A>;             ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                      ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                     ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                     ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                     ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = sub_traits::is_fast;       ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                     ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                      ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                     ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                      ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                     ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                     ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                      ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                      ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                     ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return sub_traits::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return sub_traits::dim(e._a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return sub_traits::size(e._a);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return sub_traits::size();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return 2;
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+/*!
+ * \brief Creates an expression representing the lower triangular factor L
+ * of the Cholesky decomposition A = L * L^T.
+ *
+ * A must be symmetric positive definite, only its lower part is used. If A
+ * is not positive definite, the result contains NaN values.
+ *
+ * \param a The input expression
+ * \return an expression representing the Cholesky factor of a
+ */
+template <typename A>
+cholesky_expr<detail::build_type<A>> cholesky(A&& a) {
+    static_assert(is_etl_expr<A>, "Cholesky decomposition only supported for ETL expressions");
+
+    return cholesky_expr<detail::build_type<A>>{a};
+}
+
+} //end of namespace etl
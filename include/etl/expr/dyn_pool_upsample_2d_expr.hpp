@@ -12,6 +12,7 @@
 //Get the implementations
 #include "etl/impl/std/max_pooling_upsample.hpp"
 #include "etl/impl/std/avg_pooling_upsample.hpp"
+#include "etl/impl/vec/pooling.hpp"
 #include "etl/impl/cudnn/pooling_upsample.hpp"
 
 namespace etl {
@@ -94,6 +95,10 @@ public:
             return etl::pool_impl::CUDNN;
         }
 
+        if (impl::vec::pool_possible<vector_mode, A, B, C, R>) {
+            return etl::pool_impl::VEC;
+        }
+
         return etl::pool_impl::STD;
     }
 
@@ -118,6 +123,15 @@ public:
 
                     return forced;
 
+                // VEC cannot always be used
+                case pool_impl::VEC:
+                    if (!impl::vec::pool_possible<vector_mode, A, B, C, R>) {                                                        //COVERAGE_EXCLUDE_LINE
+                        std::cerr << "Forced selection to VEC pool implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
+                        return select_default_impl<R>(local_context().cpu);                                                            //COVERAGE_EXCLUDE_LINE
+                    }                                                                                                                  //COVERAGE_EXCLUDE_LINE
+
+                    return forced;
+
                 //In other cases, simply use the forced impl
                 default:
                     return forced;
@@ -167,6 +181,11 @@ public:
                     inc_counter("impl:std");
                     impl::standard::max_pool_upsample_2d::apply(smart_forward(a), smart_forward(b), smart_forward(c), result, c1, c2, s1, s2, p1, p2);
                 }
+            else if
+                constexpr_select(impl == pool_impl::VEC) {
+                    inc_counter("impl:vec");
+                    impl::vec::max_pool_upsample_2d::apply(smart_forward(a), smart_forward(b), smart_forward(c), result, c1, c2, s1, s2, p1, p2);
+                }
             else if
                 constexpr_select(impl == pool_impl::CUDNN) {
                     inc_counter("impl:cudnn");
@@ -181,6 +200,11 @@ public:
                     inc_counter("impl:std");
                     impl::standard::avg_pool_upsample_2d::apply(smart_forward(a), smart_forward(b), smart_forward(c), result, c1, c2, s1, s2, p1, p2);
                 }
+            else if
+                constexpr_select(impl == pool_impl::VEC) {
+                    inc_counter("impl:vec");
+                    impl::vec::avg_pool_upsample_2d::apply(smart_forward(a), smart_forward(b), smart_forward(c), result, c1, c2, s1, s2, p1, p2);
+                }
             else if
                 constexpr_select(impl == pool_impl::CUDNN) {
                     inc_counter("impl:cudnn");
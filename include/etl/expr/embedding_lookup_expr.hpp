@@ -8,6 +8,7 @@
 #pragma once
 
 #include "etl/expr/base_temporary_expr.hpp"
+#include "etl/impl/std/embedding.hpp"
 
 namespace etl {
 
@@ -75,14 +76,19 @@ struct embedding_lookup_expr : base_temporary_expr_bin<embedding_lookup_expr<A,
 
         check(a, b, lhs);
 
-        const auto I = etl::dim<0>(a);
-
         standard_evaluator::pre_assign_rhs(a);
         standard_evaluator::pre_assign_rhs(b);
 
-        for (size_t i = 0; i < I; ++i) {
-            lhs(i) = b(a(i));
-        }
+        decltype(auto) ids   = smart_forward(a);
+        decltype(auto) vocab = smart_forward(b);
+
+        ids.ensure_cpu_up_to_date();
+        vocab.ensure_cpu_up_to_date();
+
+        impl::standard::embedding_lookup(ids, vocab, lhs);
+
+        lhs.validate_cpu();
+        lhs.invalidate_gpu();
     }
 
     /*!
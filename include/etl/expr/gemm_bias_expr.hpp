@@ -0,0 +1,379 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Matrix-matrix multiplication followed by a bias and an activation
+ * function.
+ *
+ * This expression is built automatically from bias_add_2d(A * B, b) and from
+ * relu, sigmoid and tanh of such an expression. When the vectorized GEMM
+ * implementation is used, the bias and the activation are fused into the
+ * kernels. Otherwise, the operations are evaluated one after another.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing Op(alpha * (A * B) + bias), the bias
+ * being added to each row of the result.
+ * \tparam A The left hand side matrix type
+ * \tparam B The right hand side matrix type
+ * \tparam Bias The bias vector type
+ * \tparam Op The activation unary operator, void for none
+ */
+template <typename A, typename B, typename Bias, typename Op>
+struct gemm_bias_expr : base_temporary_expr_tern<gemm_bias_expr<A, B, Bias, Op>, A, B, Bias> {
+    using value_type  = value_t<A>;                                      ///< The type of value of the expression
+    using this_type   = gemm_bias_expr<A, B, Bias, Op>;                  ///< The type of this expression
+    using base_type   = base_temporary_expr_tern<this_type, A, B, Bias>; ///< The base type
+    using left_traits = decay_traits<A>;                                 ///< The traits of the sub type
+    using gemm_type   = gemm_expr<A, B, false>;                          ///< The type of the unfused GEMM expression
+
+    static constexpr auto storage_order = left_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    const value_type alpha; ///< The alpha multiplicator
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The left hand side matrix
+     * \param b The right hand side matrix
+     * \param bias The bias vector
+     * \param alpha The alpha multiplicator
+     */
+    explicit gemm_bias_expr(A a, B b, Bias bias, value_type alpha) : base_type(a, b, bias), alpha(alpha) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Assert for the validity of the operation
+     * \param a The left side matrix
+     * \param b The right side matrix
+     * \param bias The bias vector
+     * \param c The result matrix
+     */
+    template <typename C>
+    static void check(const A& a, const B& b, [[maybe_unused]] const Bias& bias, const C& c) {
+        static_assert(etl::dimensions<Bias>() == 1, "The bias of a GEMM is a vector");
+
+        gemm_type::check(a, b, c);
+
+        if constexpr (all_fast<Bias, C>) {
+            static_assert(etl::dim<0, Bias>() == etl::dim<1, C>(), "Invalid dimensions for the bias of a GEMM");
+        } else {
+            cpp_assert(etl::dim<0>(bias) == etl::dim<1>(c), "Invalid dimensions for the bias of a GEMM");
+        }
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, B, Bias, C>, "gemm only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        auto& a    = this->a();
+        auto& b    = this->b();
+        auto& bias = this->c();
+
+        check(a, b, bias, c);
+
+        if constexpr (fusable<C>) {
+            constexpr_select auto impl = gemm_type::template select_gemm_impl<A, B, C>();
+
+            if constexpr_select(impl == gemm_impl::VEC) {
+                inc_counter("impl:vec");
+                etl::impl::vec::gemm_bias<Op, false>(smart_forward(a), smart_forward(b), smart_forward(bias), c, alpha);
+                return;
+            }
+        }
+
+        // Without the vectorized kernels, the operations are done one by one
+
+        c = gemm_type(a, b, alpha);
+        c = bias_add_2d(c, bias);
+
+        if constexpr (!std::is_void_v<Op>) {
+            c = unary_expr<value_type, detail::build_type<C>, Op>(c);
+        }
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        // The accumulation can only be fused when there is no activation
+        if constexpr (fusable<L> && std::is_void_v<Op>) {
+            constexpr_select auto impl = gemm_type::template select_gemm_impl<A, B, L>();
+
+            if (impl == gemm_impl::VEC && !this->alias(lhs)) {
+                auto& a    = this->a();
+                auto& b    = this->b();
+                auto& bias = this->c();
+
+                check(a, b, bias, lhs);
+
+                inc_counter("impl:vec");
+                etl::impl::vec::gemm_bias<Op, true>(smart_forward(a), smart_forward(b), smart_forward(bias), lhs, alpha);
+                return;
+            }
+        }
+
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const gemm_bias_expr& expr) {
+        return os << "bias_add_2d(" << expr._a << " * " << expr._b << ", " << expr._c << ")";
+    }
+
+private:
+    /*!
+     * \brief Indicates if the epilogue can be fused in the vectorized GEMM
+     * kernels for the given result type
+     * \tparam C The type of the result expression
+     */
+    template <typename C>
+    static constexpr bool fusable = !is_transpose_expr<A> && !is_transpose_expr<B> && impl::vec::gemm_epilogue_possible<vector_mode, Op, A, B, C>
+                                    && all_homogeneous<A, Bias> && all_vectorizable<vector_mode, Bias>;
+};
+
+/*!
+ * \brief Traits for a GEMM with bias expression
+ * \tparam A The left hand side matrix type
+ * \tparam B The right hand side matrix type
+ * \tparam Bias The bias vector type
+ * \tparam Op The activation unary operator
+ */
+template <typename A, typename B, typename Bias, typename Op>
+struct etl_traits<etl::gemm_bias_expr<A, B, Bias, Op>> {
+    using expr_t       = etl::gemm_bias_expr<A, B, Bias, Op>; ///< The expression type
+    using left_expr_t  = std::decay_t<A>;                     ///< The left sub expression type
+    using right_expr_t = std::decay_t<B>;                     ///< The right sub expression type
+    using left_traits  = etl_traits<left_expr_t>;             ///< The left sub traits
+    using right_traits = etl_traits<right_expr_t>;            ///< The right sub traits
+    using value_type   = value_t<A>;                          ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                                                            ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                                                           ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                                                           ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                                                           ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = left_traits::is_fast && right_traits::is_fast && all_fast<Bias>; ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                                                           ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                                                            ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                                                           ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                                                            ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                                                           ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                                                           ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                                                            ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                                                            ///< Indicates if the expression needs a evaluator visitor
+    static constexpr order storage_order = left_traits::storage_order;                                      ///< The expression's storage order
+    static constexpr bool gpu_computable = false;                                                           ///< Indicates if the expression can be computed on GPU
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return DD == 0 ? decay_traits<A>::template dim<0>() : decay_traits<B>::template dim<1>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        if (d == 0) {
+            return etl::dim(e._a, 0);
+        } else {
+            return etl::dim(e._b, 1);
+        }
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return etl::dim(e._a, 0) * etl::dim(e._b, 1);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return decay_traits<A>::template dim<0>() * decay_traits<B>::template dim<1>();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return 2;
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+/*!
+ * \brief Add the bias to each row of the result of a matrix-matrix
+ * multiplication.
+ *
+ * This overload fuses the bias with the GEMM.
+ *
+ * \param x The GEMM expression
+ * \param biases The vector of biases
+ * \return An expression representing bias_add_2d(x, biases)
+ */
+template <typename A, typename B, typename Bias>
+gemm_bias_expr<A, B, detail::build_type<Bias>, void> bias_add_2d(const gemm_expr<A, B, false>& x, const Bias& biases) {
+    static_assert(all_etl_expr<Bias>, "etl::bias_add_2d can only be used on ETL expressions");
+    static_assert(is_1d<Bias>, "etl::bias_add_2d is only defined for 1D bias vector");
+
+    return gemm_bias_expr<A, B, detail::build_type<Bias>, void>{x.a(), x.b(), biases, x.alpha};
+}
+
+/*!
+ * \brief Apply the relu activation on the result of a GEMM with bias.
+ *
+ * This overload fuses the activation with the GEMM.
+ *
+ * \param value The GEMM with bias expression
+ * \return An expression representing the relu activation of the input.
+ */
+template <typename A, typename B, typename Bias>
+gemm_bias_expr<A, B, Bias, relu_unary_op<value_t<A>>> relu(const gemm_bias_expr<A, B, Bias, void>& value) {
+    return gemm_bias_expr<A, B, Bias, relu_unary_op<value_t<A>>>{value._a, value._b, value._c, value.alpha};
+}
+
+/*!
+ * \brief Apply the logistic sigmoid on the result of a GEMM with bias.
+ *
+ * This overload fuses the activation with the GEMM.
+ *
+ * \param value The GEMM with bias expression
+ * \return An expression representing the logistic sigmoid of the input.
+ */
+template <typename A, typename B, typename Bias>
+gemm_bias_expr<A, B, Bias, sigmoid_unary_op<value_t<A>>> sigmoid(const gemm_bias_expr<A, B, Bias, void>& value) {
+    return gemm_bias_expr<A, B, Bias, sigmoid_unary_op<value_t<A>>>{value._a, value._b, value._c, value.alpha};
+}
+
+/*!
+ * \brief Apply the hyperbolic tangent on the result of a GEMM with bias.
+ *
+ * This overload fuses the activation with the GEMM.
+ *
+ * \param value The GEMM with bias expression
+ * \return An expression representing the hyperbolic tangent of the input.
+ */
+template <typename A, typename B, typename Bias>
+gemm_bias_expr<A, B, Bias, tanh_unary_op<value_t<A>>> tanh(const gemm_bias_expr<A, B, Bias, void>& value) {
+    return gemm_bias_expr<A, B, Bias, tanh_unary_op<value_t<A>>>{value._a, value._b, value._c, value.alpha};
+}
+
+/*!
+ * \copydoc tanh(const gemm_bias_expr<A, B, Bias, void>&)
+ *
+ * The generic tanh takes a forwarding reference, it would be a better
+ * match than the const overload for non-const lvalues.
+ */
+template <typename A, typename B, typename Bias>
+gemm_bias_expr<A, B, Bias, tanh_unary_op<value_t<A>>> tanh(gemm_bias_expr<A, B, Bias, void>& value) {
+    return tanh(std::as_const(value));
+}
+
+/*!
+ * \copydoc tanh(const gemm_bias_expr<A, B, Bias, void>&)
+ *
+ * The generic tanh takes a forwarding reference, it would be a better
+ * match than the const overload for temporaries.
+ */
+template <typename A, typename B, typename Bias>
+gemm_bias_expr<A, B, Bias, tanh_unary_op<value_t<A>>> tanh(gemm_bias_expr<A, B, Bias, void>&& value) {
+    return tanh(std::as_const(value));
+}
+
+} //end of namespace etl
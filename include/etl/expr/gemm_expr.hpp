@@ -16,6 +16,7 @@
 #include "etl/impl/vec/gemm.hpp"
 #include "etl/impl/vec/gemm_conv.hpp"
 #include "etl/impl/cublas/gemm.hpp"
+#include "etl/impl/trmm.hpp"
 
 namespace etl {
 
@@ -168,6 +169,25 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
 
 #endif
 
+    /*!
+     * \brief Indicates if A * trans(B) can be computed as a symmetric rank-k
+     * product (SYRK), if B is the same matrix as A.
+     */
+    template <typename AA, typename BB, typename C>
+    static constexpr bool syrk_possible = all_dma<AA, BB, C> && all_row_major<AA, BB, C> && all_homogeneous<AA, BB, C> && is_floating<AA> && !is_adapter<C>;
+
+    /*!
+     * \brief Indicates if A * trans(B) is a symmetric rank-k product (SYRK),
+     * B being the same matrix as A. This can only be known at runtime.
+     * \param a The A matrix
+     * \param b The B matrix, not transposed
+     * \return true if the product can be computed as a SYRK, false otherwise
+     */
+    template <typename AA, typename BB>
+    static bool is_syrk(const AA& a, const BB& b) {
+        return a.memory_start() == b.memory_start() && etl::dim<0>(a) == etl::dim<0>(b) && etl::dim<1>(a) == etl::dim<1>(b);
+    }
+
     /*!
      * \brief Compute C = trans(A) * trans(B)
      * \param a The A matrix
@@ -197,6 +217,22 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
                 cpp_unreachable("invalid selection of gemm");
             }
         } else if constexpr (!is_transpose_expr<AA> && is_transpose_expr<BB>) {
+            if constexpr (syrk_possible<AA, decltype(b.a()), C>) {
+                if ((impl == gemm_impl::STD || impl == gemm_impl::VEC) && is_syrk(a, b.a())) {
+                    a.ensure_cpu_up_to_date();
+
+                    if (impl == gemm_impl::VEC) {
+                        detail::syrk(a.memory_start(), c.memory_start(), etl::dim<0>(a), etl::dim<1>(a), alpha);
+                    } else {
+                        inc_counter("impl:std");
+                        etl::impl::standard::syrk(a.memory_start(), c.memory_start(), etl::dim<0>(a), etl::dim<1>(a), alpha);
+                    }
+
+                    c.invalidate_gpu();
+                    return;
+                }
+            }
+
             if constexpr_select(impl == gemm_impl::STD) {
                 inc_counter("impl:std");
                 etl::impl::standard::mm_mul(smart_forward(a), smart_forward(b), c, alpha);
@@ -264,7 +300,31 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
 
         check(a, b, c);
 
-        if constexpr (!Strassen) {
+        if constexpr (is_float16_t<value_type>) {
+            // 16-bit floating point are converted (vectorized) to single
+            // precision, multiplied and accumulated in single precision and
+            // rounded only once when stored
+            using acc_type   = accumulate_t<value_type>;
+            using acc_matrix = dyn_matrix<acc_type, 2>;
+
+            acc_matrix fa(etl::dim<0>(a), etl::dim<1>(a));
+            acc_matrix fb(etl::dim<0>(b), etl::dim<1>(b));
+
+            fa = a;
+            fb = b;
+
+            gemm_expr<const acc_matrix&, const acc_matrix&, false> f_expr(fa, fb, acc_type(alpha));
+
+            if constexpr (std::is_same_v<value_t<C>, acc_type>) {
+                f_expr.assign_to(c);
+            } else {
+                acc_matrix fc(etl::dim<0>(c), etl::dim<1>(c));
+
+                f_expr.assign_to(fc);
+
+                c = fc;
+            }
+        } else if constexpr (!Strassen) {
             apply_raw(a, b, c);
         } else {
             etl::impl::standard::strassen_mm_mul(smart_forward(a), smart_forward(b), c);
@@ -277,6 +337,22 @@ struct gemm_expr : base_temporary_expr_bin<gemm_expr<A, B, Strassen>, A, B> {
      */
     template <typename L>
     void assign_add_to(L&& lhs) const {
+        // With the vectorized kernels, the accumulation is fused into GEMM
+        if constexpr (!Strassen && !is_transpose_expr<A> && !is_transpose_expr<B> && impl::vec::gemm_epilogue_possible<vector_mode, void, A, B, L>) {
+            constexpr_select auto impl = select_gemm_impl<A, B, L>();
+
+            if (impl == gemm_impl::VEC && !this->alias(lhs)) {
+                auto& a = this->a();
+                auto& b = this->b();
+
+                check(a, b, lhs);
+
+                inc_counter("impl:vec");
+                etl::impl::vec::gemm_add(smart_forward(a), smart_forward(b), lhs, alpha);
+                return;
+            }
+        }
+
         std_add_evaluate(*this, lhs);
     }
 
@@ -429,7 +505,7 @@ struct etl_traits<etl::gemm_expr<A, B, Strassen>> {
  * \param b The right hand side matrix
  * \return An expression representing the matrix-matrix multiplication of a and b
  */
-template <typename A, typename B, cpp_enable_iff(all_2d<A, B>)>
+template <typename A, typename B, cpp_enable_iff(all_2d<A, B> && !is_sparse_mul<A, B> && !is_structured_mul<A, B>)>
 gemm_expr<detail::build_type<A>, detail::build_type<B>, false> operator*(A&& a, B&& b) {
     static_assert(all_etl_expr<A, B>, "Matrix multiplication only supported for ETL expressions");
     static_assert(all_2d<A, B>, "Matrix multiplication only works in 2D");
@@ -443,7 +519,7 @@ gemm_expr<detail::build_type<A>, detail::build_type<B>, false> operator*(A&& a,
  * \param b The right hand side matrix
  * \return An expression representing the matrix-matrix multiplication of a and b
  */
-template <typename A, typename B, cpp_enable_iff(all_2d<A, B>)>
+template <typename A, typename B, cpp_enable_iff(all_2d<A, B> && !is_sparse_mul<A, B> && !is_structured_mul<A, B>)>
 gemm_expr<detail::build_type<A>, detail::build_type<B>, false> mul(A&& a, B&& b) {
     static_assert(all_etl_expr<A, B>, "Matrix multiplication only supported for ETL expressions");
     static_assert(all_2d<A, B>, "Matrix multiplication only works in 2D");
@@ -0,0 +1,441 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Backward pass of a GRU cell, on a single time step or on a
+ * sequence.
+ *
+ * The gradients of the gates are computed backward in time, with a single
+ * pass over the gates and a single recurrent GEMM per time step. The
+ * gradients of the input, of the weights and of the biases are then computed
+ * with GEMMs over all the time steps at once.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+#include "etl/impl/std/rnn.hpp"
+#include "etl/impl/vec/rnn.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the gradients of the input of a GRU
+ * over a [B, I] input (a single time step) or a [T, B, I] input (a
+ * sequence).
+ *
+ * The gradients of the initial hidden state are stored, and the gradients of
+ * the weights and of the biases are accumulated, in the given matrices when
+ * the expression is evaluated.
+ *
+ * \tparam X The input type
+ * \tparam DH The gradients of the hidden states type
+ * \tparam GS The gates type
+ * \tparam H0 The initial hidden state type
+ * \tparam HS The hidden states type
+ * \tparam WX The input weights type
+ * \tparam WH The recurrent weights type
+ * \tparam DH0 The gradients of the initial hidden state type
+ * \tparam DWX The gradients of the input weights type
+ * \tparam DWH The gradients of the recurrent weights type
+ * \tparam DBX The gradients of the input bias type
+ * \tparam DBH The gradients of the recurrent bias type
+ */
+template <typename X, typename DH, typename GS, typename H0, typename HS, typename WX, typename WH, typename DH0, typename DWX, typename DWH, typename DBX, typename DBH>
+struct gru_backward_expr : base_temporary_expr_tern<gru_backward_expr<X, DH, GS, H0, HS, WX, WH, DH0, DWX, DWH, DBX, DBH>, X, DH, GS> {
+    using value_type = value_t<X>;                                                       ///< The type of value of the expression
+    using this_type  = gru_backward_expr<X, DH, GS, H0, HS, WX, WH, DH0, DWX, DWH, DBX, DBH>; ///< The type of this expression
+    using base_type  = base_temporary_expr_tern<this_type, X, DH, GS>;                   ///< The base type
+    using sub_traits = decay_traits<X>;                                                  ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    H0 _h0;    ///< The initial hidden state
+    HS _hs;    ///< The hidden states
+    WX _w_x;   ///< The [I, 3H] input weights
+    WH _w_h;   ///< The [H, 3H] recurrent weights
+    DH0 _dh0;  ///< The gradients of the initial hidden state
+    DWX _dw_x; ///< The gradients of the input weights
+    DWH _dw_h; ///< The gradients of the recurrent weights
+    DBX _db_x; ///< The gradients of the input bias
+    DBH _db_h; ///< The gradients of the recurrent bias
+
+    /*!
+     * \brief Construct a new expression
+     * \param x The input
+     * \param dh The gradients of the hidden states
+     * \param gates The activations of the gates
+     * \param h0 The initial hidden state
+     * \param hs The hidden states
+     * \param w_x The input weights
+     * \param w_h The recurrent weights
+     * \param dh0 The gradients of the initial hidden state
+     * \param dw_x The gradients of the input weights
+     * \param dw_h The gradients of the recurrent weights
+     * \param db_x The gradients of the input bias
+     * \param db_h The gradients of the recurrent bias
+     */
+    gru_backward_expr(X x, DH dh, GS gates, H0 h0, HS hs, WX w_x, WH w_h, DH0 dh0, DWX dw_x, DWH dw_h, DBX db_x, DBH db_h)
+            : base_type(x, dh, gates), _h0(h0), _hs(hs), _w_x(w_x), _w_h(w_h), _dh0(dh0), _dw_x(dw_x), _dw_h(dw_h), _db_x(db_x), _db_h(db_h) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the dimensions of the GRU
+     * \param x The input
+     * \param dh The gradients of the hidden states
+     * \param gates The activations of the gates
+     * \param dx The output
+     */
+    template <typename L>
+    void check([[maybe_unused]] const X& x, [[maybe_unused]] const DH& dh, [[maybe_unused]] const GS& gates, [[maybe_unused]] const L& dx) const {
+        static_assert(etl::dimensions<X>() == etl::dimensions<L>(), "The output of gru_backward has the dimensions of the input");
+
+        [[maybe_unused]] const size_t I = etl::dim<0>(_w_x);
+        [[maybe_unused]] const size_t H = etl::dim<0>(_w_h);
+
+        cpp_assert(etl::dim<1>(_w_x) == 3 * H, "Invalid dimensions for the weights of gru_backward");
+        cpp_assert(etl::dim<1>(_w_h) == 3 * H, "Invalid dimensions for the weights of gru_backward");
+        cpp_assert(etl::size(_dw_x) == etl::size(_w_x), "Invalid dimensions for the gradients of gru_backward");
+        cpp_assert(etl::size(_dw_h) == etl::size(_w_h), "Invalid dimensions for the gradients of gru_backward");
+        cpp_assert(etl::dim<0>(_db_x) == 3 * H, "Invalid dimensions for the gradients of gru_backward");
+        cpp_assert(etl::dim<0>(_db_h) == 3 * H, "Invalid dimensions for the gradients of gru_backward");
+        cpp_assert(etl::dim<1>(_h0) == H, "Invalid dimensions for the initial state of gru_backward");
+        cpp_assert(etl::size(_dh0) == etl::size(_h0), "Invalid dimensions for the gradients of gru_backward");
+        cpp_assert(etl::size(dx) == etl::size(x), "Invalid dimensions for gru_backward");
+        cpp_assert(etl::size(dh) == etl::size(x) / I * H, "Invalid dimensions for gru_backward");
+        cpp_assert(etl::size(gates) == 4 * etl::size(dh), "Invalid dimensions for gru_backward");
+        cpp_assert(etl::size(dh) == etl::size(_h0) || etl::size(_hs) == etl::size(dh), "Invalid dimensions for gru_backward");
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_to(L&& lhs) const {
+        static_assert(all_etl_expr<X, DH, GS, H0, HS, WX, WH, DH0, DWX, DWH, DBX, DBH, L>, "gru_backward only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        using T = value_type;
+
+        auto& x     = this->a();
+        auto& dh    = this->b();
+        auto& gates = this->c();
+
+        check(x, dh, gates, lhs);
+
+        standard_evaluator::pre_assign_rhs(x);
+        standard_evaluator::pre_assign_rhs(dh);
+        standard_evaluator::pre_assign_rhs(gates);
+        standard_evaluator::pre_assign_rhs(_h0);
+        standard_evaluator::pre_assign_rhs(_hs);
+        standard_evaluator::pre_assign_rhs(_w_x);
+        standard_evaluator::pre_assign_rhs(_w_h);
+
+        decltype(auto) xx  = smart_forward(x);
+        decltype(auto) dd  = smart_forward(dh);
+        decltype(auto) gg  = smart_forward(gates);
+        decltype(auto) h0  = smart_forward(_h0);
+        decltype(auto) hs  = smart_forward(_hs);
+        decltype(auto) w_x = smart_forward(_w_x);
+        decltype(auto) w_h = smart_forward(_w_h);
+
+        xx.ensure_cpu_up_to_date();
+        dd.ensure_cpu_up_to_date();
+        gg.ensure_cpu_up_to_date();
+        h0.ensure_cpu_up_to_date();
+        hs.ensure_cpu_up_to_date();
+        w_x.ensure_cpu_up_to_date();
+        w_h.ensure_cpu_up_to_date();
+
+        const size_t B = etl::dim<0>(h0);
+        const size_t I = etl::dim<0>(w_x);
+        const size_t H = etl::dim<0>(w_h);
+        const size_t S = etl::size(xx) / (B * I);
+
+        const T* g = gg.memory_start();
+
+        etl::dyn_matrix<T, 2> dgx_all(S * B, 3 * H);
+        etl::dyn_matrix<T, 2> dgh_all(S * B, 3 * H);
+
+        // The gradients flowing backward through the hidden state
+        etl::dyn_matrix<T, 2> dh_t(B, H);
+
+        dh_t = T(0);
+
+        for (size_t tt = S; tt > 0; --tt) {
+            const size_t t = tt - 1;
+
+            const T* h_prev = t == 0 ? h0.memory_start() : hs.memory_start() + (t - 1) * B * H;
+
+            etl::custom_dyn_matrix<T> dgh_t(dgh_all.memory_start() + t * B * 3 * H, B, 3 * H);
+
+            dh_t += etl::custom_dyn_matrix<T>(const_cast<T*>(dd.memory_start()) + t * B * H, B, H);
+
+            if constexpr (impl::vec::rnn_possible<vector_mode, T>) {
+                inc_counter("impl:vec");
+                impl::vec::gru_backward_gates(g + t * B * 4 * H, h_prev, dh_t.memory_start(), dgx_all.memory_start() + t * B * 3 * H, dgh_t.memory_start(),
+                                              dh_t.memory_start(), B, H);
+            } else {
+                inc_counter("impl:std");
+                impl::standard::gru_backward_gates(g + t * B * 4 * H, h_prev, dh_t.memory_start(), dgx_all.memory_start() + t * B * 3 * H, dgh_t.memory_start(),
+                                                   dh_t.memory_start(), B, H);
+            }
+
+            // The direct gradient is completed with the recurrent projection
+            dh_t += dgh_t * trans(w_h);
+        }
+
+        _dh0 = dh_t;
+
+        // The gradients of the weights and of the input over all the time steps
+
+        etl::custom_dyn_matrix<T> x_all(const_cast<T*>(xx.memory_start()), S * B, I);
+        etl::custom_dyn_matrix<T> dgh_0(dgh_all.memory_start(), B, 3 * H);
+
+        _dw_x += trans(x_all) * dgx_all;
+        _dw_h += trans(h0) * dgh_0;
+
+        if (S > 1) {
+            etl::custom_dyn_matrix<T> h_prevs(const_cast<T*>(hs.memory_start()), (S - 1) * B, H);
+            etl::custom_dyn_matrix<T> dgh_next(dgh_all.memory_start() + B * 3 * H, (S - 1) * B, 3 * H);
+
+            _dw_h += trans(h_prevs) * dgh_next;
+        }
+
+        _db_x += bias_batch_sum_2d(dgx_all);
+        _db_h += bias_batch_sum_2d(dgh_all);
+
+        etl::custom_dyn_matrix<T> dx_all(lhs.memory_start(), S * B, I);
+
+        dx_all = dgx_all * trans(w_x);
+
+        lhs.validate_cpu();
+        lhs.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const gru_backward_expr& expr) {
+        return os << "gru_backward(" << expr._a << ", " << expr._b << ", " << expr._c << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a GRU backward expression
+ */
+template <typename X, typename DH, typename GS, typename H0, typename HS, typename WX, typename WH, typename DH0, typename DWX, typename DWH, typename DBX, typename DBH>
+struct etl_traits<etl::gru_backward_expr<X, DH, GS, H0, HS, WX, WH, DH0, DWX, DWH, DBX, DBH>> {
+    using expr_t     = etl::gru_backward_expr<X, DH, GS, H0, HS, WX, WH, DH0, DWX, DWH, DBX, DBH>; ///< The expression type
+    using sub_expr_t = std::decay_t<X>;                                                         ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;                                                  ///< The sub traits
+    using value_type = value_t<X>;                                                              ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                      ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                     ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                     ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                     ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = sub_traits::is_fast;       ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                     ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                      ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                     ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                      ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                     ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                     ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                      ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                      ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                     ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return sub_traits::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return sub_traits::dim(e._a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return sub_traits::size(e._a);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return sub_traits::size();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return sub_traits::dimensions();
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+/*!
+ * \brief Returns the gradients of the input of a GRU cell for a single time
+ * step.
+ *
+ * The gradients of the previous hidden state are stored in dh_prev. The
+ * gradients of the weights and of the biases are accumulated into dw_x,
+ * dw_h, db_x and db_h, so that they can be summed over several time steps.
+ *
+ * \param x The [B, I] input
+ * \param h_prev The [B, H] previous hidden state
+ * \param gates The [B, 4H] activations of the gates computed by gru_cell_forward
+ * \param dh The [B, H] gradients of the hidden state
+ * \param w_x The [I, 3H] input weights
+ * \param w_h The [H, 3H] recurrent weights
+ * \param dh_prev The [B, H] matrix in which the gradients of the previous hidden state are stored
+ * \param dw_x The [I, 3H] gradients of the input weights
+ * \param dw_h The [H, 3H] gradients of the recurrent weights
+ * \param db_x The [3H] gradients of the input bias
+ * \param db_h The [3H] gradients of the recurrent bias
+ * \return An expression representing the [B, I] gradients of the input
+ */
+template <typename X, typename H0, typename GS, typename DH, typename WX, typename WH, typename DH0, typename DWX, typename DWH, typename DBX, typename DBH>
+gru_backward_expr<detail::build_type<X>, detail::build_type<DH>, detail::build_type<GS>, detail::build_type<H0>, detail::build_type<H0>, detail::build_type<WX>,
+                  detail::build_type<WH>, DH0&, DWX&, DWH&, DBX&, DBH&>
+gru_cell_backward(const X& x, const H0& h_prev, const GS& gates, const DH& dh, const WX& w_x, const WH& w_h, DH0& dh_prev, DWX& dw_x, DWH& dw_h, DBX& db_x, DBH& db_h) {
+    static_assert(all_etl_expr<X, H0, GS, DH, WX, WH, DH0, DWX, DWH, DBX, DBH>, "etl::gru_cell_backward can only be used on ETL expressions");
+    static_assert(all_2d<X, H0, GS, DH, WX, WH, DH0, DWX, DWH> && all_1d<DBX, DBH>, "etl::gru_cell_backward is only defined for 2D input and states");
+    static_assert(all_row_major<X, H0, GS, DH, WX, WH, DH0, DWX, DWH, DBX, DBH>, "etl::gru_cell_backward is only defined for row-major expressions");
+
+    return {x, dh, gates, h_prev, h_prev, w_x, w_h, dh_prev, dw_x, dw_h, db_x, db_h};
+}
+
+/*!
+ * \brief Returns the gradients of the input sequence of a GRU, with
+ * backpropagation through time.
+ *
+ * The gradients of the initial hidden state are stored in dh0. The gradients
+ * of the weights and of the biases are accumulated into dw_x, dw_h, db_x and
+ * db_h.
+ *
+ * \param x The [T, B, I] input sequence
+ * \param h0 The [B, H] initial hidden state
+ * \param hs The [T, B, H] hidden states computed by gru_forward
+ * \param gates The [T, B, 4H] activations of the gates computed by gru_forward
+ * \param dhs The [T, B, H] gradients of the hidden states
+ * \param w_x The [I, 3H] input weights
+ * \param w_h The [H, 3H] recurrent weights
+ * \param dh0 The [B, H] matrix in which the gradients of the initial hidden state are stored
+ * \param dw_x The [I, 3H] gradients of the input weights
+ * \param dw_h The [H, 3H] gradients of the recurrent weights
+ * \param db_x The [3H] gradients of the input bias
+ * \param db_h The [3H] gradients of the recurrent bias
+ * \return An expression representing the [T, B, I] gradients of the input sequence
+ */
+template <typename X, typename H0, typename HS, typename GS, typename DH, typename WX, typename WH, typename DH0, typename DWX, typename DWH, typename DBX, typename DBH>
+gru_backward_expr<detail::build_type<X>, detail::build_type<DH>, detail::build_type<GS>, detail::build_type<H0>, detail::build_type<HS>, detail::build_type<WX>,
+                  detail::build_type<WH>, DH0&, DWX&, DWH&, DBX&, DBH&>
+gru_backward(const X& x, const H0& h0, const HS& hs, const GS& gates, const DH& dhs, const WX& w_x, const WH& w_h, DH0& dh0, DWX& dw_x, DWH& dw_h, DBX& db_x, DBH& db_h) {
+    static_assert(all_etl_expr<X, H0, HS, GS, DH, WX, WH, DH0, DWX, DWH, DBX, DBH>, "etl::gru_backward can only be used on ETL expressions");
+    static_assert(all_3d<X, HS, GS, DH> && all_2d<H0, WX, WH, DH0, DWX, DWH> && all_1d<DBX, DBH>, "etl::gru_backward is only defined for 3D input sequence");
+    static_assert(all_row_major<X, H0, HS, GS, DH, WX, WH, DH0, DWX, DWH, DBX, DBH>, "etl::gru_backward is only defined for row-major expressions");
+
+    return {x, dhs, gates, h0, hs, w_x, w_h, dh0, dw_x, dw_h, db_x, db_h};
+}
+
+} //end of namespace etl
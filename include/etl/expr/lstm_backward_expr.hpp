@@ -0,0 +1,472 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Backward pass of a LSTM cell, on a single time step or on a
+ * sequence.
+ *
+ * The gradients of the gates are computed backward in time, with a single
+ * pass over the gates and a single recurrent GEMM per time step. The
+ * gradients of the input, of the weights and of the bias are then computed
+ * with GEMMs over all the time steps at once.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+#include "etl/impl/std/rnn.hpp"
+#include "etl/impl/vec/rnn.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the gradients of the input of a LSTM
+ * over a [B, I] input (a single time step) or a [T, B, I] input (a
+ * sequence).
+ *
+ * The gradients of the initial states are stored, and the gradients of the
+ * weights and of the bias are accumulated, in the given matrices when the
+ * expression is evaluated.
+ *
+ * \tparam X The input type
+ * \tparam DH The gradients of the hidden states type
+ * \tparam GS The gates type
+ * \tparam H0 The initial hidden state type
+ * \tparam C0 The initial cell state type
+ * \tparam HS The hidden states type
+ * \tparam CS The cell states type
+ * \tparam DC The gradients of the last cell state type
+ * \tparam WX The input weights type
+ * \tparam WH The recurrent weights type
+ * \tparam DH0 The gradients of the initial hidden state type
+ * \tparam DC0 The gradients of the initial cell state type
+ * \tparam DWX The gradients of the input weights type
+ * \tparam DWH The gradients of the recurrent weights type
+ * \tparam DB The gradients of the bias type
+ */
+template <typename X, typename DH, typename GS, typename H0, typename C0, typename HS, typename CS, typename DC, typename WX, typename WH, typename DH0, typename DC0, typename DWX, typename DWH, typename DB>
+struct lstm_backward_expr
+        : base_temporary_expr_tern<lstm_backward_expr<X, DH, GS, H0, C0, HS, CS, DC, WX, WH, DH0, DC0, DWX, DWH, DB>, X, DH, GS> {
+    using value_type = value_t<X>;                                                            ///< The type of value of the expression
+    using this_type  = lstm_backward_expr<X, DH, GS, H0, C0, HS, CS, DC, WX, WH, DH0, DC0, DWX, DWH, DB>; ///< The type of this expression
+    using base_type  = base_temporary_expr_tern<this_type, X, DH, GS>;                        ///< The base type
+    using sub_traits = decay_traits<X>;                                                       ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    H0 _h0;    ///< The initial hidden state
+    C0 _c0;    ///< The initial cell state
+    HS _hs;    ///< The hidden states
+    CS _cs;    ///< The cell states
+    DC _dc;    ///< The gradients of the last cell state
+    WX _w_x;   ///< The [I, 4H] input weights
+    WH _w_h;   ///< The [H, 4H] recurrent weights
+    DH0 _dh0;  ///< The gradients of the initial hidden state
+    DC0 _dc0;  ///< The gradients of the initial cell state
+    DWX _dw_x; ///< The gradients of the input weights
+    DWH _dw_h; ///< The gradients of the recurrent weights
+    DB _db;    ///< The gradients of the bias
+
+    /*!
+     * \brief Construct a new expression
+     * \param x The input
+     * \param dh The gradients of the hidden states
+     * \param gates The activations of the gates
+     * \param h0 The initial hidden state
+     * \param c0 The initial cell state
+     * \param hs The hidden states
+     * \param cs The cell states
+     * \param dc The gradients of the last cell state
+     * \param w_x The input weights
+     * \param w_h The recurrent weights
+     * \param dh0 The gradients of the initial hidden state
+     * \param dc0 The gradients of the initial cell state
+     * \param dw_x The gradients of the input weights
+     * \param dw_h The gradients of the recurrent weights
+     * \param db The gradients of the bias
+     */
+    lstm_backward_expr(X x, DH dh, GS gates, H0 h0, C0 c0, HS hs, CS cs, DC dc, WX w_x, WH w_h, DH0 dh0, DC0 dc0, DWX dw_x, DWH dw_h, DB db)
+            : base_type(x, dh, gates), _h0(h0), _c0(c0), _hs(hs), _cs(cs), _dc(dc), _w_x(w_x), _w_h(w_h), _dh0(dh0), _dc0(dc0), _dw_x(dw_x), _dw_h(dw_h), _db(db) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the dimensions of the LSTM
+     * \param x The input
+     * \param dh The gradients of the hidden states
+     * \param gates The activations of the gates
+     * \param dx The output
+     */
+    template <typename L>
+    void check([[maybe_unused]] const X& x, [[maybe_unused]] const DH& dh, [[maybe_unused]] const GS& gates, [[maybe_unused]] const L& dx) const {
+        static_assert(etl::dimensions<X>() == etl::dimensions<L>(), "The output of lstm_backward has the dimensions of the input");
+
+        [[maybe_unused]] const size_t I = etl::dim<0>(_w_x);
+        [[maybe_unused]] const size_t H = etl::dim<0>(_w_h);
+
+        cpp_assert(etl::dim<1>(_w_x) == 4 * H, "Invalid dimensions for the weights of lstm_backward");
+        cpp_assert(etl::dim<1>(_w_h) == 4 * H, "Invalid dimensions for the weights of lstm_backward");
+        cpp_assert(etl::size(_dw_x) == etl::size(_w_x), "Invalid dimensions for the gradients of lstm_backward");
+        cpp_assert(etl::size(_dw_h) == etl::size(_w_h), "Invalid dimensions for the gradients of lstm_backward");
+        cpp_assert(etl::dim<0>(_db) == 4 * H, "Invalid dimensions for the gradients of lstm_backward");
+        cpp_assert(etl::dim<1>(_h0) == H, "Invalid dimensions for the initial state of lstm_backward");
+        cpp_assert(etl::size(_c0) == etl::size(_h0), "Invalid dimensions for the initial state of lstm_backward");
+        cpp_assert(etl::size(_dc) == etl::size(_h0), "Invalid dimensions for the gradients of lstm_backward");
+        cpp_assert(etl::size(_dh0) == etl::size(_h0), "Invalid dimensions for the gradients of lstm_backward");
+        cpp_assert(etl::size(_dc0) == etl::size(_h0), "Invalid dimensions for the gradients of lstm_backward");
+        cpp_assert(etl::size(dx) == etl::size(x), "Invalid dimensions for lstm_backward");
+        cpp_assert(etl::size(dh) == etl::size(x) / I * H, "Invalid dimensions for lstm_backward");
+        cpp_assert(etl::size(_cs) == etl::size(dh), "Invalid dimensions for lstm_backward");
+        cpp_assert(etl::size(gates) == 4 * etl::size(dh), "Invalid dimensions for lstm_backward");
+        cpp_assert(etl::size(dh) == etl::size(_h0) || etl::size(_hs) == etl::size(dh), "Invalid dimensions for lstm_backward");
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_to(L&& lhs) const {
+        static_assert(all_etl_expr<X, DH, GS, H0, C0, HS, CS, DC, WX, WH, DH0, DC0, DWX, DWH, DB, L>, "lstm_backward only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        using T = value_type;
+
+        auto& x     = this->a();
+        auto& dh    = this->b();
+        auto& gates = this->c();
+
+        check(x, dh, gates, lhs);
+
+        standard_evaluator::pre_assign_rhs(x);
+        standard_evaluator::pre_assign_rhs(dh);
+        standard_evaluator::pre_assign_rhs(gates);
+        standard_evaluator::pre_assign_rhs(_h0);
+        standard_evaluator::pre_assign_rhs(_c0);
+        standard_evaluator::pre_assign_rhs(_hs);
+        standard_evaluator::pre_assign_rhs(_cs);
+        standard_evaluator::pre_assign_rhs(_dc);
+        standard_evaluator::pre_assign_rhs(_w_x);
+        standard_evaluator::pre_assign_rhs(_w_h);
+
+        decltype(auto) xx  = smart_forward(x);
+        decltype(auto) dd  = smart_forward(dh);
+        decltype(auto) gg  = smart_forward(gates);
+        decltype(auto) h0  = smart_forward(_h0);
+        decltype(auto) c0  = smart_forward(_c0);
+        decltype(auto) hs  = smart_forward(_hs);
+        decltype(auto) cs  = smart_forward(_cs);
+        decltype(auto) dc  = smart_forward(_dc);
+        decltype(auto) w_x = smart_forward(_w_x);
+        decltype(auto) w_h = smart_forward(_w_h);
+
+        xx.ensure_cpu_up_to_date();
+        dd.ensure_cpu_up_to_date();
+        gg.ensure_cpu_up_to_date();
+        h0.ensure_cpu_up_to_date();
+        c0.ensure_cpu_up_to_date();
+        hs.ensure_cpu_up_to_date();
+        cs.ensure_cpu_up_to_date();
+        dc.ensure_cpu_up_to_date();
+        w_x.ensure_cpu_up_to_date();
+        w_h.ensure_cpu_up_to_date();
+
+        const size_t B = etl::dim<0>(h0);
+        const size_t I = etl::dim<0>(w_x);
+        const size_t H = etl::dim<0>(w_h);
+        const size_t S = etl::size(xx) / (B * I);
+
+        const T* g = gg.memory_start();
+        const T* c = cs.memory_start();
+
+        etl::dyn_matrix<T, 2> dg_all(S * B, 4 * H);
+
+        // The gradients flowing backward through the hidden and cell states
+        etl::dyn_matrix<T, 2> dh_t(B, H);
+        etl::dyn_matrix<T, 2> dc_t(B, H);
+
+        dh_t = T(0);
+        dc_t = dc;
+
+        for (size_t tt = S; tt > 0; --tt) {
+            const size_t t = tt - 1;
+
+            const T* c_prev = t == 0 ? c0.memory_start() : c + (t - 1) * B * H;
+
+            etl::custom_dyn_matrix<T> dg_t(dg_all.memory_start() + t * B * 4 * H, B, 4 * H);
+
+            dh_t += etl::custom_dyn_matrix<T>(const_cast<T*>(dd.memory_start()) + t * B * H, B, H);
+
+            if constexpr (impl::vec::rnn_possible<vector_mode, T>) {
+                inc_counter("impl:vec");
+                impl::vec::lstm_backward_gates(g + t * B * 4 * H, c_prev, c + t * B * H, dh_t.memory_start(), dc_t.memory_start(), dg_t.memory_start(),
+                                               dc_t.memory_start(), B, H);
+            } else {
+                inc_counter("impl:std");
+                impl::standard::lstm_backward_gates(g + t * B * 4 * H, c_prev, c + t * B * H, dh_t.memory_start(), dc_t.memory_start(), dg_t.memory_start(),
+                                                    dc_t.memory_start(), B, H);
+            }
+
+            dh_t = dg_t * trans(w_h);
+        }
+
+        _dh0 = dh_t;
+        _dc0 = dc_t;
+
+        // The gradients of the weights and of the input over all the time steps
+
+        etl::custom_dyn_matrix<T> x_all(const_cast<T*>(xx.memory_start()), S * B, I);
+        etl::custom_dyn_matrix<T> dg_0(dg_all.memory_start(), B, 4 * H);
+
+        _dw_x += trans(x_all) * dg_all;
+        _dw_h += trans(h0) * dg_0;
+
+        if (S > 1) {
+            etl::custom_dyn_matrix<T> h_prevs(const_cast<T*>(hs.memory_start()), (S - 1) * B, H);
+            etl::custom_dyn_matrix<T> dg_next(dg_all.memory_start() + B * 4 * H, (S - 1) * B, 4 * H);
+
+            _dw_h += trans(h_prevs) * dg_next;
+        }
+
+        _db += bias_batch_sum_2d(dg_all);
+
+        etl::custom_dyn_matrix<T> dx_all(lhs.memory_start(), S * B, I);
+
+        dx_all = dg_all * trans(w_x);
+
+        lhs.validate_cpu();
+        lhs.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const lstm_backward_expr& expr) {
+        return os << "lstm_backward(" << expr._a << ", " << expr._b << ", " << expr._c << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a LSTM backward expression
+ */
+template <typename X, typename DH, typename GS, typename H0, typename C0, typename HS, typename CS, typename DC, typename WX, typename WH, typename DH0, typename DC0, typename DWX, typename DWH, typename DB>
+struct etl_traits<etl::lstm_backward_expr<X, DH, GS, H0, C0, HS, CS, DC, WX, WH, DH0, DC0, DWX, DWH, DB>> {
+    using expr_t     = etl::lstm_backward_expr<X, DH, GS, H0, C0, HS, CS, DC, WX, WH, DH0, DC0, DWX, DWH, DB>; ///< The expression type
+    using sub_expr_t = std::decay_t<X>;                                                                     ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;                                                              ///< The sub traits
+    using value_type = value_t<X>;                                                                          ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                      ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                     ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                     ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                     ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = sub_traits::is_fast;       ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                     ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                      ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                     ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                      ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                     ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                     ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                      ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                      ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                     ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return sub_traits::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return sub_traits::dim(e._a, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return sub_traits::size(e._a);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return sub_traits::size();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return sub_traits::dimensions();
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+/*!
+ * \brief Returns the gradients of the input of a LSTM cell for a single
+ * time step.
+ *
+ * The gradients of the previous states are stored in dh_prev and dc_prev.
+ * The gradients of the weights and of the bias are accumulated into dw_x,
+ * dw_h and db, so that they can be summed over several time steps.
+ *
+ * \param x The [B, I] input
+ * \param h_prev The [B, H] previous hidden state
+ * \param c_prev The [B, H] previous cell state
+ * \param c The [B, H] cell state computed by lstm_cell_forward
+ * \param gates The [B, 4H] activations of the gates computed by lstm_cell_forward
+ * \param dh The [B, H] gradients of the hidden state
+ * \param dc The [B, H] gradients of the cell state coming from the next time step
+ * \param w_x The [I, 4H] input weights
+ * \param w_h The [H, 4H] recurrent weights
+ * \param dh_prev The [B, H] matrix in which the gradients of the previous hidden state are stored
+ * \param dc_prev The [B, H] matrix in which the gradients of the previous cell state are stored
+ * \param dw_x The [I, 4H] gradients of the input weights
+ * \param dw_h The [H, 4H] gradients of the recurrent weights
+ * \param db The [4H] gradients of the bias
+ * \return An expression representing the [B, I] gradients of the input
+ */
+template <typename X, typename H0, typename C0, typename CS, typename GS, typename DH, typename DC, typename WX, typename WH, typename DH0, typename DC0, typename DWX, typename DWH, typename DB>
+lstm_backward_expr<detail::build_type<X>, detail::build_type<DH>, detail::build_type<GS>, detail::build_type<H0>, detail::build_type<C0>, detail::build_type<H0>,
+                   detail::build_type<CS>, detail::build_type<DC>, detail::build_type<WX>, detail::build_type<WH>, DH0&, DC0&, DWX&, DWH&, DB&>
+lstm_cell_backward(const X& x, const H0& h_prev, const C0& c_prev, const CS& c, const GS& gates, const DH& dh, const DC& dc, const WX& w_x, const WH& w_h,
+                   DH0& dh_prev, DC0& dc_prev, DWX& dw_x, DWH& dw_h, DB& db) {
+    static_assert(all_etl_expr<X, H0, C0, CS, GS, DH, DC, WX, WH, DH0, DC0, DWX, DWH, DB>, "etl::lstm_cell_backward can only be used on ETL expressions");
+    static_assert(all_2d<X, H0, C0, CS, GS, DH, DC, WX, WH, DH0, DC0, DWX, DWH> && is_1d<DB>, "etl::lstm_cell_backward is only defined for 2D input and states");
+    static_assert(all_row_major<X, H0, C0, CS, GS, DH, DC, WX, WH, DH0, DC0, DWX, DWH, DB>, "etl::lstm_cell_backward is only defined for row-major expressions");
+
+    return {x, dh, gates, h_prev, c_prev, h_prev, c, dc, w_x, w_h, dh_prev, dc_prev, dw_x, dw_h, db};
+}
+
+/*!
+ * \brief Returns the gradients of the input sequence of a LSTM, with
+ * backpropagation through time.
+ *
+ * The gradients of the initial states are stored in dh0 and dc0. The
+ * gradients of the weights and of the bias are accumulated into dw_x, dw_h
+ * and db.
+ *
+ * \param x The [T, B, I] input sequence
+ * \param h0 The [B, H] initial hidden state
+ * \param c0 The [B, H] initial cell state
+ * \param hs The [T, B, H] hidden states computed by lstm_forward
+ * \param cs The [T, B, H] cell states computed by lstm_forward
+ * \param gates The [T, B, 4H] activations of the gates computed by lstm_forward
+ * \param dhs The [T, B, H] gradients of the hidden states
+ * \param dc The [B, H] gradients of the last cell state
+ * \param w_x The [I, 4H] input weights
+ * \param w_h The [H, 4H] recurrent weights
+ * \param dh0 The [B, H] matrix in which the gradients of the initial hidden state are stored
+ * \param dc0 The [B, H] matrix in which the gradients of the initial cell state are stored
+ * \param dw_x The [I, 4H] gradients of the input weights
+ * \param dw_h The [H, 4H] gradients of the recurrent weights
+ * \param db The [4H] gradients of the bias
+ * \return An expression representing the [T, B, I] gradients of the input sequence
+ */
+template <typename X, typename H0, typename C0, typename HS, typename CS, typename GS, typename DH, typename DC, typename WX, typename WH, typename DH0, typename DC0, typename DWX, typename DWH, typename DB>
+lstm_backward_expr<detail::build_type<X>, detail::build_type<DH>, detail::build_type<GS>, detail::build_type<H0>, detail::build_type<C0>, detail::build_type<HS>,
+                   detail::build_type<CS>, detail::build_type<DC>, detail::build_type<WX>, detail::build_type<WH>, DH0&, DC0&, DWX&, DWH&, DB&>
+lstm_backward(const X& x, const H0& h0, const C0& c0, const HS& hs, const CS& cs, const GS& gates, const DH& dhs, const DC& dc, const WX& w_x, const WH& w_h,
+              DH0& dh0, DC0& dc0, DWX& dw_x, DWH& dw_h, DB& db) {
+    static_assert(all_etl_expr<X, H0, C0, HS, CS, GS, DH, DC, WX, WH, DH0, DC0, DWX, DWH, DB>, "etl::lstm_backward can only be used on ETL expressions");
+    static_assert(all_3d<X, HS, CS, GS, DH> && all_2d<H0, C0, DC, WX, WH, DH0, DC0, DWX, DWH> && is_1d<DB>, "etl::lstm_backward is only defined for 3D input sequence");
+    static_assert(all_row_major<X, H0, C0, HS, CS, GS, DH, DC, WX, WH, DH0, DC0, DWX, DWH, DB>, "etl::lstm_backward is only defined for row-major expressions");
+
+    return {x, dhs, gates, h0, c0, hs, cs, dc, w_x, w_h, dh0, dc0, dw_x, dw_h, db};
+}
+
+} //end of namespace etl
@@ -0,0 +1,425 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Forward pass of a LSTM cell, on a single time step or on a sequence.
+ *
+ * The weights of the four gates are concatenated, so that the input and the
+ * recurrent projections are each a single GEMM. For a sequence, the input
+ * projection of all the time steps is a single large GEMM, only the
+ * recurrent projection is done at each time step. All the activations and
+ * elementwise operations of a time step are then done in a single pass over
+ * the gates.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+#include "etl/impl/std/rnn.hpp"
+#include "etl/impl/vec/rnn.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the hidden states of a LSTM cell over a
+ * [B, I] input (a single time step) or a [T, B, I] input (a sequence).
+ *
+ * The gates are in the (i, f, g, o) order. The cell states and the
+ * activations of the gates are stored in the given matrices when the
+ * expression is evaluated, to be used by the backward pass.
+ *
+ * \tparam X The input type
+ * \tparam H0 The initial hidden state type
+ * \tparam C0 The initial cell state type
+ * \tparam WX The input weights type
+ * \tparam WH The recurrent weights type
+ * \tparam Bias The bias type
+ * \tparam CS The cell states type
+ * \tparam GS The gates type
+ */
+template <typename X, typename H0, typename C0, typename WX, typename WH, typename Bias, typename CS, typename GS>
+struct lstm_forward_expr : base_temporary_expr_tern<lstm_forward_expr<X, H0, C0, WX, WH, Bias, CS, GS>, X, H0, C0> {
+    using value_type = value_t<X>;                                        ///< The type of value of the expression
+    using this_type  = lstm_forward_expr<X, H0, C0, WX, WH, Bias, CS, GS>; ///< The type of this expression
+    using base_type  = base_temporary_expr_tern<this_type, X, H0, C0>;    ///< The base type
+    using sub_traits = decay_traits<X>;                                   ///< The traits of the sub type
+
+    static constexpr auto storage_order = sub_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    WX _w_x;   ///< The [I, 4H] input weights
+    WH _w_h;   ///< The [H, 4H] recurrent weights
+    Bias _b;   ///< The [4H] bias
+    CS _cs;    ///< The cell states
+    GS _gates; ///< The activations of the gates
+
+    /*!
+     * \brief Construct a new expression
+     * \param x The input
+     * \param h0 The initial hidden state
+     * \param c0 The initial cell state
+     * \param w_x The input weights
+     * \param w_h The recurrent weights
+     * \param b The bias
+     * \param cs The cell states
+     * \param gates The activations of the gates
+     */
+    lstm_forward_expr(X x, H0 h0, C0 c0, WX w_x, WH w_h, Bias b, CS cs, GS gates)
+            : base_type(x, h0, c0), _w_x(w_x), _w_h(w_h), _b(b), _cs(cs), _gates(gates) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the dimensions of the LSTM
+     * \param x The input
+     * \param h0 The initial hidden state
+     * \param c0 The initial cell state
+     * \param w_x The input weights
+     * \param w_h The recurrent weights
+     * \param b The bias
+     * \param cs The cell states
+     * \param gates The activations of the gates
+     * \param h The output
+     */
+    template <typename L>
+    static void check([[maybe_unused]] const X& x,
+                      [[maybe_unused]] const H0& h0,
+                      [[maybe_unused]] const C0& c0,
+                      [[maybe_unused]] const WX& w_x,
+                      [[maybe_unused]] const WH& w_h,
+                      [[maybe_unused]] const Bias& b,
+                      [[maybe_unused]] const CS& cs,
+                      [[maybe_unused]] const GS& gates,
+                      [[maybe_unused]] const L& h) {
+        static_assert(etl::dimensions<X>() == etl::dimensions<L>(), "The output of the LSTM has the dimensions of the input");
+        static_assert(etl::dimensions<X>() == etl::dimensions<CS>(), "The cell states of the LSTM have the dimensions of the input");
+        static_assert(etl::dimensions<X>() == etl::dimensions<GS>(), "The gates of the LSTM have the dimensions of the input");
+
+        constexpr size_t D = etl::dimensions<X>();
+
+        cpp_assert(etl::dim<1>(w_x) == 4 * etl::dim<0>(w_h), "Invalid dimensions for the weights of the LSTM");
+        cpp_assert(etl::dim<1>(w_h) == 4 * etl::dim<0>(w_h), "Invalid dimensions for the weights of the LSTM");
+        cpp_assert(etl::dim<0>(b) == 4 * etl::dim<0>(w_h), "Invalid dimensions for the bias of the LSTM");
+        cpp_assert(etl::dim(x, D - 1) == etl::dim<0>(w_x), "Invalid dimensions for the input of the LSTM");
+        cpp_assert(etl::dim(x, D - 2) == etl::dim<0>(h0), "Invalid dimensions for the hidden state of the LSTM");
+        cpp_assert(etl::dim<1>(h0) == etl::dim<0>(w_h), "Invalid dimensions for the hidden state of the LSTM");
+        cpp_assert(etl::size(h0) == etl::size(c0), "Invalid dimensions for the cell state of the LSTM");
+        cpp_assert(etl::size(h) == etl::size(x) / etl::dim<0>(w_x) * etl::dim<0>(w_h), "Invalid dimensions for the output of the LSTM");
+        cpp_assert(etl::size(cs) == etl::size(h), "Invalid dimensions for the cell states of the LSTM");
+        cpp_assert(etl::size(gates) == 4 * etl::size(h), "Invalid dimensions for the gates of the LSTM");
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_to(L&& lhs) const {
+        static_assert(all_etl_expr<X, H0, C0, WX, WH, Bias, CS, GS, L>, "lstm_forward only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        using T = value_type;
+
+        auto& x  = this->a();
+        auto& h0 = this->b();
+        auto& c0 = this->c();
+
+        check(x, h0, c0, _w_x, _w_h, _b, _cs, _gates, lhs);
+
+        standard_evaluator::pre_assign_rhs(x);
+        standard_evaluator::pre_assign_rhs(h0);
+        standard_evaluator::pre_assign_rhs(c0);
+        standard_evaluator::pre_assign_rhs(_w_x);
+        standard_evaluator::pre_assign_rhs(_w_h);
+        standard_evaluator::pre_assign_rhs(_b);
+
+        decltype(auto) xx  = smart_forward(x);
+        decltype(auto) hh  = smart_forward(h0);
+        decltype(auto) cc  = smart_forward(c0);
+        decltype(auto) w_x = smart_forward(_w_x);
+        decltype(auto) w_h = smart_forward(_w_h);
+        decltype(auto) b   = smart_forward(_b);
+
+        xx.ensure_cpu_up_to_date();
+        hh.ensure_cpu_up_to_date();
+        cc.ensure_cpu_up_to_date();
+        w_x.ensure_cpu_up_to_date();
+        w_h.ensure_cpu_up_to_date();
+        b.ensure_cpu_up_to_date();
+
+        const size_t B = etl::dim<0>(hh);
+        const size_t I = etl::dim<0>(w_x);
+        const size_t H = etl::dim<0>(w_h);
+        const size_t S = etl::size(xx) / (B * I);
+
+        T* h = lhs.memory_start();
+        T* c = _cs.memory_start();
+        T* g = _gates.memory_start();
+
+        // The input projection of all the time steps, with the bias
+        etl::custom_dyn_matrix<T> x_all(const_cast<T*>(xx.memory_start()), S * B, I);
+        etl::custom_dyn_matrix<T> g_all(g, S * B, 4 * H);
+
+        g_all = bias_add_2d(x_all * w_x, b);
+
+        for (size_t t = 0; t < S; ++t) {
+            T* h_prev       = t == 0 ? const_cast<T*>(hh.memory_start()) : h + (t - 1) * B * H;
+            const T* c_prev = t == 0 ? cc.memory_start() : c + (t - 1) * B * H;
+
+            etl::custom_dyn_matrix<T> g_t(g + t * B * 4 * H, B, 4 * H);
+            etl::custom_dyn_matrix<T> h_t(h_prev, B, H);
+
+            // The recurrent projection is accumulated into the gates
+            g_t += h_t * w_h;
+
+            if constexpr (impl::vec::rnn_possible<vector_mode, T>) {
+                inc_counter("impl:vec");
+                impl::vec::lstm_forward_gates(g_t.memory_start(), c_prev, c + t * B * H, h + t * B * H, B, H);
+            } else {
+                inc_counter("impl:std");
+                impl::standard::lstm_forward_gates(g_t.memory_start(), c_prev, c + t * B * H, h + t * B * H, B, H);
+            }
+        }
+
+        _cs.validate_cpu();
+        _cs.invalidate_gpu();
+        _gates.validate_cpu();
+        _gates.invalidate_gpu();
+
+        lhs.validate_cpu();
+        lhs.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const lstm_forward_expr& expr) {
+        return os << "lstm_forward(" << expr._a << ", " << expr._b << ", " << expr._c << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a LSTM forward expression
+ * \tparam X The input type
+ * \tparam H0 The initial hidden state type
+ * \tparam C0 The initial cell state type
+ * \tparam WX The input weights type
+ * \tparam WH The recurrent weights type
+ * \tparam Bias The bias type
+ * \tparam CS The cell states type
+ * \tparam GS The gates type
+ */
+template <typename X, typename H0, typename C0, typename WX, typename WH, typename Bias, typename CS, typename GS>
+struct etl_traits<etl::lstm_forward_expr<X, H0, C0, WX, WH, Bias, CS, GS>> {
+    using expr_t     = etl::lstm_forward_expr<X, H0, C0, WX, WH, Bias, CS, GS>; ///< The expression type
+    using sub_expr_t = std::decay_t<X>;                                        ///< The sub expression type
+    using sub_traits = etl_traits<sub_expr_t>;                                 ///< The sub traits
+    using value_type = value_t<X>;                                             ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                      ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                     ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                     ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                     ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = all_fast<X, WX, WH>;       ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                     ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                      ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                     ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                      ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                     ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                     ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                      ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                      ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                     ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = sub_traits::storage_order; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        if constexpr (DD == sub_traits::dimensions() - 1) {
+            return decay_traits<WH>::template dim<0>();
+        } else {
+            return sub_traits::template dim<DD>();
+        }
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        if (d == sub_traits::dimensions() - 1) {
+            return etl::dim<0>(e._w_h);
+        } else {
+            return sub_traits::dim(e._a, d);
+        }
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return (sub_traits::size(e._a) / etl::dim<0>(e._w_x)) * etl::dim<0>(e._w_h);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return (sub_traits::size() / decay_traits<WX>::template dim<0>()) * decay_traits<WH>::template dim<0>();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return sub_traits::dimensions();
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+/*!
+ * \brief Returns the hidden state of a LSTM cell for a single time step.
+ *
+ * The gates are computed as x * w_x + h_prev * w_h + b, with the weights of
+ * the four gates concatenated in the (i, f, g, o) order. The new cell state
+ * and the activations of the gates (needed by lstm_cell_backward) are stored
+ * in c and gates when the expression is evaluated.
+ *
+ * \param x The [B, I] input
+ * \param h_prev The [B, H] previous hidden state
+ * \param c_prev The [B, H] previous cell state
+ * \param w_x The [I, 4H] input weights
+ * \param w_h The [H, 4H] recurrent weights
+ * \param b The [4H] bias
+ * \param c The [B, H] matrix in which the new cell state is stored
+ * \param gates The [B, 4H] matrix in which the activations of the gates are stored
+ * \return An expression representing the [B, H] new hidden state
+ */
+template <typename X, typename H0, typename C0, typename WX, typename WH, typename Bias, typename CS, typename GS>
+lstm_forward_expr<detail::build_type<X>, detail::build_type<H0>, detail::build_type<C0>, detail::build_type<WX>, detail::build_type<WH>, detail::build_type<Bias>, CS&, GS&>
+lstm_cell_forward(const X& x, const H0& h_prev, const C0& c_prev, const WX& w_x, const WH& w_h, const Bias& b, CS& c, GS& gates) {
+    static_assert(all_etl_expr<X, H0, C0, WX, WH, Bias, CS, GS>, "etl::lstm_cell_forward can only be used on ETL expressions");
+    static_assert(all_2d<X, H0, C0, WX, WH, CS, GS> && is_1d<Bias>, "etl::lstm_cell_forward is only defined for 2D input and states");
+    static_assert(all_row_major<X, H0, C0, WX, WH, Bias, CS, GS>, "etl::lstm_cell_forward is only defined for row-major expressions");
+    static_assert(all_dma<CS, GS>, "etl::lstm_cell_forward needs direct access to the cell state and the gates");
+
+    return {x, h_prev, c_prev, w_x, w_h, b, c, gates};
+}
+
+/*!
+ * \brief Returns the hidden states of a LSTM over a sequence.
+ *
+ * The input projection of all the time steps is done with a single GEMM
+ * over the concatenated weights of the gates, the recurrent projection is
+ * done at each time step. The cell states and the activations of the gates
+ * of all the time steps are stored in cs and gates when the expression is
+ * evaluated.
+ *
+ * \param x The [T, B, I] input sequence
+ * \param h0 The [B, H] initial hidden state
+ * \param c0 The [B, H] initial cell state
+ * \param w_x The [I, 4H] input weights
+ * \param w_h The [H, 4H] recurrent weights
+ * \param b The [4H] bias
+ * \param cs The [T, B, H] matrix in which the cell states are stored
+ * \param gates The [T, B, 4H] matrix in which the activations of the gates are stored
+ * \return An expression representing the [T, B, H] hidden states
+ */
+template <typename X, typename H0, typename C0, typename WX, typename WH, typename Bias, typename CS, typename GS>
+lstm_forward_expr<detail::build_type<X>, detail::build_type<H0>, detail::build_type<C0>, detail::build_type<WX>, detail::build_type<WH>, detail::build_type<Bias>, CS&, GS&>
+lstm_forward(const X& x, const H0& h0, const C0& c0, const WX& w_x, const WH& w_h, const Bias& b, CS& cs, GS& gates) {
+    static_assert(all_etl_expr<X, H0, C0, WX, WH, Bias, CS, GS>, "etl::lstm_forward can only be used on ETL expressions");
+    static_assert(all_3d<X, CS, GS> && all_2d<H0, C0, WX, WH> && is_1d<Bias>, "etl::lstm_forward is only defined for 3D input sequence");
+    static_assert(all_row_major<X, H0, C0, WX, WH, Bias, CS, GS>, "etl::lstm_forward is only defined for row-major expressions");
+    static_assert(all_dma<CS, GS>, "etl::lstm_forward needs direct access to the cell states and the gates");
+
+    return {x, h0, c0, w_x, w_h, b, cs, gates};
+}
+
+} //end of namespace etl
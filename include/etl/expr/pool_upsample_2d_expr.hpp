@@ -12,6 +12,7 @@
 //Get the implementations
 #include "etl/impl/std/max_pooling_upsample.hpp"
 #include "etl/impl/std/avg_pooling_upsample.hpp"
+#include "etl/impl/vec/pooling.hpp"
 #include "etl/impl/cudnn/pooling_upsample.hpp"
 
 namespace etl {
@@ -90,6 +91,10 @@ struct pool_upsample_2d_expr : base_temporary_expr_tern<pool_upsample_2d_expr<A,
             return etl::pool_impl::CUDNN;
         }
 
+        if (impl::vec::pool_possible<vector_mode, A, B, C, R>) {
+            return etl::pool_impl::VEC;
+        }
+
         return etl::pool_impl::STD;
     }
 
@@ -114,6 +119,15 @@ struct pool_upsample_2d_expr : base_temporary_expr_tern<pool_upsample_2d_expr<A,
 
                     return forced;
 
+                // VEC cannot always be used
+                case pool_impl::VEC:
+                    if (!impl::vec::pool_possible<vector_mode, A, B, C, R>) {                                                        //COVERAGE_EXCLUDE_LINE
+                        std::cerr << "Forced selection to VEC pool implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
+                        return select_default_impl<R>(local_context().cpu);                                                            //COVERAGE_EXCLUDE_LINE
+                    }                                                                                                                  //COVERAGE_EXCLUDE_LINE
+
+                    return forced;
+
                 //In other cases, simply use the forced impl
                 default:
                     return forced;
@@ -163,6 +177,11 @@ struct pool_upsample_2d_expr : base_temporary_expr_tern<pool_upsample_2d_expr<A,
                     inc_counter("impl:std");
                     impl::standard::max_pool_upsample_2d::apply<C1, C2, S1, S2, P1, P2>(smart_forward(a), smart_forward(b), smart_forward(c), result);
                 }
+            else if
+                constexpr_select(impl == pool_impl::VEC) {
+                    inc_counter("impl:vec");
+                    impl::vec::max_pool_upsample_2d::apply<C1, C2, S1, S2, P1, P2>(smart_forward(a), smart_forward(b), smart_forward(c), result);
+                }
             else if
                 constexpr_select(impl == pool_impl::CUDNN) {
                     inc_counter("impl:cudnn");
@@ -177,6 +196,11 @@ struct pool_upsample_2d_expr : base_temporary_expr_tern<pool_upsample_2d_expr<A,
                     inc_counter("impl:std");
                     impl::standard::avg_pool_upsample_2d::apply<C1, C2, S1, S2, P1, P2>(smart_forward(a), smart_forward(b), smart_forward(c), result);
                 }
+            else if
+                constexpr_select(impl == pool_impl::VEC) {
+                    inc_counter("impl:vec");
+                    impl::vec::avg_pool_upsample_2d::apply<C1, C2, S1, S2, P1, P2>(smart_forward(a), smart_forward(b), smart_forward(c), result);
+                }
             else if
                 constexpr_select(impl == pool_impl::CUDNN) {
                     inc_counter("impl:cudnn");
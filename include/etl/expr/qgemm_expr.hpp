@@ -0,0 +1,342 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+#include "etl/impl/std/qgemm.hpp"
+#include "etl/impl/vec/qgemm.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A quantized matrix-matrix or matrix-vector multiplication
+ *
+ * The int8 operands are multiplied with int32 accumulators, which are then
+ * converted into the output type by the epilogue: kept as int32,
+ * dequantized to floating point or requantized to int8.
+ *
+ * \tparam A The lhs matrix type
+ * \tparam B The rhs matrix or vector type
+ * \tparam T The output type
+ */
+template <typename A, typename B, typename T>
+struct qgemm_expr : base_temporary_expr_bin<qgemm_expr<A, B, T>, A, B> {
+    using value_type  = T;                                         ///< The type of value of the expression
+    using this_type   = qgemm_expr<A, B, T>;                       ///< The type of this expression
+    using base_type   = base_temporary_expr_bin<this_type, A, B>;  ///< The base type
+    using left_traits = decay_traits<A>;                           ///< The traits of the left sub type
+
+    static constexpr auto storage_order = left_traits::storage_order; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    const impl::standard::qgemm_epilogue<T> epi; ///< The epilogue
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The lhs matrix
+     * \param b The rhs matrix or vector
+     * \param scale The scale of the accumulators
+     * \param zero_point The zero point of the requantized output
+     */
+    qgemm_expr(A a, B b, float scale, int32_t zero_point) : base_type(a, b), epi{scale, zero_point} {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Validate the dimensions of the multiplication
+     * \param a The lhs matrix
+     * \param b The rhs matrix or vector
+     * \param c The output
+     */
+    template <typename C>
+    static void check([[maybe_unused]] const A& a, [[maybe_unused]] const B& b, [[maybe_unused]] const C& c) {
+        static_assert(is_2d<A>, "The lhs of a quantized multiplication must be a matrix");
+        static_assert(is_1d<B> || is_2d<B>, "The rhs of a quantized multiplication must be a matrix or a vector");
+        static_assert(etl::dimensions<B>() == etl::dimensions<C>(), "Invalid output of quantized multiplication");
+
+        if constexpr (all_fast<A, B, C>) {
+            static_assert(etl::dim<1, A>() == etl::dim<0, B>(), "Invalid dimensions for quantized multiplication");
+            static_assert(etl::dim<0, A>() == etl::dim<0, C>(), "Invalid dimensions for quantized multiplication");
+
+            if constexpr (is_2d<B>) {
+                static_assert(etl::dim<1, B>() == etl::dim<1, C>(), "Invalid dimensions for quantized multiplication");
+            }
+        } else {
+            cpp_assert(etl::dim<1>(a) == etl::dim<0>(b), "Invalid dimensions for quantized multiplication");
+            cpp_assert(etl::dim<0>(a) == etl::dim<0>(c), "Invalid dimensions for quantized multiplication");
+
+            if constexpr (is_2d<B>) {
+                cpp_assert(etl::dim<1>(b) == etl::dim<1>(c), "Invalid dimensions for quantized multiplication");
+            }
+        }
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix of the same storage order
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_to(L&& lhs) const {
+        static_assert(all_etl_expr<A, B, L>, "Quantized multiplication only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        auto& a = this->a();
+        auto& b = this->b();
+
+        check(a, b, lhs);
+
+        standard_evaluator::pre_assign_rhs(a);
+        standard_evaluator::pre_assign_rhs(b);
+
+        decltype(auto) x = smart_forward(a);
+        decltype(auto) y = smart_forward(b);
+
+        x.ensure_cpu_up_to_date();
+        y.ensure_cpu_up_to_date();
+
+        if constexpr (impl::vec::qgemm_possible<decltype(x), decltype(y), L>) {
+            inc_counter("impl:vec");
+            impl::vec::qgemm(x, y, lhs, epi);
+        } else {
+            inc_counter("impl:std");
+            impl::standard::qgemm(x, y, lhs, epi);
+        }
+
+        lhs.validate_cpu();
+        lhs.invalidate_gpu();
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const qgemm_expr& expr) {
+        return os << "qmul(" << expr._a << ", " << expr._b << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a quantized multiplication expression
+ * \tparam A The lhs matrix type
+ * \tparam B The rhs matrix or vector type
+ * \tparam T The output type
+ */
+template <typename A, typename B, typename T>
+struct etl_traits<etl::qgemm_expr<A, B, T>> {
+    using expr_t       = etl::qgemm_expr<A, B, T>; ///< The expression type
+    using left_expr_t  = std::decay_t<A>;          ///< The left sub expression type
+    using right_expr_t = std::decay_t<B>;          ///< The right sub expression type
+    using left_traits  = etl_traits<left_expr_t>;  ///< The left sub traits
+    using right_traits = etl_traits<right_expr_t>; ///< The right sub traits
+    using value_type   = T;                        ///< The value type of the expression
+
+    static constexpr size_t D = right_traits::dimensions(); ///< The number of dimensions
+
+    static constexpr bool is_etl         = true;                                          ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                                         ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                                         ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                                         ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = left_traits::is_fast && right_traits::is_fast; ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                                         ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                                          ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                                         ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                                          ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                                         ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                                         ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                                          ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                                          ///< Indicates if the expression needs a evaluator visitor
+    static constexpr order storage_order = left_traits::storage_order;                    ///< The expression's storage order
+    static constexpr bool gpu_computable = false;                                         ///< Indicates if the expression can be computed on GPU
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        static_assert(DD < D, "Invalid dimensions access");
+        return DD == 0 ? left_traits::template dim<0>() : right_traits::template dim<1>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, [[maybe_unused]] size_t d) {
+        cpp_assert(d < D, "Invalid dimensions access");
+
+        return d == 0 ? etl::dim<0>(e._a) : etl::dim<1>(e._b);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        if constexpr (D == 1) {
+            return etl::dim<0>(e._a);
+        } else {
+            return etl::dim<0>(e._a) * etl::dim<1>(e._b);
+        }
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        if constexpr (D == 1) {
+            return left_traits::template dim<0>();
+        } else {
+            return left_traits::template dim<0>() * right_traits::template dim<1>();
+        }
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return D;
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+/*!
+ * \brief Multiply two int8 operands with int32 accumulation.
+ *
+ * The rhs can be a matrix (GEMM) or a vector (GEMV).
+ *
+ * \param a The lhs matrix
+ * \param b The rhs matrix or vector
+ * \return An expression representing the int32 product of a and b
+ */
+template <typename A, typename B>
+qgemm_expr<detail::build_type<A>, detail::build_type<B>, int32_t> qmul(const A& a, const B& b) {
+    static_assert(all_etl_expr<A, B>, "etl::qmul can only be used on ETL expressions");
+    static_assert(std::is_same_v<value_t<A>, int8_t> && std::is_same_v<value_t<B>, int8_t>, "etl::qmul is only defined for int8 operands");
+
+    return qgemm_expr<detail::build_type<A>, detail::build_type<B>, int32_t>{a, b, 1.0f, 0};
+}
+
+/*!
+ * \brief Multiply two int8 operands and dequantize the result.
+ *
+ * Each int32 accumulator acc is converted as scale * acc. The scale is
+ * generally the product of the scales of a and b.
+ *
+ * \param a The lhs matrix
+ * \param b The rhs matrix or vector
+ * \param scale The scale of the accumulators
+ * \tparam T The floating point type of the result
+ * \return An expression representing the dequantized product of a and b
+ */
+template <typename T = float, typename A, typename B>
+qgemm_expr<detail::build_type<A>, detail::build_type<B>, T> qmul_dequantize(const A& a, const B& b, float scale) {
+    static_assert(all_etl_expr<A, B>, "etl::qmul_dequantize can only be used on ETL expressions");
+    static_assert(std::is_same_v<value_t<A>, int8_t> && std::is_same_v<value_t<B>, int8_t>, "etl::qmul_dequantize is only defined for int8 operands");
+    static_assert(std::is_floating_point_v<T>, "etl::qmul_dequantize can only dequantize into floating points");
+
+    return qgemm_expr<detail::build_type<A>, detail::build_type<B>, T>{a, b, scale, 0};
+}
+
+/*!
+ * \brief Multiply two int8 operands and requantize the result to int8.
+ *
+ * Each int32 accumulator acc is converted as
+ * saturate(round(scale * acc) + zero_point). The scale is generally
+ * scale(a) * scale(b) / scale(output).
+ *
+ * \param a The lhs matrix
+ * \param b The rhs matrix or vector
+ * \param scale The requantization scale
+ * \param zero_point The zero point of the output
+ * \return An expression representing the requantized product of a and b
+ */
+template <typename A, typename B>
+qgemm_expr<detail::build_type<A>, detail::build_type<B>, int8_t> qmul_requantize(const A& a, const B& b, float scale, int32_t zero_point = 0) {
+    static_assert(all_etl_expr<A, B>, "etl::qmul_requantize can only be used on ETL expressions");
+    static_assert(std::is_same_v<value_t<A>, int8_t> && std::is_same_v<value_t<B>, int8_t>, "etl::qmul_requantize is only defined for int8 operands");
+
+    return qgemm_expr<detail::build_type<A>, detail::build_type<B>, int8_t>{a, b, scale, zero_point};
+}
+
+} //end of namespace etl
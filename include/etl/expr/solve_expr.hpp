@@ -0,0 +1,303 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Solution of dense linear systems A * X = B.
+ *
+ * A is decomposed with the blocked LU decomposition with partial pivoting and
+ * the right-hand sides are solved in row-major order.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the solution X of the linear system
+ * A * X = B, with A a square matrix and B a vector or a matrix.
+ *
+ * \tparam A The type of the matrix of the system
+ * \tparam B The type of the right-hand sides
+ */
+template <typename A, typename B>
+struct solve_expr : base_temporary_expr_bin<solve_expr<A, B>, A, B> {
+    using value_type   = value_t<A>;                               ///< The type of value of the expression
+    using this_type    = solve_expr<A, B>;                         ///< The type of this expression
+    using base_type    = base_temporary_expr_bin<this_type, A, B>; ///< The base type
+    using right_traits = decay_traits<B>;                          ///< The traits of the right-hand sides
+
+    static constexpr auto storage_order = right_traits::storage_order; ///< The storage order of the right-hand sides
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The matrix of the system
+     * \param b The right-hand sides
+     */
+    explicit solve_expr(A a, B b) : base_type(a, b) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Assert that the system is valid
+     * \param a The matrix of the system
+     * \param b The right-hand sides
+     * \param c The output expression
+     */
+    template <typename C>
+    static void check([[maybe_unused]] const A& a, [[maybe_unused]] const B& b, [[maybe_unused]] const C& c) {
+        static_assert(is_2d<A>, "solve is only defined for a matrix A");
+        static_assert(is_1d<B> || is_2d<B>, "solve is only defined for vector or matrix right-hand sides");
+        static_assert(etl::dimensions<B>() == etl::dimensions<C>(), "solve must be assigned to an expression of the dimensionality of B");
+
+        if constexpr (all_fast<A, B, C>) {
+            static_assert(dim<0, A>() == dim<1, A>() //square system
+                              && dim<0, A>() == dim<0, B>() //rows of the right-hand sides
+                              && decay_traits<B>::size() == decay_traits<C>::size(),
+                          "Invalid sizes for solve");
+        } else {
+            cpp_assert(dim<0>(a) == dim<1>(a) //square system
+                           && dim<0>(a) == dim<0>(b) //rows of the right-hand sides
+                           && etl::size(b) == etl::size(c),
+                       "Invalid sizes for solve");
+        }
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix or a vector
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, B, C>, "solve only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        auto& a = this->a();
+        auto& b = this->b();
+
+        check(a, b, c);
+
+        const size_t n = etl::dim<0>(a);
+        const size_t m = is_1d<B> ? 1 : etl::dim(b, 1);
+
+        // The decomposition is done on a copy, before c is touched, since c
+        // may alias A
+
+        dyn_matrix<value_type, 2> lu(n, n);
+        lu = a;
+
+        std::vector<size_t> piv(n);
+
+        detail::lu_factor(lu.memory_start(), piv.data(), n);
+
+        if constexpr (is_dma<C> && is_row_major<C> && std::is_same_v<value_t<C>, value_type> && !is_adapter<C>) {
+            c = b;
+
+            detail::lu_solve(lu.memory_start(), piv.data(), c.memory_start(), n, m);
+
+            c.validate_cpu();
+            c.invalidate_gpu();
+        } else {
+            // The substitutions are always done on row-major right-hand sides
+            dyn_matrix<value_type, decay_traits<C>::dimensions()> tmp;
+
+            if constexpr (decay_traits<C>::dimensions() == 1) {
+                tmp.resize(n);
+            } else {
+                tmp.resize(n, m);
+            }
+
+            tmp = b;
+
+            detail::lu_solve(lu.memory_start(), piv.data(), tmp.memory_start(), n, m);
+
+            c = tmp;
+        }
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const solve_expr& expr) {
+        return os << "solve(" << expr._a << ", " << expr._b << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a solve expression
+ * \tparam A The type of the matrix of the system
+ * \tparam B The type of the right-hand sides
+ */
+template <typename A, typename B>
+struct etl_traits<etl::solve_expr<A, B>> {
+    using expr_t       = etl::solve_expr<A, B>;    ///< The expression type
+    using left_expr_t  = std::decay_t<A>;          ///< The left sub expression type
+    using right_expr_t = std::decay_t<B>;          ///< The right sub expression type
+    using left_traits  = etl_traits<left_expr_t>;  ///< The left sub traits
+    using right_traits = etl_traits<right_expr_t>; ///< The right sub traits
+    using value_type   = value_t<A>;               ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                                          ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                                         ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                                         ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                                         ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = left_traits::is_fast && right_traits::is_fast; ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                                         ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                                          ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                                         ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                                          ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                                         ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                                         ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                                          ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                                          ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;                                         ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = right_traits::storage_order;                   ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return right_traits::template dim<DD>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        return etl::dim(e._b, d);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return etl::size(e._b);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return right_traits::size();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return right_traits::dimensions();
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return 4;
+    }
+};
+
+/*!
+ * \brief Solve the linear system A * X = B
+ *
+ * A must be a square matrix and B a vector or a matrix with as many rows as
+ * A. A is not modified. If A is a triangular adapter (lower_matrix,
+ * upper_matrix, uni_lower_matrix or uni_upper_matrix), the system is solved
+ * by substitution, without decomposition.
+ *
+ * \param a The matrix of the system
+ * \param b The right-hand sides
+ * \return An expression representing the solution X of the system
+ */
+template <typename A, typename B>
+auto solve(A&& a, B&& b) {
+    static_assert(all_etl_expr<A, B>, "solve only supported for ETL expressions");
+
+    if constexpr (is_lower_adapter<A> || is_upper_adapter<A>) {
+        return trsm_expr<detail::build_type<A>, detail::build_type<B>>{a, b};
+    } else {
+        return solve_expr<detail::build_type<A>, detail::build_type<B>>{a, b};
+    }
+}
+
+} //end of namespace etl
@@ -0,0 +1,450 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Products between a sparse matrix and a dense matrix or vector.
+ *
+ * Only the non-zeros of the sparse matrix are read. COO matrices are first
+ * converted to CSR, the dense operands are used in row-major order.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+//The implementations
+#include "etl/impl/std/spmm.hpp"
+#include "etl/impl/vec/spmm.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the product of a sparse matrix and a
+ * dense matrix or vector (SpMM and SpMV), in either order.
+ *
+ * Exactly one of A and B is a sparse matrix.
+ *
+ * \tparam A The left hand side type
+ * \tparam B The right hand side type
+ * \tparam Trans Indicates if the sparse matrix is transposed
+ */
+template <typename A, typename B, bool Trans>
+struct sparse_mul_expr : base_temporary_expr_bin<sparse_mul_expr<A, B, Trans>, A, B> {
+    using value_type = value_t<A>;                                ///< The type of value of the expression
+    using this_type  = sparse_mul_expr<A, B, Trans>;              ///< The type of this expression
+    using base_type  = base_temporary_expr_bin<this_type, A, B>; ///< The base type
+
+    static constexpr auto storage_order = order::RowMajor; ///< The storage order
+
+    static constexpr bool sparse_left = is_sparse_matrix<A>; ///< Indicates if the sparse matrix is the left hand side
+
+    static_assert(sparse_left != is_sparse_matrix<B>, "sparse_mul_expr needs exactly one sparse matrix");
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The left hand side
+     * \param b The right hand side
+     */
+    explicit sparse_mul_expr(A a, B b) : base_type(a, b) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Returns the number of rows of the left hand side, after transposition
+     * \param a The left hand side
+     */
+    static size_t left_rows(const A& a) {
+        if constexpr (is_1d<A>) {
+            return 1;
+        } else if constexpr (sparse_left && Trans) {
+            return etl::dim<1>(a);
+        } else {
+            return etl::dim<0>(a);
+        }
+    }
+
+    /*!
+     * \brief Returns the number of columns of the left hand side, after transposition
+     * \param a The left hand side
+     */
+    static size_t left_columns(const A& a) {
+        if constexpr (is_1d<A>) {
+            return etl::dim<0>(a);
+        } else if constexpr (sparse_left && Trans) {
+            return etl::dim<0>(a);
+        } else {
+            return etl::dim<1>(a);
+        }
+    }
+
+    /*!
+     * \brief Returns the number of rows of the right hand side, after transposition
+     * \param b The right hand side
+     */
+    static size_t right_rows(const B& b) {
+        if constexpr (!sparse_left && Trans) {
+            return etl::dim<1>(b);
+        } else {
+            return etl::dim<0>(b);
+        }
+    }
+
+    /*!
+     * \brief Returns the number of columns of the right hand side, after transposition
+     * \param b The right hand side
+     */
+    static size_t right_columns(const B& b) {
+        if constexpr (is_1d<B>) {
+            return 1;
+        } else if constexpr (!sparse_left && Trans) {
+            return etl::dim<0>(b);
+        } else {
+            return etl::dim<1>(b);
+        }
+    }
+
+    /*!
+     * \brief Assert for the validity of the product
+     * \param a The left side
+     * \param b The right side
+     * \param c The result
+     */
+    template <typename C>
+    static void check([[maybe_unused]] const A& a, [[maybe_unused]] const B& b, [[maybe_unused]] const C& c) {
+        static_assert(etl::dimensions<C>() == (is_1d<A> || is_1d<B> ? 1 : 2), "Invalid dimensions for the result of the sparse product");
+
+        cpp_assert(left_columns(a) == right_rows(b), "Invalid sizes for multiplication");
+
+        if constexpr (is_1d<A>) {
+            cpp_assert(etl::dim<0>(c) == right_columns(b), "Invalid sizes for multiplication");
+        } else if constexpr (is_1d<B>) {
+            cpp_assert(etl::dim<0>(c) == left_rows(a), "Invalid sizes for multiplication");
+        } else {
+            cpp_assert(etl::dim<0>(c) == left_rows(a) && etl::dim<1>(c) == right_columns(b), "Invalid sizes for multiplication");
+        }
+    }
+
+    /*!
+     * \brief Returns the dense operand as a row-major direct expression of
+     * the value type, making a copy only if necessary.
+     * \param e The dense operand
+     */
+    template <typename E>
+    static decltype(auto) row_major_operand(const E& e) {
+        if constexpr (is_dma<E> && is_row_major<E> && std::is_same_v<value_t<E>, value_type>) {
+            e.ensure_cpu_up_to_date();
+            return (e);
+        } else if constexpr (is_1d<E>) {
+            dyn_vector<value_type> mat(etl::dim<0>(e));
+            mat = e;
+            return mat;
+        } else {
+            dyn_matrix<value_type, 2> mat(etl::dim<0>(e), etl::dim<1>(e));
+            mat = e;
+            return mat;
+        }
+    }
+
+    /*!
+     * \brief Returns the sparse operand
+     * \param a The left hand side
+     * \param b The right hand side
+     */
+    static const auto& sparse_operand(const A& a, const B& b) {
+        if constexpr (sparse_left) {
+            return a;
+        } else {
+            return b;
+        }
+    }
+
+    /*!
+     * \brief Returns the dense operand
+     * \param a The left hand side
+     * \param b The right hand side
+     */
+    static const auto& dense_operand(const A& a, const B& b) {
+        if constexpr (sparse_left) {
+            return b;
+        } else {
+            return a;
+        }
+    }
+
+    /*!
+     * \brief Returns the sparse operand in a compressed format, converting
+     * a COO matrix to CSR.
+     * \param s The sparse operand
+     */
+    template <typename S>
+    static decltype(auto) compressed_operand(const S& s) {
+        using sparse_type = std::decay_t<S>;
+
+        if constexpr (sparse_type::storage_format == sparse_storage::COO) {
+            csr_matrix<value_type, typename sparse_type::index_type> csr;
+            csr = s;
+            return csr;
+        } else {
+            return (s);
+        }
+    }
+
+    /*!
+     * \brief Compute the product into the given row-major memory
+     * \param a The left hand side
+     * \param b The right hand side
+     * \param c The memory of the result
+     */
+    static void apply_raw(const A& a, const B& b, value_type* c) {
+        const size_t m                  = left_rows(a);
+        [[maybe_unused]] const size_t k = left_columns(a);
+        const size_t n                  = right_columns(b);
+
+        auto& s = sparse_operand(a, b);
+
+        if (!etl::size(s)) {
+            std::fill_n(c, m * n, value_type(0));
+            return;
+        }
+
+        decltype(auto) ss = compressed_operand(s);
+        decltype(auto) dd = row_major_operand(dense_operand(a, b));
+
+        using compressed_type = std::decay_t<decltype(ss)>;
+
+        // A CSR matrix is seen by rows, unless it is transposed
+        static constexpr bool row_view = compressed_type::row_compressed != Trans;
+
+        impl::standard::compressed_view<value_type, typename compressed_type::index_type> view{
+            ss.values(), ss.inner_index(), ss.outer_index(), compressed_type::row_compressed ? etl::dim<0>(ss) : etl::dim<1>(ss)};
+
+        if constexpr (sparse_left) {
+            if constexpr (is_1d<B>) {
+                inc_counter("impl:std");
+
+                if constexpr (row_view) {
+                    impl::standard::csr_mv(view, dd.memory_start(), c);
+                } else {
+                    impl::standard::csc_mv(view, dd.memory_start(), c, m);
+                }
+            } else if constexpr (impl::vec::spmm_possible<vector_mode, value_type>) {
+                inc_counter("impl:vec");
+
+                if constexpr (row_view) {
+                    impl::vec::csr_mm(view, dd.memory_start(), c, n);
+                } else {
+                    impl::vec::csc_mm(view, dd.memory_start(), c, m, n);
+                }
+            } else {
+                inc_counter("impl:std");
+
+                if constexpr (row_view) {
+                    impl::standard::csr_mm(view, dd.memory_start(), c, n);
+                } else {
+                    impl::standard::csc_mm(view, dd.memory_start(), c, m, n);
+                }
+            }
+        } else {
+            inc_counter("impl:std");
+
+            if constexpr (row_view) {
+                impl::standard::dense_csr_mm(dd.memory_start(), view, c, m, n);
+            } else {
+                impl::standard::dense_csc_mm(dd.memory_start(), view, c, m, k);
+            }
+        }
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, B, C>, "sparse multiplication only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        auto& a = this->a();
+        auto& b = this->b();
+
+        check(a, b, c);
+
+        standard_evaluator::pre_assign_rhs(dense_operand(a, b));
+
+        if constexpr (is_dma<C> && is_row_major<C> && std::is_same_v<value_t<C>, value_type>) {
+            apply_raw(a, b, c.memory_start());
+
+            c.validate_cpu();
+            c.invalidate_gpu();
+        } else {
+            // The kernels always compute a row-major result
+            dyn_matrix<value_type, decay_traits<C>::dimensions()> tmp;
+
+            if constexpr (decay_traits<C>::dimensions() == 1) {
+                tmp.resize(etl::dim<0>(c));
+            } else {
+                tmp.resize(etl::dim<0>(c), etl::dim<1>(c));
+            }
+
+            apply_raw(a, b, tmp.memory_start());
+
+            c = tmp;
+        }
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const sparse_mul_expr& expr) {
+        if constexpr (Trans && sparse_left) {
+            return os << "trans(" << expr._a << ") * " << expr._b;
+        } else if constexpr (Trans) {
+            return os << expr._a << " * trans(" << expr._b << ")";
+        } else {
+            return os << expr._a << " * " << expr._b;
+        }
+    }
+};
+
+/*!
+ * \brief Traits for a sparse product expression
+ * \tparam A The left hand side type
+ * \tparam B The right hand side type
+ * \tparam Trans Indicates if the sparse matrix is transposed
+ */
+template <typename A, typename B, bool Trans>
+struct etl_traits<etl::sparse_mul_expr<A, B, Trans>> {
+    using expr_t       = etl::sparse_mul_expr<A, B, Trans>; ///< The expression type
+    using left_expr_t  = std::decay_t<A>;                   ///< The left sub expression type
+    using right_expr_t = std::decay_t<B>;                   ///< The right sub expression type
+    using value_type   = value_t<A>;                        ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;            ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;           ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;           ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;           ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = false;           ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;           ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;            ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;           ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;            ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;           ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;           ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;            ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;            ///< Indicates if the expression needs a evaluator visitor
+    static constexpr order storage_order = order::RowMajor; ///< The expression's storage order
+    static constexpr bool gpu_computable = false;           ///< Indicates if the expression can be computed on GPU
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        if (is_1d<A>) {
+            return expr_t::right_columns(e._b);
+        } else if (is_1d<B> || d == 0) {
+            return expr_t::left_rows(e._a);
+        } else {
+            return expr_t::right_columns(e._b);
+        }
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return expr_t::left_rows(e._a) * expr_t::right_columns(e._b);
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return is_1d<A> || is_1d<B> ? 1 : 2;
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+} //end of namespace etl
@@ -0,0 +1,376 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+namespace etl {
+
+/*!
+ * \brief A Short-Time Fourier Transform expression.
+ *
+ * The frames are read directly from the signal, with no copy of
+ * the overlapping regions, and windowed inside the transform.
+ *
+ * \tparam A The signal type
+ * \tparam W The window type
+ * \tparam T The value type of the result
+ * \tparam Mode The output of the transform
+ */
+template <typename A, typename W, typename T, stft_mode Mode>
+struct stft_expr : base_temporary_expr_bin<stft_expr<A, W, T, Mode>, A, W, false> {
+    using value_type  = T;                                                ///< The type of value of the expression
+    using this_type   = stft_expr<A, W, T, Mode>;                         ///< The type of this expression
+    using base_type   = base_temporary_expr_bin<this_type, A, W, false>; ///< The base type
+    using left_traits = decay_traits<A>;                                  ///< The traits of the sub type
+
+    static constexpr auto storage_order = order::RowMajor; ///< The sub storage order
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    const size_t hop; ///< The number of samples between two frames
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The signal
+     * \param w The window
+     * \param hop The number of samples between two frames
+     */
+    explicit stft_expr(A a, W w, size_t hop) : base_type(a, w), hop(hop) {
+        //Nothing else to init
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, W, C>, "stft only supported for ETL expressions");
+        static_assert(etl::dimensions<A>() == 1 && etl::dimensions<W>() == 1, "stft must be applied on vectors");
+        static_assert(etl::dimensions<C>() == 2, "stft must be assigned to a matrix");
+
+        cpp_assert(etl::size(this->b()) <= etl::size(this->a()), "The frame of stft cannot be larger than the signal");
+        cpp_assert(etl::dim<0>(c) == (etl::size(this->a()) - etl::size(this->b())) / hop + 1, "Invalid number of frames for stft");
+        cpp_assert(etl::dim<1>(c) == etl::size(this->b()) / 2 + 1, "Invalid number of bins for stft");
+
+        inc_counter("temp:assign");
+
+        detail::stft_impl<Mode>::apply(this->a(), this->b(), c, hop);
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const stft_expr& expr) {
+        return os << "stft(" << expr._a << ", " << expr._b << ")";
+    }
+};
+
+/*!
+ * \brief Traits for a STFT expression
+ * \tparam A The signal type
+ * \tparam W The window type
+ */
+template <typename A, typename W, typename T, stft_mode Mode>
+struct etl_traits<etl::stft_expr<A, W, T, Mode>> {
+    using expr_t       = etl::stft_expr<A, W, T, Mode>; ///< The expression type
+    using left_expr_t  = std::decay_t<A>;               ///< The left sub expression type
+    using right_expr_t = std::decay_t<W>;               ///< The right sub expression type
+    using left_traits  = etl_traits<left_expr_t>;       ///< The left sub traits
+    using right_traits = etl_traits<right_expr_t>;      ///< The right sub traits
+    using value_type   = T;                             ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;            ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;           ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;           ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;           ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = false;           ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;           ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;            ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;           ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;            ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;           ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;           ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;            ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;            ///< Indicates if the expression needs a evaluator visitor
+    static constexpr bool gpu_computable = false;           ///< Indicates if the expression can be computed on GPU
+    static constexpr order storage_order = order::RowMajor; ///< The expression's storage order
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        if (d == 0) {
+            return (etl::size(e._a) - etl::size(e._b)) / e.hop + 1;
+        } else {
+            return etl::size(e._b) / 2 + 1;
+        }
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return dim(e, 0) * dim(e, 1);
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return 2;
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+/*!
+ * \brief Creates an expression representing the Short-Time Fourier Transform of a real signal
+ *
+ * The result is a matrix of complex values with one row per frame
+ * and frame / 2 + 1 columns (the non-redundant bins of each frame).
+ *
+ * \param signal The input signal
+ * \param window The window to apply to each frame, of size frame
+ * \param frame The number of samples of each frame
+ * \param hop The number of samples between two frames
+ * \return an expression representing the STFT of the signal
+ */
+template <typename A, typename W>
+stft_expr<detail::build_type<A>, detail::build_type<W>, std::complex<value_t<A>>, stft_mode::COMPLEX> stft(A&& signal, W&& window, [[maybe_unused]] size_t frame, size_t hop) {
+    static_assert(all_etl_expr<A, W>, "stft only supported for ETL expressions");
+    static_assert(!is_complex<A>, "stft is only supported for real signals");
+    cpp_assert(etl::size(window) == frame, "The window of stft must be of the size of a frame");
+    cpp_assert(hop > 0, "The hop of stft must be strictly positive");
+
+    return stft_expr<detail::build_type<A>, detail::build_type<W>, std::complex<value_t<A>>, stft_mode::COMPLEX>{signal, window, hop};
+}
+
+/*!
+ * \brief Creates an expression representing the magnitude of the Short-Time Fourier Transform of a real signal
+ * \param signal The input signal
+ * \param window The window to apply to each frame, of size frame
+ * \param frame The number of samples of each frame
+ * \param hop The number of samples between two frames
+ * \return an expression representing the magnitude of the STFT of the signal
+ */
+template <typename A, typename W>
+stft_expr<detail::build_type<A>, detail::build_type<W>, value_t<A>, stft_mode::MAGNITUDE> stft_magnitude(A&& signal, W&& window, [[maybe_unused]] size_t frame, size_t hop) {
+    static_assert(all_etl_expr<A, W>, "stft only supported for ETL expressions");
+    static_assert(!is_complex<A>, "stft is only supported for real signals");
+    cpp_assert(etl::size(window) == frame, "The window of stft must be of the size of a frame");
+    cpp_assert(hop > 0, "The hop of stft must be strictly positive");
+
+    return stft_expr<detail::build_type<A>, detail::build_type<W>, value_t<A>, stft_mode::MAGNITUDE>{signal, window, hop};
+}
+
+/*!
+ * \brief Creates an expression representing the power spectrogram of a real signal
+ * \param signal The input signal
+ * \param window The window to apply to each frame, of size frame
+ * \param frame The number of samples of each frame
+ * \param hop The number of samples between two frames
+ * \return an expression representing the squared magnitude of the STFT of the signal
+ */
+template <typename A, typename W>
+stft_expr<detail::build_type<A>, detail::build_type<W>, value_t<A>, stft_mode::POWER> stft_power(A&& signal, W&& window, [[maybe_unused]] size_t frame, size_t hop) {
+    static_assert(all_etl_expr<A, W>, "stft only supported for ETL expressions");
+    static_assert(!is_complex<A>, "stft is only supported for real signals");
+    cpp_assert(etl::size(window) == frame, "The window of stft must be of the size of a frame");
+    cpp_assert(hop > 0, "The hop of stft must be strictly positive");
+
+    return stft_expr<detail::build_type<A>, detail::build_type<W>, value_t<A>, stft_mode::POWER>{signal, window, hop};
+}
+
+/*!
+ * \brief Incremental Short-Time Fourier Transform of a real signal.
+ *
+ * The signal is pushed in chunks of any size, as they arrive, and
+ * the spectra of the complete frames can be popped in batches. Only
+ * the samples that are still needed by the next frames are kept.
+ *
+ * \tparam T The value type of the signal
+ * \tparam Mode The output of the transform
+ */
+template <typename T, stft_mode Mode = stft_mode::POWER>
+struct stft_stream {
+    using value_type  = T;                                                                       ///< The value type of the signal
+    using output_type = std::conditional_t<Mode == stft_mode::COMPLEX, std::complex<T>, T>; ///< The value type of the spectra
+
+    /*!
+     * \brief Construct a new stream
+     * \param window The window to apply to each frame, its size is the size of a frame
+     * \param hop The number of samples between two frames
+     */
+    template <typename W>
+    stft_stream(const W& window, size_t hop) : _window(etl::size(window)), _hop(hop) {
+        static_assert(is_etl_expr<W>, "stft_stream only supported for ETL expressions");
+        cpp_assert(hop > 0, "The hop of stft must be strictly positive");
+
+        _window = window;
+    }
+
+    /*!
+     * \brief Returns the number of samples of a frame
+     */
+    size_t frame() const {
+        return etl::size(_window);
+    }
+
+    /*!
+     * \brief Returns the number of bins of each spectrum
+     */
+    size_t bins() const {
+        return frame() / 2 + 1;
+    }
+
+    /*!
+     * \brief Returns the number of complete frames that are ready to be popped
+     */
+    size_t frames() const {
+        return _buffer.size() < frame() ? 0 : (_buffer.size() - frame()) / _hop + 1;
+    }
+
+    /*!
+     * \brief Append a chunk of the signal
+     * \param chunk The samples to append
+     */
+    template <typename E>
+    void push(const E& chunk) {
+        static_assert(is_etl_expr<E>, "stft_stream only supported for ETL expressions");
+
+        const size_t n = etl::size(chunk);
+        const size_t s = _buffer.size();
+
+        _buffer.resize(s + n);
+
+        for (size_t i = 0; i < n; ++i) {
+            _buffer[s + i] = chunk[i];
+        }
+    }
+
+    /*!
+     * \brief Compute the spectra of the complete frames
+     *
+     * At most dim<0>(out) frames are computed, the remaining frames
+     * stay available for the next calls.
+     *
+     * \param out The output matrix, one row per frame
+     * \return The number of frames that have been written to out
+     */
+    template <typename C>
+    size_t pop(C&& out) {
+        static_assert(is_dma<C> && etl::dimensions<C>() == 2, "stft_stream can only pop to 2D matrices");
+        static_assert(std::is_same_v<value_t<C>, output_type>, "Invalid output type for stft_stream");
+        cpp_assert(etl::dim<1>(out) == bins(), "Invalid number of bins for stft_stream");
+
+        const size_t n = std::min(frames(), etl::dim<0>(out));
+
+        if (n) {
+            _window.ensure_cpu_up_to_date();
+
+            impl::standard::detail::stft_kernel<Mode>(_buffer.data(), _window.memory_start(), out.memory_start(), n, frame(), _hop);
+
+            out.validate_cpu();
+            out.invalidate_gpu();
+
+            _buffer.erase(_buffer.begin(), _buffer.begin() + n * _hop);
+        }
+
+        return n;
+    }
+
+    /*!
+     * \brief Drop all the pending samples
+     */
+    void reset() {
+        _buffer.clear();
+    }
+
+private:
+    dyn_vector<T> _window;  ///< The window
+    std::vector<T> _buffer; ///< The pending samples
+    const size_t _hop;      ///< The number of samples between two frames
+};
+
+} //end of namespace etl
@@ -0,0 +1,387 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Products between a diagonal or triangular adapter and a dense
+ * matrix.
+ *
+ * The diagonal products are computed as a scaling of the rows or of the
+ * columns of the dense matrix and the triangular products (TRMM) skip the
+ * zero half of the triangular matrix. The products from the right are
+ * computed from the left on the transposed matrices.
+ */
+
+#pragma once
+
+#include "etl/expr/base_temporary_expr.hpp"
+
+//The implementations
+#include "etl/impl/trmm.hpp"
+
+namespace etl {
+
+/*!
+ * \brief An expression representing the product of a diagonal or triangular
+ * matrix and a dense matrix, in either order.
+ *
+ * At least one of A and B is a structured matrix, if both are, the structure
+ * of A is used.
+ *
+ * \tparam A The left hand side type
+ * \tparam B The right hand side type
+ * \tparam Trans Indicates if the structured matrix is transposed
+ */
+template <typename A, typename B, bool Trans>
+struct structured_mul_expr : base_temporary_expr_bin<structured_mul_expr<A, B, Trans>, A, B> {
+    using value_type   = value_t<A>;                               ///< The type of value of the expression
+    using this_type    = structured_mul_expr<A, B, Trans>;         ///< The type of this expression
+    using base_type    = base_temporary_expr_bin<this_type, A, B>; ///< The base type
+    using left_traits  = decay_traits<A>;                          ///< The traits of the left hand side
+    using right_traits = decay_traits<B>;                          ///< The traits of the right hand side
+
+    static constexpr auto storage_order = order::RowMajor; ///< The storage order
+
+    static constexpr bool structured_left = is_structured_matrix<A>; ///< Indicates if the structured matrix is the left hand side
+
+    static_assert(structured_left || is_structured_matrix<B>, "structured_mul_expr needs a structured matrix");
+
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Construct a new expression
+     * \param a The left hand side
+     * \param b The right hand side
+     */
+    explicit structured_mul_expr(A a, B b) : base_type(a, b) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Assert for the validity of the product
+     * \param a The left side
+     * \param b The right side
+     * \param c The result
+     */
+    template <typename C>
+    static void check([[maybe_unused]] const A& a, [[maybe_unused]] const B& b, [[maybe_unused]] const C& c) {
+        static_assert(all_2d<A, B, C>, "Invalid dimensions for the result of the structured product");
+
+        // The structured matrix is square, its transposition has the same dimensions
+
+        if constexpr (all_fast<A, B, C>) {
+            static_assert(dim<1, A>() == dim<0, B>()         //interior dimensions
+                              && dim<0, A>() == dim<0, C>()  //exterior dimension 1
+                              && dim<1, B>() == dim<1, C>(), //exterior dimension 2
+                          "Invalid sizes for multiplication");
+        } else {
+            cpp_assert(dim<1>(a) == dim<0>(b)         //interior dimensions
+                           && dim<0>(a) == dim<0>(c)  //exterior dimension 1
+                           && dim<1>(b) == dim<1>(c), //exterior dimension 2
+                       "Invalid sizes for multiplication");
+        }
+    }
+
+    /*!
+     * \brief Returns the operand as a row-major direct expression of the
+     * value type, making a copy only if necessary.
+     * \param e The operand
+     */
+    template <typename E>
+    static decltype(auto) row_major_operand(const E& e) {
+        if constexpr (is_dma<E> && is_row_major<E> && std::is_same_v<value_t<E>, value_type>) {
+            e.ensure_cpu_up_to_date();
+            return (e);
+        } else {
+            dyn_matrix<value_type, 2> mat(etl::dim<0>(e), etl::dim<1>(e));
+            mat = e;
+            return mat;
+        }
+    }
+
+    /*!
+     * \brief Returns the structured operand
+     * \param a The left hand side
+     * \param b The right hand side
+     */
+    static const auto& structured_operand(const A& a, const B& b) {
+        if constexpr (structured_left) {
+            return a;
+        } else {
+            return b;
+        }
+    }
+
+    /*!
+     * \brief Returns the dense operand
+     * \param a The left hand side
+     * \param b The right hand side
+     */
+    static const auto& dense_operand(const A& a, const B& b) {
+        if constexpr (structured_left) {
+            return b;
+        } else {
+            return a;
+        }
+    }
+
+    /*!
+     * \brief Compute the product into the given row-major memory
+     * \param a The left hand side
+     * \param b The right hand side
+     * \param c The memory of the result
+     */
+    static void apply_raw(const A& a, const B& b, value_type* c) {
+        using structured_type = std::decay_t<decltype(structured_operand(a, b))>;
+
+        decltype(auto) ss = row_major_operand(structured_operand(a, b));
+        decltype(auto) dd = row_major_operand(dense_operand(a, b));
+
+        const size_t n = etl::dim<0>(ss);
+        const size_t m = structured_left ? etl::dim<1>(dd) : etl::dim<0>(dd);
+
+        if constexpr (is_diagonal_matrix<structured_type>) {
+            // A diagonal matrix is its own transposition
+            dyn_vector<value_type> diagonal(n);
+
+            for (size_t i = 0; i < n; ++i) {
+                diagonal[i] = ss.memory_start()[i * n + i];
+            }
+
+            if constexpr (structured_left) {
+                detail::diag_scale_left(diagonal.memory_start(), dd.memory_start(), c, n, m);
+            } else {
+                detail::diag_scale_right(dd.memory_start(), diagonal.memory_start(), c, m, n);
+            }
+        } else {
+            // The products are computed from the left, C = op(S) * D or C^T = op(S)^T * D^T,
+            // the kernels read the transposition of S directly from its memory
+            static constexpr bool transposed = structured_left == Trans;
+            static constexpr bool lower      = (is_lower_adapter<structured_type> || is_strictly_lower_matrix<structured_type>) != transposed;
+
+            auto multiply = [&](const value_type* x, value_type* y) {
+                if constexpr (lower) {
+                    detail::trmm_lower<transposed>(ss.memory_start(), x, y, n, m);
+                } else {
+                    detail::trmm_upper<transposed>(ss.memory_start(), x, y, n, m);
+                }
+            };
+
+            if constexpr (structured_left) {
+                multiply(dd.memory_start(), c);
+            } else {
+                dyn_matrix<value_type, 2> dt(n, m);
+                dyn_matrix<value_type, 2> ct(n, m);
+
+                dt = transpose(dd);
+
+                multiply(dt.memory_start(), ct.memory_start());
+
+                etl::custom_dyn_matrix<value_type> result(c, m, n);
+
+                result = transpose(ct);
+            }
+        }
+    }
+
+    // Assignment functions
+
+    /*!
+     * \brief Assign to a matrix
+     * \param c The expression to which assign
+     */
+    template <typename C>
+    void assign_to(C&& c) const {
+        static_assert(all_etl_expr<A, B, C>, "structured multiplication only supported for ETL expressions");
+
+        inc_counter("temp:assign");
+
+        auto& a = this->a();
+        auto& b = this->b();
+
+        check(a, b, c);
+
+        standard_evaluator::pre_assign_rhs(dense_operand(a, b));
+
+        if constexpr (is_dma<C> && is_row_major<C> && std::is_same_v<value_t<C>, value_type> && !is_adapter<C>) {
+            apply_raw(a, b, c.memory_start());
+
+            c.validate_cpu();
+            c.invalidate_gpu();
+        } else {
+            // The kernels always compute a row-major result
+            dyn_matrix<value_type, 2> tmp(etl::dim<0>(c), etl::dim<1>(c));
+
+            apply_raw(a, b, tmp.memory_start());
+
+            c = tmp;
+        }
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Sub from the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Multiply the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Divide the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Modulo the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Print a representation of the expression on the given stream
+     * \param os The output stream
+     * \param expr The expression to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const structured_mul_expr& expr) {
+        if constexpr (Trans && structured_left) {
+            return os << "trans(" << expr._a << ") * " << expr._b;
+        } else if constexpr (Trans) {
+            return os << expr._a << " * trans(" << expr._b << ")";
+        } else {
+            return os << expr._a << " * " << expr._b;
+        }
+    }
+};
+
+/*!
+ * \brief Traits for a structured product expression
+ * \tparam A The left hand side type
+ * \tparam B The right hand side type
+ * \tparam Trans Indicates if the structured matrix is transposed
+ */
+template <typename A, typename B, bool Trans>
+struct etl_traits<etl::structured_mul_expr<A, B, Trans>> {
+    using expr_t       = etl::structured_mul_expr<A, B, Trans>; ///< The expression type
+    using left_expr_t  = std::decay_t<A>;                       ///< The left sub expression type
+    using right_expr_t = std::decay_t<B>;                       ///< The right sub expression type
+    using left_traits  = etl_traits<left_expr_t>;               ///< The left sub traits
+    using right_traits = etl_traits<right_expr_t>;              ///< The right sub traits
+    using value_type   = value_t<A>;                            ///< The value type of the expression
+
+    static constexpr bool is_etl         = true;                                          ///< Indicates if the type is an ETL expression
+    static constexpr bool is_transformer = false;                                         ///< Indicates if the type is a transformer
+    static constexpr bool is_view        = false;                                         ///< Indicates if the type is a view
+    static constexpr bool is_magic_view  = false;                                         ///< Indicates if the type is a magic view
+    static constexpr bool is_fast        = left_traits::is_fast && right_traits::is_fast; ///< Indicates if the expression is fast
+    static constexpr bool is_linear      = false;                                         ///< Indicates if the expression is linear
+    static constexpr bool is_thread_safe = true;                                          ///< Indicates if the expression is thread safe
+    static constexpr bool is_value       = false;                                         ///< Indicates if the expression is of value type
+    static constexpr bool is_direct      = true;                                          ///< Indicates if the expression has direct memory access
+    static constexpr bool is_generator   = false;                                         ///< Indicates if the expression is a generator
+    static constexpr bool is_padded      = false;                                         ///< Indicates if the expression is padded
+    static constexpr bool is_aligned     = true;                                          ///< Indicates if the expression is padded
+    static constexpr bool is_temporary   = true;                                          ///< Indicates if the expression needs a evaluator visitor
+    static constexpr order storage_order = order::RowMajor;                               ///< The expression's storage order
+    static constexpr bool gpu_computable = false;                                         ///< Indicates if the expression can be computed on GPU
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = true;
+
+    /*!
+     * \brief Returns the DDth dimension of the expression
+     * \return the DDth dimension of the expression
+     */
+    template <size_t DD>
+    static constexpr size_t dim() {
+        return DD == 0 ? left_traits::template dim<0>() : right_traits::template dim<1>();
+    }
+
+    /*!
+     * \brief Returns the dth dimension of the expression
+     * \param e The sub expression
+     * \param d The dimension to get
+     * \return the dth dimension of the expression
+     */
+    static size_t dim(const expr_t& e, size_t d) {
+        if (d == 0) {
+            return etl::dim(e._a, 0);
+        } else {
+            return etl::dim(e._b, 1);
+        }
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \param e The sub expression
+     * \return the size of the expression
+     */
+    static size_t size(const expr_t& e) {
+        return etl::dim(e._a, 0) * etl::dim(e._b, 1);
+    }
+
+    /*!
+     * \brief Returns the size of the expression
+     * \return the size of the expression
+     */
+    static constexpr size_t size() {
+        return left_traits::template dim<0>() * right_traits::template dim<1>();
+    }
+
+    /*!
+     * \brief Returns the number of dimensions of the expression
+     * \return the number of dimensions of the expression
+     */
+    static constexpr size_t dimensions() {
+        return 2;
+    }
+
+    /*!
+     * \brief Estimate the complexity of computation
+     * \return An estimation of the complexity of the expression
+     */
+    static constexpr int complexity() noexcept {
+        return -1;
+    }
+};
+
+} //end of namespace etl
@@ -252,7 +252,12 @@ public:
      */
     template <typename L>
     void assign_to(L&& lhs) const {
-        std_assign_evaluate(*this, lhs);
+        if constexpr (is_sparse_structural<this_type> && is_dma<L> && decay_traits<L>::dimensions() == 2) {
+            // Only compute the non-zeros of the sparse operands
+            sparse_detail::structural_scatter(*this, lhs);
+        } else {
+            std_assign_evaluate(*this, lhs);
+        }
     }
 
     /*!
@@ -328,6 +333,14 @@ public:
         value.ensure_gpu_up_to_date();
     }
 
+    /*!
+     * \brief Returns a reference to the sub expression
+     * \return a reference to the sub expression
+     */
+    const Expr& get_value() const {
+        return value;
+    }
+
     /*!
      * \brief Prints the type of the unary expression to the stream
      * \param os The output stream
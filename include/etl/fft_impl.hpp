@@ -7,7 +7,7 @@
 
 /*!
  * \file
- * \brief Enumeration for the fft implementations
+ * \brief Enumeration for the fft implementations and the STFT output modes
  */
 
 #pragma once
@@ -23,4 +23,13 @@ enum class fft_impl {
     CUFFT ///< The NVidia CuFFT implementation
 };
 
+/*!
+ * \brief The different outputs of a Short-Time Fourier Transform
+ */
+enum class stft_mode {
+    COMPLEX,   ///< The complex spectrum of each frame
+    MAGNITUDE, ///< The magnitude of the spectrum of each frame
+    POWER      ///< The power (squared magnitude) of the spectrum of each frame
+};
+
 } //end of namespace etl
@@ -0,0 +1,445 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief 16-bit floating point storage types (bfloat16 and half)
+ *
+ * These types are only storage types: they implicitly convert to float, all
+ * the operations are done in single precision and rounded back (to nearest
+ * even) to 16 bits. The conversions
+ * of whole arrays to and from float are vectorized when possible and are
+ * used by the evaluator when assigning between matrices of different types.
+ */
+
+#pragma once
+
+#include <bit>
+
+#if defined(__SSE4_1__) || defined(__AVX2__) || defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Compound assignment operators of the 16-bit floating point types,
+ * computed in single precision.
+ *
+ * The other operators are the ones of float, through the implicit conversion.
+ *
+ * \tparam D The 16-bit floating point type
+ */
+template <typename D>
+struct float16_operators {
+    /*!
+     * \brief Add rhs to this value
+     * \param rhs The value to add
+     * \return a reference to this value
+     */
+    D& operator+=(float rhs) noexcept {
+        return as_derived() = D(float(as_derived()) + rhs);
+    }
+
+    /*!
+     * \brief Subtract rhs from this value
+     * \param rhs The value to subtract
+     * \return a reference to this value
+     */
+    D& operator-=(float rhs) noexcept {
+        return as_derived() = D(float(as_derived()) - rhs);
+    }
+
+    /*!
+     * \brief Multiply this value by rhs
+     * \param rhs The value to multiply by
+     * \return a reference to this value
+     */
+    D& operator*=(float rhs) noexcept {
+        return as_derived() = D(float(as_derived()) * rhs);
+    }
+
+    /*!
+     * \brief Divide this value by rhs
+     * \param rhs The value to divide by
+     * \return a reference to this value
+     */
+    D& operator/=(float rhs) noexcept {
+        return as_derived() = D(float(as_derived()) / rhs);
+    }
+
+private:
+    D& as_derived() noexcept {
+        return *static_cast<D*>(this);
+    }
+};
+
+} //end of namespace detail
+
+/*!
+ * \brief bfloat16 floating point storage type.
+ *
+ * The bfloat16 format has the same exponent as float, with only 7 bits of
+ * mantissa. The conversion from float is a simple rounding of the lower bits
+ * of the float.
+ */
+struct bfloat16 : detail::float16_operators<bfloat16> {
+    uint16_t bits; ///< The raw bits of the value
+
+    /*!
+     * \brief Construct an uninitialized value (zero when value-initialized)
+     */
+    bfloat16() = default;
+
+    /*!
+     * \brief Construct a bfloat16 from any arithmetic value
+     * \param value The value to convert
+     */
+    template <typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 42>
+    bfloat16(T value) noexcept : bits(from_float(float(value))) {}
+
+    /*!
+     * \brief Convert the value to float
+     */
+    operator float() const noexcept {
+        return to_float(bits);
+    }
+
+    /*!
+     * \brief Create a bfloat16 from raw bits
+     * \param bits The raw bits
+     * \return the bfloat16 value
+     */
+    static bfloat16 from_bits(uint16_t bits) noexcept {
+        bfloat16 value;
+        value.bits = bits;
+        return value;
+    }
+
+    /*!
+     * \brief Convert a float to bfloat16 bits, rounding to nearest even
+     * \param f The float to convert
+     * \return The bfloat16 bits
+     */
+    static uint16_t from_float(float f) noexcept {
+        uint32_t u = std::bit_cast<uint32_t>(f);
+
+        // NaN must stay NaN, whatever the rounding
+        if ((u & 0x7FFFFFFFU) > 0x7F800000U) {
+            return uint16_t(((u >> 16) & 0x8000U) | 0x7FC0U);
+        }
+
+        u += 0x7FFFU + ((u >> 16) & 1U);
+
+        return uint16_t(u >> 16);
+    }
+
+    /*!
+     * \brief Convert bfloat16 bits to float
+     * \param h The bfloat16 bits
+     * \return The float value
+     */
+    static float to_float(uint16_t h) noexcept {
+        return std::bit_cast<float>(uint32_t(h) << 16);
+    }
+};
+
+/*!
+ * \brief IEEE-754 half precision (binary16) floating point storage type.
+ */
+struct half : detail::float16_operators<half> {
+    uint16_t bits; ///< The raw bits of the value
+
+    /*!
+     * \brief Construct an uninitialized value (zero when value-initialized)
+     */
+    half() = default;
+
+    /*!
+     * \brief Construct a half from any arithmetic value
+     * \param value The value to convert
+     */
+    template <typename T, std::enable_if_t<std::is_arithmetic_v<T>, int> = 42>
+    half(T value) noexcept : bits(from_float(float(value))) {}
+
+    /*!
+     * \brief Convert the value to float
+     */
+    operator float() const noexcept {
+        return to_float(bits);
+    }
+
+    /*!
+     * \brief Create a half from raw bits
+     * \param bits The raw bits
+     * \return the half value
+     */
+    static half from_bits(uint16_t bits) noexcept {
+        half value;
+        value.bits = bits;
+        return value;
+    }
+
+    /*!
+     * \brief Convert a float to half bits, rounding to nearest even
+     * \param f The float to convert
+     * \return The half bits
+     */
+    static uint16_t from_float(float f) noexcept {
+        constexpr uint32_t f32_infinity = 255U << 23;
+        constexpr uint32_t f16_max      = (127U + 16U) << 23;
+        constexpr uint32_t denorm_magic = ((127U - 15U) + (23U - 10U) + 1U) << 23;
+
+        uint32_t u          = std::bit_cast<uint32_t>(f);
+        const uint32_t sign = u & 0x80000000U;
+
+        u ^= sign;
+
+        uint16_t h;
+
+        if (u >= f16_max) {
+            // Overflow to infinity, NaN stay (quiet) NaN
+            h = u > f32_infinity ? 0x7E00U : 0x7C00U;
+        } else if (u < (113U << 23)) {
+            // Subnormal or zero, rounded by the float addition
+            const float r = std::bit_cast<float>(u) + std::bit_cast<float>(denorm_magic);
+            h             = uint16_t(std::bit_cast<uint32_t>(r) - denorm_magic);
+        } else {
+            const uint32_t mant_odd = (u >> 13) & 1U;
+
+            u += ((15U - 127U) << 23) + 0xFFFU + mant_odd;
+
+            h = uint16_t(u >> 13);
+        }
+
+        return uint16_t(h | (sign >> 16));
+    }
+
+    /*!
+     * \brief Convert half bits to float
+     * \param h The half bits
+     * \return The float value
+     */
+    static float to_float(uint16_t h) noexcept {
+        constexpr uint32_t shifted_exp = 0x7C00U << 13;
+
+        uint32_t u         = (uint32_t(h) & 0x7FFFU) << 13;
+        const uint32_t exp = shifted_exp & u;
+
+        u += (127U - 15U) << 23;
+
+        if (exp == shifted_exp) {
+            // Infinity or NaN
+            u += (128U - 16U) << 23;
+        } else if (exp == 0) {
+            // Zero or subnormal, renormalized by the float subtraction
+            u += 1U << 23;
+            u = std::bit_cast<uint32_t>(std::bit_cast<float>(u) - std::bit_cast<float>(113U << 23));
+        }
+
+        return std::bit_cast<float>(u | ((uint32_t(h) & 0x8000U) << 16));
+    }
+};
+
+static_assert(sizeof(bfloat16) == 2, "bfloat16 must be a 16-bit type");
+static_assert(sizeof(half) == 2, "half must be a 16-bit type");
+
+/*!
+ * \brief Traits to test if a type is bfloat16
+ */
+template <typename T>
+constexpr bool is_bfloat16_t = std::is_same_v<T, bfloat16>;
+
+/*!
+ * \brief Traits to test if a type is half
+ */
+template <typename T>
+constexpr bool is_half_t = std::is_same_v<T, half>;
+
+/*!
+ * \brief Traits to test if a type is a 16-bit floating point type
+ */
+template <typename T>
+constexpr bool is_float16_t = is_bfloat16_t<T> || is_half_t<T>;
+
+/*!
+ * \brief The type used to accumulate values of type T.
+ *
+ * 16-bit floating point values are accumulated in single precision.
+ */
+template <typename T>
+using accumulate_t = std::conditional_t<is_float16_t<T>, float, T>;
+
+namespace detail {
+
+/*!
+ * \brief Convert n bfloat16 values to float
+ * \param src The bfloat16 values
+ * \param dst The float output
+ * \param n The number of values
+ */
+inline void float16_convert(const bfloat16* src, float* dst, size_t n) {
+    size_t i = 0;
+
+#ifdef __AVX2__
+    for (; i + 7 < n; i += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16)));
+    }
+#elif defined(__SSE4_1__)
+    for (; i + 3 < n; i += 4) {
+        const __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_ps(dst + i, _mm_castsi128_ps(_mm_slli_epi32(_mm_cvtepu16_epi32(h), 16)));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        dst[i] = bfloat16::to_float(src[i].bits);
+    }
+}
+
+/*!
+ * \brief Convert n float values to bfloat16, rounding to nearest even
+ * \param src The float values
+ * \param dst The bfloat16 output
+ * \param n The number of values
+ */
+inline void float16_convert(const float* src, bfloat16* dst, size_t n) {
+    size_t i = 0;
+
+#ifdef __AVX2__
+    const __m256i one      = _mm256_set1_epi32(1);
+    const __m256i bias     = _mm256_set1_epi32(0x7FFF);
+    const __m256i qnan     = _mm256_set1_epi32(0x7FC0);
+
+    for (; i + 7 < n; i += 8) {
+        const __m256 f  = _mm256_loadu_ps(src + i);
+        const __m256i u = _mm256_castps_si256(f);
+
+        const __m256i lsb     = _mm256_and_si256(_mm256_srli_epi32(u, 16), one);
+        const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(u, _mm256_add_epi32(bias, lsb)), 16);
+
+        const __m256i nan_mask = _mm256_castps_si256(_mm256_cmp_ps(f, f, _CMP_UNORD_Q));
+        const __m256i nan      = _mm256_or_si256(qnan, _mm256_and_si256(_mm256_srli_epi32(u, 16), _mm256_set1_epi32(0x8000)));
+        const __m256i r        = _mm256_blendv_epi8(rounded, nan, nan_mask);
+
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0xD8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(packed));
+    }
+#elif defined(__SSE4_1__)
+    const __m128i one  = _mm_set1_epi32(1);
+    const __m128i bias = _mm_set1_epi32(0x7FFF);
+    const __m128i qnan = _mm_set1_epi32(0x7FC0);
+
+    for (; i + 3 < n; i += 4) {
+        const __m128 f  = _mm_loadu_ps(src + i);
+        const __m128i u = _mm_castps_si128(f);
+
+        const __m128i lsb     = _mm_and_si128(_mm_srli_epi32(u, 16), one);
+        const __m128i rounded = _mm_srli_epi32(_mm_add_epi32(u, _mm_add_epi32(bias, lsb)), 16);
+
+        const __m128i nan_mask = _mm_castps_si128(_mm_cmpunord_ps(f, f));
+        const __m128i nan      = _mm_or_si128(qnan, _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(0x8000)));
+        const __m128i r        = _mm_blendv_epi8(rounded, nan, nan_mask);
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi32(r, r));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        dst[i].bits = bfloat16::from_float(src[i]);
+    }
+}
+
+/*!
+ * \brief Convert n half values to float
+ * \param src The half values
+ * \param dst The float output
+ * \param n The number of values
+ */
+inline void float16_convert(const half* src, float* dst, size_t n) {
+    size_t i = 0;
+
+#if defined(__F16C__) && defined(__AVX__)
+    for (; i + 7 < n; i += 8) {
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        dst[i] = half::to_float(src[i].bits);
+    }
+}
+
+/*!
+ * \brief Convert n float values to half, rounding to nearest even
+ * \param src The float values
+ * \param dst The half output
+ * \param n The number of values
+ */
+inline void float16_convert(const float* src, half* dst, size_t n) {
+    size_t i = 0;
+
+#if defined(__F16C__) && defined(__AVX__)
+    for (; i + 7 < n; i += 8) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        dst[i].bits = half::from_float(src[i]);
+    }
+}
+
+} //end of namespace detail
+
+// The overloads of the memory copies used when assigning between matrices
+// of float and 16-bit floating point values
+
+/*!
+ * \brief Performs a direct memory copy, converting bfloat16 to float
+ * \param first pointer to the first element to copy
+ * \param last pointer to the next-to-last element to copy
+ * \param target pointer to the first element of the result
+ */
+inline void direct_copy(const bfloat16* first, const bfloat16* last, float* target) {
+    detail::float16_convert(first, target, size_t(last - first));
+}
+
+/*!
+ * \brief Performs a direct memory copy, converting float to bfloat16
+ * \param first pointer to the first element to copy
+ * \param last pointer to the next-to-last element to copy
+ * \param target pointer to the first element of the result
+ */
+inline void direct_copy(const float* first, const float* last, bfloat16* target) {
+    detail::float16_convert(first, target, size_t(last - first));
+}
+
+/*!
+ * \brief Performs a direct memory copy, converting half to float
+ * \param first pointer to the first element to copy
+ * \param last pointer to the next-to-last element to copy
+ * \param target pointer to the first element of the result
+ */
+inline void direct_copy(const half* first, const half* last, float* target) {
+    detail::float16_convert(first, target, size_t(last - first));
+}
+
+/*!
+ * \brief Performs a direct memory copy, converting float to half
+ * \param first pointer to the first element to copy
+ * \param last pointer to the next-to-last element to copy
+ * \param target pointer to the first element of the result
+ */
+inline void direct_copy(const float* first, const float* last, half* target) {
+    detail::float16_convert(first, target, size_t(last - first));
+}
+
+} //end of namespace etl
@@ -91,6 +91,10 @@ bool is_symmetric(E&& expr) {
     // symmetric_matrix<E> is already enforced to be symmetric
     if constexpr (is_symmetric_matrix<E>) {
         return true;
+    }
+    // diagonal_matrix<E> is already enforced to be symmetric
+    else if constexpr (is_diagonal_matrix<E>) {
+        return true;
     } else {
         if (is_square(expr)) {
             for (size_t i = 0; i < etl::dim<0>(expr) - 1; ++i) {
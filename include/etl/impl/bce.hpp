@@ -17,6 +17,7 @@
 
 //Include the implementations
 #include "etl/impl/std/bce.hpp"
+#include "etl/impl/vec/bce.hpp"
 #include "etl/impl/egblas/bce.hpp"
 
 namespace etl::detail {
@@ -33,6 +34,10 @@ constexpr etl::bce_impl select_bce_impl() {
         return etl::bce_impl::EGBLAS;
     }
 
+    if (impl::vec::bce_possible<vector_mode, O, L>) {
+        return etl::bce_impl::VEC;
+    }
+
     return etl::bce_impl::STD;
 }
 
@@ -48,6 +53,10 @@ constexpr etl::bce_impl select_bce_loss_impl() {
         return etl::bce_impl::EGBLAS;
     }
 
+    if (impl::vec::bce_loss_possible<vector_mode, O, L>) {
+        return etl::bce_impl::VEC;
+    }
+
     return etl::bce_impl::STD;
 }
 
@@ -63,6 +72,10 @@ constexpr etl::bce_impl select_bce_error_impl() {
         return etl::bce_impl::EGBLAS;
     }
 
+    if (impl::vec::bce_error_possible<vector_mode, O, L>) {
+        return etl::bce_impl::VEC;
+    }
+
     return etl::bce_impl::STD;
 }
 
@@ -82,6 +95,8 @@ struct bce_impl {
             etl::force(labels);
 
             return impl::standard::bce(output, labels, alpha, beta);
+        } else if constexpr (impl == etl::bce_impl::VEC) {
+            return impl::vec::bce(smart_forward(output), smart_forward(labels), alpha, beta);
         } else if constexpr (impl == etl::bce_impl::EGBLAS) {
             decltype(auto) output_gpu = smart_forward_gpu(output);
             decltype(auto) labels_gpu = smart_forward_gpu(labels);
@@ -112,6 +127,8 @@ struct bce_loss_impl {
             etl::force(labels);
 
             return impl::standard::bce_loss(output, labels, scale);
+        } else if constexpr (impl == etl::bce_impl::VEC) {
+            return impl::vec::bce_loss(smart_forward(output), smart_forward(labels), scale);
         } else if constexpr (impl == etl::bce_impl::EGBLAS) {
             decltype(auto) output_gpu = smart_forward_gpu(output);
             decltype(auto) labels_gpu = smart_forward_gpu(labels);
@@ -142,6 +159,8 @@ struct bce_error_impl {
             etl::force(labels);
 
             return impl::standard::bce_error(output, labels, scale);
+        } else if constexpr (impl == etl::bce_impl::VEC) {
+            return impl::vec::bce_error(smart_forward(output), smart_forward(labels), scale);
         } else if constexpr (impl == etl::bce_impl::EGBLAS) {
             decltype(auto) output_gpu = smart_forward_gpu(output);
             decltype(auto) labels_gpu = smart_forward_gpu(labels);
@@ -17,6 +17,7 @@
 
 //Include the implementations
 #include "etl/impl/std/cce.hpp"
+#include "etl/impl/vec/cce.hpp"
 #include "etl/impl/egblas/cce.hpp"
 
 namespace etl::detail {
@@ -33,6 +34,10 @@ constexpr etl::cce_impl select_cce_impl() {
         return etl::cce_impl::EGBLAS;
     }
 
+    if (impl::vec::cce_possible<vector_mode, O, L>) {
+        return etl::cce_impl::VEC;
+    }
+
     return etl::cce_impl::STD;
 }
 
@@ -48,6 +53,10 @@ constexpr etl::cce_impl select_cce_loss_impl() {
         return etl::cce_impl::EGBLAS;
     }
 
+    if (impl::vec::cce_loss_possible<vector_mode, O, L>) {
+        return etl::cce_impl::VEC;
+    }
+
     return etl::cce_impl::STD;
 }
 
@@ -63,6 +72,27 @@ constexpr etl::cce_impl select_cce_error_impl() {
         return etl::cce_impl::EGBLAS;
     }
 
+    if (impl::vec::cce_error_possible<vector_mode, O, L>) {
+        return etl::cce_impl::VEC;
+    }
+
+    return etl::cce_impl::STD;
+}
+
+/*!
+ * \brief Select the softmax cross entropy implementation for an expression of type E
+ *
+ * \tparam O The type of the logits expression
+ * \tparam L The type of the labels expression
+ * \tparam G The type of the gradients expression
+ * \return The implementation to use
+ */
+template <typename O, typename L, typename G>
+constexpr etl::cce_impl select_softmax_cross_entropy_impl() {
+    if (impl::vec::softmax_cross_entropy_possible<vector_mode, O, L, G>) {
+        return etl::cce_impl::VEC;
+    }
+
     return etl::cce_impl::STD;
 }
 
@@ -82,6 +112,8 @@ struct cce_impl {
             etl::force(labels);
 
             return impl::standard::cce(output, labels, alpha, beta);
+        } else if constexpr (impl == etl::cce_impl::VEC) {
+            return impl::vec::cce(smart_forward(output), smart_forward(labels), alpha, beta);
         } else if constexpr (impl == etl::cce_impl::EGBLAS) {
             decltype(auto) output_gpu = smart_forward_gpu(output);
             decltype(auto) labels_gpu = smart_forward_gpu(labels);
@@ -112,6 +144,8 @@ struct cce_loss_impl {
             etl::force(labels);
 
             return impl::standard::cce_loss(output, labels, scale);
+        } else if constexpr (impl == etl::cce_impl::VEC) {
+            return impl::vec::cce_loss(smart_forward(output), smart_forward(labels), scale);
         } else if constexpr (impl == etl::cce_impl::EGBLAS) {
             decltype(auto) output_gpu = smart_forward_gpu(output);
             decltype(auto) labels_gpu = smart_forward_gpu(labels);
@@ -142,6 +176,8 @@ struct cce_error_impl {
             etl::force(labels);
 
             return impl::standard::cce_error(output, labels, scale);
+        } else if constexpr (impl == etl::cce_impl::VEC) {
+            return impl::vec::cce_error(smart_forward(output), smart_forward(labels), scale);
         } else if constexpr (impl == etl::cce_impl::EGBLAS) {
             decltype(auto) output_gpu = smart_forward_gpu(output);
             decltype(auto) labels_gpu = smart_forward_gpu(labels);
@@ -156,4 +192,28 @@ struct cce_error_impl {
     }
 };
 
+/*!
+ * \brief Fused softmax cross entropy implementation
+ */
+struct softmax_cross_entropy_impl {
+    /*!
+     * \brief Apply the functor to the logits and labels
+     */
+    template <typename O, typename L, typename G>
+    static value_t<O> apply(const O& logits, const L& labels, G&& gradients, value_t<O> scale) {
+        constexpr auto impl = select_softmax_cross_entropy_impl<O, L, G>();
+
+        if constexpr (impl == etl::cce_impl::STD) {
+            etl::force(logits);
+            etl::force(labels);
+
+            return impl::standard::softmax_cross_entropy(logits, labels, gradients, scale);
+        } else if constexpr (impl == etl::cce_impl::VEC) {
+            return impl::vec::softmax_cross_entropy(smart_forward(logits), smart_forward(labels), gradients, scale);
+        } else {
+            cpp_unreachable("Invalid selection for softmax cross entropy");
+        }
+    }
+};
+
 } //end of namespace etl::detail
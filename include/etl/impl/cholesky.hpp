@@ -0,0 +1,60 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the Cholesky decomposition kernels
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/cholesky.hpp"
+#include "etl/impl/vec/cholesky.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief Compute the Cholesky decomposition of a row-major symmetric
+ * positive definite matrix, in place.
+ *
+ * \param a The matrix to decompose in place [N, N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the matrix is positive definite, false otherwise
+ */
+template <typename T>
+bool cholesky_factor(T* a, size_t n) {
+    if constexpr (impl::vec::cholesky_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        return impl::vec::cholesky_factor(a, n);
+    } else {
+        inc_counter("impl:std");
+        return impl::standard::cholesky_factor(a, n);
+    }
+}
+
+/*!
+ * \brief Solve A * X = B from the Cholesky decomposition of A.
+ *
+ * \param l The Cholesky decomposition of A [N, N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ */
+template <typename T>
+void cholesky_solve(const T* l, T* b, size_t n, size_t m) {
+    if constexpr (impl::vec::cholesky_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::cholesky_solve(l, b, n, m);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::cholesky_solve(l, b, n, m);
+    }
+}
+
+} //end of namespace etl::detail
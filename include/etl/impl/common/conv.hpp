@@ -443,6 +443,29 @@ etl::dyn_matrix<value_t<I>, 4> pad_right_flip_multi(const I& input, size_t pad)
     return padded_input;
 }
 
+/*!
+ * \brief Return a new matrix equivalent to the input matrix with each of its
+ * 3D kernels flipped
+ * \param input The 5D matrix of kernels to flip
+ * \return a new matrix containing the result
+ */
+template <typename I, cpp_enable_iff(etl::dimensions<I>() == 5)>
+etl::dyn_matrix<value_t<I>, 5> flip_multi_3d(const I& input) {
+    using T = value_t<I>;
+
+    input.ensure_cpu_up_to_date();
+
+    etl::dyn_matrix<T, 5> flipped(etl::dim<0>(input), etl::dim<1>(input), etl::dim<2>(input), etl::dim<3>(input), etl::dim<4>(input));
+
+    const auto C = etl::dim<2>(input) * etl::dim<3>(input) * etl::dim<4>(input);
+
+    for (size_t i = 0; i < etl::dim<0>(input) * etl::dim<1>(input); ++i) {
+        std::reverse_copy(input.memory_start() + i * C, input.memory_start() + (i + 1) * C, flipped.memory_start() + i * C);
+    }
+
+    return flipped;
+}
+
 /*!
  * \brief Returns a matrix corresponding to the input with some amount of inner
  * padding.
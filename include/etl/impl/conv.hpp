@@ -24,6 +24,7 @@
 //Include the implementations
 #include "etl/impl/std/conv.hpp"
 #include "etl/impl/vec/conv.hpp"
+#include "etl/impl/vec/conv_winograd.hpp"
 #include "etl/impl/cudnn/conv.hpp"
 #include "etl/impl/egblas/conv_1d.hpp"
 
@@ -31,5 +32,6 @@
 
 // All the descriptors
 #include "etl/impl/conv_2d.hpp"
+#include "etl/impl/conv_3d.hpp"
 #include "etl/impl/conv_4d.hpp"
 #include "etl/impl/conv_multi.hpp"
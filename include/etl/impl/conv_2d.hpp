@@ -308,4 +308,58 @@ struct dyn_conv2_valid_flipped_impl {
     }
 };
 
+/*!
+ * \brief The functor impl for 2D valid dilated conv
+ */
+struct dyn_conv2_valid_dilated_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param d1 The dilation of the first dimension
+     * \param d2 The dilation of the second dimension
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+        auto impl = select_conv_impl<conv_type::VALID, I, K, C>();
+
+        // Only the vectorized and the standard implementations support dilation
+        if (impl == etl::conv_impl::VEC) {
+            inc_counter("impl:vec");
+            impl::vec::conv2_valid_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else {
+            inc_counter("impl:std");
+            impl::standard::conv2_valid_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 2D valid dilated conv (flipped kernel)
+ */
+struct dyn_conv2_valid_dilated_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param d1 The dilation of the first dimension
+     * \param d2 The dilation of the second dimension
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+        auto impl = select_conv_impl<conv_type::VALID, I, K, C>();
+
+        // Only the vectorized and the standard implementations support dilation
+        if (impl == etl::conv_impl::VEC) {
+            inc_counter("impl:vec");
+            impl::vec::conv2_valid_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else {
+            inc_counter("impl:std");
+            impl::standard::conv2_valid_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        }
+    }
+};
+
 } //end of namespace etl::detail
@@ -0,0 +1,221 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Contains descriptors for 3D and 5D (batched 3D) convolution operations
+ */
+
+namespace etl::detail {
+
+/*!
+ * \brief The functor impl for 3D valid conv
+ */
+struct dyn_conv3_valid_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+        auto impl = select_conv_impl<conv_type::VALID, I, K, C>();
+
+        // Only the vectorized and the standard implementations support 3D convolutions
+        if (impl == etl::conv_impl::VEC) {
+            inc_counter("impl:vec");
+            impl::vec::conv3_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else {
+            inc_counter("impl:std");
+            impl::standard::conv3_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 3D valid conv (flipped kernel)
+ */
+struct dyn_conv3_valid_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+        auto impl = select_conv_impl<conv_type::VALID, I, K, C>();
+
+        // Only the vectorized and the standard implementations support 3D convolutions
+        if (impl == etl::conv_impl::VEC) {
+            inc_counter("impl:vec");
+            impl::vec::conv3_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else {
+            inc_counter("impl:std");
+            impl::standard::conv3_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 5D valid conv
+ */
+struct dyn_conv5_valid_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+        auto impl = select_conv5_impl<I, K, C>(etl::dim<1>(input), etl::dim<2>(kernel) * etl::dim<3>(kernel) * etl::dim<4>(kernel));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv5_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv5_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv5_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 5D valid conv (flipped kernels)
+ */
+struct dyn_conv5_valid_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+        auto impl = select_conv5_impl<I, K, C>(etl::dim<1>(input), etl::dim<2>(kernel) * etl::dim<3>(kernel) * etl::dim<4>(kernel));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv5_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv5_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv5_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 5D valid conv backward
+ */
+struct dyn_conv5_valid_back_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+        auto impl = select_conv5_impl<I, K, C>(etl::dim<1>(input), etl::dim<2>(kernel) * etl::dim<3>(kernel) * etl::dim<4>(kernel));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv5_valid_back(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv5_valid_back(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv5_valid_back(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 5D valid conv backward (flipped kernels)
+ */
+struct dyn_conv5_valid_back_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+        auto impl = select_conv5_impl<I, K, C>(etl::dim<1>(input), etl::dim<2>(kernel) * etl::dim<3>(kernel) * etl::dim<4>(kernel));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv5_valid_back_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv5_valid_back_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv5_valid_back_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 5D valid conv filter gradients
+ */
+struct dyn_conv5_valid_filter_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+        auto impl = select_conv5_impl<I, K, C>(etl::dim<0>(input), etl::dim<2>(kernel) * etl::dim<3>(kernel) * etl::dim<4>(kernel));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv5_valid_filter(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv5_valid_filter(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv5_valid_filter(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 5D valid conv filter gradients (flipped kernels)
+ */
+struct dyn_conv5_valid_filter_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+        auto impl = select_conv5_impl<I, K, C>(etl::dim<0>(input), etl::dim<2>(kernel) * etl::dim<3>(kernel) * etl::dim<4>(kernel));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv5_valid_filter_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv5_valid_filter_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv5_valid_filter_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, s3, p1, p2, p3);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+} //end of namespace etl::detail
@@ -30,10 +30,12 @@ struct conv4_valid_impl {
             impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
         } else {
 #endif
-            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), S1, S2);
 
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_valid(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
                 impl::vec::blas_conv4_valid(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::BLAS_MKL) {
@@ -69,10 +71,12 @@ struct conv4_valid_flipped_impl {
             impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
         } else {
 #endif
-            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), S1, S2);
 
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, S1, S2, P1, P2);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
                 impl::vec::blas_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
             } else if (impl == etl::conv4_impl::BLAS_MKL) {
@@ -107,10 +111,12 @@ struct dyn_conv4_valid_impl {
             impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
         } else {
 #endif
-            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), s1, s2);
 
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_forward(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
                 impl::vec::blas_conv4_valid(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::BLAS_MKL) {
@@ -145,10 +151,12 @@ struct dyn_conv4_valid_flipped_impl {
             impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
         } else {
 #endif
-            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+            auto impl = select_conv4_valid_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel), s1, s2);
 
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_forward_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv, s1, s2, p1, p2);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::BLAS_VEC) {
                 impl::vec::blas_conv4_valid_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
             } else if (impl == etl::conv4_impl::BLAS_MKL) {
@@ -179,9 +187,12 @@ struct conv4_valid_filter_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv) {
-        auto impl = select_conv4_valid_filter_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+        auto impl = select_conv4_valid_filter_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel),
+                                                            etl::dim<2>(conv), etl::dim<3>(conv), S1, S2);
 
-        if (impl == etl::conv4_impl::BLAS_VEC) {
+        if (impl == etl::conv4_impl::WINOGRAD) {
+            impl::vec::winograd_conv4_valid_filter(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_filter(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
             impl::blas::blas_conv4_valid_filter(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
@@ -208,9 +219,12 @@ struct conv4_valid_filter_flipped_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv) {
-        auto impl = select_conv4_valid_filter_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+        auto impl = select_conv4_valid_filter_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel),
+                                                            etl::dim<2>(conv), etl::dim<3>(conv), S1, S2);
 
-        if (impl == etl::conv4_impl::BLAS_VEC) {
+        if (impl == etl::conv4_impl::WINOGRAD) {
+            impl::vec::winograd_conv4_valid_filter_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_filter_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
             impl::blas::blas_conv4_valid_filter_flipped(smart_forward(input), smart_forward(kernel), conv, S1, S2, P1, P2);
@@ -236,9 +250,12 @@ struct dyn_conv4_valid_filter_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-        auto impl = select_conv4_valid_filter_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+        auto impl = select_conv4_valid_filter_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel),
+                                                            etl::dim<2>(conv), etl::dim<3>(conv), s1, s2);
 
-        if (impl == etl::conv4_impl::BLAS_VEC) {
+        if (impl == etl::conv4_impl::WINOGRAD) {
+            impl::vec::winograd_conv4_valid_filter(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_filter(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
             impl::blas::blas_conv4_valid_filter(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
@@ -264,9 +281,12 @@ struct dyn_conv4_valid_filter_flipped_impl {
      */
     template <typename I, typename K, typename C>
     static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2) {
-        auto impl = select_conv4_valid_filter_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+        auto impl = select_conv4_valid_filter_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel),
+                                                            etl::dim<2>(conv), etl::dim<3>(conv), s1, s2);
 
-        if (impl == etl::conv4_impl::BLAS_VEC) {
+        if (impl == etl::conv4_impl::WINOGRAD) {
+            impl::vec::winograd_conv4_valid_filter_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
             impl::vec::blas_conv4_valid_filter_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
         } else if (impl == etl::conv4_impl::BLAS_MKL) {
             impl::blas::blas_conv4_valid_filter_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2);
@@ -415,6 +435,8 @@ struct conv4_full_impl {
 
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_backward_data_full(smart_forward_gpu(input), smart_forward_gpu(kernel), conv);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_full(smart_forward(input), smart_forward(kernel), conv);
             } else if (impl == etl::conv4_impl::VEC) {
                 impl::vec::conv4_full(smart_forward(input), smart_forward(kernel), conv);
             } else if (impl == etl::conv4_impl::FFT_STD) {
@@ -455,6 +477,8 @@ struct conv4_full_flipped_impl {
 
             if (impl == etl::conv4_impl::CUDNN) {
                 impl::cudnn::conv4_backward_data_full_flipped(smart_forward_gpu(input), smart_forward_gpu(kernel), conv);
+            } else if (impl == etl::conv4_impl::WINOGRAD) {
+                impl::vec::winograd_conv4_full_flipped(smart_forward(input), smart_forward(kernel), conv);
             } else if (impl == etl::conv4_impl::VEC) {
                 impl::vec::conv4_full_flipped(smart_forward(input), smart_forward(kernel), conv);
             } else if (impl == etl::conv4_impl::FFT_STD) {
@@ -474,4 +498,322 @@ struct conv4_full_flipped_impl {
     }
 };
 
+/*!
+ * \brief The functor impl for 4D valid grouped conv
+ */
+struct dyn_conv4_valid_grouped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param groups The number of groups
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+        auto impl = select_conv4_grouped_impl<I, K, C>();
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_grouped(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_grouped(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid grouped conv (flipped kernels)
+ */
+struct dyn_conv4_valid_grouped_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param groups The number of groups
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+        auto impl = select_conv4_grouped_impl<I, K, C>();
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_grouped_flipped(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_grouped_flipped(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid grouped conv backward
+ */
+struct dyn_conv4_valid_grouped_back_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param groups The number of groups
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+        auto impl = select_conv4_grouped_impl<I, K, C>();
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_grouped_back(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_grouped_back(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid grouped conv backward (flipped kernels)
+ */
+struct dyn_conv4_valid_grouped_back_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param groups The number of groups
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+        auto impl = select_conv4_grouped_impl<I, K, C>();
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_grouped_back_flipped(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_grouped_back_flipped(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid grouped conv filter gradients
+ */
+struct dyn_conv4_valid_grouped_filter_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param groups The number of groups
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+        auto impl = select_conv4_grouped_impl<I, K, C>();
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_grouped_filter(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_grouped_filter(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid grouped conv filter gradients (flipped kernels)
+ */
+struct dyn_conv4_valid_grouped_filter_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param groups The number of groups
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+        auto impl = select_conv4_grouped_impl<I, K, C>();
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_grouped_filter_flipped(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_grouped_filter_flipped(smart_forward(input), smart_forward(kernel), conv, groups, s1, s2, p1, p2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid dilated conv
+ */
+struct dyn_conv4_valid_dilated_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param d1 The dilation of the first dimension
+     * \param d2 The dilation of the second dimension
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+        auto impl = select_conv4_dilated_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv4_valid_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid dilated conv (flipped kernels)
+ */
+struct dyn_conv4_valid_dilated_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param d1 The dilation of the first dimension
+     * \param d2 The dilation of the second dimension
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+        auto impl = select_conv4_dilated_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv4_valid_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid dilated conv backward
+ */
+struct dyn_conv4_valid_back_dilated_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param d1 The dilation of the first dimension
+     * \param d2 The dilation of the second dimension
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+        auto impl = select_conv4_dilated_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_back_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv4_valid_back_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_back_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid dilated conv backward (flipped kernels)
+ */
+struct dyn_conv4_valid_back_dilated_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param d1 The dilation of the first dimension
+     * \param d2 The dilation of the second dimension
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+        auto impl = select_conv4_dilated_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(kernel), etl::dim<3>(kernel));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_back_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv4_valid_back_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_back_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid dilated conv filter gradients
+ */
+struct dyn_conv4_valid_filter_dilated_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param d1 The dilation of the first dimension
+     * \param d2 The dilation of the second dimension
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+        auto impl = select_conv4_dilated_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(conv), etl::dim<3>(conv));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_filter_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv4_valid_filter_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_filter_dilated(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
+/*!
+ * \brief The functor impl for 4D valid dilated conv filter gradients (flipped kernels)
+ */
+struct dyn_conv4_valid_filter_dilated_flipped_impl {
+    /*!
+     * \brief Apply the convolution
+     * \param input The input expression
+     * \param kernel The kernel expression
+     * \param conv The output expression
+     * \param d1 The dilation of the first dimension
+     * \param d2 The dilation of the second dimension
+     */
+    template <typename I, typename K, typename C>
+    static void apply(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+        auto impl = select_conv4_dilated_impl<I, K, C>(etl::dim<2>(input), etl::dim<3>(input), etl::dim<2>(conv), etl::dim<3>(conv));
+
+        if (impl == etl::conv4_impl::VEC) {
+            impl::vec::conv4_valid_filter_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::BLAS_VEC) {
+            impl::vec::blas_conv4_valid_filter_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else if (impl == etl::conv4_impl::STD) {
+            impl::standard::conv4_valid_filter_dilated_flipped(smart_forward(input), smart_forward(kernel), conv, s1, s2, p1, p2, d1, d2);
+        } else {
+            cpp_unreachable("Invalid conv implementation selection");
+        }
+    }
+};
+
 } //end of namespace etl::detail
@@ -14,6 +14,24 @@
 
 namespace etl::detail {
 
+/*!
+ * \brief Indicates if the Winograd implementation can be used for a 4D
+ * convolution with the given kernel dimensions and strides.
+ *
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \param k1 The first dimension of the kernel
+ * \param k2 The second dimension of the kernel
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \return true if the Winograd implementation can be used, false otherwise
+ */
+template <typename I, typename K, typename C>
+constexpr bool winograd_conv4_possible(size_t k1, size_t k2, size_t s1, size_t s2) {
+    return impl::vec::conv2_possible<vector_mode, I, K, C> && k1 == 3 && k2 == 3 && s1 == 1 && s2 == 1;
+}
+
 /*!
  * \brief Select the implementation of the 4D conv of I and K in C
  *
@@ -25,7 +43,7 @@ namespace etl::detail {
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-constexpr etl::conv4_impl select_default_conv4_valid_impl(bool no_gpu, size_t i1, size_t i2, size_t k1, size_t k2) {
+constexpr etl::conv4_impl select_default_conv4_valid_impl(bool no_gpu, size_t i1, size_t i2, size_t k1, size_t k2, size_t s1, size_t s2) {
     //Note: since the constexpr values will be known at compile time, the
     //conditions will be a lot simplified
 
@@ -42,6 +60,11 @@ constexpr etl::conv4_impl select_default_conv4_valid_impl(bool no_gpu, size_t i1
         return etl::conv4_impl::CUDNN;
     }
 
+    // Winograd has the lowest arithmetic cost for 3x3 kernels
+    if (winograd_conv4_possible<I, K, C>(k1, k2, s1, s2)) {
+        return etl::conv4_impl::WINOGRAD;
+    }
+
     // Small kernels
     if (k1 == k2 && k1 <= 5) {
         if (impl::vec::conv2_possible<vector_mode, I, K, C> && i1 == i2 && i1 > 100) {
@@ -75,7 +98,7 @@ constexpr etl::conv4_impl select_default_conv4_valid_impl(bool no_gpu, size_t i1
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-constexpr etl::conv4_impl select_default_conv4_valid_filter_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+constexpr etl::conv4_impl select_default_conv4_valid_filter_impl(size_t i1, size_t i2, size_t k1, size_t k2, size_t c1, size_t c2, size_t s1, size_t s2) {
     //Note: since the constexpr values will be known at compile time, the
     //conditions will be a lot simplified
 
@@ -88,6 +111,11 @@ constexpr etl::conv4_impl select_default_conv4_valid_filter_impl(size_t i1, size
         return etl::conv4_impl::STD;
     }
 
+    // Winograd has the lowest arithmetic cost for 3x3 kernels
+    if (winograd_conv4_possible<I, K, C>(c1, c2, s1, s2)) {
+        return etl::conv4_impl::WINOGRAD;
+    }
+
     // Small kernels
     if (k1 == k2 && k1 <= 5) {
         if (impl::vec::conv2_possible<vector_mode, I, K, C> && i1 == i2 && i1 > 100) {
@@ -192,6 +220,11 @@ constexpr etl::conv4_impl select_default_conv4_full_impl(bool no_gpu, size_t k1,
         return etl::conv4_impl::FFT_CUFFT;
     }
 
+    // Winograd has the lowest arithmetic cost for 3x3 kernels
+    if (winograd_conv4_possible<I, K, C>(k1, k2, 1, 1)) {
+        return etl::conv4_impl::WINOGRAD;
+    }
+
     // MKL is generally faster than VEC
     // This could be improved for small batch size where VEC is interesting
     if (impl::blas::conv2_possible<I, K, C>) {
@@ -211,6 +244,94 @@ constexpr etl::conv4_impl select_default_conv4_full_impl(bool no_gpu, size_t k1,
     return etl::conv4_impl::FFT_STD;
 }
 
+/*!
+ * \brief Select the implementation of the grouped 4D conv of I and K in C
+ *
+ * This does not take the local context into account.
+ *
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \return the implementation to be used
+ */
+template <typename I, typename K, typename C>
+constexpr etl::conv4_impl select_default_conv4_grouped_impl() {
+    // The vectorized version directly works on the planes of each group
+    if (impl::vec::conv2_possible<vector_mode, I, K, C>) {
+        return etl::conv4_impl::VEC;
+    }
+
+    return etl::conv4_impl::STD;
+}
+
+/*!
+ * \brief Select the implementation of the dilated conv of I and K in C
+ *
+ * This does not take the local context into account.
+ *
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \return the implementation to be used
+ */
+template <typename I, typename K, typename C>
+constexpr etl::conv4_impl select_default_conv4_dilated_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+    constexpr order input_order  = decay_traits<I>::storage_order;
+    constexpr order kernel_order = decay_traits<K>::storage_order;
+    constexpr order output_order = decay_traits<C>::storage_order;
+
+    //Only the standard implementation is able to handle column major
+    if (input_order == order::ColumnMajor || kernel_order == order::ColumnMajor || output_order == order::ColumnMajor) {
+        return etl::conv4_impl::STD;
+    }
+
+    if (impl::vec::conv2_possible<vector_mode, I, K, C>) {
+        // Small kernels on small images are better handled by a single large GEMM
+        if (k1 == k2 && k1 <= 5 && !(i1 == i2 && i1 > 100)) {
+            return etl::conv4_impl::BLAS_VEC;
+        }
+
+        return etl::conv4_impl::VEC;
+    }
+
+    return etl::conv4_impl::STD;
+}
+
+/*!
+ * \brief Select the implementation of the 5D conv of I and K in C
+ *
+ * This does not take the local context into account.
+ *
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \param channels The number of channels reduced by the convolution
+ * \param k_size The number of elements of each 3D kernel
+ * \return the implementation to be used
+ */
+template <typename I, typename K, typename C>
+constexpr etl::conv4_impl select_default_conv5_impl(size_t channels, size_t k_size) {
+    constexpr order input_order  = decay_traits<I>::storage_order;
+    constexpr order kernel_order = decay_traits<K>::storage_order;
+    constexpr order output_order = decay_traits<C>::storage_order;
+
+    //Only the standard implementation is able to handle column major
+    if (input_order == order::ColumnMajor || kernel_order == order::ColumnMajor || output_order == order::ColumnMajor) {
+        return etl::conv4_impl::STD;
+    }
+
+    if (impl::vec::conv2_possible<vector_mode, I, K, C>) {
+        // With many channels or large kernels, the reduction is large enough for vol2col + GEMM
+        if (channels >= 8 || k_size > 27) {
+            return etl::conv4_impl::BLAS_VEC;
+        }
+
+        return etl::conv4_impl::VEC;
+    }
+
+    return etl::conv4_impl::STD;
+}
+
 #ifdef ETL_MANUAL_SELECT
 
 /*!
@@ -221,7 +342,7 @@ constexpr etl::conv4_impl select_default_conv4_full_impl(bool no_gpu, size_t k1,
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1, size_t k2, size_t s1, size_t s2) {
     if (local_context().conv4_selector.forced) {
         auto forced = local_context().conv4_selector.impl;
 
@@ -231,7 +352,7 @@ inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1,
             case etl::conv4_impl::VEC:
                 if (!impl::vec::conv2_possible<vector_mode, I, K, C>) {                                                             // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to VEC conv4 implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2);                           // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2, s1, s2);                   // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                   // COVERAGE_EXCLUDE_LINE
 
                 return forced;
@@ -240,7 +361,7 @@ inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1,
             case etl::conv4_impl::BLAS_MKL:
                 if (!cblas_enabled) {                                                                                               // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to BLAS conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2);                           // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2, s1, s2);                   // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                   // COVERAGE_EXCLUDE_LINE
 
                 return forced;
@@ -249,17 +370,26 @@ inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1,
             case etl::conv4_impl::CUDNN:
                 if (!impl::cudnn::conv_possible<I, K, C> || local_context().cpu) {                                                   // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to CUDNN conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2);                            // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2, s1, s2);                    // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                    // COVERAGE_EXCLUDE_LINE
 
                 return forced;
 
+                //WINOGRAD cannot always be used
+            case etl::conv4_impl::WINOGRAD:
+                if (!winograd_conv4_possible<I, K, C>(k1, k2, s1, s2)) {                                                                 // COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to WINOGRAD conv4 implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2, s1, s2);                        // COVERAGE_EXCLUDE_LINE
+                }                                                                                                                        // COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
             default:
                 return forced;
         }
     }
 
-    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2);
+    return select_default_conv4_valid_impl<I, K, C>(local_context().cpu, i1, i2, k1, k2, s1, s2);
 }
 
 /*!
@@ -270,7 +400,7 @@ inline etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1,
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-inline etl::conv4_impl select_conv4_valid_filter_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+inline etl::conv4_impl select_conv4_valid_filter_impl(size_t i1, size_t i2, size_t k1, size_t k2, size_t c1, size_t c2, size_t s1, size_t s2) {
     if (local_context().conv4_selector.forced) {
         auto forced = local_context().conv4_selector.impl;
 
@@ -280,9 +410,9 @@ inline etl::conv4_impl select_conv4_valid_filter_impl(size_t i1, size_t i2, size
             case etl::conv4_impl::VEC:
                 if (!impl::vec::conv2_possible<vector_mode, I, K, C>) { // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to VEC conv4_valid_filter implementation, but not possible for this expression"
-                              << std::endl;                                                 // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_filter_impl<I, K, C>(i1, i2, k1, k2); // COVERAGE_EXCLUDE_LINE
-                }                                                                           // COVERAGE_EXCLUDE_LINE
+                              << std::endl;                                                                 // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_filter_impl<I, K, C>(i1, i2, k1, k2, c1, c2, s1, s2); // COVERAGE_EXCLUDE_LINE
+                }                                                                                           // COVERAGE_EXCLUDE_LINE
 
                 return forced;
 
@@ -290,17 +420,26 @@ inline etl::conv4_impl select_conv4_valid_filter_impl(size_t i1, size_t i2, size
             case etl::conv4_impl::BLAS_MKL:
                 if (!cblas_enabled) {                                                                                               // COVERAGE_EXCLUDE_LINE
                     std::cerr << "Forced selection to BLAS conv implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
-                    return select_default_conv4_valid_filter_impl<I, K, C>(i1, i2, k1, k2);                                         // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_filter_impl<I, K, C>(i1, i2, k1, k2, c1, c2, s1, s2);                         // COVERAGE_EXCLUDE_LINE
                 }                                                                                                                   // COVERAGE_EXCLUDE_LINE
 
                 return forced;
 
+                //WINOGRAD cannot always be used
+            case etl::conv4_impl::WINOGRAD:
+                if (!winograd_conv4_possible<I, K, C>(c1, c2, s1, s2)) {                                                                              // COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to WINOGRAD conv4_valid_filter implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_valid_filter_impl<I, K, C>(i1, i2, k1, k2, c1, c2, s1, s2);                                           // COVERAGE_EXCLUDE_LINE
+                }                                                                                                                                     // COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
             default:
                 return forced;
         }
     }
 
-    return select_default_conv4_valid_filter_impl<I, K, C>(i1, i2, k1, k2);
+    return select_default_conv4_valid_filter_impl<I, K, C>(i1, i2, k1, k2, c1, c2, s1, s2);
 }
 
 /*!
@@ -395,6 +534,15 @@ inline etl::conv4_impl select_conv4_full_impl(size_t k1, size_t k2) {
 
                 return forced;
 
+            //WINOGRAD cannot always be used
+            case etl::conv4_impl::WINOGRAD:
+                if (!winograd_conv4_possible<I, K, C>(k1, k2, 1, 1)) {                                                                        // COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to WINOGRAD conv4_full implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_full_impl<I, K, C>(local_context().cpu, k1, k2);                                              // COVERAGE_EXCLUDE_LINE
+                }                                                                                                                             // COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
             default:
                 return forced;
         }
@@ -403,6 +551,117 @@ inline etl::conv4_impl select_conv4_full_impl(size_t k1, size_t k2) {
     return select_default_conv4_full_impl<I, K, C>(local_context().cpu, k1, k2);
 }
 
+/*!
+ * \brief Select the implementation of the grouped conv of I and K in C
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \return the implementation to be used
+ */
+template <typename I, typename K, typename C>
+inline etl::conv4_impl select_conv4_grouped_impl() {
+    if (local_context().conv4_selector.forced) {
+        auto forced = local_context().conv4_selector.impl;
+
+        switch (forced) {
+            //VEC cannot always be used
+            case etl::conv4_impl::VEC:
+                if (!impl::vec::conv2_possible<vector_mode, I, K, C>) { // COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to VEC conv4_grouped implementation, but not possible for this expression"
+                              << std::endl;                              // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_grouped_impl<I, K, C>(); // COVERAGE_EXCLUDE_LINE
+                }                                                        // COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
+            case etl::conv4_impl::STD:
+                return forced;
+
+            //The other implementations do not support groups
+            default:
+                std::cerr << "Forced selection to unsupported conv4_grouped implementation, falling back to default" << std::endl; // COVERAGE_EXCLUDE_LINE
+                return select_default_conv4_grouped_impl<I, K, C>();                                                             // COVERAGE_EXCLUDE_LINE
+        }
+    }
+
+    return select_default_conv4_grouped_impl<I, K, C>();
+}
+
+/*!
+ * \brief Select the implementation of the dilated conv of I and K in C
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \return the implementation to be used
+ */
+template <typename I, typename K, typename C>
+inline etl::conv4_impl select_conv4_dilated_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+    if (local_context().conv4_selector.forced) {
+        auto forced = local_context().conv4_selector.impl;
+
+        switch (forced) {
+            //VEC and BLAS_VEC cannot always be used
+            case etl::conv4_impl::VEC:
+            case etl::conv4_impl::BLAS_VEC:
+                if (!impl::vec::conv2_possible<vector_mode, I, K, C>) { // COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to VEC conv4_dilated implementation, but not possible for this expression"
+                              << std::endl;                                         // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv4_dilated_impl<I, K, C>(i1, i2, k1, k2); // COVERAGE_EXCLUDE_LINE
+                }                                                                   // COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
+            case etl::conv4_impl::STD:
+                return forced;
+
+            //The other implementations do not support dilation
+            default:
+                std::cerr << "Forced selection to unsupported conv4_dilated implementation, falling back to default" << std::endl; // COVERAGE_EXCLUDE_LINE
+                return select_default_conv4_dilated_impl<I, K, C>(i1, i2, k1, k2);                                                // COVERAGE_EXCLUDE_LINE
+        }
+    }
+
+    return select_default_conv4_dilated_impl<I, K, C>(i1, i2, k1, k2);
+}
+
+/*!
+ * \brief Select the implementation of the 5D conv of I and K in C
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \param channels The number of channels reduced by the convolution
+ * \param k_size The number of elements of each 3D kernel
+ * \return the implementation to be used
+ */
+template <typename I, typename K, typename C>
+inline etl::conv4_impl select_conv5_impl(size_t channels, size_t k_size) {
+    if (local_context().conv4_selector.forced) {
+        auto forced = local_context().conv4_selector.impl;
+
+        switch (forced) {
+            //VEC and BLAS_VEC cannot always be used
+            case etl::conv4_impl::VEC:
+            case etl::conv4_impl::BLAS_VEC:
+                if (!impl::vec::conv2_possible<vector_mode, I, K, C>) {                                                       // COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to VEC conv5 implementation, but not possible for this expression" << std::endl; // COVERAGE_EXCLUDE_LINE
+                    return select_default_conv5_impl<I, K, C>(channels, k_size);                                                // COVERAGE_EXCLUDE_LINE
+                }                                                                                                               // COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
+            case etl::conv4_impl::STD:
+                return forced;
+
+            //The other implementations do not support 3D convolutions
+            default:
+                std::cerr << "Forced selection to unsupported conv5 implementation, falling back to default" << std::endl; // COVERAGE_EXCLUDE_LINE
+                return select_default_conv5_impl<I, K, C>(channels, k_size);                                                // COVERAGE_EXCLUDE_LINE
+        }
+    }
+
+    return select_default_conv5_impl<I, K, C>(channels, k_size);
+}
+
 #else
 
 /*!
@@ -416,8 +675,8 @@ inline etl::conv4_impl select_conv4_full_impl(size_t k1, size_t k2) {
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-constexpr etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
-    return select_default_conv4_valid_impl<I, K, C>(false, i1, i2, k1, k2);
+constexpr etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k1, size_t k2, size_t s1, size_t s2) {
+    return select_default_conv4_valid_impl<I, K, C>(false, i1, i2, k1, k2, s1, s2);
 }
 
 /*!
@@ -431,8 +690,8 @@ constexpr etl::conv4_impl select_conv4_valid_impl(size_t i1, size_t i2, size_t k
  * \return the implementation to be used
  */
 template <typename I, typename K, typename C>
-constexpr etl::conv4_impl select_conv4_valid_filter_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
-    return select_default_conv4_valid_filter_impl<I, K, C>(i1, i2, k1, k2);
+constexpr etl::conv4_impl select_conv4_valid_filter_impl(size_t i1, size_t i2, size_t k1, size_t k2, size_t c1, size_t c2, size_t s1, size_t s2) {
+    return select_default_conv4_valid_filter_impl<I, K, C>(i1, i2, k1, k2, c1, c2, s1, s2);
 }
 
 /*!
@@ -465,6 +724,53 @@ constexpr etl::conv4_impl select_conv4_full_impl(size_t k1, size_t k2) {
     return select_default_conv4_full_impl<I, K, C>(false, k1, k2);
 }
 
+/*!
+ * \brief Select the implementation of the grouped 4D conv of I and K in C
+ *
+ * This does not take the local context into account.
+ *
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \return the implementation to be used
+ */
+template <typename I, typename K, typename C>
+constexpr etl::conv4_impl select_conv4_grouped_impl() {
+    return select_default_conv4_grouped_impl<I, K, C>();
+}
+
+/*!
+ * \brief Select the implementation of the dilated 4D conv of I and K in C
+ *
+ * This does not take the local context into account.
+ *
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \return the implementation to be used
+ */
+template <typename I, typename K, typename C>
+constexpr etl::conv4_impl select_conv4_dilated_impl(size_t i1, size_t i2, size_t k1, size_t k2) {
+    return select_default_conv4_dilated_impl<I, K, C>(i1, i2, k1, k2);
+}
+
+/*!
+ * \brief Select the implementation of the 5D conv of I and K in C
+ *
+ * This does not take the local context into account.
+ *
+ * \tparam I The input type
+ * \tparam K The kernel type
+ * \tparam C The conv type
+ * \param channels The number of channels reduced by the convolution
+ * \param k_size The number of elements of each 3D kernel
+ * \return the implementation to be used
+ */
+template <typename I, typename K, typename C>
+constexpr etl::conv4_impl select_conv5_impl(size_t channels, size_t k_size) {
+    return select_default_conv5_impl<I, K, C>(channels, k_size);
+}
+
 #endif
 
 } //end of namespace etl::detail
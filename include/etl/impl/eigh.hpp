@@ -0,0 +1,43 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the symmetric eigendecomposition kernels
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/eigh.hpp"
+#include "etl/impl/vec/eigh.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief Compute the eigenvalues, and optionally the eigenvectors, of a
+ * row-major symmetric matrix.
+ *
+ * \param a The symmetric matrix, only its lower part is used, destroyed [N, N]
+ * \param w The eigenvalues, in ascending order [N]
+ * \param v The eigenvectors, in columns, or nullptr [N, N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the algorithm converged, false otherwise
+ */
+template <typename T>
+bool eigh(T* a, T* w, T* v, size_t n) {
+    if constexpr (impl::vec::eigh_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        return impl::vec::eigh(a, w, v, n);
+    } else {
+        inc_counter("impl:std");
+        return impl::standard::eigh(a, w, v, n);
+    }
+}
+
+} //end of namespace etl::detail
@@ -479,6 +479,33 @@ struct ifft1_real_impl {
     }
 };
 
+/*!
+ * \brief Functor for Short-Time Fourier Transform
+ * \tparam Mode The output of the transform
+ */
+template <stft_mode Mode>
+struct stft_impl {
+    /*!
+     * \brief Indicates if the temporary expression can be directly evaluated
+     * using only GPU.
+     */
+    template <typename A>
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Apply the functor
+     * \param a The input signal
+     * \param w The window
+     * \param c The output sub expression
+     * \param hop The number of samples between two frames
+     */
+    template <typename A, typename W, typename C>
+    static void apply(A&& a, W&& w, C&& c, size_t hop) {
+        inc_counter("impl:std");
+        etl::impl::standard::stft<Mode>(smart_forward(a), smart_forward(w), c, hop);
+    }
+};
+
 /*!
  * \brief Functor for 2D FFT
  */
@@ -0,0 +1,62 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the LU decomposition kernels
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/lu.hpp"
+#include "etl/impl/vec/lu.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief Compute the LU decomposition with partial pivoting of a row-major
+ * square matrix, in place.
+ *
+ * \param a The matrix to decompose in place [N, N]
+ * \param piv The pivot vector [N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the matrix is not singular, false otherwise
+ */
+template <typename T>
+bool lu_factor(T* a, size_t* piv, size_t n) {
+    if constexpr (impl::vec::lu_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        return impl::vec::lu_factor(a, piv, n);
+    } else {
+        inc_counter("impl:std");
+        return impl::standard::lu_factor(a, piv, n);
+    }
+}
+
+/*!
+ * \brief Solve A * X = B from the LU decomposition of A.
+ *
+ * \param lu The LU decomposition of A [N, N]
+ * \param piv The pivot vector [N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ */
+template <typename T>
+void lu_solve(const T* lu, const size_t* piv, T* b, size_t n, size_t m) {
+    if constexpr (impl::vec::lu_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::lu_solve(lu, piv, b, n, m);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::lu_solve(lu, piv, b, n, m);
+    }
+}
+
+} //end of namespace etl::detail
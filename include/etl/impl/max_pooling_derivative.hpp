@@ -98,6 +98,15 @@ struct max_pool_derivative_2d {
         in.ensure_cpu_up_to_date();
         out.ensure_cpu_up_to_date();
 
+        if constexpr (!cudnn_compatible && !P1 && !P2) {
+            if
+                constexpr_select(select_pool_impl<A, M>() == pool_impl::VEC) {
+                    inc_counter("impl:vec");
+                    vec::max_pool_derivative_2d(in, out, m, C1, C2, S1, S2);
+                    return;
+                }
+        }
+
         if constexpr (C1 != S1 || C2 != S2) {
             m = 0;
         }
@@ -214,6 +223,12 @@ struct max_pool_derivative_2d {
         in.ensure_cpu_up_to_date();
         out.ensure_cpu_up_to_date();
 
+        if (!cudnn_compatible && !p1 && !p2 && select_pool_impl<A, M>() == pool_impl::VEC) {
+            inc_counter("impl:vec");
+            vec::max_pool_derivative_2d(in, out, m, c1, c2, s1, s2);
+            return;
+        }
+
         if (c1 != s1 || c2 != s2) {
             m = 0;
         }
@@ -239,10 +254,19 @@ struct max_pool_derivative_2d {
      * \tparam C2 The second dimension pooling ratio
      */
     template <size_t C1, size_t C2, size_t C3, size_t S1, size_t S2, size_t S3, size_t P1, size_t P2, size_t P3, typename A, typename B, typename M, cpp_enable_iff(!is_2d<A>)>
-    static void apply(A&& in, B&& out, M& m) {
+    static void apply(A&& in, B&& out, M&& m) {
         in.ensure_cpu_up_to_date();
         out.ensure_cpu_up_to_date();
 
+        if constexpr (!cudnn_compatible && !P1 && !P2) {
+            if
+                constexpr_select(select_pool_impl<A, M>() == pool_impl::VEC) {
+                    inc_counter("impl:vec");
+                    vec::max_pool_derivative_2d(in, out, m, C1, C2, S1, S2);
+                    return;
+                }
+        }
+
         for (size_t i = 0; i < etl::dim<0>(in); ++i) {
             apply<C1, C2, C3, S1, S2, S3, P1, P2, P3>(in(i), out(i), m(i));
         }
@@ -260,10 +284,16 @@ struct max_pool_derivative_2d {
      * \param c2 The second dimension pooling ratio
      */
     template <typename A, typename B, typename M, cpp_enable_iff(!is_2d<A>)>
-    static void apply(A&& in, B&& out, M& m, size_t c1, size_t c2, size_t c3, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    static void apply(A&& in, B&& out, M&& m, size_t c1, size_t c2, size_t c3, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
         in.ensure_cpu_up_to_date();
         out.ensure_cpu_up_to_date();
 
+        if (!cudnn_compatible && !p1 && !p2 && select_pool_impl<A, M>() == pool_impl::VEC) {
+            inc_counter("impl:vec");
+            vec::max_pool_derivative_2d(in, out, m, c1, c2, s1, s2);
+            return;
+        }
+
         for (size_t i = 0; i < etl::dim<0>(in); ++i) {
             apply(in(i), out(i), m(i), c1, c2, c3, s1, s2, s3, p1, p2, p3);
         }
@@ -410,7 +440,7 @@ struct max_pool_derivative_3d {
      * \tparam C3 The third dimension pooling ratio
      */
     template <size_t C1, size_t C2, size_t C3, size_t S1, size_t S2, size_t S3, size_t P1, size_t P2, size_t P3, typename A, typename B, typename M, cpp_enable_iff(!is_3d<A>)>
-    static void apply(A&& in, B&& out, M& m) {
+    static void apply(A&& in, B&& out, M&& m) {
         in.ensure_cpu_up_to_date();
         out.ensure_cpu_up_to_date();
 
@@ -432,7 +462,7 @@ struct max_pool_derivative_3d {
      */
     template <typename A, typename B, typename M, cpp_enable_iff(!is_3d<A>)>
     static void apply(
-            A&& in, B&& out, M& m, size_t c1, size_t c2, size_t c3, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+            A&& in, B&& out, M&& m, size_t c1, size_t c2, size_t c3, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
         in.ensure_cpu_up_to_date();
         out.ensure_cpu_up_to_date();
 
@@ -17,6 +17,7 @@
 
 //Include the implementations
 #include "etl/impl/std/mse.hpp"
+#include "etl/impl/vec/mse.hpp"
 #include "etl/impl/egblas/mse.hpp"
 
 namespace etl::detail {
@@ -33,6 +34,10 @@ constexpr etl::mse_impl select_mse_impl() {
         return etl::mse_impl::EGBLAS;
     }
 
+    if (impl::vec::mse_possible<vector_mode, O, L>) {
+        return etl::mse_impl::VEC;
+    }
+
     return etl::mse_impl::STD;
 }
 
@@ -48,6 +53,10 @@ constexpr etl::mse_impl select_mse_loss_impl() {
         return etl::mse_impl::EGBLAS;
     }
 
+    if (impl::vec::mse_possible<vector_mode, O, L>) {
+        return etl::mse_impl::VEC;
+    }
+
     return etl::mse_impl::STD;
 }
 
@@ -63,6 +72,10 @@ constexpr etl::mse_impl select_mse_error_impl() {
         return etl::mse_impl::EGBLAS;
     }
 
+    if (impl::vec::mse_possible<vector_mode, O, L>) {
+        return etl::mse_impl::VEC;
+    }
+
     return etl::mse_impl::STD;
 }
 
@@ -82,6 +95,8 @@ struct mse_impl {
             etl::force(labels);
 
             return impl::standard::mse(output, labels, alpha, beta);
+        } else if constexpr (impl == etl::mse_impl::VEC) {
+            return impl::vec::mse(smart_forward(output), smart_forward(labels), alpha, beta);
         } else if constexpr (impl == etl::mse_impl::EGBLAS) {
             decltype(auto) output_gpu = smart_forward_gpu(output);
             decltype(auto) labels_gpu = smart_forward_gpu(labels);
@@ -111,7 +126,9 @@ struct mse_loss_impl {
             etl::force(output);
             etl::force(labels);
 
-            return impl::standard::mse_loss(etl::size(output), output, labels, scale);
+            return impl::standard::mse_loss(output, labels, scale);
+        } else if constexpr (impl == etl::mse_impl::VEC) {
+            return impl::vec::mse_loss(smart_forward(output), smart_forward(labels), scale);
         } else if constexpr (impl == etl::mse_impl::EGBLAS) {
             decltype(auto) output_gpu = smart_forward_gpu(output);
             decltype(auto) labels_gpu = smart_forward_gpu(labels);
@@ -141,7 +158,9 @@ struct mse_error_impl {
             etl::force(output);
             etl::force(labels);
 
-            return impl::standard::mse_error(etl::size(output), output, labels, scale);
+            return impl::standard::mse_error(output, labels, scale);
+        } else if constexpr (impl == etl::mse_impl::VEC) {
+            return impl::vec::mse_error(smart_forward(output), smart_forward(labels), scale);
         } else if constexpr (impl == etl::mse_impl::EGBLAS) {
             decltype(auto) output_gpu = smart_forward_gpu(output);
             decltype(auto) labels_gpu = smart_forward_gpu(labels);
@@ -7,15 +7,11 @@
 
 #pragma once
 
-// Include all the modules
-
-#include "etl/impl/max_pooling_derivative.hpp"
-#include "etl/impl/avg_pooling_derivative.hpp"
-
 // Include the implementations
 
 #include "etl/impl/std/max_pooling.hpp"
 #include "etl/impl/std/avg_pooling.hpp"
+#include "etl/impl/vec/pooling.hpp"
 #include "etl/impl/cudnn/max_pooling.hpp"
 
 namespace etl::impl {
@@ -38,6 +34,10 @@ constexpr etl::pool_impl select_default_pool_impl(bool no_gpu) {
         return etl::pool_impl::CUDNN;
     }
 
+    if (vec::pool_possible<vector_mode, X, Y>) {
+        return etl::pool_impl::VEC;
+    }
+
     return etl::pool_impl::STD;
 }
 
@@ -64,6 +64,15 @@ etl::pool_impl select_pool_impl() {
 
                 return forced;
 
+            // VEC cannot always be used
+            case pool_impl::VEC:
+                if (!vec::pool_possible<vector_mode, X, Y>) {                                                                    //COVERAGE_EXCLUDE_LINE
+                    std::cerr << "Forced selection to VEC pool implementation, but not possible for this expression" << std::endl; //COVERAGE_EXCLUDE_LINE
+                    return select_default_pool_impl<X, Y>(local_context().cpu);                                                    //COVERAGE_EXCLUDE_LINE
+                }                                                                                                                  //COVERAGE_EXCLUDE_LINE
+
+                return forced;
+
             //In other cases, simply use the forced impl
             default:
                 return forced;
@@ -125,6 +134,11 @@ struct max_pool_2d {
                 inc_counter("impl:std");
                 etl::impl::standard::max_pool_2d::apply<C1, C2, S1, S2, P1, P2>(smart_forward(x), y);
             }
+        else if
+            constexpr_select(impl == pool_impl::VEC) {
+                inc_counter("impl:vec");
+                etl::impl::vec::max_pool_2d::apply<C1, C2, S1, S2, P1, P2>(smart_forward(x), y);
+            }
         else if
             constexpr_select(impl == pool_impl::CUDNN) {
                 inc_counter("impl:cudnn");
@@ -159,6 +173,11 @@ struct max_pool_2d {
                 inc_counter("impl:std");
                 etl::impl::standard::max_pool_2d::apply(smart_forward(x), y, c1, c2, s1, s2, p1, p2);
             }
+        else if
+            constexpr_select(impl == pool_impl::VEC) {
+                inc_counter("impl:vec");
+                etl::impl::vec::max_pool_2d::apply(smart_forward(x), y, c1, c2, s1, s2, p1, p2);
+            }
         else if
             constexpr_select(impl == pool_impl::CUDNN) {
                 inc_counter("impl:cudnn");
@@ -205,6 +224,11 @@ struct avg_pool_2d {
                 inc_counter("impl:std");
                 etl::impl::standard::avg_pool_2d::apply<C1, C2, S1, S2, P1, P2>(smart_forward(x), y);
             }
+        else if
+            constexpr_select(impl == pool_impl::VEC) {
+                inc_counter("impl:vec");
+                etl::impl::vec::avg_pool_2d::apply<C1, C2, S1, S2, P1, P2>(smart_forward(x), y);
+            }
         else if
             constexpr_select(impl == pool_impl::CUDNN) {
                 inc_counter("impl:cudnn");
@@ -239,6 +263,11 @@ struct avg_pool_2d {
                 inc_counter("impl:std");
                 etl::impl::standard::avg_pool_2d::apply(smart_forward(x), y, c1, c2, s1, s2, p1, p2);
             }
+        else if
+            constexpr_select(impl == pool_impl::VEC) {
+                inc_counter("impl:vec");
+                etl::impl::vec::avg_pool_2d::apply(smart_forward(x), y, c1, c2, s1, s2, p1, p2);
+            }
         else if
             constexpr_select(impl == pool_impl::CUDNN) {
                 inc_counter("impl:cudnn");
@@ -252,6 +281,9 @@ struct avg_pool_2d {
 
 /*!
  * \brief Functor for 3D Max Pooling
+ *
+ * There is no vectorized implementation of 3D pooling, the standard
+ * implementation is used in its place.
  */
 struct max_pool_3d {
     /*!
@@ -281,7 +313,7 @@ struct max_pool_3d {
         constexpr_select const auto impl = select_pool_impl<X, Y>();
 
         if
-            constexpr_select(impl == pool_impl::STD) {
+            constexpr_select(impl == pool_impl::STD || impl == pool_impl::VEC) {
                 inc_counter("impl:std");
                 etl::impl::standard::max_pool_3d::apply<C1, C2, C3, S1, S2, S3, P1, P2, P3>(smart_forward(x), y);
             }
@@ -315,7 +347,7 @@ struct max_pool_3d {
         constexpr_select const auto impl = select_pool_impl<X, Y>();
 
         if
-            constexpr_select(impl == pool_impl::STD) {
+            constexpr_select(impl == pool_impl::STD || impl == pool_impl::VEC) {
                 inc_counter("impl:std");
                 etl::impl::standard::max_pool_3d::apply(smart_forward(x), y, c1, c2, c3, s1, s2, s3, p1, p2, p3);
             }
@@ -332,6 +364,9 @@ struct max_pool_3d {
 
 /*!
  * \brief Functor for 3D Average Pooling
+ *
+ * There is no vectorized implementation of 3D pooling, the standard
+ * implementation is used in its place.
  */
 struct avg_pool_3d {
     /*!
@@ -361,7 +396,7 @@ struct avg_pool_3d {
         constexpr_select const auto impl = select_pool_impl<X, Y>();
 
         if
-            constexpr_select(impl == pool_impl::STD) {
+            constexpr_select(impl == pool_impl::STD || impl == pool_impl::VEC) {
                 inc_counter("impl:std");
                 etl::impl::standard::avg_pool_3d::apply<C1, C2, C3, S1, S2, S3, P1, P2, P3>(smart_forward(x), y);
             }
@@ -395,7 +430,7 @@ struct avg_pool_3d {
         const auto impl = select_pool_impl<X, Y>();
 
         if
-            constexpr_select(impl == pool_impl::STD) {
+            constexpr_select(impl == pool_impl::STD || impl == pool_impl::VEC) {
                 inc_counter("impl:std");
                 etl::impl::standard::avg_pool_3d::apply(smart_forward(x), y, c1, c2, c3, s1, s2, s3, p1, p2, p3);
             }
@@ -411,3 +446,8 @@ struct avg_pool_3d {
 };
 
 } //end of namespace etl::impl
+
+// Include the derivatives, which depend on the implementation selection
+
+#include "etl/impl/max_pooling_derivative.hpp"
+#include "etl/impl/avg_pooling_derivative.hpp"
@@ -0,0 +1,82 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the QR decomposition kernels
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/qr.hpp"
+#include "etl/impl/vec/qr.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief Compute the QR decomposition of a row-major matrix, in place.
+ *
+ * \param a The matrix to decompose in place [M, N]
+ * \param t The T factors of the panels [min(M, N) * qr_block_size]
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ */
+template <typename T>
+void qr_factor(T* a, T* t, size_t m, size_t n) {
+    if constexpr (impl::vec::qr_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::qr_factor(a, t, m, n);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::qr_factor(a, t, m, n);
+    }
+}
+
+/*!
+ * \brief Compute C = Q * C from a QR decomposition.
+ *
+ * \param qr The QR decomposition [M, N]
+ * \param t The T factors of the panels
+ * \param m The number of rows of the decomposed matrix
+ * \param n The number of columns of the decomposed matrix
+ * \param c The row-major matrix to transform in place [M, K]
+ * \param k The number of columns of C
+ */
+template <typename T>
+void qr_apply_q(const T* qr, const T* t, size_t m, size_t n, T* c, size_t k) {
+    if constexpr (impl::vec::qr_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::qr_apply_q(qr, t, m, n, c, k);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::qr_apply_q(qr, t, m, n, c, k);
+    }
+}
+
+/*!
+ * \brief Compute C = Q^T * C from a QR decomposition.
+ *
+ * \param qr The QR decomposition [M, N]
+ * \param t The T factors of the panels
+ * \param m The number of rows of the decomposed matrix
+ * \param n The number of columns of the decomposed matrix
+ * \param c The row-major matrix to transform in place [M, K]
+ * \param k The number of columns of C
+ */
+template <typename T>
+void qr_apply_qt(const T* qr, const T* t, size_t m, size_t n, T* c, size_t k) {
+    if constexpr (impl::vec::qr_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::qr_apply_qt(qr, t, m, n, c, k);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::qr_apply_qt(qr, t, m, n, c, k);
+    }
+}
+
+} //end of namespace etl::detail
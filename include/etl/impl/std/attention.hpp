@@ -0,0 +1,150 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the scaled dot-product attention
+ *
+ * The queries are processed by blocks and the keys are processed by tiles,
+ * with an online softmax: for each row, the running maximum and the running
+ * sum of the exponentials are updated with each tile of scores and the
+ * output accumulated so far is rescaled accordingly. Only one tile of
+ * scores is computed at a time, the full matrix of scores is never stored.
+ */
+
+#pragma once
+
+namespace etl::impl::standard {
+
+namespace detail {
+
+constexpr size_t attention_q_block = 64;  ///< The number of queries processed together
+constexpr size_t attention_k_block = 128; ///< The number of keys of a tile of scores
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the scaled dot-product attention of N independent groups
+ * (batches and heads)
+ *
+ * For each group, out = softmax(scale * q * trans(k)) * v, where the
+ * softmax is computed on each row. With causal masking, the query i only
+ * attends to the keys j <= i.
+ *
+ * \param q The [N, Sq, D] queries
+ * \param k The [N, Sk, D] keys
+ * \param v The [N, Sk, Dv] values
+ * \param out The [N, Sq, Dv] output
+ * \param N The number of groups
+ * \param Sq The number of queries
+ * \param Sk The number of keys
+ * \param D The dimension of the queries and keys
+ * \param Dv The dimension of the values
+ * \param scale The scale of the scores
+ * \param causal Indicates if the causal mask is applied
+ */
+template <typename T>
+void attention(const T* q, const T* k, const T* v, T* out, size_t N, size_t Sq, size_t Sk, size_t D, size_t Dv, T scale, bool causal) {
+    const size_t q_blocks = (Sq + detail::attention_q_block - 1) / detail::attention_q_block;
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        std::vector<T> s(detail::attention_q_block * detail::attention_k_block);
+        std::vector<T> m(detail::attention_q_block);
+        std::vector<T> l(detail::attention_q_block);
+
+        for (size_t task = first; task < last; ++task) {
+            const size_t n  = task / q_blocks;
+            const size_t q0 = (task % q_blocks) * detail::attention_q_block;
+            const size_t bq = std::min(detail::attention_q_block, Sq - q0);
+
+            const T* qq = q + (n * Sq + q0) * D;
+            const T* kk = k + n * Sk * D;
+            const T* vv = v + n * Sk * Dv;
+            T* oo       = out + (n * Sq + q0) * Dv;
+
+            // With causal masking, the keys after the last query are never used
+            const size_t k_last = causal ? std::min(Sk, q0 + bq) : Sk;
+
+            for (size_t i = 0; i < bq; ++i) {
+                m[i] = -std::numeric_limits<T>::infinity();
+                l[i] = T(0);
+            }
+
+            for (size_t i = 0; i < bq * Dv; ++i) {
+                oo[i] = T(0);
+            }
+
+            for (size_t k0 = 0; k0 < k_last; k0 += detail::attention_k_block) {
+                const size_t bk = std::min(detail::attention_k_block, k_last - k0);
+
+                for (size_t i = 0; i < bq; ++i) {
+                    // 1. Compute the scores of the tile and their maximum
+
+                    const size_t j_last = causal ? std::min(bk, q0 + i + 1 > k0 ? q0 + i + 1 - k0 : 0) : bk;
+
+                    if (!j_last) {
+                        continue;
+                    }
+
+                    T mx = -std::numeric_limits<T>::infinity();
+
+                    for (size_t j = 0; j < j_last; ++j) {
+                        T acc = 0;
+
+                        for (size_t d = 0; d < D; ++d) {
+                            acc += qq[i * D + d] * kk[(k0 + j) * D + d];
+                        }
+
+                        s[i * bk + j] = scale * acc;
+                        mx            = std::max(mx, s[i * bk + j]);
+                    }
+
+                    // 2. Update the running maximum and sum, and rescale the output
+
+                    const T m_new = std::max(m[i], mx);
+                    const T corr  = std::exp(m[i] - m_new);
+
+                    T sum = 0;
+
+                    for (size_t j = 0; j < j_last; ++j) {
+                        s[i * bk + j] = std::exp(s[i * bk + j] - m_new);
+                        sum += s[i * bk + j];
+                    }
+
+                    m[i] = m_new;
+                    l[i] = l[i] * corr + sum;
+
+                    // 3. Accumulate the weighted values
+
+                    for (size_t dv = 0; dv < Dv; ++dv) {
+                        T acc = 0;
+
+                        for (size_t j = 0; j < j_last; ++j) {
+                            acc += s[i * bk + j] * vv[(k0 + j) * Dv + dv];
+                        }
+
+                        oo[i * Dv + dv] = oo[i * Dv + dv] * corr + acc;
+                    }
+                }
+            }
+
+            // 4. Normalize the output by the sums of the exponentials
+
+            for (size_t i = 0; i < bq; ++i) {
+                const T inv = T(1) / l[i];
+
+                for (size_t dv = 0; dv < Dv; ++dv) {
+                    oo[i * Dv + dv] *= inv;
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, N * q_blocks, 2UL);
+}
+
+} //end of namespace etl::impl::standard
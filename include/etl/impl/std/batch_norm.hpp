@@ -0,0 +1,384 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the batch normalization
+ *
+ * The input is seen as a [N, K, S] tensor, with S = 1 for a 2D input [N, K]
+ * and S = W * H for a 4D input [N, K, W, H]. The statistics are computed for
+ * each of the K channels with a single-pass Welford reduction. The channels
+ * are independent and are processed in parallel.
+ */
+
+#pragma once
+
+namespace etl::impl::standard {
+
+namespace detail {
+
+/*!
+ * \brief Merge the Welford accumulators (nb, mean_b, m2_b) into (n, mean, m2)
+ * \param n The number of elements of the first accumulator
+ * \param mean The mean of the first accumulator
+ * \param m2 The sum of squared differences of the first accumulator
+ * \param nb The number of elements of the second accumulator
+ * \param mean_b The mean of the second accumulator
+ * \param m2_b The sum of squared differences of the second accumulator
+ */
+template <typename T>
+void welford_merge(T& n, T& mean, T& m2, T nb, T mean_b, T m2_b) {
+    if (nb == T(0)) {
+        return;
+    }
+
+    const T total = n + nb;
+    const T delta = mean_b - mean;
+
+    mean += delta * (nb / total);
+    m2 += m2_b + delta * delta * (n * nb / total);
+    n = total;
+}
+
+/*!
+ * \brief Compute the mean and the sum of squared differences of a range of
+ * channels
+ * \param x The input
+ * \param mean The output mean
+ * \param m2 The output sum of squared differences to the mean
+ * \param N The number of samples
+ * \param K The number of channels
+ * \param S The number of elements of each channel in each sample
+ * \param first The first channel
+ * \param last The end of the range of channels
+ */
+template <typename T>
+void batch_norm_stats(const T* x, T* mean, T* m2, size_t N, size_t K, size_t S, size_t first, size_t last) {
+    if (S == 1) {
+        // The channels are contiguous, the rows are streamed
+
+        for (size_t k = first; k < last; ++k) {
+            mean[k] = T(0);
+            m2[k]   = T(0);
+        }
+
+        for (size_t b = 0; b < N; ++b) {
+            const T inv = T(1) / T(b + 1);
+
+            for (size_t k = first; k < last; ++k) {
+                const T v = x[b * K + k];
+                const T d = v - mean[k];
+
+                mean[k] += d * inv;
+                m2[k] += d * (v - mean[k]);
+            }
+        }
+    } else {
+        for (size_t k = first; k < last; ++k) {
+            T n = 0;
+            T m = 0;
+            T s = 0;
+
+            for (size_t b = 0; b < N; ++b) {
+                const T* p = x + (b * K + k) * S;
+
+                for (size_t i = 0; i < S; ++i) {
+                    n += T(1);
+
+                    const T d = p[i] - m;
+
+                    m += d / n;
+                    s += d * (p[i] - m);
+                }
+            }
+
+            mean[k] = m;
+            m2[k]   = s;
+        }
+    }
+}
+
+/*!
+ * \brief Compute the scale and shift of the affine transformation of a range
+ * of channels
+ *
+ * \param gamma The scale parameters
+ * \param beta The shift parameters
+ * \param mean The mean of each channel
+ * \param var The variance of each channel
+ * \param scale The output scale, gamma / sqrt(var + eps)
+ * \param shift The output shift, beta - mean * scale
+ * \param eps The epsilon added to the variance
+ * \param first The first channel
+ * \param last The end of the range of channels
+ */
+template <typename T>
+void batch_norm_scale_shift(const T* gamma, const T* beta, const T* mean, const T* var, T* scale, T* shift, T eps, size_t first, size_t last) {
+    for (size_t k = first; k < last; ++k) {
+        scale[k] = gamma[k] / std::sqrt(var[k] + eps);
+        shift[k] = beta[k] - mean[k] * scale[k];
+    }
+}
+
+/*!
+ * \brief Apply the affine transformation y = x * scale + shift on a range of
+ * channels
+ * \param x The input
+ * \param y The output
+ * \param scale The scale of each channel
+ * \param shift The shift of each channel
+ * \param N The number of samples
+ * \param K The number of channels
+ * \param S The number of elements of each channel in each sample
+ * \param first The first channel
+ * \param last The end of the range of channels
+ */
+template <typename T>
+void batch_norm_affine(const T* x, T* y, const T* scale, const T* shift, size_t N, size_t K, size_t S, size_t first, size_t last) {
+    for (size_t b = 0; b < N; ++b) {
+        for (size_t k = first; k < last; ++k) {
+            const T* in = x + (b * K + k) * S;
+            T* out      = y + (b * K + k) * S;
+
+            for (size_t i = 0; i < S; ++i) {
+                out[i] = in[i] * scale[k] + shift[k];
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute the sums of the errors and of the errors multiplied by the
+ * centered input of a range of channels
+ * \param x The input
+ * \param dy The errors
+ * \param mean The mean of each channel
+ * \param sum_dy The output sum of the errors
+ * \param sum_dy_xmu The output sum of dy * (x - mean)
+ * \param N The number of samples
+ * \param K The number of channels
+ * \param S The number of elements of each channel in each sample
+ * \param first The first channel
+ * \param last The end of the range of channels
+ */
+template <typename T>
+void batch_norm_backward_sums(const T* x, const T* dy, const T* mean, T* sum_dy, T* sum_dy_xmu, size_t N, size_t K, size_t S, size_t first, size_t last) {
+    for (size_t k = first; k < last; ++k) {
+        sum_dy[k]     = T(0);
+        sum_dy_xmu[k] = T(0);
+    }
+
+    for (size_t b = 0; b < N; ++b) {
+        for (size_t k = first; k < last; ++k) {
+            const T* in  = x + (b * K + k) * S;
+            const T* err = dy + (b * K + k) * S;
+
+            T s1 = 0;
+            T s2 = 0;
+
+            for (size_t i = 0; i < S; ++i) {
+                s1 += err[i];
+                s2 += err[i] * (in[i] - mean[k]);
+            }
+
+            sum_dy[k] += s1;
+            sum_dy_xmu[k] += s2;
+        }
+    }
+}
+
+/*!
+ * \brief Compute the gradients of the parameters and the coefficients of the
+ * input gradients of a range of channels.
+ *
+ * The input gradients are then dx = a_dy * dy + a_x * x + a_0.
+ *
+ * \param gamma The scale parameters
+ * \param mean The mean of each channel
+ * \param var The variance of each channel
+ * \param dgamma The sum of dy * (x - mean), replaced by the gradients of gamma
+ * \param dbeta The sum of dy, which is the gradients of beta
+ * \param a_dy The output coefficient of the errors
+ * \param a_x The output coefficient of the input
+ * \param a_0 The output constant
+ * \param n The number of elements of each channel
+ * \param eps The epsilon added to the variance
+ * \param first The first channel
+ * \param last The end of the range of channels
+ */
+template <typename T>
+void batch_norm_backward_coefficients(
+        const T* gamma, const T* mean, const T* var, T* dgamma, const T* dbeta, T* a_dy, T* a_x, T* a_0, T n, T eps, size_t first, size_t last) {
+    for (size_t k = first; k < last; ++k) {
+        const T inv_std = T(1) / std::sqrt(var[k] + eps);
+        const T scale   = gamma[k] * inv_std;
+        const T c       = inv_std * inv_std * dgamma[k] / n;
+
+        a_dy[k] = scale;
+        a_x[k]  = -scale * c;
+        a_0[k]  = scale * (c * mean[k] - dbeta[k] / n);
+
+        dgamma[k] *= inv_std;
+    }
+}
+
+/*!
+ * \brief Compute the input gradients dx = a_dy * dy + a_x * x + a_0 on a
+ * range of channels
+ * \param x The input
+ * \param dy The errors
+ * \param dx The output gradients
+ * \param a_dy The coefficient of the errors
+ * \param a_x The coefficient of the input
+ * \param a_0 The constant
+ * \param N The number of samples
+ * \param K The number of channels
+ * \param S The number of elements of each channel in each sample
+ * \param first The first channel
+ * \param last The end of the range of channels
+ */
+template <typename T>
+void batch_norm_backward_apply(
+        const T* x, const T* dy, T* dx, const T* a_dy, const T* a_x, const T* a_0, size_t N, size_t K, size_t S, size_t first, size_t last) {
+    for (size_t b = 0; b < N; ++b) {
+        for (size_t k = first; k < last; ++k) {
+            const T* in  = x + (b * K + k) * S;
+            const T* err = dy + (b * K + k) * S;
+            T* out       = dx + (b * K + k) * S;
+
+            for (size_t i = 0; i < S; ++i) {
+                out[i] = a_dy[k] * err[i] + a_x[k] * in[i] + a_0[k];
+            }
+        }
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the batch normalization of x in training mode.
+ *
+ * The mean and the (biased) variance of each channel are computed over the
+ * batch and stored in mean and var.
+ *
+ * \param x The input
+ * \param gamma The scale parameters
+ * \param beta The shift parameters
+ * \param y The output
+ * \param mean The output mean
+ * \param var The output variance
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename G, typename B, typename Y, typename M, typename V>
+void batch_norm_forward(const X& x, const G& gamma, const B& beta, Y&& y, M&& mean, V&& var, value_t<X> eps) {
+    using T = value_t<X>;
+
+    const size_t N = etl::dim<0>(x);
+    const size_t K = etl::dim<1>(x);
+    const size_t S = etl::size(x) / (N * K);
+
+    etl::dyn_matrix<T, 2> tmp(2, K);
+
+    const T* in = x.memory_start();
+    T* out      = y.memory_start();
+    T* m        = mean.memory_start();
+    T* v        = var.memory_start();
+    T* scale    = tmp.memory_start();
+    T* shift    = tmp.memory_start() + K;
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        detail::batch_norm_stats(in, m, v, N, K, S, first, last);
+
+        for (size_t k = first; k < last; ++k) {
+            v[k] /= T(N * S);
+        }
+
+        detail::batch_norm_scale_shift(gamma.memory_start(), beta.memory_start(), m, v, scale, shift, eps, first, last);
+        detail::batch_norm_affine(in, out, scale, shift, N, K, S, first, last);
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, K, 2UL);
+}
+
+/*!
+ * \brief Compute the batch normalization of x in inference mode, with the
+ * given mean and variance.
+ *
+ * \param x The input
+ * \param gamma The scale parameters
+ * \param beta The shift parameters
+ * \param mean The mean of each channel
+ * \param var The variance of each channel
+ * \param y The output
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename G, typename B, typename M, typename V, typename Y>
+void batch_norm_inference(const X& x, const G& gamma, const B& beta, const M& mean, const V& var, Y&& y, value_t<X> eps) {
+    using T = value_t<X>;
+
+    const size_t N = etl::dim<0>(x);
+    const size_t K = etl::dim<1>(x);
+    const size_t S = etl::size(x) / (N * K);
+
+    etl::dyn_matrix<T, 2> tmp(2, K);
+
+    const T* in = x.memory_start();
+    T* out      = y.memory_start();
+    T* scale    = tmp.memory_start();
+    T* shift    = tmp.memory_start() + K;
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        detail::batch_norm_scale_shift(gamma.memory_start(), beta.memory_start(), mean.memory_start(), var.memory_start(), scale, shift, eps, first, last);
+        detail::batch_norm_affine(in, out, scale, shift, N, K, S, first, last);
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, K, 2UL);
+}
+
+/*!
+ * \brief Compute the gradients of the batch normalization.
+ *
+ * \param x The input of the forward pass
+ * \param dy The errors at the output of the batch normalization
+ * \param gamma The scale parameters
+ * \param mean The mean computed by the forward pass
+ * \param var The variance computed by the forward pass
+ * \param dx The output gradients of the input
+ * \param dgamma The output gradients of gamma
+ * \param dbeta The output gradients of beta
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename E, typename G, typename M, typename V, typename DX, typename DG, typename DB>
+void batch_norm_backward(const X& x, const E& dy, const G& gamma, const M& mean, const V& var, DX&& dx, DG&& dgamma, DB&& dbeta, value_t<X> eps) {
+    using T = value_t<X>;
+
+    const size_t N = etl::dim<0>(x);
+    const size_t K = etl::dim<1>(x);
+    const size_t S = etl::size(x) / (N * K);
+
+    etl::dyn_matrix<T, 2> tmp(3, K);
+
+    const T* in  = x.memory_start();
+    const T* err = dy.memory_start();
+    const T* m   = mean.memory_start();
+    T* out       = dx.memory_start();
+    T* dg        = dgamma.memory_start();
+    T* db        = dbeta.memory_start();
+    T* a_dy      = tmp.memory_start();
+    T* a_x       = tmp.memory_start() + K;
+    T* a_0       = tmp.memory_start() + 2 * K;
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        detail::batch_norm_backward_sums(in, err, m, db, dg, N, K, S, first, last);
+        detail::batch_norm_backward_coefficients(gamma.memory_start(), m, var.memory_start(), dg, db, a_dy, a_x, a_0, T(N * S), eps, first, last);
+        detail::batch_norm_backward_apply(in, err, out, a_dy, a_x, a_0, N, K, S, first, last);
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, K, 2UL);
+}
+
+} //end of namespace etl::impl::standard
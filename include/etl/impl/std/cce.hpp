@@ -45,4 +45,26 @@ std::pair<value_t<O>, value_t<O>> cce(const O& output, const L& labels, value_t<
     return std::make_pair(cce_loss(output, labels, alpha), cce_error(output, labels, beta));
 }
 
+/*!
+ * \brief Compute the softmax of the logits, its Categorical Cross Entropy
+ * loss against the labels and the gradients of the loss with respect to the
+ * logits.
+ *
+ * \param logits The logits expression
+ * \param labels The labels expression
+ * \param gradients The output gradients, softmax(logits) - labels
+ * \param scale The scale to apply to the loss
+ * \return The CCE loss of softmax(logits)
+ */
+template <typename O, typename L, typename G>
+value_t<O> softmax_cross_entropy(const O& logits, const L& labels, G&& gradients, value_t<O> scale) {
+    gradients = softmax(logits);
+
+    auto loss = cce_loss(gradients, labels, scale);
+
+    gradients = gradients - labels;
+
+    return loss;
+}
+
 } //end of namespace etl::impl::standard
@@ -0,0 +1,219 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the blocked Cholesky decomposition and of
+ * the associated solver.
+ *
+ * The decomposition A = L * L^T of a symmetric positive definite matrix is
+ * done in place on a row-major square matrix. Only the lower part of A is
+ * read. After the decomposition, the lower part contains L and the strictly
+ * upper part is set to zero.
+ *
+ * The decomposition is right-looking: a diagonal block is factorized, the
+ * block column below it is computed by a triangular solve and the lower part
+ * of the trailing matrix is updated with A22 -= L21 * L21^T.
+ */
+
+#pragma once
+
+#include "etl/impl/std/trsm.hpp"
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief The number of columns of the panels of the blocked Cholesky
+ * decomposition
+ */
+constexpr size_t cholesky_block_size = 64;
+
+namespace detail {
+
+/*!
+ * \brief Factorize the panel of columns [k, k + nb) of the matrix
+ *
+ * \param a The matrix [N, N]
+ * \param n The dimension of the matrix
+ * \param k The first column of the panel
+ * \param nb The number of columns of the panel
+ *
+ * \return true if all the pivots of the panel are positive, false otherwise
+ */
+template <typename T>
+bool cholesky_panel(T* a, size_t n, size_t k, size_t nb) {
+    using std::sqrt;
+
+    bool positive = true;
+
+    // 1. Factorize the diagonal block
+
+    for (size_t j = k; j < k + nb; ++j) {
+        T d = a[j * n + j];
+
+        for (size_t p = k; p < j; ++p) {
+            d -= a[j * n + p] * a[j * n + p];
+        }
+
+        positive &= d > T(0);
+
+        a[j * n + j] = sqrt(d);
+
+        for (size_t i = j + 1; i < k + nb; ++i) {
+            T v = a[i * n + j];
+
+            for (size_t p = k; p < j; ++p) {
+                v -= a[i * n + p] * a[j * n + p];
+            }
+
+            a[i * n + j] = v / a[j * n + j];
+        }
+    }
+
+    // 2. Compute the block column below the diagonal block: L21 = A21 * L11^-T
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            for (size_t j = k; j < k + nb; ++j) {
+                T v = a[i * n + j];
+
+                for (size_t p = k; p < j; ++p) {
+                    v -= a[i * n + p] * a[j * n + p];
+                }
+
+                a[i * n + j] = v / a[j * n + j];
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, k + nb, n, (n - k - nb) * nb * nb >= parallel_threshold);
+
+    return positive;
+}
+
+/*!
+ * \brief Blocked, right-looking, Cholesky decomposition
+ *
+ * \param a The matrix to decompose in place [N, N]
+ * \param n The dimension of the matrix
+ * \param update The functor computing C -= A * B on blocks of the matrix
+ *
+ * \return true if the matrix is positive definite, false otherwise
+ */
+template <typename T, typename Update>
+bool cholesky_blocked(T* a, size_t n, Update update) {
+    bool positive = true;
+
+    std::vector<T> lt;
+
+    for (size_t k = 0; k < n; k += cholesky_block_size) {
+        const size_t nb = std::min(cholesky_block_size, n - k);
+
+        positive &= cholesky_panel(a, n, k, nb);
+
+        const size_t rest = n - k - nb;
+
+        if (rest) {
+            T* l21 = a + (k + nb) * n + k;
+            T* a22 = a + (k + nb) * n + k + nb;
+
+            // L21^T is needed as the right-hand side of the update
+            lt.resize(nb * rest);
+
+            for (size_t i = 0; i < rest; ++i) {
+                for (size_t p = 0; p < nb; ++p) {
+                    lt[p * rest + i] = l21[i * n + p];
+                }
+            }
+
+            // A22 -= L21 * L21^T, only on the lower part, by blocks of rows
+
+            for (size_t i = 0; i < rest; i += cholesky_block_size) {
+                const size_t rows = std::min(cholesky_block_size, rest - i);
+
+                update(l21 + i * n, n, lt.data(), rest, a22 + i * n, n, rows, i + rows, nb);
+            }
+        }
+    }
+
+    // Clear the strictly upper part
+
+    for (size_t i = 0; i < n; ++i) {
+        std::fill(a + i * n + i + 1, a + (i + 1) * n, T(0));
+    }
+
+    return positive;
+}
+
+/*!
+ * \brief Solve L * L^T * X = B in place.
+ *
+ * \param l The Cholesky decomposition [N, N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ * \param update The functor computing C -= A * B on blocks of matrices
+ */
+template <typename T, typename Update>
+void cholesky_solve_blocked(const T* l, T* b, size_t n, size_t m, Update update) {
+    // 1. Forward substitution with L
+
+    trsm_lower_blocked<false>(l, b, n, m, update);
+
+    // 2. Backward substitution with L^T, made contiguous
+
+    std::vector<T> u(n * n);
+
+    // The transposition is done by tiles to stay in cache
+    constexpr size_t tile = 32;
+
+    for (size_t ii = 0; ii < n; ii += tile) {
+        for (size_t jj = 0; jj <= ii; jj += tile) {
+            for (size_t i = ii; i < std::min(ii + tile, n); ++i) {
+                for (size_t j = jj; j < std::min(jj + tile, i + 1); ++j) {
+                    u[j * n + i] = l[i * n + j];
+                }
+            }
+        }
+    }
+
+    trsm_upper_blocked<false>(u.data(), b, n, m, update);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the Cholesky decomposition of a row-major symmetric
+ * positive definite matrix, in place.
+ *
+ * If the matrix is not positive definite, the decomposition is not stopped
+ * and the result contains NaN values.
+ *
+ * \param a The matrix to decompose in place [N, N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the matrix is positive definite, false otherwise
+ */
+template <typename T>
+bool cholesky_factor(T* a, size_t n) {
+    return detail::cholesky_blocked(a, n, [](auto&&... args) { block_update(args...); });
+}
+
+/*!
+ * \brief Solve A * X = B from the Cholesky decomposition of A.
+ *
+ * \param l The Cholesky decomposition of A [N, N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ */
+template <typename T>
+void cholesky_solve(const T* l, T* b, size_t n, size_t m) {
+    detail::cholesky_solve_blocked(l, b, n, m, [](auto&&... args) { block_update(args...); });
+}
+
+} //end of namespace etl::impl::standard
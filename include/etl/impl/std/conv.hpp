@@ -553,6 +553,642 @@ void conv4_valid_filter_flipped(const I& input, const K& kernel, C&& conv, size_
     }
 }
 
+/*!
+ * \brief Standard implementation of a 4D 'valid' grouped convolution C = I * K
+ *
+ * The input channels and the kernels are split in groups, each kernel is
+ * only convolved with the input channels of its group.
+ *
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_grouped(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(etl::dim<1>(input) == groups * etl::dim<1>(kernel), "Invalid number of channels");
+    cpp_assert(etl::dim<0>(kernel) == etl::dim<1>(conv), "Invalid number of kernels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    const size_t CG = etl::dim<1>(kernel);          // The number of channels per group
+    const size_t KG = etl::dim<0>(kernel) / groups; // The number of kernels per group
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+            const size_t g = k / KG;
+
+            for (size_t c = 0; c < CG; ++c) {
+                conv2_valid(input(i)(g * CG + c), kernel(k)(c), conv(i)(k), s1, s2, p1, p2, c ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 4D 'valid' grouped convolution C = I * K, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_grouped_flipped(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(etl::dim<1>(input) == groups * etl::dim<1>(kernel), "Invalid number of channels");
+    cpp_assert(etl::dim<0>(kernel) == etl::dim<1>(conv), "Invalid number of kernels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    const size_t CG = etl::dim<1>(kernel);          // The number of channels per group
+    const size_t KG = etl::dim<0>(kernel) / groups; // The number of kernels per group
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+            const size_t g = k / KG;
+
+            for (size_t c = 0; c < CG; ++c) {
+                conv2_valid_flipped(input(i)(g * CG + c), kernel(k)(c), conv(i)(k), s1, s2, p1, p2, c ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of the backward pass of a 4D 'valid' grouped convolution
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_grouped_back(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(etl::dim<1>(input) == etl::dim<0>(kernel), "Invalid number of kernels");
+    cpp_assert(etl::dim<1>(conv) == groups * etl::dim<1>(kernel), "Invalid number of channels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    const size_t CG = etl::dim<1>(kernel);          // The number of channels per group
+    const size_t KG = etl::dim<0>(kernel) / groups; // The number of kernels per group
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t c = 0; c < etl::dim<1>(conv); ++c) {
+            const size_t g = c / CG;
+
+            for (size_t k = 0; k < KG; ++k) {
+                conv2_valid(input(i)(g * KG + k), kernel(g * KG + k)(c % CG), conv(i)(c), s1, s2, p1, p2, k ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of the backward pass of a 4D 'valid' grouped convolution, with flipped kernels
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_grouped_back_flipped(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(etl::dim<1>(input) == etl::dim<0>(kernel), "Invalid number of kernels");
+    cpp_assert(etl::dim<1>(conv) == groups * etl::dim<1>(kernel), "Invalid number of channels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    const size_t CG = etl::dim<1>(kernel);          // The number of channels per group
+    const size_t KG = etl::dim<0>(kernel) / groups; // The number of kernels per group
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t c = 0; c < etl::dim<1>(conv); ++c) {
+            const size_t g = c / CG;
+
+            for (size_t k = 0; k < KG; ++k) {
+                conv2_valid_flipped(input(i)(g * KG + k), kernel(g * KG + k)(c % CG), conv(i)(c), s1, s2, p1, p2, k ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of the filter gradients of a 4D 'valid' grouped convolution
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_grouped_filter(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(kernel), "Invalid number of images");
+    cpp_assert(etl::dim<1>(kernel) == etl::dim<0>(conv), "Invalid number of kernels");
+    cpp_assert(etl::dim<1>(input) == groups * etl::dim<1>(conv), "Invalid number of channels");
+
+    const size_t CG = etl::dim<1>(conv);          // The number of channels per group
+    const size_t KG = etl::dim<0>(conv) / groups; // The number of kernels per group
+
+    for (size_t k = 0; k < etl::dim<0>(conv); ++k) {
+        const size_t g = k / KG;
+
+        for (size_t c = 0; c < CG; ++c) {
+            for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+                conv2_valid(input(i)(g * CG + c), kernel(i)(k), conv(k)(c), s1, s2, p1, p2, i ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of the filter gradients of a 4D 'valid' grouped convolution, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_grouped_filter_flipped(const I& input, const K& kernel, C&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(kernel), "Invalid number of images");
+    cpp_assert(etl::dim<1>(kernel) == etl::dim<0>(conv), "Invalid number of kernels");
+    cpp_assert(etl::dim<1>(input) == groups * etl::dim<1>(conv), "Invalid number of channels");
+
+    const size_t CG = etl::dim<1>(conv);          // The number of channels per group
+    const size_t KG = etl::dim<0>(conv) / groups; // The number of kernels per group
+
+    for (size_t k = 0; k < etl::dim<0>(conv); ++k) {
+        const size_t g = k / KG;
+
+        for (size_t c = 0; c < CG; ++c) {
+            for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+                conv2_valid_flipped(input(i)(g * CG + c), kernel(i)(k), conv(k)(c), s1, s2, p1, p2, i ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 2D 'valid' dilated convolution C = I * K
+ *
+ * The taps of the kernel are spaced by d1 rows and d2 columns over the
+ * (padded) input, without ever building the dilated kernel.
+ *
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename K, typename C>
+void conv2_valid_dilated(
+    const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2, value_t<I> beta = value_t<I>(0.0)) {
+    const size_t n1 = rows(input);
+    const size_t n2 = columns(input);
+    const size_t k1 = rows(kernel);
+    const size_t k2 = columns(kernel);
+
+    for (size_t i = 0; i < rows(conv); ++i) {
+        for (size_t j = 0; j < columns(conv); ++j) {
+            value_t<I> temp = 0.0;
+
+            for (size_t k = 0; k < k1; ++k) {
+                const size_t i_i = i * s1 + k * d1;
+
+                if (i_i < p1 || i_i - p1 >= n1) {
+                    continue;
+                }
+
+                for (size_t l = 0; l < k2; ++l) {
+                    const size_t i_j = j * s2 + l * d2;
+
+                    if (i_j >= p2 && i_j - p2 < n2) {
+                        temp += input(i_i - p1, i_j - p2) * kernel(k1 - 1 - k, k2 - 1 - l);
+                    }
+                }
+            }
+
+            if (beta == value_t<I>(0.0)) {
+                conv(i, j) = temp;
+            } else {
+                conv(i, j) = beta * conv(i, j) + temp;
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 2D 'valid' dilated convolution C = I * K, with a flipped kernel
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename K, typename C>
+void conv2_valid_dilated_flipped(
+    const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2, value_t<I> beta = value_t<I>(0.0)) {
+    const size_t n1 = rows(input);
+    const size_t n2 = columns(input);
+    const size_t k1 = rows(kernel);
+    const size_t k2 = columns(kernel);
+
+    for (size_t i = 0; i < rows(conv); ++i) {
+        for (size_t j = 0; j < columns(conv); ++j) {
+            value_t<I> temp = 0.0;
+
+            for (size_t k = 0; k < k1; ++k) {
+                const size_t i_i = i * s1 + k * d1;
+
+                if (i_i < p1 || i_i - p1 >= n1) {
+                    continue;
+                }
+
+                for (size_t l = 0; l < k2; ++l) {
+                    const size_t i_j = j * s2 + l * d2;
+
+                    if (i_j >= p2 && i_j - p2 < n2) {
+                        temp += input(i_i - p1, i_j - p2) * kernel(k, l);
+                    }
+                }
+            }
+
+            if (beta == value_t<I>(0.0)) {
+                conv(i, j) = temp;
+            } else {
+                conv(i, j) = beta * conv(i, j) + temp;
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 4D 'valid' dilated convolution C = I * K
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_dilated(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    cpp_assert(etl::dim<1>(input) == etl::dim<1>(kernel), "Invalid number of channels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+            for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
+                conv2_valid_dilated(input(i)(c), kernel(k)(c), conv(i)(k), s1, s2, p1, p2, d1, d2, c ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 4D 'valid' dilated convolution C = I * K, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_dilated_flipped(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    cpp_assert(etl::dim<1>(input) == etl::dim<1>(kernel), "Invalid number of channels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+            for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
+                conv2_valid_dilated_flipped(input(i)(c), kernel(k)(c), conv(i)(k), s1, s2, p1, p2, d1, d2, c ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of the backward pass of a 4D 'valid' dilated convolution
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_back_dilated(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    cpp_assert(etl::dim<1>(input) == etl::dim<0>(kernel), "Invalid dimensions for std::conv4_valid_back_dilated");
+    cpp_assert(etl::dim<1>(kernel) == etl::dim<1>(conv), "Invalid dimensions for std::conv4_valid_back_dilated");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid dimensions for std::conv4_valid_back_dilated");
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
+            for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+                conv2_valid_dilated(input(i)(k), kernel(k)(c), conv(i)(c), s1, s2, p1, p2, d1, d2, k ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of the backward pass of a 4D 'valid' dilated convolution, with flipped kernels
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_back_dilated_flipped(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    cpp_assert(etl::dim<1>(input) == etl::dim<0>(kernel), "Invalid dimensions for std::conv4_valid_back_dilated_flipped");
+    cpp_assert(etl::dim<1>(kernel) == etl::dim<1>(conv), "Invalid dimensions for std::conv4_valid_back_dilated_flipped");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid dimensions for std::conv4_valid_back_dilated_flipped");
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
+            for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+                conv2_valid_dilated_flipped(input(i)(k), kernel(k)(c), conv(i)(c), s1, s2, p1, p2, d1, d2, k ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 4D 'valid' dilated convolution C = I * K, where the output are considered to be kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_filter_dilated(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(kernel), "Invalid number of images");
+    cpp_assert(etl::dim<1>(input) == etl::dim<1>(conv), "Invalid number of channels");
+    cpp_assert(etl::dim<1>(kernel) == etl::dim<0>(conv), "Invalid number of kernels");
+
+    for (size_t k = 0; k < etl::dim<1>(kernel); ++k) {
+        for (size_t c = 0; c < etl::dim<1>(input); ++c) {
+            for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+                conv2_valid_dilated(input(i)(c), kernel(i)(k), conv(k)(c), s1, s2, p1, p2, d1, d2, i ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 4D 'valid' dilated convolution C = I * K, where the output are considered to be kernels, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename K, typename C>
+void conv4_valid_filter_dilated_flipped(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(kernel), "Invalid number of images");
+    cpp_assert(etl::dim<1>(input) == etl::dim<1>(conv), "Invalid number of channels");
+    cpp_assert(etl::dim<1>(kernel) == etl::dim<0>(conv), "Invalid number of kernels");
+
+    for (size_t k = 0; k < etl::dim<1>(kernel); ++k) {
+        for (size_t c = 0; c < etl::dim<1>(input); ++c) {
+            for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+                conv2_valid_dilated_flipped(input(i)(c), kernel(i)(k), conv(k)(c), s1, s2, p1, p2, d1, d2, i ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 3D 'valid' convolution C = I * K
+ *
+ * The output is computed for all its positions, the input voxels that fall
+ * into the padding are considered to be zeroes.
+ *
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param beta The scaling factor of the previous value of the output
+ */
+template <typename I, typename K, typename C>
+void conv3_valid(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3, value_t<I> beta = value_t<I>(0.0)) {
+    const size_t n1 = etl::dim<0>(input);
+    const size_t n2 = etl::dim<1>(input);
+    const size_t n3 = etl::dim<2>(input);
+    const size_t k1 = etl::dim<0>(kernel);
+    const size_t k2 = etl::dim<1>(kernel);
+    const size_t k3 = etl::dim<2>(kernel);
+
+    for (size_t i = 0; i < etl::dim<0>(conv); ++i) {
+        for (size_t j = 0; j < etl::dim<1>(conv); ++j) {
+            for (size_t jj = 0; jj < etl::dim<2>(conv); ++jj) {
+                value_t<I> temp = 0.0;
+
+                for (size_t k = 0; k < k1; ++k) {
+                    const size_t i_i = i * s1 + k;
+
+                    if (i_i < p1 || i_i - p1 >= n1) {
+                        continue;
+                    }
+
+                    for (size_t l = 0; l < k2; ++l) {
+                        const size_t i_j = j * s2 + l;
+
+                        if (i_j < p2 || i_j - p2 >= n2) {
+                            continue;
+                        }
+
+                        for (size_t m = 0; m < k3; ++m) {
+                            const size_t i_k = jj * s3 + m;
+
+                            if (i_k >= p3 && i_k - p3 < n3) {
+                                temp += input(i_i - p1, i_j - p2, i_k - p3) * kernel(k1 - 1 - k, k2 - 1 - l, k3 - 1 - m);
+                            }
+                        }
+                    }
+                }
+
+                if (beta == value_t<I>(0.0)) {
+                    conv(i, j, jj) = temp;
+                } else {
+                    conv(i, j, jj) = beta * conv(i, j, jj) + temp;
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 3D 'valid' convolution C = I * K, with a flipped kernel
+ *
+ * The output is computed for all its positions, the input voxels that fall
+ * into the padding are considered to be zeroes.
+ *
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param beta The scaling factor of the previous value of the output
+ */
+template <typename I, typename K, typename C>
+void conv3_valid_flipped(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3, value_t<I> beta = value_t<I>(0.0)) {
+    const size_t n1 = etl::dim<0>(input);
+    const size_t n2 = etl::dim<1>(input);
+    const size_t n3 = etl::dim<2>(input);
+    const size_t k1 = etl::dim<0>(kernel);
+    const size_t k2 = etl::dim<1>(kernel);
+    const size_t k3 = etl::dim<2>(kernel);
+
+    for (size_t i = 0; i < etl::dim<0>(conv); ++i) {
+        for (size_t j = 0; j < etl::dim<1>(conv); ++j) {
+            for (size_t jj = 0; jj < etl::dim<2>(conv); ++jj) {
+                value_t<I> temp = 0.0;
+
+                for (size_t k = 0; k < k1; ++k) {
+                    const size_t i_i = i * s1 + k;
+
+                    if (i_i < p1 || i_i - p1 >= n1) {
+                        continue;
+                    }
+
+                    for (size_t l = 0; l < k2; ++l) {
+                        const size_t i_j = j * s2 + l;
+
+                        if (i_j < p2 || i_j - p2 >= n2) {
+                            continue;
+                        }
+
+                        for (size_t m = 0; m < k3; ++m) {
+                            const size_t i_k = jj * s3 + m;
+
+                            if (i_k >= p3 && i_k - p3 < n3) {
+                                temp += input(i_i - p1, i_j - p2, i_k - p3) * kernel(k, l, m);
+                            }
+                        }
+                    }
+                }
+
+                if (beta == value_t<I>(0.0)) {
+                    conv(i, j, jj) = temp;
+                } else {
+                    conv(i, j, jj) = beta * conv(i, j, jj) + temp;
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 5D 'valid' convolution C = I * K
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename K, typename C>
+void conv5_valid(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    cpp_assert(etl::dim<1>(input) == etl::dim<1>(kernel), "Invalid number of channels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+            for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
+                conv3_valid(input(i)(c), kernel(k)(c), conv(i)(k), s1, s2, s3, p1, p2, p3, c ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 5D 'valid' convolution C = I * K, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename K, typename C>
+void conv5_valid_flipped(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    cpp_assert(etl::dim<1>(input) == etl::dim<1>(kernel), "Invalid number of channels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+            for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
+                conv3_valid_flipped(input(i)(c), kernel(k)(c), conv(i)(k), s1, s2, s3, p1, p2, p3, c ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of the backward pass of a 5D 'valid' convolution
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename K, typename C>
+void conv5_valid_back(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    cpp_assert(etl::dim<1>(input) == etl::dim<0>(kernel), "Invalid number of kernels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
+            for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+                conv3_valid(input(i)(k), kernel(k)(c), conv(i)(c), s1, s2, s3, p1, p2, p3, k ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of the backward pass of a 5D 'valid' convolution, with flipped kernels
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename K, typename C>
+void conv5_valid_back_flipped(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    cpp_assert(etl::dim<1>(input) == etl::dim<0>(kernel), "Invalid number of kernels");
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(conv), "Invalid number of images");
+
+    for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+        for (size_t c = 0; c < etl::dim<1>(kernel); ++c) {
+            for (size_t k = 0; k < etl::dim<0>(kernel); ++k) {
+                conv3_valid_flipped(input(i)(k), kernel(k)(c), conv(i)(c), s1, s2, s3, p1, p2, p3, k ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 5D 'valid' convolution C = I * K, where the output are considered to be kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ */
+template <typename I, typename K, typename C>
+void conv5_valid_filter(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(kernel), "Invalid number of images");
+    cpp_assert(etl::dim<1>(input) == etl::dim<1>(conv), "Invalid number of channels");
+    cpp_assert(etl::dim<1>(kernel) == etl::dim<0>(conv), "Invalid number of kernels");
+
+    for (size_t k = 0; k < etl::dim<1>(kernel); ++k) {
+        for (size_t c = 0; c < etl::dim<1>(input); ++c) {
+            for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+                conv3_valid(input(i)(c), kernel(i)(k), conv(k)(c), s1, s2, s3, p1, p2, p3, i ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Standard implementation of a 5D 'valid' convolution C = I * K, where the output are considered to be kernels, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ */
+template <typename I, typename K, typename C>
+void conv5_valid_filter_flipped(const I& input, const K& kernel, C&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    cpp_assert(etl::dim<0>(input) == etl::dim<0>(kernel), "Invalid number of images");
+    cpp_assert(etl::dim<1>(input) == etl::dim<1>(conv), "Invalid number of channels");
+    cpp_assert(etl::dim<1>(kernel) == etl::dim<0>(conv), "Invalid number of kernels");
+
+    for (size_t k = 0; k < etl::dim<1>(kernel); ++k) {
+        for (size_t c = 0; c < etl::dim<1>(input); ++c) {
+            for (size_t i = 0; i < etl::dim<0>(input); ++i) {
+                conv3_valid_flipped(input(i)(c), kernel(i)(k), conv(k)(c), s1, s2, s3, p1, p2, p3, i ? 1.0 : 0.0);
+            }
+        }
+    }
+}
+
 /*!
  * \brief Standard implementation of a 4D 'valid' convolution C = I * K
  * \param input The input matrix
@@ -12,10 +12,31 @@
 
 #pragma once
 
+namespace etl::detail {
+
+/*!
+ * \copydoc etl::impl::standard::lu_factor
+ */
+template <typename T>
+bool lu_factor(T* a, size_t* piv, size_t n);
+
+} //end of namespace etl::detail
+
+namespace etl {
+
+template <typename T>
+struct qr_decomposition;
+
+} //end of namespace etl
+
 namespace etl::impl::standard {
 
 /*!
  * \brief Performs the PA=LU decomposition of the matrix A
+ *
+ * The decomposition is done in place on a row-major copy of A, with the
+ * blocked LU decomposition. L, U and P are only extracted at the end.
+ *
  * \param A The matrix to decompose
  * \param L The resulting L matrix
  * \param U The resulting U matrix
@@ -23,149 +44,87 @@ namespace etl::impl::standard {
  */
 template <typename AT, typename LT, typename UT, typename PT>
 void lu(const AT& A, LT& L, UT& U, PT& P) {
+    using T = value_t<AT>;
+
     const auto n = etl::dim(A, 0);
 
+    // 1. Decompose a row-major copy of A
+
+    etl::dyn_matrix<T, 2> LU(n, n);
+    LU = A;
+
+    std::vector<size_t> piv(n);
+
+    etl::detail::lu_factor(LU.memory_start(), piv.data(), n);
+
+    // 2. Extract L and U
+
     L = 0;
     U = 0;
     P = 0;
 
-    // 1. Create the pivot matrix
-
     for (size_t i = 0; i < n; ++i) {
-        P(i, i) = 1;
-    }
+        for (size_t j = 0; j < i; ++j) {
+            L(i, j) = LU(i, j);
+        }
 
-    for (size_t i = 0; i < n; ++i) {
-        auto max_j = i;
+        L(i, i) = 1;
 
         for (size_t j = i; j < n; ++j) {
-            if (std::abs(A(j, i)) > A(max_j, i)) {
-                max_j = j;
-            }
-        }
-
-        if (max_j != i) {
-            for (size_t k = 0; k < n; ++k) {
-                using std::swap;
-                swap(P(i, k), P(max_j, k));
-            }
+            U(i, j) = LU(i, j);
         }
     }
 
-    auto Ap = etl::force_temporary(P * A);
+    // 3. Create the permutation matrix from the row interchanges
+
+    std::vector<size_t> perm(n);
+    std::iota(perm.begin(), perm.end(), size_t(0));
 
     for (size_t i = 0; i < n; ++i) {
-        L(i, i) = 1;
+        std::swap(perm[i], perm[piv[i]]);
     }
 
     for (size_t i = 0; i < n; ++i) {
-        for (size_t j = 0; j < n; ++j) {
-            if (j <= i) {
-                value_t<AT> s = 0;
-                for (size_t k = 0; k < j; ++k) {
-                    s += L(j, k) * U(k, i);
-                }
-
-                U(j, i) = Ap(j, i) - s;
-            }
-
-            if (j >= i) {
-                value_t<AT> s = 0;
-                for (size_t k = 0; k < i; ++k) {
-                    s += L(j, k) * U(k, i);
-                }
-
-                L(j, i) = (Ap(j, i) - s) / U(i, i);
-            }
-        }
+        P(i, perm[i]) = 1;
     }
 }
 
 /*!
- * \brief Use the householder algorithm to perform the A=QR decomposition of the matrix A
+ * \brief Performs the A=QR decomposition of the matrix A
+ *
+ * The decomposition is done with the blocked Householder QR decomposition.
+ * Q is formed explicitly by applying it to the identity.
+ *
  * \param A The matrix to decompose
  * \param Q The resulting Q matrix
  * \param R The resulting R matrix
  */
 template <typename AT, typename QT, typename RT>
-void householder(AT& A, QT& Q, RT& R) {
+void qr(AT& A, QT& Q, RT& R) {
     using T = value_t<AT>;
 
     const auto m = etl::dim<0>(A);
     const auto n = etl::dim<1>(A);
 
-    std::vector<etl::dyn_matrix<T, 2>> q;
-    q.reserve(m);
+    etl::qr_decomposition<T> decomposition(A);
+
+    Q = 0;
 
     for (size_t i = 0; i < m; ++i) {
-        q.emplace_back(m, m);
+        Q(i, i) = 1;
     }
 
-    etl::dyn_matrix<T> z(m, n);
-    z = A;
+    decomposition.apply_q(Q);
 
-    for (size_t k = 0; k < n && k < m - 1; k++) {
-        etl::dyn_matrix<T> zz(m, n, T(0));
+    auto r = decomposition.r();
 
-        for (size_t i = 0; i < k; ++i) {
-            zz(i, i) = 1;
-        }
+    R = 0;
 
-        for (size_t i = k; i < m; ++i) {
-            for (size_t j = k; j < n; ++j) {
-                zz(i, j) = z(i, j);
-            }
-        }
-
-        z = std::move(zz);
-
-        // x -> Take k-th column of z
-        etl::dyn_vector<T> x(m);
-
-        for (size_t i = 0; i < m; ++i) {
-            x[i] = z(i, k);
-        }
-
-        auto a = norm(x);
-        if (A(k, k) > 0) {
-            a = -a;
-        }
-
-        x[k] += a;
-
-        x /= norm(x);
-
-        for (size_t i = 0; i < m; ++i) {
-            for (size_t j = 0; j < m; ++j) {
-                q[k](i, j) = T(-2) * x[i] * x[j];
-            }
-
-            q[k](i, i) += 1;
+    for (size_t i = 0; i < etl::dim<0>(r); ++i) {
+        for (size_t j = i; j < n; ++j) {
+            R(i, j) = r(i, j);
         }
-
-        z = q[k] * z;
-    }
-
-    Q = q[0];
-
-    for (size_t i = 1; i < n && i < m - 1; i++) {
-        Q = q[i] * Q;
     }
-
-    R = Q * A;
-
-    Q = transpose(Q);
-}
-
-/*!
- * \brief Performs the A=QR decomposition of the matrix A
- * \param A The matrix to decompose
- * \param Q The resulting Q matrix
- * \param R The resulting R matrix
- */
-template <typename AT, typename QT, typename RT>
-void qr(AT& A, QT& Q, RT& R) {
-    householder(A, Q, R);
 }
 
 } //end of namespace etl::impl::standard
@@ -14,11 +14,15 @@
 
 namespace etl {
 
+namespace detail {
+
 /*!
- * \copydoc etl::lu
+ * \copydoc etl::impl::standard::lu_factor
  */
-template <typename AT, typename LT, typename UT, typename PT>
-bool lu(const AT& A, LT& L, UT& U, PT& P);
+template <typename T>
+bool lu_factor(T* a, size_t* piv, size_t n);
+
+} //end of namespace detail
 
 namespace impl {
 
@@ -34,37 +38,62 @@ value_t<AT> det(const AT& A) {
 
     const auto n = etl::dim<0>(A);
 
-    if (is_permutation_matrix(A)) {
-        size_t t = 0;
+    // The determinant of a triangular matrix is the product of its diagonal
+    if constexpr (is_diagonal_matrix<AT> || is_lower_adapter<AT> || is_upper_adapter<AT> || is_strictly_lower_matrix<AT> || is_strictly_upper_matrix<AT>) {
+        T det(1.0);
 
         for (size_t i = 0; i < n; ++i) {
-            for (size_t j = 0; j < n; ++j) {
-                if (A(i, j) != 0.0 && i != j) {
-                    ++t;
+            det *= A(i, i);
+        }
+
+        return det;
+    } else {
+        if (is_permutation_matrix(A)) {
+            size_t t = 0;
+
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    if (A(i, j) != 0.0 && i != j) {
+                        ++t;
+                    }
                 }
             }
+
+            return std::pow(T(-1.0), t - 1);
         }
 
-        return std::pow(T(-1.0), t - 1);
-    }
+        if (is_triangular(A)) {
+            T det(1.0);
+
+            for (size_t i = 0; i < n; ++i) {
+                det *= A(i, i);
+            }
+
+            return det;
+        }
+
+        // The determinant is the product of the diagonal of U, with the sign
+        // of the row interchanges
+
+        etl::dyn_matrix<T, 2> LU(n, n);
+        LU = A;
+
+        std::vector<size_t> piv(n);
+
+        etl::detail::lu_factor(LU.memory_start(), piv.data(), n);
 
-    if (is_triangular(A)) {
         T det(1.0);
 
         for (size_t i = 0; i < n; ++i) {
-            det *= A(i, i);
+            det *= LU(i, i);
+
+            if (piv[i] != i) {
+                det = -det;
+            }
         }
 
         return det;
     }
-
-    auto L = force_temporary_dim_only(A);
-    auto U = force_temporary_dim_only(A);
-    auto P = force_temporary_dim_only(A);
-
-    etl::lu(A, L, U, P);
-
-    return det(L) * det(U) * det(P);
 }
 
 } //end of namespace standard
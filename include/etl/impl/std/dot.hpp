@@ -16,13 +16,29 @@ namespace etl::impl::standard {
 
 /*!
  * \brief Compute the dot product of a and b
+ *
+ * 16-bit floating point values are accumulated in single precision.
+ *
  * \param a The lhs expression
  * \param b The rhs expression
  * \return the sum
  */
 template <typename A, typename B>
 value_t<A> dot(const A& a, const B& b) {
-    return sum(scale(a, b));
+    if constexpr (is_float16_t<value_t<A>>) {
+        // The products are accumulated in single precision
+        using T = accumulate_t<value_t<A>>;
+
+        T acc(0);
+
+        for (size_t i = 0; i < etl::size(a); ++i) {
+            acc += T(a[i]) * T(b[i]);
+        }
+
+        return value_t<A>(acc);
+    } else {
+        return sum(scale(a, b));
+    }
 }
 
 } //end of namespace etl::impl::standard
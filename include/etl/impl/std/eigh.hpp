@@ -0,0 +1,561 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the eigendecomposition of symmetric
+ * matrices.
+ *
+ * The matrix is first reduced to a tridiagonal matrix T = Q^T A Q with
+ * Householder reflectors. The eigenvalues and eigenvectors of T are then
+ * computed with the implicit QL algorithm and the eigenvectors of A are
+ * obtained by applying Q, in compact WY form, to the eigenvectors of T.
+ *
+ * The Givens rotations of each QL sweep are accumulated on the transposed
+ * eigenvectors, where they combine contiguous rows, and they are applied by
+ * blocks of columns, in parallel.
+ *
+ * The loops over the rows of the matrices are done by the kernels given as
+ * template parameter, which are vectorized by the vectorized implementation.
+ */
+
+#pragma once
+
+#include "etl/impl/std/qr.hpp"
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief The maximum number of QL or QR iterations for one eigenvalue or
+ * one singular value
+ */
+constexpr size_t eigen_max_iterations = 30;
+
+/*!
+ * \brief The number of columns on which the Givens rotations of a sweep are
+ * applied at once
+ */
+constexpr size_t rotation_block = 256;
+
+namespace detail {
+
+/*!
+ * \brief The standard kernels of the reductions to condensed form and of
+ * the QL and QR iterations
+ */
+struct eigen_kernels {
+    /*!
+     * \brief Compute C -= A * B on blocks of row-major matrices
+     * \param args The blocks and their dimensions
+     */
+    template <typename... Args>
+    static void update(Args&&... args) {
+        block_update(args...);
+    }
+
+    /*!
+     * \brief Rotate two rows: (x, y) = (c x + s y, c y - s x)
+     * \param x The first row
+     * \param y The second row
+     * \param c The cosine of the rotation
+     * \param s The sine of the rotation
+     * \param n The number of elements
+     */
+    template <typename T>
+    static void rotate(T* x, T* y, T c, T s, size_t n) {
+        for (size_t k = 0; k < n; ++k) {
+            const T a = x[k];
+            const T b = y[k];
+
+            x[k] = c * a + s * b;
+            y[k] = c * b - s * a;
+        }
+    }
+
+    /*!
+     * \brief Compute y += alpha * x
+     * \param y The vector to update
+     * \param x The vector to add
+     * \param alpha The scaling factor
+     * \param n The number of elements
+     */
+    template <typename T>
+    static void axpy(T* y, const T* x, T alpha, size_t n) {
+        for (size_t k = 0; k < n; ++k) {
+            y[k] += alpha * x[k];
+        }
+    }
+
+    /*!
+     * \brief Compute the dot product of two vectors
+     * \param x The first vector
+     * \param y The second vector
+     * \param n The number of elements
+     * \return the dot product of x and y
+     */
+    template <typename T>
+    static T dot(const T* x, const T* y, size_t n) {
+        T acc(0);
+
+        for (size_t k = 0; k < n; ++k) {
+            acc += x[k] * y[k];
+        }
+
+        return acc;
+    }
+};
+
+/*!
+ * \brief A Givens rotation of two rows i and j:
+ * (r_i, r_j) = (c r_i + s r_j, c r_j - s r_i)
+ */
+template <typename T>
+struct givens_rotation {
+    size_t i; ///< The first row
+    size_t j; ///< The second row
+    T c;      ///< The cosine of the rotation
+    T s;      ///< The sine of the rotation
+};
+
+/*!
+ * \brief Apply a sequence of Givens rotations to the rows of a matrix
+ *
+ * \tparam Kernels The row kernels
+ *
+ * \param z The matrix to transform in place [N, N]
+ * \param n The dimension of the matrix
+ * \param rotations The rotations to apply, in order
+ */
+template <typename Kernels, typename T>
+void apply_rotations(T* z, size_t n, const std::vector<givens_rotation<T>>& rotations) {
+    if (rotations.empty()) {
+        return;
+    }
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t kk = first; kk < last; kk += rotation_block) {
+            const size_t kl = std::min(kk + rotation_block, last);
+
+            for (auto& rot : rotations) {
+                Kernels::rotate(z + rot.i * n + kk, z + rot.j * n + kk, rot.c, rot.s, kl - kk);
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, n, rotations.size() * n >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute a Householder reflector H = I - tau v v^T such that
+ * H x = (beta, 0, ..., 0).
+ *
+ * The elements of v after the first one, which is an implicit one, are
+ * stored in place of x.
+ *
+ * \tparam Kernels The row kernels
+ *
+ * \param x The vector to reflect
+ * \param n The size of the vector
+ * \param beta The first element of the reflected vector
+ *
+ * \return The scalar factor (tau) of the reflector
+ */
+template <typename Kernels, typename T>
+T householder(T* x, size_t n, T& beta) {
+    using std::sqrt;
+
+    const T alpha = x[0];
+    const T sigma = n > 1 ? Kernels::dot(x + 1, x + 1, n - 1) : T(0);
+
+    if (sigma == T(0)) {
+        beta = alpha;
+        return T(0);
+    }
+
+    beta = sqrt(alpha * alpha + sigma);
+
+    if (alpha >= T(0)) {
+        beta = -beta;
+    }
+
+    const T scale = T(1) / (alpha - beta);
+
+    for (size_t i = 1; i < n; ++i) {
+        x[i] *= scale;
+    }
+
+    return (beta - alpha) / beta;
+}
+
+/*!
+ * \brief Compute C = Q * C, for Q = H_0 H_1 ... H_{n-2}, the product of the
+ * reflectors of a reduction to tridiagonal or bidiagonal form.
+ *
+ * The reflector H_k acts on the rows [k + 1, N) and its vector is stored in
+ * the row k of the reduced matrix, from the column k + 2, its first element
+ * being an implicit one.
+ *
+ * \tparam Kernels The row kernels
+ *
+ * \param a The reduced matrix [N, N]
+ * \param tau The scalar factors of the reflectors [N - 1]
+ * \param n The dimension of the matrix
+ * \param c The matrix to transform in place [N, N]
+ */
+template <typename Kernels, typename T>
+void apply_row_reflectors(const T* a, const T* tau, size_t n, T* c) {
+    if (n < 2) {
+        return;
+    }
+
+    // The vectors are laid out like the ones of a QR decomposition of
+    // a [N - 1, N - 1] matrix, which applies them with matrix products
+
+    const size_t p = n - 1;
+
+    std::vector<T> v(p * p, T(0));
+    std::vector<T> t(p * qr_block_size);
+
+    for (size_t k = 0; k < p; ++k) {
+        for (size_t i = k + 1; i < p; ++i) {
+            v[i * p + k] = a[k * n + i + 1];
+        }
+    }
+
+    qr_form_t(v.data(), tau, t.data(), p, p);
+
+    qr_apply_blocked<false>(v.data(), t.data(), p, p, c + n, n, [](auto&&... args) { Kernels::update(args...); });
+}
+
+/*!
+ * \brief Reduce a symmetric matrix to tridiagonal form, T = Q^T A Q
+ *
+ * The update of the trailing matrix by a reflector is done in the same pass
+ * as the product of the trailing matrix with the next reflector, which
+ * makes a single pass over the trailing matrix per column.
+ *
+ * \tparam Kernels The row kernels
+ *
+ * \param a The symmetric matrix, with both parts, reduced in place [N, N]
+ * \param n The dimension of the matrix
+ * \param d The diagonal of T [N]
+ * \param e The off-diagonal of T, e[k] being T(k, k + 1) [N]
+ * \param tau The scalar factors of the reflectors [N - 1]
+ */
+template <typename Kernels, typename T>
+void tridiagonalize(T* a, size_t n, T* d, T* e, T* tau) {
+    std::fill_n(e, n, T(0));
+
+    if (n < 2) {
+        if (n) {
+            d[0] = a[0];
+        }
+
+        return;
+    }
+
+    std::vector<T> v(n);
+    std::vector<T> v_next(n);
+    std::vector<T> p(n);
+    std::vector<T> p_next(n);
+    std::vector<T> w(n);
+
+    // Prepare the first reflector and p = tau S v, S being the trailing matrix
+
+    d[0]   = a[0];
+    tau[0] = householder<Kernels>(a + 1, n - 1, e[0]);
+
+    v[0] = T(1);
+    std::copy(a + 2, a + n, v.begin() + 1);
+
+    engine_dispatch_1d_serial([&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            p[i] = tau[0] * Kernels::dot(a + (i + 1) * n + 1, v.data(), n - 1);
+        }
+    }, 0, n - 1, n * n >= parallel_threshold);
+
+    for (size_t k = 0; k + 1 < n; ++k) {
+        const size_t q = n - k - 1;
+
+        T* s = a + (k + 1) * n + k + 1;
+
+        // w = p - (tau / 2) (p^T v) v, S = H S H = S - v w^T - w v^T
+
+        const T alpha = -(tau[k] / T(2)) * Kernels::dot(p.data(), v.data(), q);
+
+        std::copy_n(p.begin(), q, w.begin());
+
+        Kernels::axpy(w.data(), v.data(), alpha, q);
+
+        // The first row of S is updated first, it holds the next reflector
+
+        Kernels::axpy(s, w.data(), -v[0], q);
+        Kernels::axpy(s, v.data(), -w[0], q);
+
+        d[k + 1] = s[0];
+
+        if (q == 1) {
+            break;
+        }
+
+        const T tau_next = householder<Kernels>(s + 1, q - 1, e[k + 1]);
+
+        tau[k + 1] = tau_next;
+
+        v_next[0] = T(1);
+        std::copy(s + 2, s + q, v_next.begin() + 1);
+
+        // Update the other rows and compute p = tau S v for the next reflector
+
+        auto batch_fun = [&](const size_t first, const size_t last) {
+            for (size_t i = first; i < last; ++i) {
+                T* s_i = s + i * n;
+
+                Kernels::axpy(s_i, w.data(), -v[i], q);
+                Kernels::axpy(s_i, v.data(), -w[i], q);
+
+                p_next[i - 1] = tau_next * Kernels::dot(s_i + 1, v_next.data(), q - 1);
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 1, q, q * q >= parallel_threshold);
+
+        std::swap(v, v_next);
+        std::swap(p, p_next);
+    }
+}
+
+/*!
+ * \brief Compute the eigenvalues, and optionally the eigenvectors, of a
+ * symmetric tridiagonal matrix with the implicit QL algorithm.
+ *
+ * \tparam Kernels The row kernels
+ *
+ * \param d The diagonal of the matrix, replaced by the eigenvalues [N]
+ * \param e The off-diagonal of the matrix, e[k] being T(k, k + 1), destroyed [N]
+ * \param zt The transposed vectors to transform by the rotations, or nullptr [N, N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the algorithm converged, false otherwise
+ */
+template <typename Kernels, typename T>
+bool tridiagonal_ql(T* d, T* e, T* zt, size_t n) {
+    using std::abs;
+    using std::hypot;
+
+    const T eps = std::numeric_limits<T>::epsilon();
+
+    std::vector<givens_rotation<T>> rotations;
+
+    for (size_t l = 0; l < n; ++l) {
+        size_t iterations = 0;
+        size_t m;
+
+        do {
+            // Look for a negligible off-diagonal element to split the matrix
+
+            for (m = l; m + 1 < n; ++m) {
+                const T dd = abs(d[m]) + abs(d[m + 1]);
+
+                if (abs(e[m]) <= eps * dd) {
+                    break;
+                }
+            }
+
+            if (m == l) {
+                break;
+            }
+
+            if (iterations++ == eigen_max_iterations) {
+                return false;
+            }
+
+            // Wilkinson shift
+
+            T g = (d[l + 1] - d[l]) / (T(2) * e[l]);
+            T r = hypot(g, T(1));
+
+            g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+
+            T s(1);
+            T c(1);
+            T p(0);
+
+            bool underflow = false;
+
+            for (size_t i = m; i-- > l;) {
+                const T f = s * e[i];
+                const T b = c * e[i];
+
+                r        = hypot(f, g);
+                e[i + 1] = r;
+
+                if (r == T(0)) {
+                    d[i + 1] -= p;
+                    e[m] = T(0);
+                    underflow = true;
+                    break;
+                }
+
+                s = f / r;
+                c = g / r;
+                g = d[i + 1] - p;
+                r = (d[i] - g) * s + T(2) * c * b;
+                p = s * r;
+
+                d[i + 1] = g + p;
+                g        = c * r - b;
+
+                if (zt) {
+                    rotations.push_back({i, i + 1, c, -s});
+                }
+            }
+
+            if (zt) {
+                apply_rotations<Kernels>(zt, n, rotations);
+                rotations.clear();
+            }
+
+            if (!underflow) {
+                d[l] -= p;
+                e[l] = g;
+                e[m] = T(0);
+            }
+        } while (true);
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Sort eigenvalues, or singular values, and their vectors
+ *
+ * \tparam Ascending Indicates if the values are sorted in ascending order
+ *
+ * \param d The values [N]
+ * \param n The number of values
+ * \param z1 The first transposed vectors, or nullptr [N, N]
+ * \param z2 The second transposed vectors, or nullptr [N, N]
+ */
+template <bool Ascending, typename T>
+void sort_values(T* d, size_t n, T* z1, T* z2) {
+    for (size_t i = 0; i + 1 < n; ++i) {
+        size_t b = i;
+
+        for (size_t j = i + 1; j < n; ++j) {
+            if (Ascending ? d[j] < d[b] : d[j] > d[b]) {
+                b = j;
+            }
+        }
+
+        if (b != i) {
+            std::swap(d[i], d[b]);
+
+            if (z1) {
+                std::swap_ranges(z1 + i * n, z1 + (i + 1) * n, z1 + b * n);
+            }
+
+            if (z2) {
+                std::swap_ranges(z2 + i * n, z2 + (i + 1) * n, z2 + b * n);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Transpose a square matrix into another one, by tiles
+ *
+ * \param a The matrix to transpose [N, N]
+ * \param b The transposed matrix [N, N]
+ * \param n The dimension of the matrices
+ */
+template <typename T>
+void transpose_square(const T* a, T* b, size_t n) {
+    constexpr size_t tile = 32;
+
+    for (size_t ii = 0; ii < n; ii += tile) {
+        for (size_t jj = 0; jj < n; jj += tile) {
+            for (size_t i = ii; i < std::min(ii + tile, n); ++i) {
+                for (size_t j = jj; j < std::min(jj + tile, n); ++j) {
+                    b[j * n + i] = a[i * n + j];
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Eigendecomposition of a symmetric matrix
+ *
+ * \tparam Kernels The row kernels
+ *
+ * \param a The symmetric matrix, only its lower part is used, destroyed [N, N]
+ * \param w The eigenvalues, in ascending order [N]
+ * \param v The eigenvectors, in columns, or nullptr [N, N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the algorithm converged, false otherwise
+ */
+template <typename Kernels, typename T>
+bool eigh_blocked(T* a, T* w, T* v, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = i + 1; j < n; ++j) {
+            a[i * n + j] = a[j * n + i];
+        }
+    }
+
+    std::vector<T> e(n);
+    std::vector<T> tau(n);
+
+    tridiagonalize<Kernels>(a, n, w, e.data(), tau.data());
+
+    if (!v) {
+        const bool converged = tridiagonal_ql<Kernels>(w, e.data(), static_cast<T*>(nullptr), n);
+
+        std::sort(w, w + n);
+
+        return converged;
+    }
+
+    std::vector<T> zt(n * n, T(0));
+
+    for (size_t i = 0; i < n; ++i) {
+        zt[i * n + i] = T(1);
+    }
+
+    const bool converged = tridiagonal_ql<Kernels>(w, e.data(), zt.data(), n);
+
+    sort_values<true>(w, n, zt.data(), static_cast<T*>(nullptr));
+
+    // V = Q Z
+
+    transpose_square(zt.data(), v, n);
+
+    apply_row_reflectors<Kernels>(a, tau.data(), n, v);
+
+    return converged;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the eigenvalues, and optionally the eigenvectors, of a
+ * row-major symmetric matrix.
+ *
+ * \param a The symmetric matrix, only its lower part is used, destroyed [N, N]
+ * \param w The eigenvalues, in ascending order [N]
+ * \param v The eigenvectors, in columns, or nullptr [N, N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the algorithm converged, false otherwise
+ */
+template <typename T>
+bool eigh(T* a, T* w, T* v, size_t n) {
+    return detail::eigh_blocked<detail::eigen_kernels>(a, w, v, n);
+}
+
+} //end of namespace etl::impl::standard
@@ -0,0 +1,188 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the embedding lookup and gradients
+ *
+ * The lookup is a parallel gather of the rows of the vocabulary, with a
+ * software prefetch of the rows of the upcoming indices, since the rows of
+ * large vocabularies are very unlikely to be in cache.
+ *
+ * The gradients are computed by first grouping the positions of identical
+ * indices. Each unique row is then accumulated by a single thread, which
+ * makes the scatter conflict-free and parallel.
+ */
+
+#pragma once
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief The number of indices ahead of the current one whose rows are
+ * prefetched by the embedding lookup.
+ */
+constexpr size_t embedding_prefetch_distance = 8;
+
+namespace detail {
+
+/*!
+ * \brief Prefetch the given row of the vocabulary
+ * \param row The first element of the row
+ * \param D The number of elements of the row
+ */
+template <typename T>
+void embedding_prefetch([[maybe_unused]] const T* row, [[maybe_unused]] size_t D) {
+#ifdef __GNUC__
+    static constexpr size_t line = 64 / sizeof(T);
+
+    for (size_t j = 0; j < D; j += line) {
+        __builtin_prefetch(row + j, 0, 0);
+    }
+#endif
+}
+
+/*!
+ * \brief Gather the rows of the vocabulary for a range of indices
+ * \param ids The indices
+ * \param vocab The vocabulary
+ * \param out The output rows
+ * \param n The number of indices
+ * \param D The size of the embeddings
+ * \param first The first index
+ * \param last The end of the range of indices
+ */
+template <typename I, typename V, typename T>
+void embedding_gather(const I* ids, const V* vocab, T* out, size_t n, size_t D, size_t first, size_t last) {
+    for (size_t i = first; i < first + embedding_prefetch_distance && i < n; ++i) {
+        embedding_prefetch(vocab + size_t(ids[i]) * D, D);
+    }
+
+    for (size_t i = first; i < last; ++i) {
+        if (i + embedding_prefetch_distance < n) {
+            embedding_prefetch(vocab + size_t(ids[i + embedding_prefetch_distance]) * D, D);
+        }
+
+        direct_copy_n(vocab + size_t(ids[i]) * D, out + i * D, D);
+    }
+}
+
+/*!
+ * \brief Group the positions of identical indices.
+ *
+ * The positions are sorted by index, the positions of the same index being
+ * kept in their original order. After the call, the positions of the gth
+ * unique index are order[starts[g]] to order[starts[g + 1]].
+ *
+ * \param ids The indices
+ * \param n The number of indices
+ * \param order The sorted positions
+ * \param starts The start of each group in order, followed by n
+ */
+template <typename I>
+void embedding_groups(const I* ids, size_t n, std::vector<size_t>& order, std::vector<size_t>& starts) {
+    order.resize(n);
+    std::iota(order.begin(), order.end(), size_t(0));
+
+    std::stable_sort(order.begin(), order.end(), [ids](size_t lhs, size_t rhs) { return size_t(ids[lhs]) < size_t(ids[rhs]); });
+
+    starts.clear();
+
+    for (size_t i = 0; i < n; ++i) {
+        if (!i || size_t(ids[order[i]]) != size_t(ids[order[i - 1]])) {
+            starts.push_back(i);
+        }
+    }
+
+    starts.push_back(n);
+}
+
+/*!
+ * \brief Sum the errors of the positions of a group into a row
+ * \param errors The errors
+ * \param order The sorted positions
+ * \param first The first position of the group in order
+ * \param last The end of the group in order
+ * \param out The output row
+ * \param D The size of the embeddings
+ */
+template <typename E, typename T>
+void embedding_accumulate(const E* errors, const size_t* order, size_t first, size_t last, T* out, size_t D) {
+    direct_copy_n(errors + order[first] * D, out, D);
+
+    for (size_t p = first + 1; p < last; ++p) {
+        const E* row = errors + order[p] * D;
+
+        for (size_t j = 0; j < D; ++j) {
+            out[j] += row[j];
+        }
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Gather the rows of the vocabulary for each index.
+ *
+ * The indices can be of any dimensions, the output has one row for each of
+ * them, in the same order.
+ *
+ * \param ids The indices
+ * \param vocab The vocabulary
+ * \param out The output
+ */
+template <typename I, typename V, typename L>
+void embedding_lookup(const I& ids, const V& vocab, L&& out) {
+    const size_t n = etl::size(ids);
+    const size_t D = etl::dim<1>(vocab);
+
+    auto* ids_m   = ids.memory_start();
+    auto* vocab_m = vocab.memory_start();
+    auto* out_m   = out.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) { detail::embedding_gather(ids_m, vocab_m, out_m, n, D, first, last); };
+
+    engine_dispatch_1d_serial(batch_fun, 0, n, n * D >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute the dense gradients of the vocabulary.
+ *
+ * Only the rows of the vocabulary that are referenced by the indices are
+ * written after the output has been cleared, each by a single thread.
+ *
+ * \param ids The indices
+ * \param errors The errors, one row for each index
+ * \param out The output gradients, of the size of the vocabulary
+ */
+template <typename I, typename E, typename L>
+void embedding_gradients(const I& ids, const E& errors, L&& out) {
+    const size_t n = etl::size(ids);
+    const size_t D = etl::dim<1>(out);
+
+    std::vector<size_t> order;
+    std::vector<size_t> starts;
+
+    auto* ids_m = ids.memory_start();
+
+    detail::embedding_groups(ids_m, n, order, starts);
+
+    out = 0;
+
+    auto* errors_m = errors.memory_start();
+    auto* out_m    = out.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t g = first; g < last; ++g) {
+            detail::embedding_accumulate(errors_m, order.data(), starts[g], starts[g + 1], out_m + size_t(ids_m[order[starts[g]]]) * D, D);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, starts.size() - 1, n * D >= parallel_threshold);
+}
+
+} //end of namespace etl::impl::standard
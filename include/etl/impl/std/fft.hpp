@@ -485,21 +485,19 @@ std::unique_ptr<etl::complex<T>[]> twiddle_compute(const size_t n, size_t* facto
 }
 
 /*!
- * \brief Perform the FFT
- * \param r_in The input
+ * \brief Perform the FFT using a buffer provided by the caller
+ *
+ * The contents of the input buffer are destroyed by the transform.
+ *
+ * \param in The input, also used as scratch buffer
  * \param r_out The output
  * \param n The size of the transform
  * \param factors The factors
  * \param n_factors The number of factors
  * \param twiddle The output twiddle factors (pointers inside the main twiddle factors array)
  */
-template <typename In, typename T>
-void fft_perform(const In* r_in, etl::complex<T>* r_out, const size_t n, size_t* factors, size_t n_factors, etl::complex<T>** twiddle) {
-    auto tmp = etl::allocate<etl::complex<T>>(n);
-
-    std::copy_n(r_in, n, tmp.get());
-
-    auto* in  = tmp.get();
+template <typename T>
+void fft_perform_scratch(etl::complex<T>* in, etl::complex<T>* r_out, const size_t n, size_t* factors, size_t n_factors, etl::complex<T>** twiddle) {
     auto* out = r_out;
 
     size_t product = 1;
@@ -536,6 +534,24 @@ void fft_perform(const In* r_in, etl::complex<T>* r_out, const size_t n, size_t*
     }
 }
 
+/*!
+ * \brief Perform the FFT
+ * \param r_in The input
+ * \param r_out The output
+ * \param n The size of the transform
+ * \param factors The factors
+ * \param n_factors The number of factors
+ * \param twiddle The output twiddle factors (pointers inside the main twiddle factors array)
+ */
+template <typename In, typename T>
+void fft_perform(const In* r_in, etl::complex<T>* r_out, const size_t n, size_t* factors, size_t n_factors, etl::complex<T>** twiddle) {
+    auto tmp = etl::allocate<etl::complex<T>>(n);
+
+    std::copy_n(r_in, n, tmp.get());
+
+    fft_perform_scratch(tmp.get(), r_out, n, factors, n_factors, twiddle);
+}
+
 /*!
  * \brief Compute the general FFT of r_in
  * \param r_in The input signal
@@ -597,6 +613,106 @@ void fft_n_many(const In* r_in, etl::complex<T>* r_out, const size_t batch, cons
     engine_dispatch_1d(batch_fun_b, 0, batch, 8UL);
 }
 
+/*!
+ * \brief Store one bin of the spectrum of a STFT frame
+ * \param out The output bin
+ * \param v The complex value of the bin
+ */
+template <stft_mode Mode, typename C, typename T>
+void stft_store(C& out, const etl::complex<T>& v) {
+    if constexpr (Mode == stft_mode::COMPLEX) {
+        out = C(v.real, v.imag);
+    } else if constexpr (Mode == stft_mode::MAGNITUDE) {
+        out = std::sqrt(v.real * v.real + v.imag * v.imag);
+    } else {
+        out = v.real * v.real + v.imag * v.imag;
+    }
+}
+
+/*!
+ * \brief Compute the Short-Time Fourier Transform of a real signal
+ *
+ * The frames are read directly from the signal and windowed while
+ * being loaded into the transform buffer. Since the signal is real,
+ * two consecutive frames are packed into the real and imaginary
+ * parts of a single complex transform and separated afterwards
+ * using the conjugate symmetry of their spectrum. Only the n / 2 + 1
+ * non-redundant bins are stored for each frame.
+ *
+ * \param signal The input signal
+ * \param window The window, of size n
+ * \param out The output spectra, frames x (n / 2 + 1)
+ * \param frames The number of frames
+ * \param n The size of a frame
+ * \param hop The number of samples between two frames
+ */
+template <stft_mode Mode, typename T, typename C>
+void stft_kernel(const T* signal, const T* window, C* out, const size_t frames, const size_t n, const size_t hop) {
+    const size_t bins = n / 2 + 1;
+
+    //0. Factorize
+
+    size_t factors[MAX_FACTORS];
+    size_t n_factors = 0;
+
+    fft_factorize(n, factors, n_factors);
+
+    //1. Precompute twiddle factors (stored in trig)
+
+    etl::complex<T>* twiddle[MAX_FACTORS];
+
+    auto trig = twiddle_compute(n, factors, n_factors, twiddle);
+
+    //2. Perform the transforms, two frames at a time
+
+    auto batch_fun_p = [&](const size_t first, const size_t last) {
+        auto scratch = etl::allocate<etl::complex<T>>(2 * n);
+
+        auto* in       = scratch.get();
+        auto* spectrum = scratch.get() + n;
+
+        for (size_t p = first; p < last; ++p) {
+            const size_t f1     = 2 * p;
+            const size_t f2     = 2 * p + 1;
+            const bool   second = f2 < frames;
+
+            const T* x1 = signal + f1 * hop;
+
+            if (second) {
+                const T* x2 = signal + f2 * hop;
+
+                for (size_t i = 0; i < n; ++i) {
+                    in[i] = etl::complex<T>(window[i] * x1[i], window[i] * x2[i]);
+                }
+            } else {
+                for (size_t i = 0; i < n; ++i) {
+                    in[i] = etl::complex<T>(window[i] * x1[i], T(0));
+                }
+            }
+
+            fft_perform_scratch(in, spectrum, n, factors, n_factors, twiddle);
+
+            C* o1 = out + f1 * bins;
+            C* o2 = out + f2 * bins;
+
+            for (size_t k = 0; k < bins; ++k) {
+                const auto& z = spectrum[k];
+                const auto& y = spectrum[k == 0 ? 0 : n - k];
+
+                // X1 = (Z[k] + conj(Z[n - k])) / 2
+                stft_store<Mode>(o1[k], etl::complex<T>(T(0.5) * (z.real + y.real), T(0.5) * (z.imag - y.imag)));
+
+                // X2 = (Z[k] - conj(Z[n - k])) / 2i
+                if (second) {
+                    stft_store<Mode>(o2[k], etl::complex<T>(T(0.5) * (z.imag + y.imag), T(0.5) * (y.real - z.real)));
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d(batch_fun_p, 0, (frames + 1) / 2, 4UL);
+}
+
 /*!
  * \brief Compute many general FFT of all the signals in input
  * \param input The input signal
@@ -968,6 +1084,27 @@ void fft1_many(A&& a, C&& c) {
     c.invalidate_gpu();
 }
 
+/*!
+ * \brief Perform the Short-Time Fourier Transform of a and store the result in c
+ * \param a The input signal
+ * \param w The window
+ * \param c The output expression
+ * \param hop The number of samples between two frames
+ *
+ * The first dimension of c is the number of frames and the second
+ * dimension is the number of non-redundant bins.
+ */
+template <stft_mode Mode, typename A, typename W, typename C>
+void stft(A&& a, W&& w, C&& c, size_t hop) {
+    a.ensure_cpu_up_to_date();
+    w.ensure_cpu_up_to_date();
+
+    detail::stft_kernel<Mode>(a.memory_start(), w.memory_start(), c.memory_start(), etl::dim<0>(c), etl::size(w), hop);
+
+    c.validate_cpu();
+    c.invalidate_gpu();
+}
+
 /*!
  * \brief Perform the 2D FFT on a and store the result in c
  * \param a The input expression
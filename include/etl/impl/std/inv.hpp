@@ -9,16 +9,75 @@
 
 namespace etl {
 
+namespace detail {
+
+/*!
+ * \copydoc etl::impl::standard::lu_factor
+ */
+template <typename T>
+bool lu_factor(T* a, size_t* piv, size_t n);
+
 /*!
- * \copydoc etl::lu
+ * \copydoc etl::impl::standard::lu_solve
  */
-template <typename AT, typename LT, typename UT, typename PT>
-bool lu(const AT& A, LT& L, UT& U, PT& P);
+template <typename T>
+void lu_solve(const T* lu, const size_t* piv, T* b, size_t n, size_t m);
+
+/*!
+ * \copydoc etl::impl::standard::trsm_lower
+ */
+template <bool Unit, typename T>
+void trsm_lower(const T* l, T* b, size_t n, size_t m);
+
+/*!
+ * \copydoc etl::impl::standard::trsm_upper
+ */
+template <bool Unit, typename T>
+void trsm_upper(const T* u, T* b, size_t n, size_t m);
+
+} //end of namespace detail
 
 namespace impl {
 
 namespace standard {
 
+namespace detail {
+
+/*!
+ * \brief Compute the inverse of a triangular matrix with forward or
+ * backward substitution and store the result in c
+ * \tparam Lower true if the matrix is lower triangular, false if it is upper
+ * triangular
+ * \tparam Unit true if the diagonal of the matrix is known to be one
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <bool Lower, bool Unit, typename A, typename C>
+void inv_triangular(A&& a, C&& c) {
+    using T = value_t<A>;
+
+    const auto n = etl::dim<0>(a);
+
+    etl::dyn_matrix<T, 2> M(n, n);
+    M = a;
+
+    etl::dyn_matrix<T, 2> X(n, n, T(0));
+
+    for (size_t i = 0; i < n; ++i) {
+        X(i, i) = 1;
+    }
+
+    if constexpr (Lower) {
+        etl::detail::trsm_lower<Unit>(M.memory_start(), X.memory_start(), n, n);
+    } else {
+        etl::detail::trsm_upper<Unit>(M.memory_start(), X.memory_start(), n, n);
+    }
+
+    c = X;
+}
+
+} //end of namespace detail
+
 /*!
  * \brief Compute inv(a) and store the result in c
  * \param a The input expression
@@ -26,77 +85,63 @@ namespace standard {
  */
 template <typename A, typename C>
 void inv(A&& a, C&& c) {
-    // The inverse of a permutation matrix is its transpose
-    if (is_permutation_matrix(a)) {
-        c = transpose(a);
-        return;
-    }
-
     const auto n = etl::dim<0>(a);
 
-    // Use forward propagation for lower triangular matrix
-    if (is_lower_triangular(a)) {
-        c = 0;
-
-        // The column in c
-        for (size_t s = 0; s < n; ++s) {
-            // The row in a
-            for (size_t row = 0; row < n; ++row) {
-                auto b = row == s ? 1.0 : 0.0;
-
-                if (row == 0) {
-                    c(0, s) = b / a(0, 0);
-                } else {
-                    value_t<A> acc(0);
-
-                    // The column in a
-                    for (size_t col = 0; col < row; ++col) {
-                        acc += a(row, col) * c(col, s);
-                    }
-
-                    c(row, s) = (b - acc) / a(row, row);
-                }
-            }
+    using T = value_t<A>;
+
+    // The structure of the adapters is known at compile-time
+
+    if constexpr (is_diagonal_matrix<A>) {
+        // The inverse of a diagonal matrix is the inverse of its diagonal
+        c = T(0);
+
+        for (size_t i = 0; i < n; ++i) {
+            c(i, i) = T(1) / a(i, i);
+        }
+    } else if constexpr (is_lower_adapter<A> || is_strictly_lower_matrix<A>) {
+        detail::inv_triangular<true, is_uni_lower_matrix<A>>(a, c);
+    } else if constexpr (is_upper_adapter<A> || is_strictly_upper_matrix<A>) {
+        detail::inv_triangular<false, is_uni_upper_matrix<A>>(a, c);
+    } else {
+        // The inverse of a permutation matrix is its transpose
+        if (is_permutation_matrix(a)) {
+            c = transpose(a);
+            return;
         }
 
-        return;
-    }
+        // Use forward substitution for lower triangular matrix
+        if (is_lower_triangular(a)) {
+            detail::inv_triangular<true, false>(a, c);
+            return;
+        }
 
-    // Use backward propagation for upper triangular matrix
-    if (is_upper_triangular(a)) {
-        c = 0;
-
-        // The column in c
-        for (int64_t s = n - 1; s >= 0; --s) {
-            // The row in a
-            for (int64_t row = n - 1; row >= 0; --row) {
-                auto b = row == s ? 1.0 : 0.0;
-
-                if (row == int64_t(n) - 1) {
-                    c(row, s) = b / a(row, row);
-                } else {
-                    value_t<A> acc(0);
-
-                    // The column in a
-                    for (int64_t col = n - 1; col > row; --col) {
-                        acc += a(row, col) * c(col, s);
-                    }
-
-                    c(row, s) = (b - acc) / a(row, row);
-                }
-            }
+        // Use backward substitution for upper triangular matrix
+        if (is_upper_triangular(a)) {
+            detail::inv_triangular<false, false>(a, c);
+            return;
         }
 
-        return;
-    }
+        // Solve A * X = I from the LU decomposition of A
+
+        etl::dyn_matrix<T, 2> LU(n, n);
+        LU = a;
+
+        std::vector<size_t> piv(n);
 
-    auto L = force_temporary_dim_only(a);
-    auto U = force_temporary_dim_only(a);
-    auto P = force_temporary_dim_only(a);
+        [[maybe_unused]] const bool regular = etl::detail::lu_factor(LU.memory_start(), piv.data(), n);
 
-    etl::lu(a, L, U, P);
+        cpp_assert(regular, "Cannot compute the inverse of a singular matrix");
 
-    c = inv(U) * inv(L) * P;
+        etl::dyn_matrix<T, 2> X(n, n, T(0));
+
+        for (size_t i = 0; i < n; ++i) {
+            X(i, i) = 1;
+        }
+
+        etl::detail::lu_solve(LU.memory_start(), piv.data(), X.memory_start(), n, n);
+
+        c = X;
+    }
 }
 
 } //end of namespace standard
@@ -0,0 +1,215 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the blocked LU decomposition with partial
+ * pivoting and of the associated solver.
+ *
+ * The decomposition is done in place on a row-major square matrix. After the
+ * decomposition, the strictly lower part contains L (with an implicit unit
+ * diagonal) and the upper part contains U. The row interchanges are stored in
+ * a pivot vector, LAPACK style: the row i has been swapped with the row
+ * piv[i] at the step i.
+ *
+ * The decomposition is right-looking: a panel of columns is factorized, the
+ * corresponding block row of U is computed by a triangular solve and the
+ * trailing matrix is updated by a matrix-matrix product, which is where most
+ * of the time is spent.
+ */
+
+#pragma once
+
+#include "etl/impl/std/trsm.hpp"
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief The number of columns of the panels of the blocked LU decomposition
+ */
+constexpr size_t lu_block_size = 64;
+
+namespace detail {
+
+/*!
+ * \brief Factorize the panel of columns [k, k + nb) of the matrix, with
+ * partial pivoting.
+ *
+ * The row interchanges are applied to the full rows of the matrix.
+ *
+ * \param a The matrix [N, N]
+ * \param piv The pivot vector
+ * \param n The dimension of the matrix
+ * \param k The first column of the panel
+ * \param nb The number of columns of the panel
+ *
+ * \return true if all the pivots of the panel are non-zero, false otherwise
+ */
+template <typename T>
+bool lu_panel(T* a, size_t* piv, size_t n, size_t k, size_t nb) {
+    using std::abs;
+
+    bool regular = true;
+
+    for (size_t j = k; j < k + nb; ++j) {
+        // 1. Find the pivot of the column
+
+        size_t p   = j;
+        auto max_v = abs(a[j * n + j]);
+
+        for (size_t i = j + 1; i < n; ++i) {
+            if (abs(a[i * n + j]) > max_v) {
+                max_v = abs(a[i * n + j]);
+                p     = i;
+            }
+        }
+
+        piv[j] = p;
+
+        if (p != j) {
+            std::swap_ranges(a + j * n, a + (j + 1) * n, a + p * n);
+        }
+
+        const T pivot = a[j * n + j];
+
+        // A zero pivot means the column is already eliminated
+        if (pivot == T(0)) {
+            regular = false;
+            continue;
+        }
+
+        // 2. Compute the column of L and update the rest of the panel
+
+        for (size_t i = j + 1; i < n; ++i) {
+            const T l_ij = a[i * n + j] / pivot;
+
+            a[i * n + j] = l_ij;
+
+            for (size_t jj = j + 1; jj < k + nb; ++jj) {
+                a[i * n + jj] -= l_ij * a[j * n + jj];
+            }
+        }
+    }
+
+    return regular;
+}
+
+/*!
+ * \brief Compute the block row of U at the right of a factorized panel, by
+ * solving L11 * U12 = A12 in place.
+ *
+ * \param a The matrix [N, N]
+ * \param n The dimension of the matrix
+ * \param k The first column of the panel
+ * \param nb The number of columns of the panel
+ */
+template <typename T>
+void lu_row_block(T* a, size_t n, size_t k, size_t nb) {
+    for (size_t i = k + 1; i < k + nb; ++i) {
+        for (size_t p = k; p < i; ++p) {
+            const T l_ip = a[i * n + p];
+
+            for (size_t j = k + nb; j < n; ++j) {
+                a[i * n + j] -= l_ip * a[p * n + j];
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Blocked, right-looking, LU decomposition with partial pivoting
+ *
+ * \param a The matrix to decompose in place [N, N]
+ * \param piv The pivot vector [N]
+ * \param n The dimension of the matrix
+ * \param update The functor computing C -= A * B on blocks of the matrix
+ *
+ * \return true if the matrix is not singular, false otherwise
+ */
+template <typename T, typename Update>
+bool lu_blocked(T* a, size_t* piv, size_t n, Update update) {
+    bool regular = true;
+
+    for (size_t k = 0; k < n; k += lu_block_size) {
+        const size_t nb = std::min(lu_block_size, n - k);
+
+        regular &= lu_panel(a, piv, n, k, nb);
+
+        const size_t rest = n - k - nb;
+
+        if (rest) {
+            lu_row_block(a, n, k, nb);
+
+            // A22 -= L21 * U12
+            update(a + (k + nb) * n + k, n, a + k * n + k + nb, n, a + (k + nb) * n + k + nb, n, rest, rest, nb);
+        }
+    }
+
+    return regular;
+}
+
+/*!
+ * \brief Solve L * U * X = P * B in place, with a blocked substitution.
+ *
+ * \param lu The LU decomposition [N, N]
+ * \param piv The pivot vector [N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ * \param update The functor computing C -= A * B on blocks of matrices
+ */
+template <typename T, typename Update>
+void lu_solve_blocked(const T* lu, const size_t* piv, T* b, size_t n, size_t m, Update update) {
+    // 1. Apply the row interchanges
+
+    for (size_t i = 0; i < n; ++i) {
+        if (piv[i] != i) {
+            std::swap_ranges(b + i * m, b + (i + 1) * m, b + piv[i] * m);
+        }
+    }
+
+    // 2. Forward substitution with L (unit diagonal)
+
+    trsm_lower_blocked<true>(lu, b, n, m, update);
+
+    // 3. Backward substitution with U
+
+    trsm_upper_blocked<false>(lu, b, n, m, update);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the LU decomposition with partial pivoting of a row-major
+ * square matrix, in place.
+ *
+ * \param a The matrix to decompose in place [N, N]
+ * \param piv The pivot vector [N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the matrix is not singular, false otherwise
+ */
+template <typename T>
+bool lu_factor(T* a, size_t* piv, size_t n) {
+    return detail::lu_blocked(a, piv, n, [](auto&&... args) { block_update(args...); });
+}
+
+/*!
+ * \brief Solve A * X = B from the LU decomposition of A.
+ *
+ * \param lu The LU decomposition of A [N, N]
+ * \param piv The pivot vector [N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ */
+template <typename T>
+void lu_solve(const T* lu, const size_t* piv, T* b, size_t n, size_t m) {
+    detail::lu_solve_blocked(lu, piv, b, n, m, [](auto&&... args) { block_update(args...); });
+}
+
+} //end of namespace etl::impl::standard
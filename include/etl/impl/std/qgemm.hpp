@@ -0,0 +1,127 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the quantized (int8) matrix-matrix and
+ * matrix-vector multiplications.
+ */
+
+#pragma once
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief Epilogue of the quantized matrix multiplications, converting the
+ * int32 accumulators into the output type.
+ *
+ * int32 outputs are the raw accumulators, floating point outputs are
+ * dequantized (scale * acc) and integer outputs are requantized
+ * (saturate(round(scale * acc) + zero_point)).
+ *
+ * \tparam T The output type
+ */
+template <typename T>
+struct qgemm_epilogue {
+    float scale;        ///< The scale of the accumulators
+    int32_t zero_point; ///< The zero point of requantized outputs
+
+    /*!
+     * \brief Convert an accumulator into the output type
+     * \param acc The int32 accumulator
+     * \return The output value
+     */
+    T apply(int32_t acc) const noexcept {
+        if constexpr (std::is_same_v<T, int32_t>) {
+            return acc;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return T(scale) * T(acc);
+        } else {
+            return saturate_quantized<T>(scale * float(acc), zero_point);
+        }
+    }
+};
+
+/*!
+ * \brief Returns the number of columns of the rhs of a quantized product
+ * \param b The rhs matrix or vector
+ * \return the number of columns of b, 1 for a vector
+ */
+template <typename B>
+size_t qgemm_columns([[maybe_unused]] const B& b) {
+    if constexpr (is_2d<B>) {
+        return etl::dim<1>(b);
+    } else {
+        return 1;
+    }
+}
+
+/*!
+ * \brief Compute the quantized product of a (M,K) and b (K,N) or (K)
+ * \param a The lhs matrix
+ * \param b The rhs matrix or vector
+ * \param c The output
+ * \param epi The epilogue
+ */
+template <typename A, typename B, typename C, typename T>
+void qgemm(const A& a, const B& b, C&& c, qgemm_epilogue<T> epi) {
+    const size_t M = etl::dim<0>(a);
+    const size_t K = etl::dim<1>(a);
+    const size_t N = qgemm_columns(b);
+
+    if constexpr (all_dma<A, B, C> && all_row_major<A, B, C>) {
+        auto* a_m = a.memory_start();
+        auto* b_m = b.memory_start();
+        auto* c_m = c.memory_start();
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            std::vector<int32_t> acc(N);
+
+            for (size_t i = first; i < last; ++i) {
+                std::fill(acc.begin(), acc.end(), 0);
+
+                for (size_t k = 0; k < K; ++k) {
+                    const int32_t aik = a_m[i * K + k];
+
+                    for (size_t j = 0; j < N; ++j) {
+                        acc[j] += aik * int32_t(b_m[k * N + j]);
+                    }
+                }
+
+                for (size_t j = 0; j < N; ++j) {
+                    c_m[i * N + j] = epi.apply(acc[j]);
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, M, M * N * K >= parallel_threshold);
+    } else {
+        // Column-major operands and views are accessed element by element
+
+        for (size_t i = 0; i < M; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                int32_t acc = 0;
+
+                for (size_t k = 0; k < K; ++k) {
+                    if constexpr (is_2d<B>) {
+                        acc += int32_t(a(i, k)) * int32_t(b(k, j));
+                    } else {
+                        acc += int32_t(a(i, k)) * int32_t(b(k));
+                    }
+                }
+
+                if constexpr (is_2d<C>) {
+                    c(i, j) = epi.apply(acc);
+                } else {
+                    c(i) = epi.apply(acc);
+                }
+            }
+        }
+    }
+}
+
+} //end of namespace etl::impl::standard
@@ -0,0 +1,654 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the blocked Householder QR decomposition
+ * and of the application of its Q factor.
+ *
+ * The decomposition is done in place on a row-major [M, N] matrix. After the
+ * decomposition, the upper part contains R and the strictly lower part
+ * contains the Householder vectors, whose first element is an implicit one.
+ *
+ * The reflectors of each panel of columns are kept in compact WY form: the
+ * product of the reflectors H = H_1 H_2 ... H_nb is I - V T V^T, with T upper
+ * triangular. The T factors are stored next to each other, the factor of the
+ * panel starting at column j being stored at t + j * qr_block_size. Its
+ * diagonal contains the scalar factors (tau) of the reflectors.
+ *
+ * A block of reflectors is applied with two matrix products (W = V^T C and
+ * C -= V (T W)), which is where almost all the time is spent. The panels
+ * themselves are factorized recursively, so that only narrow panels are
+ * factorized column by column.
+ */
+
+#pragma once
+
+#include "etl/impl/std/trsm.hpp"
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief The number of columns of the panels of the blocked QR decomposition
+ */
+constexpr size_t qr_block_size = 64;
+
+/*!
+ * \brief The number of rows of the Householder vectors transposed at once
+ * for the computation of V^T C
+ */
+constexpr size_t qr_transpose_block = 256;
+
+/*!
+ * \brief The maximum number of columns of the panels that are factorized
+ * column by column
+ */
+constexpr size_t qr_panel_leaf = 16;
+
+namespace detail {
+
+/*!
+ * \brief Factorize a narrow panel of columns with Householder reflectors,
+ * column by column, and form the T factor of its compact WY representation.
+ *
+ * The panel is factorized in a contiguous copy padded to qr_panel_leaf
+ * columns, the padding columns being zero. The loops over the columns have
+ * then a constant trip count and can be vectorized.
+ *
+ * \param a The panel [M, NB], its first element being on the diagonal
+ * \param lda The distance between two rows of the panel
+ * \param m The number of rows of the panel
+ * \param nb The number of columns of the panel, at most qr_panel_leaf
+ * \param t The T factor [NB, NB]
+ * \param ldt The distance between two rows of T
+ */
+template <typename T>
+void qr_panel_unblocked(T* a, size_t lda, size_t m, size_t nb, T* t, size_t ldt) {
+    using std::sqrt;
+
+    constexpr size_t L = qr_panel_leaf;
+
+    std::vector<T> p(m * L);
+
+    for (size_t r = 0; r < m; ++r) {
+        std::copy_n(a + r * lda, nb, p.data() + r * L);
+    }
+
+    for (size_t i = 0; i < nb; ++i) {
+        std::fill_n(t + i * ldt, nb, T(0));
+    }
+
+    // 1. Compute the reflectors and apply them to the rest of the panel
+
+    // For the current column c, sigma is the squared norm below the diagonal
+    // and u is the sum of the rows below the diagonal weighted by their
+    // element in column c. Both are computed while the previous reflector is
+    // applied, which makes a single pass over the panel per reflector.
+
+    T sigma(0);
+    T u[L] = {};
+    T w[L];
+
+    for (size_t r = 1; r < m; ++r) {
+        const T* p_r = p.data() + r * L;
+        const T x    = p_r[0];
+
+        sigma += x * x;
+
+        for (size_t j = 0; j < L; ++j) {
+            u[j] += x * p_r[j];
+        }
+    }
+
+    for (size_t c = 0; c < nb; ++c) {
+        T* p_c        = p.data() + c * L;
+        const T alpha = p_c[c];
+
+        T tau(0);
+        T scale(0);
+
+        if (sigma != T(0)) {
+            T beta = sqrt(alpha * alpha + sigma);
+
+            if (alpha >= T(0)) {
+                beta = -beta;
+            }
+
+            tau   = (beta - alpha) / beta;
+            scale = T(1) / (alpha - beta);
+
+            p_c[c] = beta;
+        }
+
+        t[c * ldt + c] = tau;
+
+        // w = v^T P, only kept for the next columns
+
+        for (size_t j = 0; j < L; ++j) {
+            w[j] = j > c ? p_c[j] + scale * u[j] : T(0);
+        }
+
+        for (size_t j = 0; j < L; ++j) {
+            p_c[j] -= tau * w[j];
+        }
+
+        // Scale v and compute P -= tau v w, sigma and u for the next column
+
+        sigma = T(0);
+
+        for (size_t j = 0; j < L; ++j) {
+            u[j] = T(0);
+        }
+
+        auto apply_row = [&](T* p_r) {
+            const T v_r = scale * p_r[c];
+
+            p_r[c] = v_r;
+
+            const T tv = tau * v_r;
+
+            for (size_t j = 0; j < L; ++j) {
+                p_r[j] -= tv * w[j];
+            }
+        };
+
+        if (c + 1 < m) {
+            apply_row(p.data() + (c + 1) * L);
+        }
+
+        if (c + 1 == nb) {
+            for (size_t r = c + 2; r < m; ++r) {
+                apply_row(p.data() + r * L);
+            }
+
+            break;
+        }
+
+        for (size_t r = c + 2; r < m; ++r) {
+            T* p_r = p.data() + r * L;
+
+            apply_row(p_r);
+
+            const T x = p_r[c + 1];
+
+            sigma += x * x;
+
+            for (size_t j = 0; j < L; ++j) {
+                u[j] += x * p_r[j];
+            }
+        }
+    }
+
+    // 2. Compute G = V^T V
+
+    T g[L * L] = {};
+
+    for (size_t r = 1; r < std::min(m, nb); ++r) {
+        for (size_t j = 1; j <= r; ++j) {
+            const T v_rj = r == j ? T(1) : p[r * L + j];
+
+            for (size_t i = 0; i < j; ++i) {
+                g[j * L + i] += p[r * L + i] * v_rj;
+            }
+        }
+    }
+
+    for (size_t r = nb; r < m; ++r) {
+        const T* p_r = p.data() + r * L;
+
+        for (size_t j = 0; j < L; ++j) {
+            for (size_t i = 0; i < L; ++i) {
+                g[j * L + i] += p_r[i] * p_r[j];
+            }
+        }
+    }
+
+    // 3. Form T column by column: T(0:j, j) = -tau_j T(0:j, 0:j) V(:, 0:j)^T v_j
+
+    for (size_t j = 1; j < nb; ++j) {
+        const T tau = t[j * ldt + j];
+
+        for (size_t i = 0; i < j; ++i) {
+            T v(0);
+
+            for (size_t l = i; l < j; ++l) {
+                v += t[i * ldt + l] * g[j * L + l];
+            }
+
+            t[i * ldt + j] = -tau * v;
+        }
+    }
+
+    for (size_t r = 0; r < m; ++r) {
+        std::copy_n(p.data() + r * L, nb, a + r * lda);
+    }
+}
+
+/*!
+ * \brief Compute W -= (-V^T) C, that is W += V^T C, for dense V
+ *
+ * The rows of V are transposed (and negated) by blocks in order to use the
+ * update kernel.
+ *
+ * \param v The V block [M, NB]
+ * \param ldv The distance between two rows of V
+ * \param c The C block [M, N]
+ * \param ldc The distance between two rows of C
+ * \param w The W block [NB, N]
+ * \param ldw The distance between two rows of W
+ * \param m The number of rows of V and C
+ * \param nb The number of columns of V
+ * \param n The number of columns of C
+ * \param update The functor computing C -= A * B on blocks of matrices
+ */
+template <typename T, typename Update>
+void qr_add_vt_c(const T* v, size_t ldv, const T* c, size_t ldc, T* w, size_t ldw, size_t m, size_t nb, size_t n, Update update) {
+    std::vector<T> vt(nb * std::min(qr_transpose_block, m));
+
+    for (size_t r = 0; r < m; r += qr_transpose_block) {
+        const size_t rows = std::min(qr_transpose_block, m - r);
+
+        for (size_t q = 0; q < rows; ++q) {
+            for (size_t i = 0; i < nb; ++i) {
+                vt[i * rows + q] = -v[(r + q) * ldv + i];
+            }
+        }
+
+        update(vt.data(), rows, c + r * ldc, ldc, w, ldw, nb, n, rows);
+    }
+}
+
+/*!
+ * \brief Apply a block of reflectors, in compact WY form, to a matrix.
+ *
+ * C is replaced by H^T C if Trans is true, by H C otherwise, with
+ * H = I - V T V^T.
+ *
+ * \tparam Trans Indicates if the transpose of the block is applied
+ *
+ * \param v The Householder vectors [M, NB], with implicit unit diagonal
+ * \param ldv The distance between two rows of V
+ * \param t The T factor [NB, NB]
+ * \param ldt The distance between two rows of T
+ * \param m The number of rows of V and C
+ * \param nb The number of reflectors
+ * \param c The matrix to transform [M, N]
+ * \param ldc The distance between two rows of C
+ * \param n The number of columns of C
+ * \param update The functor computing C -= A * B on blocks of matrices
+ */
+template <bool Trans, typename T, typename Update>
+void qr_apply_block(const T* v, size_t ldv, const T* t, size_t ldt, size_t m, size_t nb, T* c, size_t ldc, size_t n, Update update) {
+    // 1. W = V^T C
+
+    std::vector<T> w(nb * n);
+
+    for (size_t p = 0; p < nb; ++p) {
+        const T* c_p = c + p * ldc;
+
+        for (size_t i = 0; i <= p; ++i) {
+            const T v_pi = i == p ? T(1) : v[p * ldv + i];
+            T* w_i       = w.data() + i * n;
+
+            for (size_t j = 0; j < n; ++j) {
+                w_i[j] += v_pi * c_p[j];
+            }
+        }
+    }
+
+    if (m > nb) {
+        qr_add_vt_c(v + nb * ldv, ldv, c + nb * ldc, ldc, w.data(), n, m - nb, nb, n, update);
+    }
+
+    // 2. W = T^T W or W = T W, in place
+
+    if constexpr (Trans) {
+        for (size_t ii = nb; ii > 0; --ii) {
+            const size_t i = ii - 1;
+            T* w_i         = w.data() + i * n;
+
+            for (size_t j = 0; j < n; ++j) {
+                w_i[j] *= t[i * ldt + i];
+            }
+
+            for (size_t l = 0; l < i; ++l) {
+                const T t_li = t[l * ldt + i];
+                const T* w_l = w.data() + l * n;
+
+                for (size_t j = 0; j < n; ++j) {
+                    w_i[j] += t_li * w_l[j];
+                }
+            }
+        }
+    } else {
+        for (size_t i = 0; i < nb; ++i) {
+            T* w_i = w.data() + i * n;
+
+            for (size_t j = 0; j < n; ++j) {
+                w_i[j] *= t[i * ldt + i];
+            }
+
+            for (size_t l = i + 1; l < nb; ++l) {
+                const T t_il = t[i * ldt + l];
+                const T* w_l = w.data() + l * n;
+
+                for (size_t j = 0; j < n; ++j) {
+                    w_i[j] += t_il * w_l[j];
+                }
+            }
+        }
+    }
+
+    // 3. C -= V W
+
+    for (size_t p = 0; p < nb; ++p) {
+        T* c_p = c + p * ldc;
+
+        for (size_t i = 0; i <= p; ++i) {
+            const T v_pi = i == p ? T(1) : v[p * ldv + i];
+            const T* w_i = w.data() + i * n;
+
+            for (size_t j = 0; j < n; ++j) {
+                c_p[j] -= v_pi * w_i[j];
+            }
+        }
+    }
+
+    if (m > nb) {
+        update(v + nb * ldv, ldv, w.data(), n, c + nb * ldc, ldc, m - nb, n, nb);
+    }
+}
+
+/*!
+ * \brief Factorize a panel of columns with Householder reflectors and form
+ * the T factor of its compact WY representation.
+ *
+ * The panel is split recursively in two halves of columns, the first half is
+ * applied to the second half with matrix products. Only narrow panels are
+ * factorized column by column.
+ *
+ * \param a The panel [M, NB], its first element being on the diagonal
+ * \param lda The distance between two rows of the panel
+ * \param m The number of rows of the panel
+ * \param nb The number of columns of the panel
+ * \param t The T factor [NB, NB]
+ * \param ldt The distance between two rows of T
+ * \param update The functor computing C -= A * B on blocks of matrices
+ */
+template <typename T, typename Update>
+void qr_panel(T* a, size_t lda, size_t m, size_t nb, T* t, size_t ldt, Update update) {
+    if (nb <= qr_panel_leaf) {
+        qr_panel_unblocked(a, lda, m, nb, t, ldt);
+        return;
+    }
+
+    const size_t n1 = nb / 2;
+    const size_t n2 = nb - n1;
+
+    T* a2  = a + n1;
+    T* a22 = a + n1 * lda + n1;
+    T* t22 = t + n1 * ldt + n1;
+
+    // 1. Factorize the left half and apply it to the right half
+
+    qr_panel(a, lda, m, n1, t, ldt, update);
+
+    qr_apply_block<true>(a, lda, t, ldt, m, n1, a2, lda, n2, update);
+
+    // 2. Factorize the bottom of the right half
+
+    qr_panel(a22, lda, m - n1, n2, t22, ldt, update);
+
+    // 3. T12 = -T11 (V1^T V2) T22
+
+    for (size_t i = n1; i < nb; ++i) {
+        std::fill_n(t + i * ldt, n1, T(0));
+    }
+
+    T* t12 = t + n1;
+
+    for (size_t i = 0; i < n1; ++i) {
+        std::fill_n(t12 + i * ldt, n2, T(0));
+    }
+
+    // The first rows of V2 are unit lower triangular
+    for (size_t p = 0; p < n2; ++p) {
+        const T* v1_p = a + (n1 + p) * lda;
+        const T* v2_p = a22 + p * lda;
+
+        for (size_t i = 0; i < n1; ++i) {
+            T* w_i = t12 + i * ldt;
+
+            for (size_t j = 0; j < p; ++j) {
+                w_i[j] += v1_p[i] * v2_p[j];
+            }
+
+            w_i[p] += v1_p[i];
+        }
+    }
+
+    if (m > nb) {
+        qr_add_vt_c(a + nb * lda, lda, a22 + n2 * lda, lda, t12, ldt, m - nb, n1, n2, update);
+    }
+
+    // W = T11 W
+    for (size_t i = 0; i < n1; ++i) {
+        T* w_i = t12 + i * ldt;
+
+        for (size_t j = 0; j < n2; ++j) {
+            w_i[j] *= t[i * ldt + i];
+        }
+
+        for (size_t l = i + 1; l < n1; ++l) {
+            const T t_il = t[i * ldt + l];
+            const T* w_l = t12 + l * ldt;
+
+            for (size_t j = 0; j < n2; ++j) {
+                w_i[j] += t_il * w_l[j];
+            }
+        }
+    }
+
+    // T12 = -W T22
+    for (size_t i = 0; i < n1; ++i) {
+        T* w_i = t12 + i * ldt;
+
+        for (size_t jj = n2; jj > 0; --jj) {
+            const size_t j = jj - 1;
+
+            T v(0);
+
+            for (size_t l = 0; l <= j; ++l) {
+                v += w_i[l] * t22[l * ldt + j];
+            }
+
+            w_i[j] = -v;
+        }
+    }
+}
+
+/*!
+ * \brief Blocked Householder QR decomposition
+ *
+ * \param a The matrix to decompose in place [M, N]
+ * \param t The T factors of the panels [min(M, N) * qr_block_size]
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ * \param update The functor computing C -= A * B on blocks of matrices
+ */
+template <typename T, typename Update>
+void qr_blocked(T* a, T* t, size_t m, size_t n, Update update) {
+    const size_t k = std::min(m, n);
+
+    // The panels are factorized in a contiguous copy, the rows of a wide
+    // matrix being too far apart to be streamed efficiently
+    std::vector<T> panel(n > qr_block_size ? m * std::min(qr_block_size, k) : 0);
+
+    for (size_t j = 0; j < k; j += qr_block_size) {
+        const size_t nb = std::min(qr_block_size, k - j);
+
+        T* a_j = a + j * n + j;
+        T* t_j = t + j * qr_block_size;
+
+        if (panel.empty()) {
+            qr_panel(a_j, n, m - j, nb, t_j, nb, update);
+        } else {
+            for (size_t i = 0; i < m - j; ++i) {
+                std::copy_n(a_j + i * n, nb, panel.data() + i * nb);
+            }
+
+            qr_panel(panel.data(), nb, m - j, nb, t_j, nb, update);
+
+            for (size_t i = 0; i < m - j; ++i) {
+                std::copy_n(panel.data() + i * nb, nb, a_j + i * n);
+            }
+        }
+
+        // Apply H^T to the trailing matrix
+
+        if (j + nb < n) {
+            qr_apply_block<true>(a_j, n, t_j, nb, m - j, nb, a_j + nb, n, n - j - nb, update);
+        }
+    }
+}
+
+/*!
+ * \brief Apply Q (or Q^T) of a blocked QR decomposition to a matrix.
+ *
+ * \tparam Trans Indicates if Q^T is applied
+ *
+ * \param qr The QR decomposition [M, N]
+ * \param t The T factors of the panels
+ * \param m The number of rows of the decomposed matrix
+ * \param n The number of columns of the decomposed matrix
+ * \param c The matrix to transform in place [M, K]
+ * \param k The number of columns of C
+ * \param update The functor computing C -= A * B on blocks of matrices
+ */
+template <bool Trans, typename T, typename Update>
+void qr_apply_blocked(const T* qr, const T* t, size_t m, size_t n, T* c, size_t k, Update update) {
+    const size_t panels = (std::min(m, n) + qr_block_size - 1) / qr_block_size;
+
+    // Q = H_1 H_2 ... H_p, Q^T = H_p^T ... H_2^T H_1^T
+
+    for (size_t pp = 0; pp < panels; ++pp) {
+        const size_t j  = (Trans ? pp : panels - 1 - pp) * qr_block_size;
+        const size_t nb = std::min(qr_block_size, std::min(m, n) - j);
+
+        qr_apply_block<Trans>(qr + j * n + j, n, t + j * qr_block_size, nb, m - j, nb, c + j * k, k, k, update);
+    }
+}
+
+/*!
+ * \brief Form the T factors of reflectors that were not computed by the QR
+ * decomposition, for instance by a reduction to condensed form.
+ *
+ * The reflectors are stored like in a QR decomposition: the reflector j is
+ * in the column j, below the diagonal, with an implicit one on the diagonal.
+ *
+ * \param v The Householder vectors [M, N]
+ * \param tau The scalar factors of the reflectors [min(M, N)]
+ * \param t The T factors of the panels [min(M, N) * qr_block_size]
+ * \param m The number of rows of V
+ * \param n The number of columns of V
+ */
+template <typename T>
+void qr_form_t(const T* v, const T* tau, T* t, size_t m, size_t n) {
+    const size_t k = std::min(m, n);
+
+    std::vector<T> g(qr_block_size * qr_block_size);
+
+    for (size_t j = 0; j < k; j += qr_block_size) {
+        const size_t nb = std::min(qr_block_size, k - j);
+
+        const T* v_j = v + j * n + j;
+        T* t_j       = t + j * qr_block_size;
+
+        // 1. Compute the strictly upper part of G = V^T V, transposed
+
+        std::fill(g.begin(), g.end(), T(0));
+
+        for (size_t r = 1; r < m - j; ++r) {
+            const T* v_r = v_j + r * n;
+
+            for (size_t c = 1; c <= std::min(r, nb - 1); ++c) {
+                const T v_rc = r == c ? T(1) : v_r[c];
+
+                for (size_t i = 0; i < c; ++i) {
+                    g[c * nb + i] += v_r[i] * v_rc;
+                }
+            }
+        }
+
+        // 2. Form T column by column: T(0:c, c) = -tau_c T(0:c, 0:c) G(0:c, c)
+
+        for (size_t i = 0; i < nb; ++i) {
+            std::fill_n(t_j + i * nb, nb, T(0));
+
+            t_j[i * nb + i] = tau[j + i];
+        }
+
+        for (size_t c = 1; c < nb; ++c) {
+            for (size_t i = 0; i < c; ++i) {
+                T s(0);
+
+                for (size_t l = i; l < c; ++l) {
+                    s += t_j[i * nb + l] * g[c * nb + l];
+                }
+
+                t_j[i * nb + c] = -tau[j + c] * s;
+            }
+        }
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the QR decomposition of a row-major matrix, in place.
+ *
+ * \param a The matrix to decompose in place [M, N]
+ * \param t The T factors of the panels [min(M, N) * qr_block_size]
+ * \param m The number of rows of the matrix
+ * \param n The number of columns of the matrix
+ */
+template <typename T>
+void qr_factor(T* a, T* t, size_t m, size_t n) {
+    detail::qr_blocked(a, t, m, n, [](auto&&... args) { block_update(args...); });
+}
+
+/*!
+ * \brief Compute C = Q * C from a QR decomposition.
+ *
+ * \param qr The QR decomposition [M, N]
+ * \param t The T factors of the panels
+ * \param m The number of rows of the decomposed matrix
+ * \param n The number of columns of the decomposed matrix
+ * \param c The matrix to transform in place [M, K]
+ * \param k The number of columns of C
+ */
+template <typename T>
+void qr_apply_q(const T* qr, const T* t, size_t m, size_t n, T* c, size_t k) {
+    detail::qr_apply_blocked<false>(qr, t, m, n, c, k, [](auto&&... args) { block_update(args...); });
+}
+
+/*!
+ * \brief Compute C = Q^T * C from a QR decomposition.
+ *
+ * \param qr The QR decomposition [M, N]
+ * \param t The T factors of the panels
+ * \param m The number of rows of the decomposed matrix
+ * \param n The number of columns of the decomposed matrix
+ * \param c The matrix to transform in place [M, K]
+ * \param k The number of columns of C
+ */
+template <typename T>
+void qr_apply_qt(const T* qr, const T* t, size_t m, size_t n, T* c, size_t k) {
+    detail::qr_apply_blocked<true>(qr, t, m, n, c, k, [](auto&&... args) { block_update(args...); });
+}
+
+} //end of namespace etl::impl::standard
@@ -0,0 +1,243 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the gate passes of the recurrent cells
+ *
+ * The matrix multiplications of the cells are done by the expressions, with
+ * the weights of all the gates concatenated. The gate passes apply all the
+ * activations and the elementwise operations of a time step in a single pass
+ * over the gates, for a batch of B samples with H hidden units.
+ *
+ * The LSTM gates are stored as [B, 4H] in the (i, f, g, o) order and the GRU
+ * gates as [B, 3H] in the (r, z, n) order.
+ */
+
+#pragma once
+
+namespace etl::impl::standard {
+
+namespace detail {
+
+/*!
+ * \brief Compute the LSTM gate pass of a range of hidden units of a sample
+ * \param g The pre-activations of the gates of the sample, replaced by the activations
+ * \param c_prev The previous cell state of the sample
+ * \param c The cell state of the sample (output)
+ * \param h The hidden state of the sample (output)
+ * \param H The number of hidden units
+ * \param first The first hidden unit
+ * \param last The end of the range of hidden units
+ */
+template <typename T>
+void lstm_forward_units(T* g, const T* c_prev, T* c, T* h, size_t H, size_t first, size_t last) {
+    for (size_t j = first; j < last; ++j) {
+        const T i  = sigmoid_unary_op<T>::apply(g[j]);
+        const T f  = sigmoid_unary_op<T>::apply(g[H + j]);
+        const T gg = tanh_unary_op<T>::apply(g[2 * H + j]);
+        const T o  = sigmoid_unary_op<T>::apply(g[3 * H + j]);
+
+        const T cc = f * c_prev[j] + i * gg;
+
+        g[j]         = i;
+        g[H + j]     = f;
+        g[2 * H + j] = gg;
+        g[3 * H + j] = o;
+
+        c[j] = cc;
+        h[j] = o * tanh_unary_op<T>::apply(cc);
+    }
+}
+
+/*!
+ * \brief Compute the LSTM backward gate pass of a range of hidden units of a
+ * sample
+ * \param g The activations of the gates of the sample
+ * \param c_prev The previous cell state of the sample
+ * \param c The cell state of the sample
+ * \param dh The gradients of the hidden state of the sample
+ * \param dc The gradients of the cell state coming from the next step
+ * \param dg The gradients of the pre-activations of the gates (output)
+ * \param dc_prev The gradients of the previous cell state (output)
+ * \param H The number of hidden units
+ * \param first The first hidden unit
+ * \param last The end of the range of hidden units
+ */
+template <typename T>
+void lstm_backward_units(const T* g, const T* c_prev, const T* c, const T* dh, const T* dc, T* dg, T* dc_prev, size_t H, size_t first, size_t last) {
+    for (size_t j = first; j < last; ++j) {
+        const T i  = g[j];
+        const T f  = g[H + j];
+        const T gg = g[2 * H + j];
+        const T o  = g[3 * H + j];
+
+        const T tc = tanh_unary_op<T>::apply(c[j]);
+        const T dt = dc[j] + dh[j] * o * (T(1) - tc * tc);
+
+        dg[j]         = dt * gg * i * (T(1) - i);
+        dg[H + j]     = dt * c_prev[j] * f * (T(1) - f);
+        dg[2 * H + j] = dt * i * (T(1) - gg * gg);
+        dg[3 * H + j] = dh[j] * tc * o * (T(1) - o);
+
+        dc_prev[j] = dt * f;
+    }
+}
+
+/*!
+ * \brief Compute the GRU gate pass of a range of hidden units of a sample
+ * \param gx The input projection of the gates of the sample (with bias)
+ * \param gh The recurrent projection of the gates of the sample (with bias)
+ * \param h_prev The previous hidden state of the sample
+ * \param cache The activations (r, z, n) and the recurrent projection of n (output)
+ * \param h The hidden state of the sample (output)
+ * \param H The number of hidden units
+ * \param first The first hidden unit
+ * \param last The end of the range of hidden units
+ */
+template <typename T>
+void gru_forward_units(const T* gx, const T* gh, const T* h_prev, T* cache, T* h, size_t H, size_t first, size_t last) {
+    for (size_t j = first; j < last; ++j) {
+        const T r = sigmoid_unary_op<T>::apply(gx[j] + gh[j]);
+        const T z = sigmoid_unary_op<T>::apply(gx[H + j] + gh[H + j]);
+        const T n = tanh_unary_op<T>::apply(gx[2 * H + j] + r * gh[2 * H + j]);
+
+        cache[j]         = r;
+        cache[H + j]     = z;
+        cache[2 * H + j] = n;
+        cache[3 * H + j] = gh[2 * H + j];
+
+        h[j] = n + z * (h_prev[j] - n);
+    }
+}
+
+/*!
+ * \brief Compute the GRU backward gate pass of a range of hidden units of a
+ * sample
+ * \param cache The activations (r, z, n) and the recurrent projection of n
+ * \param h_prev The previous hidden state of the sample
+ * \param dh The gradients of the hidden state of the sample
+ * \param dgx The gradients of the input projection of the gates (output)
+ * \param dgh The gradients of the recurrent projection of the gates (output)
+ * \param dh_prev The direct gradients of the previous hidden state (output)
+ * \param H The number of hidden units
+ * \param first The first hidden unit
+ * \param last The end of the range of hidden units
+ */
+template <typename T>
+void gru_backward_units(const T* cache, const T* h_prev, const T* dh, T* dgx, T* dgh, T* dh_prev, size_t H, size_t first, size_t last) {
+    for (size_t j = first; j < last; ++j) {
+        const T r   = cache[j];
+        const T z   = cache[H + j];
+        const T n   = cache[2 * H + j];
+        const T ghn = cache[3 * H + j];
+
+        const T dn = dh[j] * (T(1) - z) * (T(1) - n * n);
+        const T dz = dh[j] * (h_prev[j] - n) * z * (T(1) - z);
+        const T dr = dn * ghn * r * (T(1) - r);
+
+        dgx[j]         = dr;
+        dgx[H + j]     = dz;
+        dgx[2 * H + j] = dn;
+
+        dgh[j]         = dr;
+        dgh[H + j]     = dz;
+        dgh[2 * H + j] = dn * r;
+
+        dh_prev[j] = dh[j] * z;
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the LSTM gate pass of a time step
+ * \param g The [B, 4H] pre-activations of the gates, replaced by the activations
+ * \param c_prev The [B, H] previous cell state
+ * \param c The [B, H] cell state (output)
+ * \param h The [B, H] hidden state (output)
+ * \param B The number of samples
+ * \param H The number of hidden units
+ */
+template <typename T>
+void lstm_forward_gates(T* g, const T* c_prev, T* c, T* h, size_t B, size_t H) {
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            detail::lstm_forward_units(g + b * 4 * H, c_prev + b * H, c + b * H, h + b * H, H, 0, H);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, B, B * H >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute the LSTM backward gate pass of a time step
+ * \param g The [B, 4H] activations of the gates
+ * \param c_prev The [B, H] previous cell state
+ * \param c The [B, H] cell state
+ * \param dh The [B, H] gradients of the hidden state
+ * \param dc The [B, H] gradients of the cell state coming from the next step
+ * \param dg The [B, 4H] gradients of the pre-activations of the gates (output)
+ * \param dc_prev The [B, H] gradients of the previous cell state (output, can be dc)
+ * \param B The number of samples
+ * \param H The number of hidden units
+ */
+template <typename T>
+void lstm_backward_gates(const T* g, const T* c_prev, const T* c, const T* dh, const T* dc, T* dg, T* dc_prev, size_t B, size_t H) {
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            detail::lstm_backward_units(g + b * 4 * H, c_prev + b * H, c + b * H, dh + b * H, dc + b * H, dg + b * 4 * H, dc_prev + b * H, H, 0, H);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, B, B * H >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute the GRU gate pass of a time step
+ * \param gx The [B, 3H] input projection of the gates (with bias)
+ * \param gh The [B, 3H] recurrent projection of the gates (with bias)
+ * \param h_prev The [B, H] previous hidden state
+ * \param cache The [B, 4H] activations (r, z, n) and recurrent projection of n (output)
+ * \param h The [B, H] hidden state (output)
+ * \param B The number of samples
+ * \param H The number of hidden units
+ */
+template <typename T>
+void gru_forward_gates(const T* gx, const T* gh, const T* h_prev, T* cache, T* h, size_t B, size_t H) {
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            detail::gru_forward_units(gx + b * 3 * H, gh + b * 3 * H, h_prev + b * H, cache + b * 4 * H, h + b * H, H, 0, H);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, B, B * H >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute the GRU backward gate pass of a time step
+ * \param cache The [B, 4H] activations (r, z, n) and recurrent projection of n
+ * \param h_prev The [B, H] previous hidden state
+ * \param dh The [B, H] gradients of the hidden state
+ * \param dgx The [B, 3H] gradients of the input projection of the gates (output)
+ * \param dgh The [B, 3H] gradients of the recurrent projection of the gates (output)
+ * \param dh_prev The [B, H] direct gradients of the previous hidden state (output, can be dh)
+ * \param B The number of samples
+ * \param H The number of hidden units
+ */
+template <typename T>
+void gru_backward_gates(const T* cache, const T* h_prev, const T* dh, T* dgx, T* dgh, T* dh_prev, size_t B, size_t H) {
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            detail::gru_backward_units(cache + b * 4 * H, h_prev + b * H, dh + b * H, dgx + b * 3 * H, dgh + b * 3 * H, dh_prev + b * H, H, 0, H);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, B, B * H >= parallel_threshold);
+}
+
+} //end of namespace etl::impl::standard
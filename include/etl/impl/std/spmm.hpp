@@ -0,0 +1,243 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the products between compressed sparse
+ * matrices and dense matrices or vectors.
+ *
+ * The kernels only see the sparse matrix as a set of outer slices. A
+ * row-compressed view is a CSR matrix or a transposed CSC matrix, a
+ * column-compressed view is a CSC matrix or a transposed CSR matrix. All the
+ * dense matrices are in row-major order.
+ */
+
+#pragma once
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief Raw view of a compressed sparse matrix
+ * \tparam T The value type
+ * \tparam I The index type
+ */
+template <typename T, typename I>
+struct compressed_view {
+    const T* values; ///< The non-zero values
+    const I* inner;  ///< The inner index of each non-zero
+    const I* outer;  ///< The position of the first non-zero of each outer slice
+    size_t outers;   ///< The number of outer slices
+
+    /*!
+     * \brief Returns the number of non-zeros of the matrix
+     */
+    size_t non_zeros() const noexcept {
+        return outer[outers];
+    }
+};
+
+namespace detail {
+
+/*!
+ * \brief Compute y[first:last] += alpha * x[first:last]
+ * \param alpha The scale of x
+ * \param x The input vector
+ * \param y The output vector
+ * \param first The first element to compute
+ * \param last The end of the elements to compute
+ */
+template <typename T>
+void spmm_axpy(T alpha, const T* x, T* y, size_t first, size_t last) {
+    for (size_t j = first; j < last; ++j) {
+        y[j] += alpha * x[j];
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute C = A * B with a row-compressed A.
+ *
+ * Each row of C is the combination of the rows of B selected by the
+ * non-zeros of the same row of A. The rows of C are computed in parallel.
+ *
+ * \param a The row-compressed sparse matrix [M, K]
+ * \param b The dense matrix [K, N]
+ * \param c The dense output matrix [M, N]
+ * \param n The number of columns of B and C
+ */
+template <typename T, typename I>
+void csr_mm(const compressed_view<T, I>& a, const T* b, T* c, size_t n) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            T* c_row = c + i * n;
+
+            std::fill_n(c_row, n, T(0));
+
+            for (size_t p = a.outer[i]; p < a.outer[i + 1]; ++p) {
+                detail::spmm_axpy(a.values[p], b + size_t(a.inner[p]) * n, c_row, 0, n);
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, a.outers, a.non_zeros() * n >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute C = A * B with a column-compressed A.
+ *
+ * Each non-zero A(i, k) adds a scaled row k of B to the row i of C. Several
+ * non-zeros write to the same rows of C, so the columns of C are split
+ * between the threads instead of its rows.
+ *
+ * \param a The column-compressed sparse matrix [M, K]
+ * \param b The dense matrix [K, N]
+ * \param c The dense output matrix [M, N]
+ * \param m The number of rows of A and C
+ * \param n The number of columns of B and C
+ */
+template <typename T, typename I>
+void csc_mm(const compressed_view<T, I>& a, const T* b, T* c, size_t m, size_t n) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = 0; i < m; ++i) {
+            std::fill(c + i * n + first, c + i * n + last, T(0));
+        }
+
+        for (size_t k = 0; k < a.outers; ++k) {
+            for (size_t p = a.outer[k]; p < a.outer[k + 1]; ++p) {
+                detail::spmm_axpy(a.values[p], b + k * n, c + size_t(a.inner[p]) * n, first, last);
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, n, a.non_zeros() * n >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute c = A * b with a row-compressed A.
+ *
+ * The elements of c are computed in parallel.
+ *
+ * \param a The row-compressed sparse matrix [M, K]
+ * \param b The dense vector [K]
+ * \param c The dense output vector [M]
+ */
+template <typename T, typename I>
+void csr_mv(const compressed_view<T, I>& a, const T* b, T* c) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            T value(0);
+
+            for (size_t p = a.outer[i]; p < a.outer[i + 1]; ++p) {
+                value += a.values[p] * b[a.inner[p]];
+            }
+
+            c[i] = value;
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, a.outers, a.non_zeros() >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute c = A * b with a column-compressed A.
+ * \param a The column-compressed sparse matrix [M, K]
+ * \param b The dense vector [K]
+ * \param c The dense output vector [M]
+ * \param m The number of rows of A
+ */
+template <typename T, typename I>
+void csc_mv(const compressed_view<T, I>& a, const T* b, T* c, size_t m) {
+    std::fill_n(c, m, T(0));
+
+    for (size_t k = 0; k < a.outers; ++k) {
+        const T b_k = b[k];
+
+        for (size_t p = a.outer[k]; p < a.outer[k + 1]; ++p) {
+            c[a.inner[p]] += a.values[p] * b_k;
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = A * B with a dense A and a row-compressed B.
+ *
+ * Each row of C only depends on the same row of A and is computed by
+ * scattering the rows of B. A vector is handled as a matrix of one row.
+ *
+ * \param a The dense matrix [M, K]
+ * \param b The row-compressed sparse matrix [K, N]
+ * \param c The dense output matrix [M, N]
+ * \param m The number of rows of A and C
+ * \param n The number of columns of B and C
+ */
+template <typename T, typename I>
+void dense_csr_mm(const T* a, const compressed_view<T, I>& b, T* c, size_t m, size_t n) {
+    const size_t k = b.outers;
+
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            T* c_row = c + i * n;
+
+            std::fill_n(c_row, n, T(0));
+
+            for (size_t kk = 0; kk < k; ++kk) {
+                const T a_ik = a[i * k + kk];
+
+                for (size_t p = b.outer[kk]; p < b.outer[kk + 1]; ++p) {
+                    c_row[b.inner[p]] += a_ik * b.values[p];
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, m, b.non_zeros() * m >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute C = A * B with a dense A and a column-compressed B.
+ *
+ * Each element of C is the sparse dot product of a row of A and a column of
+ * B. The rows of C are computed in parallel, or its columns when there is
+ * a single row (vector-matrix product).
+ *
+ * \param a The dense matrix [M, K]
+ * \param b The column-compressed sparse matrix [K, N]
+ * \param c The dense output matrix [M, N]
+ * \param m The number of rows of A and C
+ * \param k The number of columns of A
+ */
+template <typename T, typename I>
+void dense_csc_mm(const T* a, const compressed_view<T, I>& b, T* c, size_t m, size_t k) {
+    const size_t n = b.outers;
+
+    auto compute = [&](size_t first_i, size_t last_i, size_t first_j, size_t last_j) {
+        for (size_t i = first_i; i < last_i; ++i) {
+            const T* a_row = a + i * k;
+
+            for (size_t j = first_j; j < last_j; ++j) {
+                T value(0);
+
+                for (size_t p = b.outer[j]; p < b.outer[j + 1]; ++p) {
+                    value += a_row[b.inner[p]] * b.values[p];
+                }
+
+                c[i * n + j] = value;
+            }
+        }
+    };
+
+    const bool parallel = b.non_zeros() * m >= parallel_threshold;
+
+    if (m > 1) {
+        engine_dispatch_1d_serial([&](size_t first, size_t last) { compute(first, last, 0, n); }, 0, m, parallel);
+    } else {
+        engine_dispatch_1d_serial([&](size_t first, size_t last) { compute(0, m, first, last); }, 0, n, parallel);
+    }
+}
+
+} //end of namespace etl::impl::standard
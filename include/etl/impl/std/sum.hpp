@@ -16,12 +16,15 @@ namespace etl::impl::standard {
 
 /*!
  * \brief Compute the sum of the input in the given expression
+ *
+ * 16-bit floating point values are accumulated in single precision.
+ *
  * \param input The input expression
  * \return the sum
  */
 template <typename E>
 value_t<E> sum(const E& input) {
-    using T = value_t<E>;
+    using T = accumulate_t<value_t<E>>;
 
     T acc(0);
 
@@ -31,7 +34,7 @@ value_t<E> sum(const E& input) {
         T acc(0);
 
         for (size_t i = 0; i < etl::size(sub); ++i) {
-            acc += sub[i];
+            acc += T(sub[i]);
         }
 
         return acc;
@@ -39,7 +42,7 @@ value_t<E> sum(const E& input) {
 
     engine_dispatch_1d_acc_slice(input, batch_fun, acc_functor, sum_parallel_threshold);
 
-    return acc;
+    return value_t<E>(acc);
 }
 
 /*!
@@ -49,7 +52,7 @@ value_t<E> sum(const E& input) {
  */
 template <typename E>
 value_t<E> asum(const E& input) {
-    using T = value_t<E>;
+    using T = accumulate_t<value_t<E>>;
 
     T acc(0);
 
@@ -60,7 +63,7 @@ value_t<E> asum(const E& input) {
 
         for (size_t i = 0; i < etl::size(sub); ++i) {
             using std::abs;
-            acc += abs(sub[i]);
+            acc += abs(T(sub[i]));
         }
 
         return acc;
@@ -68,7 +71,7 @@ value_t<E> asum(const E& input) {
 
     engine_dispatch_1d_acc_slice(input, batch_fun, acc_functor, sum_parallel_threshold);
 
-    return acc;
+    return value_t<E>(acc);
 }
 
 } //end of namespace etl::impl::standard
@@ -0,0 +1,393 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the singular value decomposition of
+ * square matrices.
+ *
+ * The matrix is first reduced to an upper bidiagonal matrix B = U_b^T A V_b
+ * with Householder reflectors, applied alternatively from the left and from
+ * the right. The singular values and vectors of B are then computed with the
+ * implicit (Golub-Kahan) QR algorithm and the singular vectors of A are
+ * obtained by applying U_b and V_b, in compact WY form.
+ *
+ * Rectangular matrices are handled by the callers, with a QR decomposition
+ * first.
+ */
+
+#pragma once
+
+#include "etl/impl/std/eigh.hpp"
+
+namespace etl::impl::standard {
+
+namespace detail {
+
+/*!
+ * \brief Reduce a square matrix to upper bidiagonal form, B = U_b^T A V_b
+ *
+ * The reflectors of U_b are stored below the diagonal, like in a QR
+ * decomposition and the reflectors of V_b are stored in the rows, from the
+ * column k + 2.
+ *
+ * \tparam Kernels The row kernels
+ *
+ * \param a The matrix, reduced in place [N, N]
+ * \param n The dimension of the matrix
+ * \param d The diagonal of B [N]
+ * \param e The super-diagonal of B, e[k] being B(k, k + 1) [N]
+ * \param tauq The scalar factors of the left reflectors [N]
+ * \param taup The scalar factors of the right reflectors [N]
+ */
+template <typename Kernels, typename T>
+void bidiagonalize(T* a, size_t n, T* d, T* e, T* tauq, T* taup) {
+    std::vector<T> x(n);
+    std::vector<T> w(n);
+
+    std::fill_n(e, n, T(0));
+
+    for (size_t k = 0; k < n; ++k) {
+        T* a_k = a + k * n;
+
+        // 1. Left reflector, from the column k
+
+        for (size_t i = k; i < n; ++i) {
+            x[i - k] = a[i * n + k];
+        }
+
+        const T tq = householder<Kernels>(x.data(), n - k, d[k]);
+
+        tauq[k] = tq;
+
+        a_k[k] = d[k];
+
+        for (size_t i = k + 1; i < n; ++i) {
+            a[i * n + k] = x[i - k];
+        }
+
+        if (k + 1 == n) {
+            taup[k] = T(0);
+            break;
+        }
+
+        // w = v^T A(k:, k+1:), by blocks of columns
+
+        auto left_fun = [&](const size_t first, const size_t last) {
+            std::copy(a_k + first, a_k + last, w.begin() + first);
+
+            for (size_t i = k + 1; i < n; ++i) {
+                const T* a_i = a + i * n;
+
+                Kernels::axpy(w.data() + first, a_i + first, a_i[k], last - first);
+            }
+        };
+
+        engine_dispatch_1d_serial(left_fun, k + 1, n, (n - k) * (n - k) >= parallel_threshold);
+
+        Kernels::axpy(a_k + k + 1, w.data() + k + 1, -tq, n - k - 1);
+
+        // 2. Right reflector, from the row k
+
+        const T tp = householder<Kernels>(a_k + k + 1, n - k - 1, e[k]);
+
+        taup[k] = tp;
+
+        const T* u = a_k + k + 1;
+
+        // Finish the left update and apply the right reflector, row by row
+
+        auto right_fun = [&](const size_t first, const size_t last) {
+            const size_t q = n - k - 1;
+
+            for (size_t i = first; i < last; ++i) {
+                T* a_i = a + i * n + k + 1;
+
+                Kernels::axpy(a_i, w.data() + k + 1, -tq * a[i * n + k], q);
+
+                const T ts = tp * (a_i[0] + Kernels::dot(a_i + 1, u + 1, q - 1));
+
+                a_i[0] -= ts;
+
+                Kernels::axpy(a_i + 1, u + 1, -ts, q - 1);
+            }
+        };
+
+        engine_dispatch_1d_serial(right_fun, k + 1, n, (n - k) * (n - k) >= parallel_threshold);
+
+        a_k[k + 1] = e[k];
+    }
+}
+
+/*!
+ * \brief Compute the singular values, and optionally the singular vectors,
+ * of an upper bidiagonal matrix with the implicit QR algorithm.
+ *
+ * \tparam Kernels The row kernels
+ *
+ * \param d The diagonal of the matrix, replaced by the singular values [N]
+ * \param e The super-diagonal of the matrix, e[k] being B(k, k + 1) [N]
+ * \param ut The transposed left vectors to transform, or nullptr [N, N]
+ * \param vt The transposed right vectors to transform, or nullptr [N, N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the algorithm converged, false otherwise
+ */
+template <typename Kernels, typename T>
+bool bidiagonal_qr(T* d, const T* e, T* ut, T* vt, size_t n) {
+    using std::abs;
+    using std::hypot;
+
+    const T eps = std::numeric_limits<T>::epsilon();
+
+    // f[i] is B(i - 1, i)
+    std::vector<T> f(n, T(0));
+
+    std::copy_n(e, n ? n - 1 : 0, f.begin() + (n ? 1 : 0));
+
+    T norm(0);
+
+    for (size_t i = 0; i < n; ++i) {
+        norm = std::max(norm, abs(d[i]) + abs(f[i]));
+    }
+
+    const T tol = eps * norm;
+
+    std::vector<givens_rotation<T>> urot;
+    std::vector<givens_rotation<T>> vrot;
+
+    auto flush = [&]() {
+        if (ut) {
+            apply_rotations<Kernels>(ut, n, urot);
+        }
+
+        if (vt) {
+            apply_rotations<Kernels>(vt, n, vrot);
+        }
+
+        urot.clear();
+        vrot.clear();
+    };
+
+    for (size_t k = n; k-- > 0;) {
+        for (size_t iterations = 0;; ++iterations) {
+            // Look for a negligible super-diagonal element to split the
+            // matrix, or for a negligible diagonal element
+
+            bool cancel = true;
+            size_t l    = k;
+
+            for (size_t ll = k + 1; ll-- > 0;) {
+                l = ll;
+
+                if (l == 0 || abs(f[l]) <= tol) {
+                    cancel = false;
+                    break;
+                }
+
+                if (abs(d[l - 1]) <= tol) {
+                    break;
+                }
+            }
+
+            // Cancel f[l] when d[l - 1] is negligible
+
+            if (cancel) {
+                const size_t nm = l - 1;
+
+                T c(0);
+                T s(1);
+
+                for (size_t i = l; i <= k; ++i) {
+                    const T g = s * f[i];
+
+                    f[i] = c * f[i];
+
+                    if (abs(g) <= tol) {
+                        break;
+                    }
+
+                    const T h = hypot(g, d[i]);
+
+                    c = d[i] / h;
+                    s = -g / h;
+
+                    d[i] = h;
+
+                    urot.push_back({nm, i, c, s});
+                }
+            }
+
+            if (l == k) {
+                flush();
+
+                if (d[k] < T(0)) {
+                    d[k] = -d[k];
+
+                    if (vt) {
+                        for (size_t j = 0; j < n; ++j) {
+                            vt[k * n + j] = -vt[k * n + j];
+                        }
+                    }
+                }
+
+                break;
+            }
+
+            if (iterations == eigen_max_iterations) {
+                flush();
+                return false;
+            }
+
+            // Shift from the bottom 2x2 minor
+
+            const size_t nm = k - 1;
+
+            T x = d[l];
+            T y = d[nm];
+            T z = d[k];
+            T g = f[nm];
+            T h = f[k];
+
+            T ff = ((y - z) * (y + z) + (g - h) * (g + h)) / (T(2) * h * y);
+
+            g  = hypot(ff, T(1));
+            ff = ((x - z) * (x + z) + h * ((y / (ff + std::copysign(g, ff))) - h)) / x;
+
+            // QR sweep, chasing the bulge
+
+            T c(1);
+            T s(1);
+
+            for (size_t j = l; j <= nm; ++j) {
+                const size_t i = j + 1;
+
+                g = f[i];
+                y = d[i];
+                h = s * g;
+                g = c * g;
+
+                z    = hypot(ff, h);
+                f[j] = z;
+                c    = ff / z;
+                s    = h / z;
+
+                ff = x * c + g * s;
+                g  = g * c - x * s;
+                h  = y * s;
+                y *= c;
+
+                vrot.push_back({j, i, c, s});
+
+                z    = hypot(ff, h);
+                d[j] = z;
+
+                if (z != T(0)) {
+                    c = ff / z;
+                    s = h / z;
+                }
+
+                ff = c * g + s * y;
+                x  = c * y - s * g;
+
+                urot.push_back({j, i, c, s});
+            }
+
+            f[l] = T(0);
+            f[k] = ff;
+            d[k] = x;
+
+            flush();
+        }
+    }
+
+    return true;
+}
+
+/*!
+ * \brief Singular value decomposition of a square matrix, A = U S V^T
+ *
+ * \tparam Kernels The row kernels
+ *
+ * \param a The matrix, destroyed [N, N]
+ * \param s The singular values, in descending order [N]
+ * \param u The left singular vectors, in columns, or nullptr [N, N]
+ * \param v The right singular vectors, in columns, or nullptr [N, N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the algorithm converged, false otherwise
+ */
+template <typename Kernels, typename T>
+bool svd_blocked(T* a, T* s, T* u, T* v, size_t n) {
+    std::vector<T> e(n);
+    std::vector<T> tauq(n);
+    std::vector<T> taup(n);
+
+    bidiagonalize<Kernels>(a, n, s, e.data(), tauq.data(), taup.data());
+
+    if (!u && !v) {
+        const bool converged = bidiagonal_qr<Kernels>(s, e.data(), static_cast<T*>(nullptr), static_cast<T*>(nullptr), n);
+
+        std::sort(s, s + n, std::greater<T>());
+
+        return converged;
+    }
+
+    std::vector<T> ut(n * n, T(0));
+    std::vector<T> vt(n * n, T(0));
+
+    for (size_t i = 0; i < n; ++i) {
+        ut[i * n + i] = T(1);
+        vt[i * n + i] = T(1);
+    }
+
+    const bool converged = bidiagonal_qr<Kernels>(s, e.data(), ut.data(), vt.data(), n);
+
+    sort_values<false>(s, n, ut.data(), vt.data());
+
+    // U = U_b U_B
+
+    if (u) {
+        std::vector<T> t(n * qr_block_size);
+
+        transpose_square(ut.data(), u, n);
+
+        qr_form_t(a, tauq.data(), t.data(), n, n);
+        qr_apply_blocked<false>(a, t.data(), n, n, u, n, [](auto&&... args) { Kernels::update(args...); });
+    }
+
+    // V = V_b V_B
+
+    if (v) {
+        transpose_square(vt.data(), v, n);
+
+        apply_row_reflectors<Kernels>(a, taup.data(), n, v);
+    }
+
+    return converged;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the singular values, and optionally the singular vectors,
+ * of a row-major square matrix.
+ *
+ * \param a The matrix, destroyed [N, N]
+ * \param s The singular values, in descending order [N]
+ * \param u The left singular vectors, in columns, or nullptr [N, N]
+ * \param v The right singular vectors, in columns, or nullptr [N, N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the algorithm converged, false otherwise
+ */
+template <typename T>
+bool svd(T* a, T* s, T* u, T* v, size_t n) {
+    return detail::svd_blocked<detail::eigen_kernels>(a, s, u, v, n);
+}
+
+} //end of namespace etl::impl::standard
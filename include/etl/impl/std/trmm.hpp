@@ -0,0 +1,168 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the products exploiting the structure of
+ * one of the matrices: triangular products (TRMM), diagonal scaling and
+ * symmetric rank-k products (SYRK).
+ *
+ * All the matrices are row-major. The triangular products are only computed
+ * from the left, the products from the right are transposed by the callers.
+ * The triangular matrices can be given by their transposition, which is
+ * never computed.
+ */
+
+#pragma once
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief Compute C = L * B, with L a lower triangular matrix.
+ *
+ * L is given in row-major order or, if Trans is set, by its transposition
+ * (an upper triangular matrix) in row-major order. Only the lower part of L
+ * is used.
+ *
+ * \tparam Trans Indicates if the memory holds the transposition of L
+ *
+ * \param l The lower triangular matrix [N, N]
+ * \param b The right-hand side [N, M]
+ * \param c The result [N, M]
+ * \param n The dimension of the triangular matrix
+ * \param m The number of columns of B and C
+ */
+template <bool Trans, typename T>
+void trmm_lower(const T* l, const T* b, T* c, size_t n, size_t m) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            T* c_i = c + i * m;
+
+            std::fill_n(c_i, m, T(0));
+
+            for (size_t k = 0; k <= i; ++k) {
+                const T l_ik = Trans ? l[k * n + i] : l[i * n + k];
+
+                for (size_t j = 0; j < m; ++j) {
+                    c_i[j] += l_ik * b[k * m + j];
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, n, n * n * m / 2 >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute C = U * B, with U an upper triangular matrix.
+ *
+ * U is given in row-major order or, if Trans is set, by its transposition
+ * (a lower triangular matrix) in row-major order. Only the upper part of U
+ * is used.
+ *
+ * \tparam Trans Indicates if the memory holds the transposition of U
+ *
+ * \param u The upper triangular matrix [N, N]
+ * \param b The right-hand side [N, M]
+ * \param c The result [N, M]
+ * \param n The dimension of the triangular matrix
+ * \param m The number of columns of B and C
+ */
+template <bool Trans, typename T>
+void trmm_upper(const T* u, const T* b, T* c, size_t n, size_t m) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            T* c_i = c + i * m;
+
+            std::fill_n(c_i, m, T(0));
+
+            for (size_t k = i; k < n; ++k) {
+                const T u_ik = Trans ? u[k * n + i] : u[i * n + k];
+
+                for (size_t j = 0; j < m; ++j) {
+                    c_i[j] += u_ik * b[k * m + j];
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, n, n * n * m / 2 >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute C = diag(d) * B, scaling each row of B
+ * \param d The diagonal [N]
+ * \param b The right-hand side [N, M]
+ * \param c The result [N, M]
+ * \param n The number of rows of B and C
+ * \param m The number of columns of B and C
+ */
+template <typename T>
+void diag_scale_left(const T* d, const T* b, T* c, size_t n, size_t m) {
+    for (size_t i = 0; i < n; ++i) {
+        const T d_i = d[i];
+
+        for (size_t j = 0; j < m; ++j) {
+            c[i * m + j] = d_i * b[i * m + j];
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = B * diag(d), scaling each column of B
+ * \param b The left-hand side [M, N]
+ * \param d The diagonal [N]
+ * \param c The result [M, N]
+ * \param m The number of rows of B and C
+ * \param n The number of columns of B and C
+ */
+template <typename T>
+void diag_scale_right(const T* b, const T* d, T* c, size_t m, size_t n) {
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            c[i * n + j] = b[i * n + j] * d[j];
+        }
+    }
+}
+
+/*!
+ * \brief Compute C = alpha * A * A^T (SYRK).
+ *
+ * Only the lower part of C is computed, the upper part is mirrored.
+ *
+ * \param a The matrix [M, K]
+ * \param c The symmetric result [M, M]
+ * \param m The number of rows of A
+ * \param k The number of columns of A
+ * \param alpha The multiplicator of A * A^T
+ */
+template <typename T>
+void syrk(const T* a, T* c, size_t m, size_t k, T alpha) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                T v(0);
+
+                for (size_t p = 0; p < k; ++p) {
+                    v += a[i * k + p] * a[j * k + p];
+                }
+
+                c[i * m + j] = alpha * v;
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, m, m * m * k / 2 >= parallel_threshold);
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = i + 1; j < m; ++j) {
+            c[i * m + j] = c[j * m + i];
+        }
+    }
+}
+
+} //end of namespace etl::impl::standard
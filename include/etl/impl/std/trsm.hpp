@@ -0,0 +1,178 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Standard implementation of the triangular solves (TRSM) and of the
+ * block update shared by the dense factorizations.
+ *
+ * All the matrices are row-major. The triangular solves are blocked: a
+ * diagonal block is solved by substitution and the remaining right-hand
+ * sides are updated with C -= A * B, which is where most of the time is
+ * spent.
+ */
+
+#pragma once
+
+namespace etl::impl::standard {
+
+/*!
+ * \brief The number of rows of the diagonal blocks of the triangular solves
+ */
+constexpr size_t trsm_block_size = 64;
+
+/*!
+ * \brief Compute C -= A * B on blocks of row-major matrices
+ * \param a The A block [M, K]
+ * \param lda The distance between two rows of A
+ * \param b The B block [K, N]
+ * \param ldb The distance between two rows of B
+ * \param c The C block [M, N]
+ * \param ldc The distance between two rows of C
+ * \param m The number of rows of A and C
+ * \param n The number of columns of B and C
+ * \param k The number of columns of A and rows of B
+ */
+template <typename T>
+void block_update(const T* a, size_t lda, const T* b, size_t ldb, T* c, size_t ldc, size_t m, size_t n, size_t k) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            for (size_t p = 0; p < k; ++p) {
+                const T a_ip = a[i * lda + p];
+
+                for (size_t j = 0; j < n; ++j) {
+                    c[i * ldc + j] -= a_ip * b[p * ldb + j];
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, m, m * n * k >= parallel_threshold);
+}
+
+namespace detail {
+
+/*!
+ * \brief Solve L * X = B in place, with a blocked forward substitution.
+ *
+ * Only the lower part of L is used.
+ *
+ * \tparam Unit Indicates if the diagonal of L is made of ones
+ *
+ * \param l The lower triangular matrix [N, N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ * \param update The functor computing C -= A * B on blocks of matrices
+ */
+template <bool Unit, typename T, typename Update>
+void trsm_lower_blocked(const T* l, T* b, size_t n, size_t m, Update update) {
+    for (size_t k = 0; k < n; k += trsm_block_size) {
+        const size_t nb = std::min(trsm_block_size, n - k);
+
+        for (size_t i = k; i < k + nb; ++i) {
+            for (size_t p = k; p < i; ++p) {
+                const T l_ip = l[i * n + p];
+
+                for (size_t j = 0; j < m; ++j) {
+                    b[i * m + j] -= l_ip * b[p * m + j];
+                }
+            }
+
+            if constexpr (!Unit) {
+                const T l_ii = l[i * n + i];
+
+                for (size_t j = 0; j < m; ++j) {
+                    b[i * m + j] /= l_ii;
+                }
+            }
+        }
+
+        if (k + nb < n) {
+            update(l + (k + nb) * n + k, n, b + k * m, m, b + (k + nb) * m, m, n - k - nb, m, nb);
+        }
+    }
+}
+
+/*!
+ * \brief Solve U * X = B in place, with a blocked backward substitution.
+ *
+ * Only the upper part of U is used.
+ *
+ * \tparam Unit Indicates if the diagonal of U is made of ones
+ *
+ * \param u The upper triangular matrix [N, N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ * \param update The functor computing C -= A * B on blocks of matrices
+ */
+template <bool Unit, typename T, typename Update>
+void trsm_upper_blocked(const T* u, T* b, size_t n, size_t m, Update update) {
+    for (size_t kk = (n + trsm_block_size - 1) / trsm_block_size; kk > 0; --kk) {
+        const size_t k  = (kk - 1) * trsm_block_size;
+        const size_t nb = std::min(trsm_block_size, n - k);
+
+        for (size_t i = k + nb; i > k; --i) {
+            const size_t r = i - 1;
+
+            for (size_t p = r + 1; p < k + nb; ++p) {
+                const T u_rp = u[r * n + p];
+
+                for (size_t j = 0; j < m; ++j) {
+                    b[r * m + j] -= u_rp * b[p * m + j];
+                }
+            }
+
+            if constexpr (!Unit) {
+                const T u_rr = u[r * n + r];
+
+                for (size_t j = 0; j < m; ++j) {
+                    b[r * m + j] /= u_rr;
+                }
+            }
+        }
+
+        if (k) {
+            update(u + k, n, b + k * m, m, b, m, k, m, nb);
+        }
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Solve L * X = B in place, with L a lower triangular matrix.
+ *
+ * \tparam Unit Indicates if the diagonal of L is made of ones
+ *
+ * \param l The lower triangular matrix [N, N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ */
+template <bool Unit, typename T>
+void trsm_lower(const T* l, T* b, size_t n, size_t m) {
+    detail::trsm_lower_blocked<Unit>(l, b, n, m, [](auto&&... args) { block_update(args...); });
+}
+
+/*!
+ * \brief Solve U * X = B in place, with U an upper triangular matrix.
+ *
+ * \tparam Unit Indicates if the diagonal of U is made of ones
+ *
+ * \param u The upper triangular matrix [N, N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ */
+template <bool Unit, typename T>
+void trsm_upper(const T* u, T* b, size_t n, size_t m) {
+    detail::trsm_upper_blocked<Unit>(u, b, n, m, [](auto&&... args) { block_update(args...); });
+}
+
+} //end of namespace etl::impl::standard
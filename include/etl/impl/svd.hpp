@@ -0,0 +1,44 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the singular value decomposition kernels
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/svd.hpp"
+#include "etl/impl/vec/svd.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief Compute the singular values, and optionally the singular vectors,
+ * of a row-major square matrix.
+ *
+ * \param a The matrix, destroyed [N, N]
+ * \param s The singular values, in descending order [N]
+ * \param u The left singular vectors, in columns, or nullptr [N, N]
+ * \param v The right singular vectors, in columns, or nullptr [N, N]
+ * \param n The dimension of the matrix
+ *
+ * \return true if the algorithm converged, false otherwise
+ */
+template <typename T>
+bool svd(T* a, T* s, T* u, T* v, size_t n) {
+    if constexpr (impl::vec::svd_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        return impl::vec::svd(a, s, u, v, n);
+    } else {
+        inc_counter("impl:std");
+        return impl::standard::svd(a, s, u, v, n);
+    }
+}
+
+} //end of namespace etl::detail
@@ -73,7 +73,7 @@ constexpr transpose_impl select_default_oop_transpose_impl(bool no_gpu) {
         return transpose_impl::CUBLAS;
     }
 
-    constexpr bool vec_possible = vectorize_impl && is_dma<C> && is_floating<C>;
+    constexpr bool vec_possible = vectorize_impl && is_dma<C> && is_floating<C> && all_vectorizable<vector_mode, A, C>;
 
 #ifdef SLOW_MKL
     // VEC and STD is always faster than MKL for out-of-place transpose
@@ -157,7 +157,7 @@ transpose_impl select_transpose_impl(transpose_impl def) {
 
             //VEC cannot always be used
             case transpose_impl::VEC:
-                if (!vectorize_impl || !all_dma<A, C> || !all_floating<A, C>) {
+                if (!vectorize_impl || !all_dma<A, C> || !all_floating<A, C> || !all_vectorizable<vector_mode, A, C>) {
                     std::cerr << "Forced selection to VEC transpose implementation, but not possible for this expression" << std::endl;
                     return def;
                 }
@@ -343,7 +343,7 @@ struct transpose {
                 decltype(auto) aa = smart_forward_gpu(a);
 
                 // Detect inplace (some implementations do not support inplace if not told explicitely)
-                if (aa.gpu_memory() && aa.gpu_memory() == c.gpu_memory()) {
+                if (aa.gpu_memory() && static_cast<const void*>(aa.gpu_memory()) == static_cast<const void*>(c.gpu_memory())) {
                     if (is_square(c)) {
                         inplace_square_transpose::apply(c);
                     } else {
@@ -360,7 +360,7 @@ struct transpose {
             decltype(auto) aa = smart_forward(a);
 
             // Detect inplace (some implementations do not support inplace if not told explicitely)
-            if (aa.memory_start() == c.memory_start()) {
+            if (static_cast<const void*>(aa.memory_start()) == static_cast<const void*>(c.memory_start())) {
                 if (is_square(c)) {
                     inplace_square_transpose::apply(c);
                 } else {
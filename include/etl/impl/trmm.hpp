@@ -0,0 +1,124 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the products exploiting the structure of a matrix
+ * (TRMM, diagonal scaling and SYRK)
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/trmm.hpp"
+#include "etl/impl/vec/trmm.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief Compute C = L * B, with L a lower triangular matrix.
+ *
+ * \tparam Trans Indicates if the memory holds the transposition of L
+ *
+ * \param l The lower triangular matrix [N, N]
+ * \param b The right-hand side [N, M]
+ * \param c The result [N, M]
+ * \param n The dimension of the triangular matrix
+ * \param m The number of columns of B and C
+ */
+template <bool Trans, typename T>
+void trmm_lower(const T* l, const T* b, T* c, size_t n, size_t m) {
+    if constexpr (impl::vec::trmm_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::trmm_lower<Trans>(l, b, c, n, m);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::trmm_lower<Trans>(l, b, c, n, m);
+    }
+}
+
+/*!
+ * \brief Compute C = U * B, with U an upper triangular matrix.
+ *
+ * \tparam Trans Indicates if the memory holds the transposition of U
+ *
+ * \param u The upper triangular matrix [N, N]
+ * \param b The right-hand side [N, M]
+ * \param c The result [N, M]
+ * \param n The dimension of the triangular matrix
+ * \param m The number of columns of B and C
+ */
+template <bool Trans, typename T>
+void trmm_upper(const T* u, const T* b, T* c, size_t n, size_t m) {
+    if constexpr (impl::vec::trmm_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::trmm_upper<Trans>(u, b, c, n, m);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::trmm_upper<Trans>(u, b, c, n, m);
+    }
+}
+
+/*!
+ * \brief Compute C = diag(d) * B, scaling each row of B
+ * \param d The diagonal [N]
+ * \param b The right-hand side [N, M]
+ * \param c The result [N, M]
+ * \param n The number of rows of B and C
+ * \param m The number of columns of B and C
+ */
+template <typename T>
+void diag_scale_left(const T* d, const T* b, T* c, size_t n, size_t m) {
+    if constexpr (impl::vec::trmm_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::diag_scale_left(d, b, c, n, m);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::diag_scale_left(d, b, c, n, m);
+    }
+}
+
+/*!
+ * \brief Compute C = B * diag(d), scaling each column of B
+ * \param b The left-hand side [M, N]
+ * \param d The diagonal [N]
+ * \param c The result [M, N]
+ * \param m The number of rows of B and C
+ * \param n The number of columns of B and C
+ */
+template <typename T>
+void diag_scale_right(const T* b, const T* d, T* c, size_t m, size_t n) {
+    if constexpr (impl::vec::trmm_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::diag_scale_right(b, d, c, m, n);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::diag_scale_right(b, d, c, m, n);
+    }
+}
+
+/*!
+ * \brief Compute C = alpha * A * A^T (SYRK), only half of C is computed.
+ *
+ * \param a The matrix [M, K]
+ * \param c The symmetric result [M, M]
+ * \param m The number of rows of A
+ * \param k The number of columns of A
+ * \param alpha The multiplicator of A * A^T
+ */
+template <typename T>
+void syrk(const T* a, T* c, size_t m, size_t k, T alpha) {
+    if constexpr (impl::vec::trmm_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::syrk(a, c, m, k, alpha);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::syrk(a, c, m, k, alpha);
+    }
+}
+
+} //end of namespace etl::detail
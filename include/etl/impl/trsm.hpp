@@ -0,0 +1,65 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Selector for the triangular solve kernels
+ */
+
+#pragma once
+
+//Include the implementations
+#include "etl/impl/std/trsm.hpp"
+#include "etl/impl/vec/trsm.hpp"
+
+namespace etl::detail {
+
+/*!
+ * \brief Solve L * X = B in place, with L a row-major lower triangular
+ * matrix.
+ *
+ * \tparam Unit Indicates if the diagonal of L is made of ones
+ *
+ * \param l The lower triangular matrix [N, N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ */
+template <bool Unit, typename T>
+void trsm_lower(const T* l, T* b, size_t n, size_t m) {
+    if constexpr (impl::vec::trsm_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::trsm_lower<Unit>(l, b, n, m);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::trsm_lower<Unit>(l, b, n, m);
+    }
+}
+
+/*!
+ * \brief Solve U * X = B in place, with U a row-major upper triangular
+ * matrix.
+ *
+ * \tparam Unit Indicates if the diagonal of U is made of ones
+ *
+ * \param u The upper triangular matrix [N, N]
+ * \param b The right-hand sides, replaced by the solutions [N, M]
+ * \param n The dimension of the matrix
+ * \param m The number of right-hand sides
+ */
+template <bool Unit, typename T>
+void trsm_upper(const T* u, T* b, size_t n, size_t m) {
+    if constexpr (impl::vec::trsm_possible<vector_mode, T>) {
+        inc_counter("impl:vec");
+        impl::vec::trsm_upper<Unit>(u, b, n, m);
+    } else {
+        inc_counter("impl:std");
+        impl::standard::trsm_upper<Unit>(u, b, n, m);
+    }
+}
+
+} //end of namespace etl::detail
@@ -0,0 +1,266 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the scaled dot-product attention
+ *
+ * The algorithm is the same as the standard implementation, but the two
+ * products of each tile (the scores and the weighted values) are computed
+ * with the row-major GEMM kernels. To do so, the keys are first transposed
+ * tile by tile, so that each tile of transposed keys is contiguous.
+ */
+
+#pragma once
+
+#include "etl/impl/std/attention.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized attention is possible for the
+ * given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam Q The queries expression
+ * \tparam K The keys expression
+ * \tparam VV The values expression
+ * \tparam C The output expression
+ */
+template <vector_mode_t V, typename Q, typename K, typename VV, typename C>
+constexpr bool attention_possible = vec_enabled&& vectorize_impl&& all_homogeneous<Q, K, VV, C>&& all_floating<Q, K, VV, C>&& all_vectorizable<V, Q, K, VV, C>&&
+                                        all_row_major<Q, K, VV, C>&& exp_unary_op<value_t<Q>>::template vectorizable<V>;
+
+namespace detail {
+
+/*!
+ * \brief Compute C = A * B (with the given epilogue) on the tiles, with
+ * the serial row-major kernels
+ */
+template <typename T, typename E>
+void attention_gemm(const T* a, const T* b, T* c, size_t M, size_t N, size_t K, const E& epilogue) {
+    if (K * N <= gemm_rr_small_threshold) {
+        gemm_small_kernel_rr_to_r<default_vec>(a, b, c, M, N, K, epilogue);
+    } else {
+        gemm_large_kernel_rr_to_r<default_vec>(a, b, c, M, N, K, epilogue.alpha, epilogue.beta, epilogue);
+    }
+}
+
+/*!
+ * \brief Update a row of the online softmax with a row of scores.
+ *
+ * The scores are replaced by their exponentials, shifted by the new
+ * maximum.
+ *
+ * \param s The row of scores
+ * \param n The number of scores
+ * \param m The running maximum
+ * \param l The running sum of the exponentials
+ * \return The factor by which the previous output must be rescaled
+ */
+template <typename V, typename T>
+T online_softmax_row(T* s, size_t n, T& m, T& l) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    // 1. Compute the maximum of the scores
+
+    T mx = -std::numeric_limits<T>::infinity();
+
+    size_t j = 0;
+
+    if (n >= vec_size) {
+        auto m1 = vec_type::loadu(s);
+
+        for (j = vec_size; j + vec_size - 1 < n; j += vec_size) {
+            m1 = vec_type::max(m1, vec_type::loadu(s + j));
+        }
+
+        T tmp[vec_size];
+        vec_type::storeu(tmp, m1);
+
+        for (size_t k = 0; k < vec_size; ++k) {
+            mx = std::max(mx, tmp[k]);
+        }
+    }
+
+    for (; j < n; ++j) {
+        mx = std::max(mx, s[j]);
+    }
+
+    // 2. Compute the exponentials and their sum
+
+    const T m_new = std::max(m, mx);
+    const T corr  = std::exp(m - m_new);
+
+    auto vm = vec_type::set(m_new);
+    auto s1 = vec_type::template zero<T>();
+
+    j = 0;
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        auto e1 = vec_type::exp(vec_type::sub(vec_type::loadu(s + j), vm));
+
+        vec_type::storeu(s + j, e1);
+
+        s1 = vec_type::add(s1, e1);
+    }
+
+    T sum = vec_type::hadd(s1);
+
+    for (; j < n; ++j) {
+        s[j] = std::exp(s[j] - m_new);
+        sum += s[j];
+    }
+
+    m = m_new;
+    l = l * corr + sum;
+
+    return corr;
+}
+
+/*!
+ * \brief Multiply a row by a factor
+ * \param x The row
+ * \param n The number of elements of the row
+ * \param f The factor
+ */
+template <typename V, typename T>
+void scale_row(T* x, size_t n, T f) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto vf = vec_type::set(f);
+
+    size_t j = 0;
+
+    for (; j + vec_size - 1 < n; j += vec_size) {
+        vec_type::storeu(x + j, vec_type::mul(vec_type::loadu(x + j), vf));
+    }
+
+    for (; j < n; ++j) {
+        x[j] *= f;
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the scaled dot-product attention of N independent groups
+ * (batches and heads)
+ *
+ * \param q The [N, Sq, D] queries
+ * \param k The [N, Sk, D] keys
+ * \param v The [N, Sk, Dv] values
+ * \param out The [N, Sq, Dv] output
+ * \param N The number of groups
+ * \param Sq The number of queries
+ * \param Sk The number of keys
+ * \param D The dimension of the queries and keys
+ * \param Dv The dimension of the values
+ * \param scale The scale of the scores
+ * \param causal Indicates if the causal mask is applied
+ */
+template <typename T>
+void attention(const T* q, const T* k, const T* v, T* out, size_t N, size_t Sq, size_t Sk, size_t D, size_t Dv, T scale, bool causal) {
+    static constexpr size_t q_block = etl::impl::standard::detail::attention_q_block;
+    static constexpr size_t k_block = etl::impl::standard::detail::attention_k_block;
+
+    const size_t q_blocks = (Sq + q_block - 1) / q_block;
+    const size_t k_blocks = (Sk + k_block - 1) / k_block;
+
+    // 1. Transpose each tile of keys, so that they are contiguous [D, bk] matrices
+
+    auto kt = aligned_allocate_auto<T>(N * Sk * D);
+
+    auto transpose_fun = [&](size_t first, size_t last) {
+        for (size_t task = first; task < last; ++task) {
+            const size_t n  = task / k_blocks;
+            const size_t k0 = (task % k_blocks) * k_block;
+            const size_t bk = std::min(k_block, Sk - k0);
+
+            const T* kk = k + (n * Sk + k0) * D;
+            T* tt       = kt.get() + (n * Sk + k0) * D;
+
+            for (size_t j = 0; j < bk; ++j) {
+                for (size_t d = 0; d < D; ++d) {
+                    tt[d * bk + j] = kk[j * D + d];
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(transpose_fun, 0, N * k_blocks, 2UL);
+
+    // 2. Compute the attention of each block of queries
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        auto s = aligned_allocate_auto<T>(q_block * k_block);
+
+        T m[q_block];
+        T l[q_block];
+
+        for (size_t task = first; task < last; ++task) {
+            const size_t n  = task / q_blocks;
+            const size_t q0 = (task % q_blocks) * q_block;
+            const size_t bq = std::min(q_block, Sq - q0);
+
+            const T* qq = q + (n * Sq + q0) * D;
+            const T* vv = v + n * Sk * Dv;
+            T* oo       = out + (n * Sq + q0) * Dv;
+
+            // With causal masking, the keys after the last query are never used
+            const size_t k_last = causal ? std::min(Sk, q0 + bq) : Sk;
+
+            for (size_t i = 0; i < bq; ++i) {
+                m[i] = -std::numeric_limits<T>::infinity();
+                l[i] = T(0);
+            }
+
+            std::fill_n(oo, bq * Dv, T(0));
+
+            for (size_t k0 = 0; k0 < k_last; k0 += k_block) {
+                const size_t bk = std::min(k_block, Sk - k0);
+
+                // The scores of the tile
+                detail::attention_gemm(qq, kt.get() + (n * Sk + k0) * D, s.get(), bq, bk, D, gemm_epilogue<default_vec, T>(scale));
+
+                for (size_t i = 0; i < bq; ++i) {
+                    size_t j_last = bk;
+
+                    if (causal) {
+                        j_last = std::min(bk, q0 + i + 1 > k0 ? q0 + i + 1 - k0 : 0);
+
+                        // The masked scores do not contribute to the weighted values
+                        std::fill(s.get() + i * bk + j_last, s.get() + (i + 1) * bk, T(0));
+                    }
+
+                    if (j_last) {
+                        const T corr = detail::online_softmax_row<default_vec>(s.get() + i * bk, j_last, m[i], l[i]);
+
+                        if (corr != T(1)) {
+                            detail::scale_row<default_vec>(oo + i * Dv, Dv, corr);
+                        }
+                    }
+                }
+
+                // The weighted values of the tile
+                detail::attention_gemm(s.get(), vv + k0 * Dv, oo, bq, Dv, bk, gemm_epilogue<default_vec, T, true>(T(1), T(1)));
+            }
+
+            for (size_t i = 0; i < bq; ++i) {
+                detail::scale_row<default_vec>(oo + i * Dv, Dv, T(1) / l[i]);
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, N * q_blocks, 2UL);
+}
+
+} //end of namespace etl::impl::vec
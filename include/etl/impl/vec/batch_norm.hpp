@@ -0,0 +1,567 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the batch normalization
+ *
+ * The input is seen as a [N, K, S] tensor, with S = 1 for a 2D input [N, K]
+ * and S = W * H for a 4D input [N, K, W, H]. For 2D inputs, the vectors are
+ * made of consecutive channels. For 4D inputs, the vectors are made of
+ * consecutive elements of the same channel and the Welford accumulators of
+ * the lanes are merged at the end of the channel.
+ */
+
+#pragma once
+
+#include "etl/impl/std/batch_norm.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized batch normalization is possible
+ * for the given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam X The input expression
+ * \tparam Y The output expression
+ */
+template <vector_mode_t V, typename X, typename Y>
+constexpr bool batch_norm_possible = vec_enabled&& vectorize_impl&& all_homogeneous<X, Y>&& all_floating<X, Y>&& all_vectorizable<V, X, Y>&& all_row_major<X, Y>;
+
+/*!
+ * \brief Traits indicating if the vectorized batch normalization gradients
+ * are possible for the given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam X The input expression
+ * \tparam E The errors expression
+ * \tparam Y The output expression
+ */
+template <vector_mode_t V, typename X, typename E, typename Y>
+constexpr bool batch_norm_backward_possible = batch_norm_possible<V, X, Y>&& all_homogeneous<X, E>&& all_vectorizable<V, E>&& all_row_major<E>;
+
+namespace detail {
+
+/*!
+ * \brief Compute the mean and the sum of squared differences of a range of
+ * channels
+ * \param x The input
+ * \param mean The output mean
+ * \param sq The output sum of squared differences to the mean
+ * \param N The number of samples
+ * \param K The number of channels
+ * \param S The number of elements of each channel in each sample
+ * \param first The first channel
+ * \param last The end of the range of channels
+ */
+template <typename V, typename T>
+void batch_norm_stats(const T* x, T* mean, T* sq, size_t N, size_t K, size_t S, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    if (S == 1) {
+        size_t k = first;
+
+        for (; k + 2 * vec_size - 1 < last; k += 2 * vec_size) {
+            auto m1 = vec_type::template zero<T>();
+            auto m2 = vec_type::template zero<T>();
+            auto s1 = vec_type::template zero<T>();
+            auto s2 = vec_type::template zero<T>();
+
+            for (size_t b = 0; b < N; ++b) {
+                auto inv = vec_type::set(T(1) / T(b + 1));
+
+                auto x1 = vec_type::loadu(x + b * K + k);
+                auto x2 = vec_type::loadu(x + b * K + k + vec_size);
+
+                auto d1 = vec_type::sub(x1, m1);
+                auto d2 = vec_type::sub(x2, m2);
+
+                m1 = vec_type::fmadd(d1, inv, m1);
+                m2 = vec_type::fmadd(d2, inv, m2);
+
+                s1 = vec_type::fmadd(d1, vec_type::sub(x1, m1), s1);
+                s2 = vec_type::fmadd(d2, vec_type::sub(x2, m2), s2);
+            }
+
+            vec_type::storeu(mean + k, m1);
+            vec_type::storeu(mean + k + vec_size, m2);
+            vec_type::storeu(sq + k, s1);
+            vec_type::storeu(sq + k + vec_size, s2);
+        }
+
+        for (; k + vec_size - 1 < last; k += vec_size) {
+            auto m1 = vec_type::template zero<T>();
+            auto s1 = vec_type::template zero<T>();
+
+            for (size_t b = 0; b < N; ++b) {
+                auto x1 = vec_type::loadu(x + b * K + k);
+                auto d1 = vec_type::sub(x1, m1);
+
+                m1 = vec_type::fmadd(d1, vec_type::set(T(1) / T(b + 1)), m1);
+                s1 = vec_type::fmadd(d1, vec_type::sub(x1, m1), s1);
+            }
+
+            vec_type::storeu(mean + k, m1);
+            vec_type::storeu(sq + k, s1);
+        }
+
+        etl::impl::standard::detail::batch_norm_stats(x, mean, sq, N, K, S, k, last);
+    } else {
+        // Each lane of the two sets of accumulators sees the same number of elements
+
+        T lanes[2][2][vec_size];
+
+        for (size_t k = first; k < last; ++k) {
+            auto m1 = vec_type::template zero<T>();
+            auto m2 = vec_type::template zero<T>();
+            auto s1 = vec_type::template zero<T>();
+            auto s2 = vec_type::template zero<T>();
+
+            T n1 = 0;
+            T n2 = 0;
+
+            T n = 0;
+            T m = 0;
+            T s = 0;
+
+            for (size_t b = 0; b < N; ++b) {
+                const T* p = x + (b * K + k) * S;
+
+                size_t i = 0;
+
+                for (; i + 2 * vec_size - 1 < S; i += 2 * vec_size) {
+                    n1 += T(1);
+                    n2 += T(1);
+
+                    auto x1 = vec_type::loadu(p + i);
+                    auto x2 = vec_type::loadu(p + i + vec_size);
+
+                    auto d1 = vec_type::sub(x1, m1);
+                    auto d2 = vec_type::sub(x2, m2);
+
+                    m1 = vec_type::fmadd(d1, vec_type::set(T(1) / n1), m1);
+                    m2 = vec_type::fmadd(d2, vec_type::set(T(1) / n2), m2);
+
+                    s1 = vec_type::fmadd(d1, vec_type::sub(x1, m1), s1);
+                    s2 = vec_type::fmadd(d2, vec_type::sub(x2, m2), s2);
+                }
+
+                for (; i + vec_size - 1 < S; i += vec_size) {
+                    n1 += T(1);
+
+                    auto x1 = vec_type::loadu(p + i);
+                    auto d1 = vec_type::sub(x1, m1);
+
+                    m1 = vec_type::fmadd(d1, vec_type::set(T(1) / n1), m1);
+                    s1 = vec_type::fmadd(d1, vec_type::sub(x1, m1), s1);
+                }
+
+                for (; i < S; ++i) {
+                    n += T(1);
+
+                    const T d = p[i] - m;
+
+                    m += d / n;
+                    s += d * (p[i] - m);
+                }
+            }
+
+            vec_type::storeu(lanes[0][0], m1);
+            vec_type::storeu(lanes[0][1], s1);
+            vec_type::storeu(lanes[1][0], m2);
+            vec_type::storeu(lanes[1][1], s2);
+
+            for (size_t l = 0; l < vec_size; ++l) {
+                etl::impl::standard::detail::welford_merge(n, m, s, n1, lanes[0][0][l], lanes[0][1][l]);
+                etl::impl::standard::detail::welford_merge(n, m, s, n2, lanes[1][0][l], lanes[1][1][l]);
+            }
+
+            mean[k] = m;
+            sq[k]   = s;
+        }
+    }
+}
+
+/*!
+ * \brief Apply the affine transformation y = x * scale + shift on a range of
+ * channels
+ * \param x The input
+ * \param y The output
+ * \param scale The scale of each channel
+ * \param shift The shift of each channel
+ * \param N The number of samples
+ * \param K The number of channels
+ * \param S The number of elements of each channel in each sample
+ * \param first The first channel
+ * \param last The end of the range of channels
+ */
+template <typename V, typename T>
+void batch_norm_affine(const T* x, T* y, const T* scale, const T* shift, size_t N, size_t K, size_t S, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    if (S == 1) {
+        for (size_t b = 0; b < N; ++b) {
+            const T* in = x + b * K;
+            T* out      = y + b * K;
+
+            size_t k = first;
+
+            for (; k + vec_size - 1 < last; k += vec_size) {
+                vec_type::storeu(out + k, vec_type::fmadd(vec_type::loadu(in + k), vec_type::loadu(scale + k), vec_type::loadu(shift + k)));
+            }
+
+            for (; k < last; ++k) {
+                out[k] = in[k] * scale[k] + shift[k];
+            }
+        }
+    } else {
+        for (size_t b = 0; b < N; ++b) {
+            for (size_t k = first; k < last; ++k) {
+                const T* in = x + (b * K + k) * S;
+                T* out      = y + (b * K + k) * S;
+
+                auto a1 = vec_type::set(scale[k]);
+                auto a0 = vec_type::set(shift[k]);
+
+                size_t i = 0;
+
+                for (; i + 2 * vec_size - 1 < S; i += 2 * vec_size) {
+                    vec_type::storeu(out + i, vec_type::fmadd(vec_type::loadu(in + i), a1, a0));
+                    vec_type::storeu(out + i + vec_size, vec_type::fmadd(vec_type::loadu(in + i + vec_size), a1, a0));
+                }
+
+                for (; i + vec_size - 1 < S; i += vec_size) {
+                    vec_type::storeu(out + i, vec_type::fmadd(vec_type::loadu(in + i), a1, a0));
+                }
+
+                for (; i < S; ++i) {
+                    out[i] = in[i] * scale[k] + shift[k];
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute the sums of the errors and of the errors multiplied by the
+ * centered input of a range of channels
+ * \param x The input
+ * \param dy The errors
+ * \param mean The mean of each channel
+ * \param sum_dy The output sum of the errors
+ * \param sum_dy_xmu The output sum of dy * (x - mean)
+ * \param N The number of samples
+ * \param K The number of channels
+ * \param S The number of elements of each channel in each sample
+ * \param first The first channel
+ * \param last The end of the range of channels
+ */
+template <typename V, typename T>
+void batch_norm_backward_sums(const T* x, const T* dy, const T* mean, T* sum_dy, T* sum_dy_xmu, size_t N, size_t K, size_t S, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    if (S == 1) {
+        size_t k = first;
+
+        for (; k + vec_size - 1 < last; k += vec_size) {
+            auto m = vec_type::loadu(mean + k);
+
+            auto r1 = vec_type::template zero<T>();
+            auto r2 = vec_type::template zero<T>();
+
+            for (size_t b = 0; b < N; ++b) {
+                auto e = vec_type::loadu(dy + b * K + k);
+
+                r1 = vec_type::add(r1, e);
+                r2 = vec_type::fmadd(e, vec_type::sub(vec_type::loadu(x + b * K + k), m), r2);
+            }
+
+            vec_type::storeu(sum_dy + k, r1);
+            vec_type::storeu(sum_dy_xmu + k, r2);
+        }
+
+        etl::impl::standard::detail::batch_norm_backward_sums(x, dy, mean, sum_dy, sum_dy_xmu, N, K, S, k, last);
+    } else {
+        for (size_t k = first; k < last; ++k) {
+            auto m = vec_type::set(mean[k]);
+
+            auto r1 = vec_type::template zero<T>();
+            auto r2 = vec_type::template zero<T>();
+            auto r3 = vec_type::template zero<T>();
+            auto r4 = vec_type::template zero<T>();
+
+            T s1 = 0;
+            T s2 = 0;
+
+            for (size_t b = 0; b < N; ++b) {
+                const T* in  = x + (b * K + k) * S;
+                const T* err = dy + (b * K + k) * S;
+
+                size_t i = 0;
+
+                for (; i + 2 * vec_size - 1 < S; i += 2 * vec_size) {
+                    auto e1 = vec_type::loadu(err + i);
+                    auto e2 = vec_type::loadu(err + i + vec_size);
+
+                    r1 = vec_type::add(r1, e1);
+                    r2 = vec_type::add(r2, e2);
+
+                    r3 = vec_type::fmadd(e1, vec_type::sub(vec_type::loadu(in + i), m), r3);
+                    r4 = vec_type::fmadd(e2, vec_type::sub(vec_type::loadu(in + i + vec_size), m), r4);
+                }
+
+                for (; i + vec_size - 1 < S; i += vec_size) {
+                    auto e1 = vec_type::loadu(err + i);
+
+                    r1 = vec_type::add(r1, e1);
+                    r3 = vec_type::fmadd(e1, vec_type::sub(vec_type::loadu(in + i), m), r3);
+                }
+
+                for (; i < S; ++i) {
+                    s1 += err[i];
+                    s2 += err[i] * (in[i] - mean[k]);
+                }
+            }
+
+            sum_dy[k]     = s1 + vec_type::hadd(vec_type::add(r1, r2));
+            sum_dy_xmu[k] = s2 + vec_type::hadd(vec_type::add(r3, r4));
+        }
+    }
+}
+
+/*!
+ * \brief Compute the input gradients dx = a_dy * dy + a_x * x + a_0 on a
+ * range of channels
+ * \param x The input
+ * \param dy The errors
+ * \param dx The output gradients
+ * \param a_dy The coefficient of the errors
+ * \param a_x The coefficient of the input
+ * \param a_0 The constant
+ * \param N The number of samples
+ * \param K The number of channels
+ * \param S The number of elements of each channel in each sample
+ * \param first The first channel
+ * \param last The end of the range of channels
+ */
+template <typename V, typename T>
+void batch_norm_backward_apply(
+        const T* x, const T* dy, T* dx, const T* a_dy, const T* a_x, const T* a_0, size_t N, size_t K, size_t S, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    if (S == 1) {
+        for (size_t b = 0; b < N; ++b) {
+            const T* in  = x + b * K;
+            const T* err = dy + b * K;
+            T* out       = dx + b * K;
+
+            size_t k = first;
+
+            for (; k + vec_size - 1 < last; k += vec_size) {
+                auto r = vec_type::fmadd(vec_type::loadu(in + k), vec_type::loadu(a_x + k), vec_type::loadu(a_0 + k));
+                vec_type::storeu(out + k, vec_type::fmadd(vec_type::loadu(err + k), vec_type::loadu(a_dy + k), r));
+            }
+
+            for (; k < last; ++k) {
+                out[k] = a_dy[k] * err[k] + a_x[k] * in[k] + a_0[k];
+            }
+        }
+    } else {
+        for (size_t b = 0; b < N; ++b) {
+            for (size_t k = first; k < last; ++k) {
+                const T* in  = x + (b * K + k) * S;
+                const T* err = dy + (b * K + k) * S;
+                T* out       = dx + (b * K + k) * S;
+
+                auto c1 = vec_type::set(a_dy[k]);
+                auto c2 = vec_type::set(a_x[k]);
+                auto c0 = vec_type::set(a_0[k]);
+
+                size_t i = 0;
+
+                for (; i + vec_size - 1 < S; i += vec_size) {
+                    auto r = vec_type::fmadd(vec_type::loadu(in + i), c2, c0);
+                    vec_type::storeu(out + i, vec_type::fmadd(vec_type::loadu(err + i), c1, r));
+                }
+
+                for (; i < S; ++i) {
+                    out[i] = a_dy[k] * err[i] + a_x[k] * in[i] + a_0[k];
+                }
+            }
+        }
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the batch normalization of x in training mode.
+ *
+ * The mean and the (biased) variance of each channel are computed over the
+ * batch and stored in mean and var. Each range of channels is normalized
+ * right after its statistics have been computed, while it is still in cache.
+ *
+ * \param x The input
+ * \param gamma The scale parameters
+ * \param beta The shift parameters
+ * \param y The output
+ * \param mean The output mean
+ * \param var The output variance
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename G, typename B, typename Y, typename M, typename V>
+void batch_norm_forward([[maybe_unused]] const X& x,
+                        [[maybe_unused]] const G& gamma,
+                        [[maybe_unused]] const B& beta,
+                        [[maybe_unused]] Y&& y,
+                        [[maybe_unused]] M&& mean,
+                        [[maybe_unused]] V&& var,
+                        [[maybe_unused]] value_t<X> eps) {
+    if constexpr (batch_norm_possible<vector_mode, X, Y>) {
+        using T = value_t<X>;
+
+        const size_t N = etl::dim<0>(x);
+        const size_t K = etl::dim<1>(x);
+        const size_t S = etl::size(x) / (N * K);
+
+        etl::dyn_matrix<T, 2> tmp(2, K);
+
+        const T* in = x.memory_start();
+        T* out      = y.memory_start();
+        T* m        = mean.memory_start();
+        T* v        = var.memory_start();
+        T* scale    = tmp.memory_start();
+        T* shift    = tmp.memory_start() + K;
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            detail::batch_norm_stats<default_vec>(in, m, v, N, K, S, first, last);
+
+            for (size_t k = first; k < last; ++k) {
+                v[k] /= T(N * S);
+            }
+
+            etl::impl::standard::detail::batch_norm_scale_shift(gamma.memory_start(), beta.memory_start(), m, v, scale, shift, eps, first, last);
+            detail::batch_norm_affine<default_vec>(in, out, scale, shift, N, K, S, first, last);
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, K, 2UL);
+    } else {
+        cpp_unreachable("Invalid call to vec::batch_norm_forward");
+    }
+}
+
+/*!
+ * \brief Compute the batch normalization of x in inference mode, with the
+ * given mean and variance.
+ *
+ * \param x The input
+ * \param gamma The scale parameters
+ * \param beta The shift parameters
+ * \param mean The mean of each channel
+ * \param var The variance of each channel
+ * \param y The output
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename G, typename B, typename M, typename V, typename Y>
+void batch_norm_inference([[maybe_unused]] const X& x,
+                          [[maybe_unused]] const G& gamma,
+                          [[maybe_unused]] const B& beta,
+                          [[maybe_unused]] const M& mean,
+                          [[maybe_unused]] const V& var,
+                          [[maybe_unused]] Y&& y,
+                          [[maybe_unused]] value_t<X> eps) {
+    if constexpr (batch_norm_possible<vector_mode, X, Y>) {
+        using T = value_t<X>;
+
+        const size_t N = etl::dim<0>(x);
+        const size_t K = etl::dim<1>(x);
+        const size_t S = etl::size(x) / (N * K);
+
+        etl::dyn_matrix<T, 2> tmp(2, K);
+
+        const T* in = x.memory_start();
+        T* out      = y.memory_start();
+        T* scale    = tmp.memory_start();
+        T* shift    = tmp.memory_start() + K;
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            etl::impl::standard::detail::batch_norm_scale_shift(
+                    gamma.memory_start(), beta.memory_start(), mean.memory_start(), var.memory_start(), scale, shift, eps, first, last);
+            detail::batch_norm_affine<default_vec>(in, out, scale, shift, N, K, S, first, last);
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, K, 2UL);
+    } else {
+        cpp_unreachable("Invalid call to vec::batch_norm_inference");
+    }
+}
+
+/*!
+ * \brief Compute the gradients of the batch normalization.
+ *
+ * \param x The input of the forward pass
+ * \param dy The errors at the output of the batch normalization
+ * \param gamma The scale parameters
+ * \param mean The mean computed by the forward pass
+ * \param var The variance computed by the forward pass
+ * \param dx The output gradients of the input
+ * \param dgamma The output gradients of gamma
+ * \param dbeta The output gradients of beta
+ * \param eps The epsilon added to the variance
+ */
+template <typename X, typename E, typename G, typename M, typename V, typename DX, typename DG, typename DB>
+void batch_norm_backward([[maybe_unused]] const X& x,
+                         [[maybe_unused]] const E& dy,
+                         [[maybe_unused]] const G& gamma,
+                         [[maybe_unused]] const M& mean,
+                         [[maybe_unused]] const V& var,
+                         [[maybe_unused]] DX&& dx,
+                         [[maybe_unused]] DG&& dgamma,
+                         [[maybe_unused]] DB&& dbeta,
+                         [[maybe_unused]] value_t<X> eps) {
+    if constexpr (batch_norm_backward_possible<vector_mode, X, E, DX>) {
+        using T = value_t<X>;
+
+        const size_t N = etl::dim<0>(x);
+        const size_t K = etl::dim<1>(x);
+        const size_t S = etl::size(x) / (N * K);
+
+        etl::dyn_matrix<T, 2> tmp(3, K);
+
+        const T* in  = x.memory_start();
+        const T* err = dy.memory_start();
+        const T* m   = mean.memory_start();
+        T* out       = dx.memory_start();
+        T* dg        = dgamma.memory_start();
+        T* db        = dbeta.memory_start();
+        T* a_dy      = tmp.memory_start();
+        T* a_x       = tmp.memory_start() + K;
+        T* a_0       = tmp.memory_start() + 2 * K;
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            detail::batch_norm_backward_sums<default_vec>(in, err, m, db, dg, N, K, S, first, last);
+            etl::impl::standard::detail::batch_norm_backward_coefficients(
+                    gamma.memory_start(), m, var.memory_start(), dg, db, a_dy, a_x, a_0, T(N * S), eps, first, last);
+            detail::batch_norm_backward_apply<default_vec>(in, err, out, a_dy, a_x, a_0, N, K, S, first, last);
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, K, 2UL);
+    } else {
+        cpp_unreachable("Invalid call to vec::batch_norm_backward");
+    }
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,204 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the Binary Cross Entropy reduction
+ *
+ * The loss and the error are reduced over ranges of elements, each range
+ * being possibly handled by a different thread. When both are needed, they
+ * are computed in the same pass.
+ */
+
+#pragma once
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized BCE loss is possible for the
+ * given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam O The output expression
+ * \tparam L The labels expression
+ */
+template <vector_mode_t V, typename O, typename L>
+constexpr bool bce_loss_possible = vec_enabled&& vectorize_impl&& all_homogeneous<O, L>&& all_floating<O, L>&& all_vectorizable<V, O, L>&& all_row_major<O, L>&&
+                                       log_unary_op<value_t<O>>::template vectorizable<V>;
+
+/*!
+ * \brief Traits indicating if the vectorized BCE error is possible for the
+ * given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam O The output expression
+ * \tparam L The labels expression
+ */
+template <vector_mode_t V, typename O, typename L>
+constexpr bool bce_error_possible = vec_enabled&& vectorize_impl&& all_homogeneous<O, L>&& all_floating<O, L>&& all_vectorizable<V, O, L>&& all_row_major<O, L>;
+
+/*!
+ * \brief Traits indicating if the vectorized BCE loss and error is possible
+ * for the given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam O The output expression
+ * \tparam L The labels expression
+ */
+template <vector_mode_t V, typename O, typename L>
+constexpr bool bce_possible = bce_loss_possible<V, O, L>;
+
+namespace detail {
+
+/*!
+ * \brief Compute the BCE loss and the absolute difference between the
+ * labels and the output over a range
+ * \param output The output
+ * \param labels The labels
+ * \param first The first element of the range
+ * \param last The end of the range
+ * \tparam Loss Indicates if the loss must be computed
+ * \tparam Error Indicates if the error must be computed
+ * \return The unscaled loss and error over the range
+ */
+template <typename V, bool Loss, bool Error, typename T>
+std::pair<T, T> bce_kernel(const T* output, const T* labels, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto one  = vec_type::set(T(1));
+    auto zero = vec_type::template zero<T>();
+
+    auto r1 = vec_type::template zero<T>();
+    auto r2 = vec_type::template zero<T>();
+
+    size_t i = first;
+
+    for (; i + vec_size - 1 < last; i += vec_size) {
+        auto o = vec_type::loadu(output + i);
+        auto l = vec_type::loadu(labels + i);
+
+        if constexpr (Loss) {
+            auto t1 = vec_type::mul(l, vec_type::log(o));
+            auto t2 = vec_type::mul(vec_type::sub(one, l), vec_type::log(vec_type::sub(one, o)));
+
+            r1 = vec_type::add(r1, vec_type::add(t1, t2));
+        }
+
+        if constexpr (Error) {
+            auto d = vec_type::sub(l, o);
+
+            r2 = vec_type::add(r2, vec_type::max(d, vec_type::sub(zero, d)));
+        }
+    }
+
+    T loss  = vec_type::hadd(r1);
+    T error = vec_type::hadd(r2);
+
+    for (; i < last; ++i) {
+        if constexpr (Loss) {
+            loss += labels[i] * std::log(output[i]) + (T(1) - labels[i]) * std::log(T(1) - output[i]);
+        }
+
+        if constexpr (Error) {
+            error += std::abs(labels[i] - output[i]);
+        }
+    }
+
+    return std::make_pair(loss, error);
+}
+
+/*!
+ * \brief Reduce the output and labels with the BCE kernel
+ * \param output The output expression
+ * \param labels The labels expression
+ * \tparam Loss Indicates if the loss must be computed
+ * \tparam Error Indicates if the error must be computed
+ * \return The unscaled loss and error
+ */
+template <bool Loss, bool Error, typename O, typename L>
+std::pair<value_t<O>, value_t<O>> bce_reduce(const O& output, const L& labels) {
+    using T = value_t<O>;
+
+    output.ensure_cpu_up_to_date();
+    labels.ensure_cpu_up_to_date();
+
+    const T* o = output.memory_start();
+    const T* l = labels.memory_start();
+
+    std::pair<T, T> acc(0, 0);
+
+    auto acc_functor = [&acc](std::pair<T, T> value) {
+        acc.first += value.first;
+        acc.second += value.second;
+    };
+
+    auto batch_fun = [o, l](size_t first, size_t last) { return bce_kernel<default_vec, Loss, Error>(o, l, first, last); };
+
+    engine_dispatch_1d_acc<std::pair<T, T>>(batch_fun, acc_functor, 0, etl::size(output), vec_sum_parallel_threshold);
+
+    return acc;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the Binary Cross Entropy loss of the output and labels
+ * \param output The output expression
+ * \param labels The labels expression
+ * \param scale The scale to apply to the loss
+ * \return The BCE loss
+ */
+template <typename O, typename L>
+value_t<O> bce_loss([[maybe_unused]] const O& output, [[maybe_unused]] const L& labels, [[maybe_unused]] value_t<O> scale) {
+    if constexpr (bce_loss_possible<vector_mode, O, L>) {
+        return scale * detail::bce_reduce<true, false>(output, labels).first;
+    } else {
+        cpp_unreachable("Invalid call to vec::bce_loss");
+    }
+}
+
+/*!
+ * \brief Compute the Binary Cross Entropy error of the output and labels
+ * \param output The output expression
+ * \param labels The labels expression
+ * \param scale The scale to apply to the error
+ * \return The BCE error
+ */
+template <typename O, typename L>
+value_t<O> bce_error([[maybe_unused]] const O& output, [[maybe_unused]] const L& labels, [[maybe_unused]] value_t<O> scale) {
+    if constexpr (bce_error_possible<vector_mode, O, L>) {
+        return scale * detail::bce_reduce<false, true>(output, labels).second;
+    } else {
+        cpp_unreachable("Invalid call to vec::bce_error");
+    }
+}
+
+/*!
+ * \brief Compute the Binary Cross Entropy loss and error of the output and
+ * labels
+ * \param output The output expression
+ * \param labels The labels expression
+ * \param alpha The scale to apply to the loss
+ * \param beta The scale to apply to the error
+ * \return The BCE loss and error
+ */
+template <typename O, typename L>
+std::pair<value_t<O>, value_t<O>> bce([[maybe_unused]] const O& output,
+                                      [[maybe_unused]] const L& labels,
+                                      [[maybe_unused]] value_t<O> alpha,
+                                      [[maybe_unused]] value_t<O> beta) {
+    if constexpr (bce_possible<vector_mode, O, L>) {
+        auto result = detail::bce_reduce<true, true>(output, labels);
+        return std::make_pair(alpha * result.first, beta * result.second);
+    } else {
+        cpp_unreachable("Invalid call to vec::bce");
+    }
+}
+
+} //end of namespace etl::impl::vec
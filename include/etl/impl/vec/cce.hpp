@@ -0,0 +1,420 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the Categorical Cross Entropy reduction
+ * and of the fused softmax cross entropy.
+ *
+ * The loss is reduced over ranges of elements and the error over ranges of
+ * rows, each range being possibly handled by a different thread. When both
+ * are needed, they are computed row by row so that each row is only loaded
+ * once from memory.
+ */
+
+#pragma once
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized CCE loss is possible for the
+ * given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam O The output expression
+ * \tparam L The labels expression
+ */
+template <vector_mode_t V, typename O, typename L>
+constexpr bool cce_loss_possible = vec_enabled&& vectorize_impl&& all_homogeneous<O, L>&& all_floating<O, L>&& all_vectorizable<V, O, L>&& all_row_major<O, L>&&
+                                       log_unary_op<value_t<O>>::template vectorizable<V>;
+
+/*!
+ * \brief Traits indicating if the vectorized CCE error is possible for the
+ * given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam O The output expression
+ * \tparam L The labels expression
+ */
+template <vector_mode_t V, typename O, typename L>
+constexpr bool cce_error_possible = vec_enabled&& vectorize_impl&& all_homogeneous<O, L>&& all_floating<O, L>&& all_row_major<O, L>&& all_2d<O, L>;
+
+/*!
+ * \brief Traits indicating if the vectorized CCE loss and error is possible
+ * for the given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam O The output expression
+ * \tparam L The labels expression
+ */
+template <vector_mode_t V, typename O, typename L>
+constexpr bool cce_possible = cce_loss_possible<V, O, L>&& cce_error_possible<V, O, L>;
+
+/*!
+ * \brief Traits indicating if the vectorized softmax cross entropy is
+ * possible for the given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam O The logits expression
+ * \tparam L The labels expression
+ * \tparam G The gradients expression
+ */
+template <vector_mode_t V, typename O, typename L, typename G>
+constexpr bool softmax_cross_entropy_possible = vec_enabled&& vectorize_impl&& all_homogeneous<O, L, G>&& all_floating<O, L, G>&& all_vectorizable<V, O, L, G>&&
+                                                    all_row_major<O, L, G>&& all_dma<G>&& exp_unary_op<value_t<O>>::template vectorizable<V>;
+
+namespace detail {
+
+/*!
+ * \brief Compute the sum of labels * log(output) over a range
+ * \param output The output
+ * \param labels The labels
+ * \param first The first element of the range
+ * \param last The end of the range
+ * \return The unscaled CCE loss over the range
+ */
+template <typename V, typename T>
+T cce_loss_kernel(const T* output, const T* labels, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto r1 = vec_type::template zero<T>();
+    auto r2 = vec_type::template zero<T>();
+
+    size_t i = first;
+
+    for (; i + 2 * vec_size - 1 < last; i += 2 * vec_size) {
+        r1 = vec_type::fmadd(vec_type::loadu(labels + i), vec_type::log(vec_type::loadu(output + i)), r1);
+        r2 = vec_type::fmadd(vec_type::loadu(labels + i + vec_size), vec_type::log(vec_type::loadu(output + i + vec_size)), r2);
+    }
+
+    for (; i + vec_size - 1 < last; i += vec_size) {
+        r1 = vec_type::fmadd(vec_type::loadu(labels + i), vec_type::log(vec_type::loadu(output + i)), r1);
+    }
+
+    T loss = vec_type::hadd(vec_type::add(r1, r2));
+
+    for (; i < last; ++i) {
+        loss += labels[i] * std::log(output[i]);
+    }
+
+    return loss;
+}
+
+/*!
+ * \brief Compute the number of rows for which the argmax of the output
+ * differs from the argmax of the labels
+ * \param output The output
+ * \param labels The labels
+ * \param n The number of columns
+ * \param first The first row of the range
+ * \param last The end of the range of rows
+ * \return The unscaled CCE error over the range
+ */
+template <typename T>
+T cce_error_kernel(const T* output, const T* labels, size_t n, size_t first, size_t last) {
+    T error(0);
+
+    for (size_t r = first; r < last; ++r) {
+        const T* o = output + r * n;
+        const T* l = labels + r * n;
+
+        size_t o_max = 0;
+        size_t l_max = 0;
+
+        for (size_t j = 1; j < n; ++j) {
+            if (o[j] > o[o_max]) {
+                o_max = j;
+            }
+
+            if (l[j] > l[l_max]) {
+                l_max = j;
+            }
+        }
+
+        if (o_max != l_max) {
+            error += T(1);
+        }
+    }
+
+    return error;
+}
+
+/*!
+ * \brief Compute the softmax of a row of logits into the gradients, and the
+ * sum of labels * log(softmax(logits)) of the row
+ * \param in The row of logits
+ * \param labels The row of labels
+ * \param out The row of gradients
+ * \param n The number of elements of the row
+ * \return The unscaled loss of the row
+ */
+template <typename V, typename T>
+T softmax_cross_entropy_row(const T* in, const T* labels, T* out, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    // 1. Compute the maximum of the row
+
+    T m = in[0];
+
+    size_t i = 0;
+
+    if (n >= vec_size) {
+        auto m1 = vec_type::loadu(in);
+
+        i = vec_size;
+
+        for (; i + vec_size - 1 < n; i += vec_size) {
+            m1 = vec_type::max(m1, vec_type::loadu(in + i));
+        }
+
+        T tmp[vec_size];
+        vec_type::storeu(tmp, m1);
+
+        for (size_t k = 0; k < vec_size; ++k) {
+            m = std::max(m, tmp[k]);
+        }
+    }
+
+    for (; i < n; ++i) {
+        m = std::max(m, in[i]);
+    }
+
+    // 2. Compute exp(x - m) into the output and accumulate the sums
+    //
+    // log(softmax(x)) = x - m - log(s), so the loss of the row is
+    // sum(l * (x - m)) - log(s) * sum(l)
+
+    auto vm = vec_type::set(m);
+
+    auto vs = vec_type::template zero<T>();
+    auto vd = vec_type::template zero<T>();
+    auto vl = vec_type::template zero<T>();
+
+    i = 0;
+
+    for (; i + vec_size - 1 < n; i += vec_size) {
+        auto x = vec_type::sub(vec_type::loadu(in + i), vm);
+        auto l = vec_type::loadu(labels + i);
+        auto e = vec_type::exp(x);
+
+        vec_type::storeu(out + i, e);
+
+        vs = vec_type::add(vs, e);
+        vd = vec_type::fmadd(l, x, vd);
+        vl = vec_type::add(vl, l);
+    }
+
+    T s  = vec_type::hadd(vs);
+    T d  = vec_type::hadd(vd);
+    T ls = vec_type::hadd(vl);
+
+    for (; i < n; ++i) {
+        out[i] = std::exp(in[i] - m);
+        s += out[i];
+        d += labels[i] * (in[i] - m);
+        ls += labels[i];
+    }
+
+    // 3. Compute the gradients: softmax(x) - l
+
+    const T inv = T(1) / s;
+
+    auto vinv = vec_type::set(inv);
+
+    i = 0;
+
+    for (; i + vec_size - 1 < n; i += vec_size) {
+        vec_type::storeu(out + i, vec_type::sub(vec_type::mul(vec_type::loadu(out + i), vinv), vec_type::loadu(labels + i)));
+    }
+
+    for (; i < n; ++i) {
+        out[i] = out[i] * inv - labels[i];
+    }
+
+    return d - std::log(s) * ls;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the Categorical Cross Entropy loss of the output and labels
+ * \param output The output expression
+ * \param labels The labels expression
+ * \param scale The scale to apply to the loss
+ * \return The CCE loss
+ */
+template <typename O, typename L>
+value_t<O> cce_loss([[maybe_unused]] const O& output, [[maybe_unused]] const L& labels, [[maybe_unused]] value_t<O> scale) {
+    if constexpr (cce_loss_possible<vector_mode, O, L>) {
+        using T = value_t<O>;
+
+        output.ensure_cpu_up_to_date();
+        labels.ensure_cpu_up_to_date();
+
+        const T* o = output.memory_start();
+        const T* l = labels.memory_start();
+
+        T acc(0);
+
+        auto acc_functor = [&acc](T value) { acc += value; };
+
+        auto batch_fun = [o, l](size_t first, size_t last) { return detail::cce_loss_kernel<default_vec>(o, l, first, last); };
+
+        engine_dispatch_1d_acc<T>(batch_fun, acc_functor, 0, etl::size(output), vec_sum_parallel_threshold);
+
+        return scale * acc;
+    } else {
+        cpp_unreachable("Invalid call to vec::cce_loss");
+    }
+}
+
+/*!
+ * \brief Compute the Categorical Cross Entropy error of the output and labels
+ * \param output The output expression
+ * \param labels The labels expression
+ * \param scale The scale to apply to the error
+ * \return The CCE error
+ */
+template <typename O, typename L>
+value_t<O> cce_error([[maybe_unused]] const O& output, [[maybe_unused]] const L& labels, [[maybe_unused]] value_t<O> scale) {
+    if constexpr (cce_error_possible<vector_mode, O, L>) {
+        using T = value_t<O>;
+
+        const size_t rows = etl::dim<0>(output);
+        const size_t n    = etl::dim<1>(output);
+
+        output.ensure_cpu_up_to_date();
+        labels.ensure_cpu_up_to_date();
+
+        const T* o = output.memory_start();
+        const T* l = labels.memory_start();
+
+        T acc(0);
+
+        auto acc_functor = [&acc](T value) { acc += value; };
+
+        auto batch_fun = [o, l, n](size_t first, size_t last) { return detail::cce_error_kernel(o, l, n, first, last); };
+
+        engine_dispatch_1d_acc<T>(batch_fun, acc_functor, 0, rows, std::max(vec_sum_parallel_threshold / std::max(n, size_t(1)), size_t(2)));
+
+        return scale * acc;
+    } else {
+        cpp_unreachable("Invalid call to vec::cce_error");
+    }
+}
+
+/*!
+ * \brief Compute the Categorical Cross Entropy loss and error of the output
+ * and labels
+ * \param output The output expression
+ * \param labels The labels expression
+ * \param alpha The scale to apply to the loss
+ * \param beta The scale to apply to the error
+ * \return The CCE loss and error
+ */
+template <typename O, typename L>
+std::pair<value_t<O>, value_t<O>> cce([[maybe_unused]] const O& output,
+                                      [[maybe_unused]] const L& labels,
+                                      [[maybe_unused]] value_t<O> alpha,
+                                      [[maybe_unused]] value_t<O> beta) {
+    if constexpr (cce_possible<vector_mode, O, L>) {
+        using T = value_t<O>;
+
+        const size_t rows = etl::dim<0>(output);
+        const size_t n    = etl::dim<1>(output);
+
+        output.ensure_cpu_up_to_date();
+        labels.ensure_cpu_up_to_date();
+
+        const T* o = output.memory_start();
+        const T* l = labels.memory_start();
+
+        std::pair<T, T> acc(0, 0);
+
+        auto acc_functor = [&acc](std::pair<T, T> value) {
+            acc.first += value.first;
+            acc.second += value.second;
+        };
+
+        auto batch_fun = [o, l, n](size_t first, size_t last) {
+            std::pair<T, T> result(0, 0);
+
+            for (size_t r = first; r < last; ++r) {
+                result.first += detail::cce_loss_kernel<default_vec>(o, l, r * n, (r + 1) * n);
+                result.second += detail::cce_error_kernel(o, l, n, r, r + 1);
+            }
+
+            return result;
+        };
+
+        engine_dispatch_1d_acc<std::pair<T, T>>(batch_fun, acc_functor, 0, rows, std::max(vec_sum_parallel_threshold / std::max(n, size_t(1)), size_t(2)));
+
+        return std::make_pair(alpha * acc.first, beta * acc.second);
+    } else {
+        cpp_unreachable("Invalid call to vec::cce");
+    }
+}
+
+/*!
+ * \brief Compute the softmax of the logits, its Categorical Cross Entropy
+ * loss against the labels and the gradients of the loss with respect to the
+ * logits in a single pass over each row.
+ *
+ * \param logits The logits expression
+ * \param labels The labels expression
+ * \param gradients The output gradients, softmax(logits) - labels
+ * \param scale The scale to apply to the loss
+ * \return The CCE loss of softmax(logits)
+ */
+template <typename O, typename L, typename G>
+value_t<O> softmax_cross_entropy([[maybe_unused]] const O& logits,
+                                 [[maybe_unused]] const L& labels,
+                                 [[maybe_unused]] G&& gradients,
+                                 [[maybe_unused]] value_t<O> scale) {
+    if constexpr (softmax_cross_entropy_possible<vector_mode, O, L, G>) {
+        using T = value_t<O>;
+
+        const size_t rows = decay_traits<O>::dimensions() == 1 ? 1 : etl::dim<0>(logits);
+        const size_t n    = etl::size(logits) / rows;
+
+        logits.ensure_cpu_up_to_date();
+        labels.ensure_cpu_up_to_date();
+
+        const T* in = logits.memory_start();
+        const T* l  = labels.memory_start();
+        T* out      = gradients.memory_start();
+
+        T acc(0);
+
+        auto acc_functor = [&acc](T value) { acc += value; };
+
+        auto batch_fun = [in, l, out, n](size_t first, size_t last) {
+            T loss(0);
+
+            for (size_t r = first; r < last; ++r) {
+                loss += detail::softmax_cross_entropy_row<default_vec>(in + r * n, l + r * n, out + r * n, n);
+            }
+
+            return loss;
+        };
+
+        engine_dispatch_1d_acc<T>(batch_fun, acc_functor, 0, rows, 2UL);
+
+        gradients.invalidate_gpu();
+        gradients.validate_cpu();
+
+        return scale * acc;
+    } else {
+        cpp_unreachable("Invalid call to vec::softmax_cross_entropy");
+    }
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,50 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the blocked Cholesky decomposition and
+ * of the associated solver.
+ *
+ * Only the updates of the trailing matrices are vectorized, the panels are
+ * done with the standard implementation.
+ */
+
+#pragma once
+
+#include "etl/impl/std/cholesky.hpp"
+#include "etl/impl/vec/trsm.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized Cholesky decomposition is
+ * possible for the given value type.
+ *
+ * \tparam V The vector mode
+ * \tparam T The value type
+ */
+template <vector_mode_t V, typename T>
+constexpr bool cholesky_possible = trsm_possible<V, T>;
+
+/*!
+ * \copydoc etl::impl::standard::cholesky_factor
+ */
+template <typename T>
+bool cholesky_factor(T* a, size_t n) {
+    return etl::impl::standard::detail::cholesky_blocked(a, n, [](auto&&... args) { detail::block_update<default_vec>(args...); });
+}
+
+/*!
+ * \copydoc etl::impl::standard::cholesky_solve
+ */
+template <typename T>
+void cholesky_solve(const T* l, T* b, size_t n, size_t m) {
+    etl::impl::standard::detail::cholesky_solve_blocked(l, b, n, m, [](auto&&... args) { detail::block_update<default_vec>(args...); });
+}
+
+} //end of namespace etl::impl::vec
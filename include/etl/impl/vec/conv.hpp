@@ -115,5 +115,8 @@ using safe_sse_vec = no_vec;
 #include "etl/impl/vec/conv_valid_1d.hpp"
 #include "etl/impl/vec/conv_valid_2d.hpp"
 #include "etl/impl/vec/conv_valid_4d.hpp"
+#include "etl/impl/vec/conv_valid_grouped.hpp"
+#include "etl/impl/vec/conv_dilated.hpp"
+#include "etl/impl/vec/conv_3d.hpp"
 #include "etl/impl/vec/conv_full.hpp"
 #include "etl/impl/vec/conv_same.hpp"
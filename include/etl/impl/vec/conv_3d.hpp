@@ -0,0 +1,544 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementations of the 3D (volumetric) convolutions.
+ *
+ * Each output row is computed by blocks of vectors: every tap of the kernel
+ * is broadcast and multiplied with the input voxels it touches, which are
+ * contiguous when the stride of the last dimension is one. Only the border
+ * voxels, which read into the padding, are computed with bound checks.
+ */
+
+#pragma once
+
+#include "etl/impl/common/conv.hpp"
+
+namespace etl::impl::vec {
+
+namespace detail {
+
+/*!
+ * \brief Compute some planes of a 3D valid convolution, with an already flipped kernel, using the given vector implementation
+ * \param input The input volume
+ * \param kernel The kernel volume (already flipped)
+ * \param conv The output volume
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param s3 The stride of the third dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param p3 The padding of the third dimension
+ * \param beta The scaling factor of the previous value of the output
+ * \param first The first output plane to compute
+ * \param last The end of the range of output planes to compute
+ */
+template <typename V, typename II, typename KK, typename CC>
+void conv3_valid_flipped_kernel(const II& input,
+                                const KK& kernel,
+                                CC&& conv,
+                                size_t s1,
+                                size_t s2,
+                                size_t s3,
+                                size_t p1,
+                                size_t p2,
+                                size_t p3,
+                                value_t<II> beta,
+                                size_t first,
+                                size_t last) {
+    using T        = value_t<II>;
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t n1 = etl::dim<0>(input);
+    const size_t n2 = etl::dim<1>(input);
+    const size_t n3 = etl::dim<2>(input);
+    const size_t k1 = etl::dim<0>(kernel);
+    const size_t k2 = etl::dim<1>(kernel);
+    const size_t k3 = etl::dim<2>(kernel);
+    const size_t c2 = etl::dim<1>(conv);
+    const size_t c3 = etl::dim<2>(conv);
+
+    const T* in   = input.memory_start();
+    const T* kern = kernel.memory_start();
+    T* out        = conv.memory_start();
+
+    // The columns in [j_first, j_last) only read inside the input
+    const size_t j_first = std::min(c3, (p3 + s3 - 1) / s3);
+
+    size_t j_last = j_first;
+
+    if (n3 + p3 >= k3) {
+        j_last = std::max(j_first, std::min(c3, (n3 + p3 - k3) / s3 + 1));
+    }
+
+    auto border = [&](size_t i, size_t r, size_t j) {
+        T temp = 0;
+
+        for (size_t k = 0; k < k1; ++k) {
+            const size_t i_i = i * s1 + k;
+
+            if (i_i < p1 || i_i - p1 >= n1) {
+                continue;
+            }
+
+            for (size_t l = 0; l < k2; ++l) {
+                const size_t i_r = r * s2 + l;
+
+                if (i_r < p2 || i_r - p2 >= n2) {
+                    continue;
+                }
+
+                for (size_t m = 0; m < k3; ++m) {
+                    const size_t i_j = j * s3 + m;
+
+                    if (i_j >= p3 && i_j - p3 < n3) {
+                        temp += in[((i_i - p1) * n2 + i_r - p2) * n3 + i_j - p3] * kern[(k * k2 + l) * k3 + m];
+                    }
+                }
+            }
+        }
+
+        T* o = out + (i * c2 + r) * c3 + j;
+
+        if (beta == T(0)) {
+            *o = temp;
+        } else {
+            *o = beta * *o + temp;
+        }
+    };
+
+    for (size_t i = first; i < last; ++i) {
+        for (size_t r = 0; r < c2; ++r) {
+            T* out_row = out + (i * c2 + r) * c3;
+
+            for (size_t j = 0; j < j_first; ++j) {
+                border(i, r, j);
+            }
+
+            size_t j = j_first;
+
+            if (s3 == 1) {
+                for (; j + 2 * vec_size - 1 < j_last; j += 2 * vec_size) {
+                    auto r1 = vec_type::template zero<T>();
+                    auto r2 = vec_type::template zero<T>();
+
+                    for (size_t k = 0; k < k1; ++k) {
+                        const size_t i_i = i * s1 + k;
+
+                        if (i_i < p1 || i_i - p1 >= n1) {
+                            continue;
+                        }
+
+                        for (size_t l = 0; l < k2; ++l) {
+                            const size_t i_r = r * s2 + l;
+
+                            if (i_r < p2 || i_r - p2 >= n2) {
+                                continue;
+                            }
+
+                            const T* in_row   = in + ((i_i - p1) * n2 + i_r - p2) * n3 + j - p3;
+                            const T* kern_row = kern + (k * k2 + l) * k3;
+
+                            for (size_t m = 0; m < k3; ++m) {
+                                auto w = vec_type::set(kern_row[m]);
+
+                                r1 = vec_type::fmadd(w, vec_type::loadu(in_row + m), r1);
+                                r2 = vec_type::fmadd(w, vec_type::loadu(in_row + m + vec_size), r2);
+                            }
+                        }
+                    }
+
+                    if (beta == T(0)) {
+                        vec_type::storeu(out_row + j, r1);
+                        vec_type::storeu(out_row + j + vec_size, r2);
+                    } else {
+                        auto b = vec_type::set(beta);
+
+                        vec_type::storeu(out_row + j, vec_type::fmadd(b, vec_type::loadu(out_row + j), r1));
+                        vec_type::storeu(out_row + j + vec_size, vec_type::fmadd(b, vec_type::loadu(out_row + j + vec_size), r2));
+                    }
+                }
+
+                for (; j + vec_size - 1 < j_last; j += vec_size) {
+                    auto r1 = vec_type::template zero<T>();
+
+                    for (size_t k = 0; k < k1; ++k) {
+                        const size_t i_i = i * s1 + k;
+
+                        if (i_i < p1 || i_i - p1 >= n1) {
+                            continue;
+                        }
+
+                        for (size_t l = 0; l < k2; ++l) {
+                            const size_t i_r = r * s2 + l;
+
+                            if (i_r < p2 || i_r - p2 >= n2) {
+                                continue;
+                            }
+
+                            const T* in_row   = in + ((i_i - p1) * n2 + i_r - p2) * n3 + j - p3;
+                            const T* kern_row = kern + (k * k2 + l) * k3;
+
+                            for (size_t m = 0; m < k3; ++m) {
+                                r1 = vec_type::fmadd(vec_type::set(kern_row[m]), vec_type::loadu(in_row + m), r1);
+                            }
+                        }
+                    }
+
+                    if (beta == T(0)) {
+                        vec_type::storeu(out_row + j, r1);
+                    } else {
+                        vec_type::storeu(out_row + j, vec_type::fmadd(vec_type::set(beta), vec_type::loadu(out_row + j), r1));
+                    }
+                }
+            }
+
+            for (; j < c3; ++j) {
+                border(i, r, j);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Compute a 3D valid convolution, with an already flipped kernel, in parallel over the output planes
+ * \param input The input volume
+ * \param kernel The kernel volume (already flipped)
+ * \param conv The output volume
+ */
+template <typename II, typename KK, typename CC>
+void conv3_valid_flipped_impl(const II& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    using T = value_t<II>;
+
+    auto fun_i = [&](const size_t first, const size_t last) {
+        conv3_valid_flipped_kernel<default_vec>(input, kernel, conv, s1, s2, s3, p1, p2, p3, T(0), first, last);
+    };
+
+    engine_dispatch_1d(fun_i, 0, etl::dim<0>(conv), 2UL);
+}
+
+/*!
+ * \brief Compute a 5D valid convolution. The kernels must already be flipped.
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv5_valid_flipped_impl(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    using T = value_t<I>;
+
+    const size_t N  = etl::dim<0>(input);  // The number of images
+    const size_t K  = etl::dim<0>(kernel); // The number of kernels
+    const size_t C  = etl::dim<1>(kernel); // The number of channels
+    const size_t c1 = etl::dim<2>(conv);
+
+    auto fun_nk = [&](const size_t first, const size_t last) {
+        for (size_t nk = first; nk < last; ++nk) {
+            const size_t i = nk / K;
+            const size_t k = nk % K;
+
+            for (size_t c = 0; c < C; ++c) {
+                conv3_valid_flipped_kernel<default_vec>(input(i)(c), kernel(k)(c), conv(i)(k), s1, s2, s3, p1, p2, p3, c ? T(1) : T(0), 0, c1);
+            }
+        }
+    };
+
+    engine_dispatch_1d(fun_nk, 0, N * K, 2UL);
+}
+
+/*!
+ * \brief Compute the backward pass of a 5D valid convolution. The kernels must already be flipped.
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv5_valid_back_flipped_impl(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    using T = value_t<I>;
+
+    const size_t N  = etl::dim<0>(input);  // The number of images
+    const size_t K  = etl::dim<0>(kernel); // The number of kernels
+    const size_t C  = etl::dim<1>(kernel); // The number of channels
+    const size_t c1 = etl::dim<2>(conv);
+
+    auto fun_nc = [&](const size_t first, const size_t last) {
+        for (size_t nc = first; nc < last; ++nc) {
+            const size_t i = nc / C;
+            const size_t c = nc % C;
+
+            for (size_t k = 0; k < K; ++k) {
+                conv3_valid_flipped_kernel<default_vec>(input(i)(k), kernel(k)(c), conv(i)(c), s1, s2, s3, p1, p2, p3, k ? T(1) : T(0), 0, c1);
+            }
+        }
+    };
+
+    engine_dispatch_1d(fun_nc, 0, N * C, 2UL);
+}
+
+/*!
+ * \brief Compute the filter gradients of a 5D valid convolution. The kernels must already be flipped.
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv5_valid_filter_flipped_impl(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    using T = value_t<I>;
+
+    const size_t N  = etl::dim<0>(input); // The number of images
+    const size_t K  = etl::dim<0>(conv);  // The number of kernels
+    const size_t C  = etl::dim<1>(conv);  // The number of channels
+    const size_t c1 = etl::dim<2>(conv);
+
+    auto fun_kc = [&](const size_t first, const size_t last) {
+        for (size_t kc = first; kc < last; ++kc) {
+            const size_t k = kc / C;
+            const size_t c = kc % C;
+
+            for (size_t i = 0; i < N; ++i) {
+                conv3_valid_flipped_kernel<default_vec>(input(i)(c), kernel(i)(k), conv(k)(c), s1, s2, s3, p1, p2, p3, i ? T(1) : T(0), 0, c1);
+            }
+        }
+    };
+
+    engine_dispatch_1d(fun_kc, 0, K * C, 2UL);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Vectorized implementation of a 3D 'valid' convolution C = I * K
+ * \param input The input volume
+ * \param kernel The kernel volume
+ * \param conv The output volume
+ */
+template <typename I, typename KK, typename CC>
+void conv3_valid([[maybe_unused]] const I& input,
+                 [[maybe_unused]] const KK& kernel,
+                 [[maybe_unused]] CC&& conv,
+                 [[maybe_unused]] size_t s1,
+                 [[maybe_unused]] size_t s2,
+                 [[maybe_unused]] size_t s3,
+                 [[maybe_unused]] size_t p1,
+                 [[maybe_unused]] size_t p2,
+                 [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        etl::dyn_matrix<value_t<I>, 3> kernel_flipped(etl::dim<0>(kernel), etl::dim<1>(kernel), etl::dim<2>(kernel));
+
+        std::reverse_copy(kernel.memory_start(), kernel.memory_end(), kernel_flipped.memory_start());
+
+        detail::conv3_valid_flipped_impl(input, kernel_flipped, conv, s1, s2, s3, p1, p2, p3);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv3_valid");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of a 3D 'valid' convolution C = I * K, with a flipped kernel
+ * \param input The input volume
+ * \param kernel The kernel volume
+ * \param conv The output volume
+ */
+template <typename I, typename KK, typename CC>
+void conv3_valid_flipped([[maybe_unused]] const I& input,
+                         [[maybe_unused]] const KK& kernel,
+                         [[maybe_unused]] CC&& conv,
+                         [[maybe_unused]] size_t s1,
+                         [[maybe_unused]] size_t s2,
+                         [[maybe_unused]] size_t s3,
+                         [[maybe_unused]] size_t p1,
+                         [[maybe_unused]] size_t p2,
+                         [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv3_valid_flipped_impl(input, kernel, conv, s1, s2, s3, p1, p2, p3);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv3_valid_flipped");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of a 5D 'valid' convolution C = I * K
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv5_valid([[maybe_unused]] const I& input,
+                 [[maybe_unused]] const KK& kernel,
+                 [[maybe_unused]] CC&& conv,
+                 [[maybe_unused]] size_t s1,
+                 [[maybe_unused]] size_t s2,
+                 [[maybe_unused]] size_t s3,
+                 [[maybe_unused]] size_t p1,
+                 [[maybe_unused]] size_t p2,
+                 [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv5_valid_flipped_impl(input, common::flip_multi_3d(kernel), conv, s1, s2, s3, p1, p2, p3);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv5_valid");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of a 5D 'valid' convolution C = I * K, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv5_valid_flipped([[maybe_unused]] const I& input,
+                         [[maybe_unused]] const KK& kernel,
+                         [[maybe_unused]] CC&& conv,
+                         [[maybe_unused]] size_t s1,
+                         [[maybe_unused]] size_t s2,
+                         [[maybe_unused]] size_t s3,
+                         [[maybe_unused]] size_t p1,
+                         [[maybe_unused]] size_t p2,
+                         [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv5_valid_flipped_impl(input, kernel, conv, s1, s2, s3, p1, p2, p3);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv5_valid_flipped");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the backward pass of a 5D 'valid' convolution
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv5_valid_back([[maybe_unused]] const I& input,
+                      [[maybe_unused]] const KK& kernel,
+                      [[maybe_unused]] CC&& conv,
+                      [[maybe_unused]] size_t s1,
+                      [[maybe_unused]] size_t s2,
+                      [[maybe_unused]] size_t s3,
+                      [[maybe_unused]] size_t p1,
+                      [[maybe_unused]] size_t p2,
+                      [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv5_valid_back_flipped_impl(input, common::flip_multi_3d(kernel), conv, s1, s2, s3, p1, p2, p3);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv5_valid_back");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the backward pass of a 5D 'valid' convolution, with flipped kernels
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv5_valid_back_flipped([[maybe_unused]] const I& input,
+                              [[maybe_unused]] const KK& kernel,
+                              [[maybe_unused]] CC&& conv,
+                              [[maybe_unused]] size_t s1,
+                              [[maybe_unused]] size_t s2,
+                              [[maybe_unused]] size_t s3,
+                              [[maybe_unused]] size_t p1,
+                              [[maybe_unused]] size_t p2,
+                              [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv5_valid_back_flipped_impl(input, kernel, conv, s1, s2, s3, p1, p2, p3);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv5_valid_back_flipped");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the filter gradients of a 5D 'valid' convolution
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv5_valid_filter([[maybe_unused]] const I& input,
+                        [[maybe_unused]] const KK& kernel,
+                        [[maybe_unused]] CC&& conv,
+                        [[maybe_unused]] size_t s1,
+                        [[maybe_unused]] size_t s2,
+                        [[maybe_unused]] size_t s3,
+                        [[maybe_unused]] size_t p1,
+                        [[maybe_unused]] size_t p2,
+                        [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv5_valid_filter_flipped_impl(input, common::flip_multi_3d(kernel), conv, s1, s2, s3, p1, p2, p3);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv5_valid_filter");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the filter gradients of a 5D 'valid' convolution, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv5_valid_filter_flipped([[maybe_unused]] const I& input,
+                                [[maybe_unused]] const KK& kernel,
+                                [[maybe_unused]] CC&& conv,
+                                [[maybe_unused]] size_t s1,
+                                [[maybe_unused]] size_t s2,
+                                [[maybe_unused]] size_t s3,
+                                [[maybe_unused]] size_t p1,
+                                [[maybe_unused]] size_t p2,
+                                [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv5_valid_filter_flipped_impl(input, kernel, conv, s1, s2, s3, p1, p2, p3);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv5_valid_filter_flipped");
+    }
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,495 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementations of the dilated (atrous) convolutions.
+ *
+ * The dilated kernel is never materialized. For each block of output
+ * columns, every tap of the kernel is broadcast and multiplied with the
+ * input pixels it touches, which are contiguous when the horizontal stride
+ * is one. Only the border columns, which read into the padding, are
+ * computed with bound checks.
+ */
+
+#pragma once
+
+#include "etl/impl/common/conv.hpp"
+
+namespace etl::impl::vec {
+
+namespace detail {
+
+/*!
+ * \brief Compute a 2D valid dilated convolution, with an already flipped kernel, using the given vector implementation
+ * \param input The input matrix
+ * \param kernel The kernel matrix (already flipped)
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ * \param beta The scaling factor of the previous value of the output
+ */
+template <typename V, typename II, typename KK, typename CC>
+void conv2_valid_dilated_flipped_kernel(
+    const II& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2, value_t<II> beta) {
+    using T        = value_t<II>;
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const size_t n1 = etl::dim<0>(input);
+    const size_t n2 = etl::dim<1>(input);
+    const size_t k1 = etl::dim<0>(kernel);
+    const size_t k2 = etl::dim<1>(kernel);
+    const size_t c1 = etl::dim<0>(conv);
+    const size_t c2 = etl::dim<1>(conv);
+
+    const T* in   = input.memory_start();
+    const T* kern = kernel.memory_start();
+    T* out        = conv.memory_start();
+
+    // The columns in [j_first, j_last) only read inside the input
+    const size_t j_first = std::min(c2, (p2 + s2 - 1) / s2);
+
+    size_t j_last = j_first;
+
+    if (n2 + p2 > (k2 - 1) * d2) {
+        j_last = std::max(j_first, std::min(c2, (n2 + p2 - 1 - (k2 - 1) * d2) / s2 + 1));
+    }
+
+    auto border = [&](size_t i, size_t j) {
+        T temp = 0;
+
+        for (size_t k = 0; k < k1; ++k) {
+            const size_t i_i = i * s1 + k * d1;
+
+            if (i_i < p1 || i_i - p1 >= n1) {
+                continue;
+            }
+
+            for (size_t l = 0; l < k2; ++l) {
+                const size_t i_j = j * s2 + l * d2;
+
+                if (i_j >= p2 && i_j - p2 < n2) {
+                    temp += in[(i_i - p1) * n2 + i_j - p2] * kern[k * k2 + l];
+                }
+            }
+        }
+
+        if (beta == T(0)) {
+            out[i * c2 + j] = temp;
+        } else {
+            out[i * c2 + j] = beta * out[i * c2 + j] + temp;
+        }
+    };
+
+    for (size_t i = 0; i < c1; ++i) {
+        for (size_t j = 0; j < j_first; ++j) {
+            border(i, j);
+        }
+
+        size_t j = j_first;
+
+        if (s2 == 1) {
+            for (; j + 2 * vec_size - 1 < j_last; j += 2 * vec_size) {
+                auto r1 = vec_type::template zero<T>();
+                auto r2 = vec_type::template zero<T>();
+
+                for (size_t k = 0; k < k1; ++k) {
+                    const size_t i_i = i * s1 + k * d1;
+
+                    if (i_i < p1 || i_i - p1 >= n1) {
+                        continue;
+                    }
+
+                    const T* in_row = in + (i_i - p1) * n2 + j - p2;
+
+                    for (size_t l = 0; l < k2; ++l) {
+                        auto w = vec_type::set(kern[k * k2 + l]);
+
+                        r1 = vec_type::fmadd(w, vec_type::loadu(in_row + l * d2), r1);
+                        r2 = vec_type::fmadd(w, vec_type::loadu(in_row + l * d2 + vec_size), r2);
+                    }
+                }
+
+                if (beta == T(0)) {
+                    vec_type::storeu(out + i * c2 + j, r1);
+                    vec_type::storeu(out + i * c2 + j + vec_size, r2);
+                } else {
+                    auto b = vec_type::set(beta);
+
+                    vec_type::storeu(out + i * c2 + j, vec_type::fmadd(b, vec_type::loadu(out + i * c2 + j), r1));
+                    vec_type::storeu(out + i * c2 + j + vec_size, vec_type::fmadd(b, vec_type::loadu(out + i * c2 + j + vec_size), r2));
+                }
+            }
+
+            for (; j + vec_size - 1 < j_last; j += vec_size) {
+                auto r1 = vec_type::template zero<T>();
+
+                for (size_t k = 0; k < k1; ++k) {
+                    const size_t i_i = i * s1 + k * d1;
+
+                    if (i_i < p1 || i_i - p1 >= n1) {
+                        continue;
+                    }
+
+                    const T* in_row = in + (i_i - p1) * n2 + j - p2;
+
+                    for (size_t l = 0; l < k2; ++l) {
+                        r1 = vec_type::fmadd(vec_type::set(kern[k * k2 + l]), vec_type::loadu(in_row + l * d2), r1);
+                    }
+                }
+
+                if (beta == T(0)) {
+                    vec_type::storeu(out + i * c2 + j, r1);
+                } else {
+                    vec_type::storeu(out + i * c2 + j, vec_type::fmadd(vec_type::set(beta), vec_type::loadu(out + i * c2 + j), r1));
+                }
+            }
+        }
+
+        for (; j < c2; ++j) {
+            border(i, j);
+        }
+    }
+}
+
+/*!
+ * \brief Compute a 4D valid dilated convolution. The kernels must already be flipped.
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_dilated_flipped_impl(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    using T = value_t<I>;
+
+    const size_t N = etl::dim<0>(input);  // The number of images
+    const size_t K = etl::dim<0>(kernel); // The number of kernels
+    const size_t C = etl::dim<1>(kernel); // The number of channels
+
+    auto fun_nk = [&](const size_t first, const size_t last) {
+        for (size_t nk = first; nk < last; ++nk) {
+            const size_t i = nk / K;
+            const size_t k = nk % K;
+
+            for (size_t c = 0; c < C; ++c) {
+                conv2_valid_dilated_flipped_kernel<default_vec>(input(i)(c), kernel(k)(c), conv(i)(k), s1, s2, p1, p2, d1, d2, c ? T(1) : T(0));
+            }
+        }
+    };
+
+    engine_dispatch_1d(fun_nk, 0, N * K, 4UL);
+}
+
+/*!
+ * \brief Compute the backward pass of a 4D valid dilated convolution. The kernels must already be flipped.
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_back_dilated_flipped_impl(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    using T = value_t<I>;
+
+    const size_t N = etl::dim<0>(input);  // The number of images
+    const size_t K = etl::dim<0>(kernel); // The number of kernels
+    const size_t C = etl::dim<1>(kernel); // The number of channels
+
+    auto fun_nc = [&](const size_t first, const size_t last) {
+        for (size_t nc = first; nc < last; ++nc) {
+            const size_t i = nc / C;
+            const size_t c = nc % C;
+
+            for (size_t k = 0; k < K; ++k) {
+                conv2_valid_dilated_flipped_kernel<default_vec>(input(i)(k), kernel(k)(c), conv(i)(c), s1, s2, p1, p2, d1, d2, k ? T(1) : T(0));
+            }
+        }
+    };
+
+    engine_dispatch_1d(fun_nc, 0, N * C, 4UL);
+}
+
+/*!
+ * \brief Compute the filter gradients of a 4D valid dilated convolution. The kernels must already be flipped.
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_filter_dilated_flipped_impl(const I& input, const KK& kernel, CC&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    using T = value_t<I>;
+
+    const size_t N = etl::dim<0>(input); // The number of images
+    const size_t K = etl::dim<0>(conv);  // The number of kernels
+    const size_t C = etl::dim<1>(conv);  // The number of channels
+
+    auto fun_kc = [&](const size_t first, const size_t last) {
+        for (size_t kc = first; kc < last; ++kc) {
+            const size_t k = kc / C;
+            const size_t c = kc % C;
+
+            for (size_t i = 0; i < N; ++i) {
+                conv2_valid_dilated_flipped_kernel<default_vec>(input(i)(c), kernel(i)(k), conv(k)(c), s1, s2, p1, p2, d1, d2, i ? T(1) : T(0));
+            }
+        }
+    };
+
+    engine_dispatch_1d(fun_kc, 0, K * C, 4UL);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Vectorized implementation of a 2D 'valid' dilated convolution C = I * K
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename KK, typename CC>
+void conv2_valid_dilated([[maybe_unused]] const I& input,
+                         [[maybe_unused]] const KK& kernel,
+                         [[maybe_unused]] CC&& conv,
+                         [[maybe_unused]] size_t s1,
+                         [[maybe_unused]] size_t s2,
+                         [[maybe_unused]] size_t p1,
+                         [[maybe_unused]] size_t p2,
+                         [[maybe_unused]] size_t d1,
+                         [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        etl::dyn_matrix<value_t<I>, 2> kernel_flipped(etl::dim<0>(kernel), etl::dim<1>(kernel));
+
+        std::reverse_copy(kernel.memory_start(), kernel.memory_end(), kernel_flipped.memory_start());
+
+        detail::conv2_valid_dilated_flipped_kernel<default_vec>(input, kernel_flipped, conv, s1, s2, p1, p2, d1, d2, value_t<I>(0));
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv2_valid_dilated");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of a 2D 'valid' dilated convolution C = I * K, with a flipped kernel
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename KK, typename CC>
+void conv2_valid_dilated_flipped([[maybe_unused]] const I& input,
+                                 [[maybe_unused]] const KK& kernel,
+                                 [[maybe_unused]] CC&& conv,
+                                 [[maybe_unused]] size_t s1,
+                                 [[maybe_unused]] size_t s2,
+                                 [[maybe_unused]] size_t p1,
+                                 [[maybe_unused]] size_t p2,
+                                 [[maybe_unused]] size_t d1,
+                                 [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv2_valid_dilated_flipped_kernel<default_vec>(input, kernel, conv, s1, s2, p1, p2, d1, d2, value_t<I>(0));
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv2_valid_dilated_flipped");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of a 4D 'valid' dilated convolution C = I * K
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_dilated([[maybe_unused]] const I& input,
+                         [[maybe_unused]] const KK& kernel,
+                         [[maybe_unused]] CC&& conv,
+                         [[maybe_unused]] size_t s1,
+                         [[maybe_unused]] size_t s2,
+                         [[maybe_unused]] size_t p1,
+                         [[maybe_unused]] size_t p2,
+                         [[maybe_unused]] size_t d1,
+                         [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv4_valid_dilated_flipped_impl(input, common::pad_right_flip_multi(kernel, 0), conv, s1, s2, p1, p2, d1, d2);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_dilated");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of a 4D 'valid' dilated convolution C = I * K, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_dilated_flipped([[maybe_unused]] const I& input,
+                                 [[maybe_unused]] const KK& kernel,
+                                 [[maybe_unused]] CC&& conv,
+                                 [[maybe_unused]] size_t s1,
+                                 [[maybe_unused]] size_t s2,
+                                 [[maybe_unused]] size_t p1,
+                                 [[maybe_unused]] size_t p2,
+                                 [[maybe_unused]] size_t d1,
+                                 [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv4_valid_dilated_flipped_impl(input, kernel, conv, s1, s2, p1, p2, d1, d2);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_dilated_flipped");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the backward pass of a 4D 'valid' dilated convolution
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_back_dilated([[maybe_unused]] const I& input,
+                              [[maybe_unused]] const KK& kernel,
+                              [[maybe_unused]] CC&& conv,
+                              [[maybe_unused]] size_t s1,
+                              [[maybe_unused]] size_t s2,
+                              [[maybe_unused]] size_t p1,
+                              [[maybe_unused]] size_t p2,
+                              [[maybe_unused]] size_t d1,
+                              [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv4_valid_back_dilated_flipped_impl(input, common::pad_right_flip_multi(kernel, 0), conv, s1, s2, p1, p2, d1, d2);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_back_dilated");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the backward pass of a 4D 'valid' dilated convolution, with flipped kernels
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_back_dilated_flipped([[maybe_unused]] const I& input,
+                                      [[maybe_unused]] const KK& kernel,
+                                      [[maybe_unused]] CC&& conv,
+                                      [[maybe_unused]] size_t s1,
+                                      [[maybe_unused]] size_t s2,
+                                      [[maybe_unused]] size_t p1,
+                                      [[maybe_unused]] size_t p2,
+                                      [[maybe_unused]] size_t d1,
+                                      [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv4_valid_back_dilated_flipped_impl(input, kernel, conv, s1, s2, p1, p2, d1, d2);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_back_dilated_flipped");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the filter gradients of a 4D 'valid' dilated convolution
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_filter_dilated([[maybe_unused]] const I& input,
+                                [[maybe_unused]] const KK& kernel,
+                                [[maybe_unused]] CC&& conv,
+                                [[maybe_unused]] size_t s1,
+                                [[maybe_unused]] size_t s2,
+                                [[maybe_unused]] size_t p1,
+                                [[maybe_unused]] size_t p2,
+                                [[maybe_unused]] size_t d1,
+                                [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv4_valid_filter_dilated_flipped_impl(input, common::pad_right_flip_multi(kernel, 0), conv, s1, s2, p1, p2, d1, d2);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_filter_dilated");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the filter gradients of a 4D 'valid' dilated convolution, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_filter_dilated_flipped([[maybe_unused]] const I& input,
+                                        [[maybe_unused]] const KK& kernel,
+                                        [[maybe_unused]] CC&& conv,
+                                        [[maybe_unused]] size_t s1,
+                                        [[maybe_unused]] size_t s2,
+                                        [[maybe_unused]] size_t p1,
+                                        [[maybe_unused]] size_t p2,
+                                        [[maybe_unused]] size_t d1,
+                                        [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        input.ensure_cpu_up_to_date();
+        kernel.ensure_cpu_up_to_date();
+
+        detail::conv4_valid_filter_dilated_flipped_impl(input, kernel, conv, s1, s2, p1, p2, d1, d2);
+
+        conv.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_filter_dilated_flipped");
+    }
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,404 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementations of the grouped (and depthwise) 4D convolutions.
+ *
+ * Every output plane only depends on the channels of its group, the work is
+ * therefore split over the images and the output channels and each plane is
+ * computed directly with the 2D micro kernels, without any intermediate
+ * expression.
+ */
+
+#pragma once
+
+#include "etl/impl/common/conv.hpp"
+#include "etl/impl/vec/conv_valid_kernels.hpp"
+
+namespace etl::impl::vec {
+
+namespace detail {
+
+/*!
+ * \brief Compute a grouped convolution with the given vector
+ * implementation. The kernels must already be flipped.
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename V, typename I, typename KK, typename CC>
+void conv4_valid_grouped_flipped_impl(const I& input, const KK& kernel, CC&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+    using T = value_t<I>;
+
+    const size_t N  = etl::dim<0>(input);           // The number of images
+    const size_t K  = etl::dim<0>(kernel);          // The number of kernels
+    const size_t CG = etl::dim<1>(kernel);          // The number of channels per group
+    const size_t KG = etl::dim<0>(kernel) / groups; // The number of kernels per group
+
+    auto fun_nk = [&](const size_t first, const size_t last) {
+        for (size_t nk = first; nk < last; ++nk) {
+            const size_t i = nk / K;
+            const size_t k = nk % K;
+            const size_t g = k / KG;
+
+            for (size_t c = 0; c < CG; ++c) {
+                conv2_valid_flipped_micro_kernel<V>(input(i)(g * CG + c), kernel(k)(c), conv(i)(k), s1, s2, p1, p2, c ? T(1) : T(0));
+            }
+        }
+    };
+
+    engine_dispatch_1d(fun_nk, 0, N * K, 4UL);
+}
+
+/*!
+ * \brief Compute the backward pass of a grouped convolution with the given
+ * vector implementation. The kernels must already be flipped.
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename V, typename I, typename KK, typename CC>
+void conv4_valid_grouped_back_flipped_impl(const I& input, const KK& kernel, CC&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+    using T = value_t<I>;
+
+    const size_t N  = etl::dim<0>(input);           // The number of images
+    const size_t C  = etl::dim<1>(conv);            // The number of channels
+    const size_t CG = etl::dim<1>(kernel);          // The number of channels per group
+    const size_t KG = etl::dim<0>(kernel) / groups; // The number of kernels per group
+
+    auto fun_nc = [&](const size_t first, const size_t last) {
+        for (size_t nc = first; nc < last; ++nc) {
+            const size_t i = nc / C;
+            const size_t c = nc % C;
+            const size_t g = c / CG;
+
+            for (size_t k = 0; k < KG; ++k) {
+                conv2_valid_flipped_micro_kernel<V>(input(i)(g * KG + k), kernel(g * KG + k)(c % CG), conv(i)(c), s1, s2, p1, p2, k ? T(1) : T(0));
+            }
+        }
+    };
+
+    engine_dispatch_1d(fun_nc, 0, N * C, 4UL);
+}
+
+/*!
+ * \brief Compute the filter gradients of a grouped convolution with the
+ * given vector implementation. The errors must already be flipped.
+ *
+ * Each thread owns a set of output filters and accumulates over the
+ * whole batch, no reduction is necessary.
+ *
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename V, typename I, typename KK, typename CC>
+void conv4_valid_grouped_filter_flipped_impl(const I& input, const KK& kernel, CC&& conv, size_t groups, size_t s1, size_t s2, size_t p1, size_t p2) {
+    using T = value_t<I>;
+
+    const size_t N  = etl::dim<0>(input);         // The number of images
+    const size_t K  = etl::dim<0>(conv);          // The number of kernels
+    const size_t CG = etl::dim<1>(conv);          // The number of channels per group
+    const size_t KG = etl::dim<0>(conv) / groups; // The number of kernels per group
+
+    auto fun_kc = [&](const size_t first, const size_t last) {
+        for (size_t kc = first; kc < last; ++kc) {
+            const size_t k = kc / CG;
+            const size_t c = kc % CG;
+            const size_t g = k / KG;
+
+            for (size_t i = 0; i < N; ++i) {
+                conv2_valid_flipped_micro_kernel<V>(input(i)(g * CG + c), kernel(i)(k), conv(k)(c), s1, s2, p1, p2, i ? T(1) : T(0));
+            }
+        }
+    };
+
+    engine_dispatch_1d(fun_kc, 0, K * CG, 4UL);
+}
+
+/*!
+ * \brief Prepare the input and the kernels of a grouped convolution for the
+ * vectorized micro kernels and call the given functor with them.
+ *
+ * The vectorized micro kernels only handle kernels whose last dimension is
+ * a multiple of the vector size, the input and the kernels are padded to
+ * the right when necessary. The convolution padding is also directly
+ * applied to the input. The kernels are flipped (only once for the whole
+ * batch) if they are not already.
+ *
+ * \tparam Flipped Indicates if the kernels are already flipped
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param p1 The padding in the first dimension
+ * \param p2 The padding in the second dimension
+ * \param fun The functor to call with the prepared matrices
+ */
+template <bool Flipped, typename I, typename KK, typename Fun>
+void conv4_valid_grouped_prepare(const I& input, const KK& kernel, size_t p1, size_t p2, Fun&& fun) {
+    using T = value_t<I>;
+
+    const size_t k1 = etl::dim<2>(kernel);
+    const size_t k2 = etl::dim<3>(kernel);
+
+    if constexpr (padding_impl) {
+        if (need_padding<T>(k1, k2, p1, p2)) {
+            const size_t pad = select_pad<T>(k1, k2);
+
+            auto padded_input = p1 || p2 ? common::pad_right_multi_double(input, pad, p1, p2) : common::pad_right_multi(input, pad);
+
+            if constexpr (Flipped) {
+                fun(padded_input, common::pad_right_multi(kernel, pad), 0UL, 0UL, k2 + pad);
+            } else {
+                fun(padded_input, common::pad_right_flip_multi(kernel, pad), 0UL, 0UL, k2 + pad);
+            }
+
+            return;
+        }
+    }
+
+    if constexpr (Flipped) {
+        fun(input, kernel, p1, p2, k2);
+    } else {
+        fun(input, common::pad_right_flip_multi(kernel, 0), p1, p2, k2);
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Vectorized implementation of a 4D 'valid' grouped convolution C = I * K
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_grouped([[maybe_unused]] const I& input,
+                         [[maybe_unused]] const KK& kernel,
+                         [[maybe_unused]] CC&& conv,
+                         [[maybe_unused]] size_t groups,
+                         [[maybe_unused]] size_t s1,
+                         [[maybe_unused]] size_t s2,
+                         [[maybe_unused]] size_t p1,
+                         [[maybe_unused]] size_t p2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        using T = value_t<I>;
+
+        if (etl::dim<1>(kernel) > 0) {
+            input.ensure_cpu_up_to_date();
+            kernel.ensure_cpu_up_to_date();
+
+            detail::conv4_valid_grouped_prepare<false>(input, kernel, p1, p2, [&](const auto& in, const auto& kern, size_t pp1, size_t pp2, size_t k2) {
+                if (detail::prefer_sse<T>(k2)) {
+                    detail::conv4_valid_grouped_flipped_impl<detail::safe_sse_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                } else {
+                    detail::conv4_valid_grouped_flipped_impl<detail::safe_avx_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                }
+            });
+
+            conv.invalidate_gpu();
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_grouped");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of a 4D 'valid' grouped convolution C = I * K, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_grouped_flipped([[maybe_unused]] const I& input,
+                                 [[maybe_unused]] const KK& kernel,
+                                 [[maybe_unused]] CC&& conv,
+                                 [[maybe_unused]] size_t groups,
+                                 [[maybe_unused]] size_t s1,
+                                 [[maybe_unused]] size_t s2,
+                                 [[maybe_unused]] size_t p1,
+                                 [[maybe_unused]] size_t p2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        using T = value_t<I>;
+
+        if (etl::dim<1>(kernel) > 0) {
+            input.ensure_cpu_up_to_date();
+            kernel.ensure_cpu_up_to_date();
+
+            detail::conv4_valid_grouped_prepare<true>(input, kernel, p1, p2, [&](const auto& in, const auto& kern, size_t pp1, size_t pp2, size_t k2) {
+                if (detail::prefer_sse<T>(k2)) {
+                    detail::conv4_valid_grouped_flipped_impl<detail::safe_sse_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                } else {
+                    detail::conv4_valid_grouped_flipped_impl<detail::safe_avx_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                }
+            });
+
+            conv.invalidate_gpu();
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_grouped_flipped");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the backward pass of a 4D 'valid' grouped convolution
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_grouped_back([[maybe_unused]] const I& input,
+                              [[maybe_unused]] const KK& kernel,
+                              [[maybe_unused]] CC&& conv,
+                              [[maybe_unused]] size_t groups,
+                              [[maybe_unused]] size_t s1,
+                              [[maybe_unused]] size_t s2,
+                              [[maybe_unused]] size_t p1,
+                              [[maybe_unused]] size_t p2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        using T = value_t<I>;
+
+        if (etl::dim<0>(kernel) > 0) {
+            input.ensure_cpu_up_to_date();
+            kernel.ensure_cpu_up_to_date();
+
+            detail::conv4_valid_grouped_prepare<false>(input, kernel, p1, p2, [&](const auto& in, const auto& kern, size_t pp1, size_t pp2, size_t k2) {
+                if (detail::prefer_sse<T>(k2)) {
+                    detail::conv4_valid_grouped_back_flipped_impl<detail::safe_sse_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                } else {
+                    detail::conv4_valid_grouped_back_flipped_impl<detail::safe_avx_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                }
+            });
+
+            conv.invalidate_gpu();
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_grouped_back");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the backward pass of a 4D 'valid' grouped convolution, with flipped kernels
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_grouped_back_flipped([[maybe_unused]] const I& input,
+                                      [[maybe_unused]] const KK& kernel,
+                                      [[maybe_unused]] CC&& conv,
+                                      [[maybe_unused]] size_t groups,
+                                      [[maybe_unused]] size_t s1,
+                                      [[maybe_unused]] size_t s2,
+                                      [[maybe_unused]] size_t p1,
+                                      [[maybe_unused]] size_t p2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        using T = value_t<I>;
+
+        if (etl::dim<0>(kernel) > 0) {
+            input.ensure_cpu_up_to_date();
+            kernel.ensure_cpu_up_to_date();
+
+            detail::conv4_valid_grouped_prepare<true>(input, kernel, p1, p2, [&](const auto& in, const auto& kern, size_t pp1, size_t pp2, size_t k2) {
+                if (detail::prefer_sse<T>(k2)) {
+                    detail::conv4_valid_grouped_back_flipped_impl<detail::safe_sse_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                } else {
+                    detail::conv4_valid_grouped_back_flipped_impl<detail::safe_avx_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                }
+            });
+
+            conv.invalidate_gpu();
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_grouped_back_flipped");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the filter gradients of a 4D 'valid' grouped convolution
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_grouped_filter([[maybe_unused]] const I& input,
+                                [[maybe_unused]] const KK& kernel,
+                                [[maybe_unused]] CC&& conv,
+                                [[maybe_unused]] size_t groups,
+                                [[maybe_unused]] size_t s1,
+                                [[maybe_unused]] size_t s2,
+                                [[maybe_unused]] size_t p1,
+                                [[maybe_unused]] size_t p2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        using T = value_t<I>;
+
+        if (etl::dim<0>(input) > 0) {
+            input.ensure_cpu_up_to_date();
+            kernel.ensure_cpu_up_to_date();
+
+            detail::conv4_valid_grouped_prepare<false>(input, kernel, p1, p2, [&](const auto& in, const auto& kern, size_t pp1, size_t pp2, size_t k2) {
+                if (detail::prefer_sse<T>(k2)) {
+                    detail::conv4_valid_grouped_filter_flipped_impl<detail::safe_sse_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                } else {
+                    detail::conv4_valid_grouped_filter_flipped_impl<detail::safe_avx_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                }
+            });
+
+            conv.invalidate_gpu();
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_grouped_filter");
+    }
+}
+
+/*!
+ * \brief Vectorized implementation of the filter gradients of a 4D 'valid' grouped convolution, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param groups The number of groups
+ */
+template <typename I, typename KK, typename CC>
+void conv4_valid_grouped_filter_flipped([[maybe_unused]] const I& input,
+                                        [[maybe_unused]] const KK& kernel,
+                                        [[maybe_unused]] CC&& conv,
+                                        [[maybe_unused]] size_t groups,
+                                        [[maybe_unused]] size_t s1,
+                                        [[maybe_unused]] size_t s2,
+                                        [[maybe_unused]] size_t p1,
+                                        [[maybe_unused]] size_t p2) {
+    if constexpr (conv2_possible<vector_mode, I, KK, CC>) {
+        using T = value_t<I>;
+
+        if (etl::dim<0>(input) > 0) {
+            input.ensure_cpu_up_to_date();
+            kernel.ensure_cpu_up_to_date();
+
+            detail::conv4_valid_grouped_prepare<true>(input, kernel, p1, p2, [&](const auto& in, const auto& kern, size_t pp1, size_t pp2, size_t k2) {
+                if (detail::prefer_sse<T>(k2)) {
+                    detail::conv4_valid_grouped_filter_flipped_impl<detail::safe_sse_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                } else {
+                    detail::conv4_valid_grouped_filter_flipped_impl<detail::safe_avx_vec>(in, kern, conv, groups, s1, s2, pp1, pp2);
+                }
+            });
+
+            conv.invalidate_gpu();
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::conv4_valid_grouped_filter_flipped");
+    }
+}
+
+} //end of namespace etl::impl::vec
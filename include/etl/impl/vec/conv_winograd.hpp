@@ -0,0 +1,729 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Winograd minimal filtering implementation of the 4D convolutions
+ * with 3x3 kernels and unit strides.
+ *
+ * The filters and the input tiles are transformed into the Winograd domain
+ * where the channel reduction becomes one GEMM per transformed element. The
+ * filter transforms are computed once per call and reused for every image and
+ * every tile. The tile transforms are vectorized over the tiles of a row.
+ */
+
+#pragma once
+
+#include "etl/impl/vec/conv.hpp"
+
+namespace etl::impl::vec {
+
+namespace detail {
+
+/*!
+ * \brief Transformation matrices of the Winograd F(MxM, 3x3) algorithm.
+ * \tparam M The size of the output tiles
+ */
+template <size_t M>
+struct winograd_tile;
+
+/*!
+ * \brief Transformation matrices of the Winograd F(2x2, 3x3) algorithm.
+ */
+template <>
+struct winograd_tile<2> {
+    static constexpr size_t m     = 2; ///< The size of the output tiles
+    static constexpr size_t alpha = 4; ///< The size of the input tiles
+
+    /*!
+     * \brief The input transformation matrix B^T (alpha x alpha)
+     */
+    static constexpr double bt[alpha * alpha] = {
+        1.0,  0.0, -1.0, 0.0,
+        0.0,  1.0,  1.0, 0.0,
+        0.0, -1.0,  1.0, 0.0,
+        0.0,  1.0,  0.0, -1.0};
+
+    /*!
+     * \brief The filter transformation matrix G (alpha x 3)
+     */
+    static constexpr double g[alpha * 3] = {
+        1.0, 0.0,  0.0,
+        0.5, 0.5,  0.5,
+        0.5, -0.5, 0.5,
+        0.0, 0.0,  1.0};
+
+    /*!
+     * \brief The output transformation matrix A^T (m x alpha)
+     */
+    static constexpr double at[m * alpha] = {
+        1.0, 1.0,  1.0, 0.0,
+        0.0, 1.0, -1.0, -1.0};
+};
+
+/*!
+ * \brief Transformation matrices of the Winograd F(4x4, 3x3) algorithm.
+ */
+template <>
+struct winograd_tile<4> {
+    static constexpr size_t m     = 4; ///< The size of the output tiles
+    static constexpr size_t alpha = 6; ///< The size of the input tiles
+
+    /*!
+     * \brief The input transformation matrix B^T (alpha x alpha)
+     */
+    static constexpr double bt[alpha * alpha] = {
+        4.0,  0.0, -5.0,  0.0, 1.0, 0.0,
+        0.0, -4.0, -4.0,  1.0, 1.0, 0.0,
+        0.0,  4.0, -4.0, -1.0, 1.0, 0.0,
+        0.0, -2.0, -1.0,  2.0, 1.0, 0.0,
+        0.0,  2.0, -1.0, -2.0, 1.0, 0.0,
+        0.0,  4.0,  0.0, -5.0, 0.0, 1.0};
+
+    /*!
+     * \brief The filter transformation matrix G (alpha x 3)
+     */
+    static constexpr double g[alpha * 3] = {
+        1.0 / 4.0,   0.0,         0.0,
+        -1.0 / 6.0,  -1.0 / 6.0,  -1.0 / 6.0,
+        -1.0 / 6.0,  1.0 / 6.0,   -1.0 / 6.0,
+        1.0 / 24.0,  1.0 / 12.0,  1.0 / 6.0,
+        1.0 / 24.0,  -1.0 / 12.0, 1.0 / 6.0,
+        0.0,         0.0,         1.0};
+
+    /*!
+     * \brief The output transformation matrix A^T (m x alpha)
+     */
+    static constexpr double at[m * alpha] = {
+        1.0, 1.0,  1.0, 1.0,  1.0, 0.0,
+        0.0, 1.0, -1.0, 2.0, -2.0, 0.0,
+        0.0, 1.0,  1.0, 4.0,  4.0, 0.0,
+        0.0, 1.0, -1.0, 8.0, -8.0, 1.0};
+};
+
+/*!
+ * \brief Indicates if the large F(4x4, 3x3) tiles should be used for an
+ * output of the given dimensions.
+ * \param c1 The first dimension of the output
+ * \param c2 The second dimension of the output
+ * \return true if the large tiles should be used, false otherwise
+ */
+inline bool winograd_large_tiles(size_t c1, size_t c2) {
+    return c1 >= 8 && c2 >= 8;
+}
+
+/*!
+ * \brief Apply a small transformation matrix to a set of rows.
+ *
+ * out[r] = sum_s op(mat)[r][s] * in[s], vectorized along the rows.
+ *
+ * \param mat The transformation matrix, in row-major order
+ * \param R The number of rows of op(mat)
+ * \param S The number of columns of op(mat)
+ * \param in The first input row
+ * \param in_stride The distance between two input rows
+ * \param out The first output row
+ * \param out_stride The distance between two output rows
+ * \param n The length of the rows
+ *
+ * \tparam Trans Indicates if mat is stored transposed (S x R)
+ */
+template <typename V, bool Trans, typename T>
+void winograd_apply(const double* mat, size_t R, size_t S, const T* in, size_t in_stride, T* out, size_t out_stride, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    for (size_t r = 0; r < R; ++r) {
+        T* ETL_RESTRICT o = out + r * out_stride;
+
+        size_t j = 0;
+
+        for (; j + vec_size - 1 < n; j += vec_size) {
+            auto acc = vec_type::template zero<T>();
+
+            for (size_t s = 0; s < S; ++s) {
+                const T coeff(Trans ? mat[s * R + r] : mat[r * S + s]);
+
+                if (coeff != T(0)) {
+                    acc = vec_type::fmadd(vec_type::set(coeff), vec_type::loadu(in + s * in_stride + j), acc);
+                }
+            }
+
+            vec_type::storeu(o + j, acc);
+        }
+
+        for (; j < n; ++j) {
+            T acc(0);
+
+            for (size_t s = 0; s < S; ++s) {
+                acc += T(Trans ? mat[s * R + r] : mat[r * S + s]) * in[s * in_stride + j];
+            }
+
+            o[j] = acc;
+        }
+    }
+}
+
+/*!
+ * \brief Transform a 3x3 filter into the Winograd domain: U = G g G^T
+ * \param g The 3x3 filter, in row-major order
+ * \param u The output (alpha x alpha) elements
+ * \param u_stride The distance between two output elements
+ * \tparam Flip Indicates if the filter must be flipped
+ */
+template <size_t M, bool Flip, typename T>
+void winograd_filter_transform(const T* g, T* u, size_t u_stride) {
+    using tile = winograd_tile<M>;
+
+    constexpr size_t alpha = tile::alpha;
+
+    T tmp[alpha * 3];
+
+    for (size_t i = 0; i < alpha; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            T acc(0);
+
+            for (size_t k = 0; k < 3; ++k) {
+                acc += T(tile::g[i * 3 + k]) * (Flip ? g[(2 - k) * 3 + (2 - j)] : g[k * 3 + j]);
+            }
+
+            tmp[i * 3 + j] = acc;
+        }
+    }
+
+    for (size_t i = 0; i < alpha; ++i) {
+        for (size_t j = 0; j < alpha; ++j) {
+            T acc(0);
+
+            for (size_t k = 0; k < 3; ++k) {
+                acc += tmp[i * 3 + k] * T(tile::g[j * 3 + k]);
+            }
+
+            u[(i * alpha + j) * u_stride] = acc;
+        }
+    }
+}
+
+/*!
+ * \brief Transform one row of input tiles into the Winograd domain: V = B^T d B
+ *
+ * \param plane The zero-padded input plane
+ * \param w The number of columns of the input plane
+ * \param ty The index of the row of tiles
+ * \param t2 The number of tiles per row
+ * \param d Scratch memory of alpha * alpha * t2 elements
+ * \param t Scratch memory of alpha * alpha * t2 elements
+ * \param v The output rows, one per Winograd element
+ * \param v_stride The distance between two output rows
+ */
+template <typename V, size_t M, typename T>
+void winograd_input_transform(const T* plane, size_t w, size_t ty, size_t t2, T* d, T* t, T* v, size_t v_stride) {
+    using tile = winograd_tile<M>;
+
+    constexpr size_t alpha = tile::alpha;
+
+    // Gather the tiles so that each element of the tiles is a contiguous row
+
+    for (size_t r = 0; r < alpha; ++r) {
+        const T* in = plane + (ty * M + r) * w;
+
+        for (size_t j = 0; j < alpha; ++j) {
+            for (size_t tx = 0; tx < t2; ++tx) {
+                d[(r * alpha + j) * t2 + tx] = in[tx * M + j];
+            }
+        }
+    }
+
+    // t = B^T d
+
+    for (size_t j = 0; j < alpha; ++j) {
+        winograd_apply<V, false>(tile::bt, alpha, alpha, d + j * t2, alpha * t2, t + j * t2, alpha * t2, t2);
+    }
+
+    // v = t B
+
+    for (size_t i = 0; i < alpha; ++i) {
+        winograd_apply<V, false>(tile::bt, alpha, alpha, t + i * alpha * t2, t2, v + i * alpha * v_stride, v_stride, t2);
+    }
+}
+
+/*!
+ * \brief Copy an input plane into a zero-padded plane
+ * \param in The input plane
+ * \param n1 The first dimension of the input
+ * \param n2 The second dimension of the input
+ * \param plane The output plane
+ * \param h The first dimension of the output plane
+ * \param w The second dimension of the output plane
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \tparam Flip Indicates if the input must be flipped
+ */
+template <bool Flip, typename T>
+void winograd_pad_plane(const T* in, size_t n1, size_t n2, T* plane, size_t h, size_t w, size_t p1, size_t p2) {
+    direct_fill_n(plane, h * w, T(0));
+
+    for (size_t i = 0; i < n1; ++i) {
+        for (size_t j = 0; j < n2; ++j) {
+            plane[(i + p1) * w + j + p2] = Flip ? in[(n1 - 1 - i) * n2 + (n2 - 1 - j)] : in[i * n2 + j];
+        }
+    }
+}
+
+/*!
+ * \brief Compute a 4D convolution of a 3x3 kernel with unit strides with
+ * the Winograd F(MxM, 3x3) algorithm.
+ *
+ * \param input The input matrix [N, C, n1, n2]
+ * \param kernel The kernel matrix [K, C, 3, 3] or [C, K, 3, 3] if Transposed
+ * \param conv The output matrix [N, K, c1, c2]
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ *
+ * \tparam Flip Indicates if the kernels must be flipped (true convolution)
+ * \tparam Transposed Indicates if the first two dimensions of the kernel are swapped
+ */
+template <size_t M, bool Flip, bool Transposed, typename I_T, typename K_T, typename C_T>
+void winograd_conv4(const I_T& input, const K_T& kernel, C_T&& conv, size_t p1, size_t p2) {
+    using T    = value_t<I_T>;
+    using tile = winograd_tile<M>;
+
+    constexpr size_t alpha = tile::alpha;
+    constexpr size_t A2    = alpha * alpha;
+
+    const size_t N = etl::dim<0>(input);
+    const size_t C = etl::dim<1>(input);
+    const size_t K = etl::dim<1>(conv);
+
+    const size_t n1 = etl::dim<2>(input);
+    const size_t n2 = etl::dim<3>(input);
+
+    const size_t c1 = etl::dim<2>(conv);
+    const size_t c2 = etl::dim<3>(conv);
+
+    const size_t t1 = (c1 + M - 1) / M;
+    const size_t t2 = (c2 + M - 1) / M;
+    const size_t P  = t1 * t2;
+
+    const size_t h = t1 * M + 2;
+    const size_t w = t2 * M + 2;
+
+    input.ensure_cpu_up_to_date();
+    kernel.ensure_cpu_up_to_date();
+
+    const T* in_m = input.memory_start();
+    const T* k_m  = kernel.memory_start();
+    T* out_m      = conv.memory_start();
+
+    // 1. Transform all the filters once, U[xi][k][c]
+
+    auto u = etl::allocate<T>(A2 * K * C);
+
+    auto filter_fun = [&](const size_t first, const size_t last) {
+        for (size_t k = first; k < last; ++k) {
+            for (size_t c = 0; c < C; ++c) {
+                const T* g = k_m + (Transposed ? (c * K + k) : (k * C + c)) * 9;
+
+                winograd_filter_transform<M, Flip>(g, u.get() + k * C + c, K * C);
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(filter_fun, 0, K, 16UL);
+
+    // 2. Transform the tiles, multiply in the Winograd domain and transform back
+
+    auto batch_fun_n = [&](const size_t first, const size_t last) {
+        if (last - first) {
+            auto plane = etl::allocate<T>(h * w);
+            auto d     = etl::allocate<T>(A2 * t2);
+            auto t     = etl::allocate<T>(A2 * t2);
+            auto v     = etl::allocate<T>(A2 * C * P);
+            auto mm    = etl::allocate<T>(A2 * K * P);
+
+            for (size_t i = first; i < last; ++i) {
+                for (size_t c = 0; c < C; ++c) {
+                    winograd_pad_plane<false>(in_m + (i * C + c) * n1 * n2, n1, n2, plane.get(), h, w, p1, p2);
+
+                    for (size_t ty = 0; ty < t1; ++ty) {
+                        winograd_input_transform<default_vec, M>(plane.get(), w, ty, t2, d.get(), t.get(), v.get() + c * P + ty * t2, C * P);
+                    }
+                }
+
+                for (size_t xi = 0; xi < A2; ++xi) {
+                    gemm_large_kernel_rr_to_r<default_vec>(u.get() + xi * K * C, v.get() + xi * C * P, mm.get() + xi * K * P, K, P, C, T(1), T(0));
+                }
+
+                for (size_t k = 0; k < K; ++k) {
+                    T* out = out_m + (i * K + k) * c1 * c2;
+
+                    for (size_t ty = 0; ty < t1; ++ty) {
+                        const T* m_row = mm.get() + k * P + ty * t2;
+
+                        // t = A^T m
+
+                        for (size_t j = 0; j < alpha; ++j) {
+                            winograd_apply<default_vec, false>(tile::at, M, alpha, m_row + j * K * P, alpha * K * P, t.get() + j * t2, alpha * t2, t2);
+                        }
+
+                        // y = t A
+
+                        for (size_t a = 0; a < M; ++a) {
+                            winograd_apply<default_vec, false>(tile::at, M, alpha, t.get() + a * alpha * t2, t2, d.get() + a * M * t2, t2, t2);
+                        }
+
+                        // Scatter the output tiles
+
+                        for (size_t a = 0; a < M && ty * M + a < c1; ++a) {
+                            for (size_t b = 0; b < M; ++b) {
+                                const T* y = d.get() + (a * M + b) * t2;
+
+                                for (size_t tx = 0; tx < t2 && tx * M + b < c2; ++tx) {
+                                    out[(ty * M + a) * c2 + tx * M + b] = y[tx];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun_n, 0, N, 2UL);
+
+    conv.validate_cpu();
+    conv.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute a 4D valid filter convolution (gradients of 3x3 kernels)
+ * with unit strides with the Winograd F(3x3, MxM) algorithm.
+ *
+ * The output tiles of the forward convolution play the role of the filters
+ * and the result is accumulated over all the tiles in the Winograd domain
+ * before being transformed back.
+ *
+ * \param input The input matrix [N, C, n1, n2]
+ * \param kernel The kernel matrix [N, K, k1, k2]
+ * \param conv The output matrix [K, C, 3, 3]
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ *
+ * \tparam Flip Indicates if the kernels must be flipped (true convolution)
+ */
+template <size_t M, bool Flip, typename I_T, typename K_T, typename C_T>
+void winograd_conv4_filter(const I_T& input, const K_T& kernel, C_T&& conv, size_t p1, size_t p2) {
+    using T    = value_t<I_T>;
+    using tile = winograd_tile<M>;
+
+    constexpr size_t alpha = tile::alpha;
+    constexpr size_t A2    = alpha * alpha;
+
+    const size_t N = etl::dim<0>(input);
+    const size_t C = etl::dim<1>(input);
+    const size_t K = etl::dim<1>(kernel);
+
+    const size_t n1 = etl::dim<2>(input);
+    const size_t n2 = etl::dim<3>(input);
+
+    const size_t k1 = etl::dim<2>(kernel);
+    const size_t k2 = etl::dim<3>(kernel);
+
+    const size_t t1 = (k1 + M - 1) / M;
+    const size_t t2 = (k2 + M - 1) / M;
+    const size_t P  = t1 * t2;
+
+    const size_t h = t1 * M + 2;
+    const size_t w = t2 * M + 2;
+
+    input.ensure_cpu_up_to_date();
+    kernel.ensure_cpu_up_to_date();
+
+    const T* in_m = input.memory_start();
+    const T* k_m  = kernel.memory_start();
+    T* out_m      = conv.memory_start();
+
+    auto v  = etl::allocate<T>(A2 * C * P);
+    auto hh = etl::allocate<T>(A2 * K * P);
+    auto mm = etl::allocate<T>(A2 * K * C);
+
+    direct_fill_n(mm.get(), A2 * K * C, T(0));
+
+    for (size_t i = 0; i < N; ++i) {
+        // Transform the input tiles: V = B^T d B
+
+        auto input_fun = [&](const size_t first, const size_t last) {
+            if (last - first) {
+                auto plane = etl::allocate<T>(h * w);
+                auto d     = etl::allocate<T>(A2 * t2);
+                auto t     = etl::allocate<T>(A2 * t2);
+
+                for (size_t c = first; c < last; ++c) {
+                    winograd_pad_plane<false>(in_m + (i * C + c) * n1 * n2, n1, n2, plane.get(), h, w, p1, p2);
+
+                    for (size_t ty = 0; ty < t1; ++ty) {
+                        winograd_input_transform<default_vec, M>(plane.get(), w, ty, t2, d.get(), t.get(), v.get() + c * P + ty * t2, C * P);
+                    }
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(input_fun, 0, C, 4UL);
+
+        // Transform the output tiles: H = A h A^T
+
+        auto kernel_fun = [&](const size_t first, const size_t last) {
+            if (last - first) {
+                auto plane = etl::allocate<T>(t1 * M * t2 * M);
+                auto d     = etl::allocate<T>(A2 * t2);
+                auto t     = etl::allocate<T>(A2 * t2);
+
+                for (size_t k = first; k < last; ++k) {
+                    winograd_pad_plane<Flip>(k_m + (i * K + k) * k1 * k2, k1, k2, plane.get(), t1 * M, t2 * M, 0, 0);
+
+                    for (size_t ty = 0; ty < t1; ++ty) {
+                        for (size_t a = 0; a < M; ++a) {
+                            for (size_t b = 0; b < M; ++b) {
+                                for (size_t tx = 0; tx < t2; ++tx) {
+                                    d[(a * M + b) * t2 + tx] = plane[(ty * M + a) * t2 * M + tx * M + b];
+                                }
+                            }
+                        }
+
+                        for (size_t b = 0; b < M; ++b) {
+                            winograd_apply<default_vec, true>(tile::at, alpha, M, d.get() + b * t2, M * t2, t.get() + b * t2, M * t2, t2);
+                        }
+
+                        for (size_t ii = 0; ii < alpha; ++ii) {
+                            winograd_apply<default_vec, true>(tile::at, alpha, M, t.get() + ii * M * t2, t2, hh.get() + (ii * alpha * K + k) * P + ty * t2, K * P, t2);
+                        }
+                    }
+                }
+            }
+        };
+
+        engine_dispatch_1d_serial(kernel_fun, 0, K, 4UL);
+
+        // Accumulate the products over the tiles
+
+        auto gemm_fun = [&](const size_t first, const size_t last) {
+            for (size_t xi = first; xi < last; ++xi) {
+                gemm_large_kernel_rc_to_r<default_vec>(hh.get() + xi * K * P, v.get() + xi * C * P, mm.get() + xi * K * C, K, C, P, T(1));
+            }
+        };
+
+        engine_dispatch_1d_serial(gemm_fun, 0, A2, 2UL);
+    }
+
+    // Transform the gradients back: dW = G^T M G
+
+    for (size_t kc = 0; kc < K * C; ++kc) {
+        T tmp[3 * alpha];
+
+        for (size_t u = 0; u < 3; ++u) {
+            for (size_t j = 0; j < alpha; ++j) {
+                T acc(0);
+
+                for (size_t ii = 0; ii < alpha; ++ii) {
+                    acc += T(tile::g[ii * 3 + u]) * mm[(ii * alpha + j) * K * C + kc];
+                }
+
+                tmp[u * alpha + j] = acc;
+            }
+        }
+
+        for (size_t u = 0; u < 3; ++u) {
+            for (size_t vv = 0; vv < 3; ++vv) {
+                T acc(0);
+
+                for (size_t j = 0; j < alpha; ++j) {
+                    acc += tmp[u * alpha + j] * T(tile::g[j * 3 + vv]);
+                }
+
+                out_m[kc * 9 + u * 3 + vv] = acc;
+            }
+        }
+    }
+
+    conv.validate_cpu();
+    conv.invalidate_gpu();
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute a 4D valid convolution with 3x3 kernels using the Winograd algorithm
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void winograd_conv4_valid([[maybe_unused]] I_T&& input,
+                          [[maybe_unused]] K_T&& kernel,
+                          [[maybe_unused]] C_T&& conv,
+                          [[maybe_unused]] size_t s1,
+                          [[maybe_unused]] size_t s2,
+                          [[maybe_unused]] size_t p1,
+                          [[maybe_unused]] size_t p2) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        cpp_assert(s1 == 1 && s2 == 1, "Winograd convolution is only possible with unit strides");
+        cpp_assert(etl::dim<2>(kernel) == 3 && etl::dim<3>(kernel) == 3, "Winograd convolution is only possible with 3x3 kernels");
+
+        if (detail::winograd_large_tiles(etl::dim<2>(conv), etl::dim<3>(conv))) {
+            detail::winograd_conv4<4, true, false>(input, kernel, conv, p1, p2);
+        } else {
+            detail::winograd_conv4<2, true, false>(input, kernel, conv, p1, p2);
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::winograd_conv4_valid");
+    }
+}
+
+/*!
+ * \brief Compute a 4D valid convolution with 3x3 flipped kernels using the Winograd algorithm
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void winograd_conv4_valid_flipped([[maybe_unused]] I_T&& input,
+                                  [[maybe_unused]] K_T&& kernel,
+                                  [[maybe_unused]] C_T&& conv,
+                                  [[maybe_unused]] size_t s1,
+                                  [[maybe_unused]] size_t s2,
+                                  [[maybe_unused]] size_t p1,
+                                  [[maybe_unused]] size_t p2) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        cpp_assert(s1 == 1 && s2 == 1, "Winograd convolution is only possible with unit strides");
+        cpp_assert(etl::dim<2>(kernel) == 3 && etl::dim<3>(kernel) == 3, "Winograd convolution is only possible with 3x3 kernels");
+
+        if (detail::winograd_large_tiles(etl::dim<2>(conv), etl::dim<3>(conv))) {
+            detail::winograd_conv4<4, false, false>(input, kernel, conv, p1, p2);
+        } else {
+            detail::winograd_conv4<2, false, false>(input, kernel, conv, p1, p2);
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::winograd_conv4_valid_flipped");
+    }
+}
+
+/*!
+ * \brief Compute a 4D full convolution with 3x3 kernels using the Winograd algorithm
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I_T, typename K_T, typename C_T>
+void winograd_conv4_full([[maybe_unused]] I_T&& input, [[maybe_unused]] K_T&& kernel, [[maybe_unused]] C_T&& conv) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        cpp_assert(etl::dim<2>(kernel) == 3 && etl::dim<3>(kernel) == 3, "Winograd convolution is only possible with 3x3 kernels");
+
+        if (detail::winograd_large_tiles(etl::dim<2>(conv), etl::dim<3>(conv))) {
+            detail::winograd_conv4<4, true, true>(input, kernel, conv, 2, 2);
+        } else {
+            detail::winograd_conv4<2, true, true>(input, kernel, conv, 2, 2);
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::winograd_conv4_full");
+    }
+}
+
+/*!
+ * \brief Compute a 4D full convolution with 3x3 flipped kernels using the Winograd algorithm
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ */
+template <typename I_T, typename K_T, typename C_T>
+void winograd_conv4_full_flipped([[maybe_unused]] I_T&& input, [[maybe_unused]] K_T&& kernel, [[maybe_unused]] C_T&& conv) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        cpp_assert(etl::dim<2>(kernel) == 3 && etl::dim<3>(kernel) == 3, "Winograd convolution is only possible with 3x3 kernels");
+
+        if (detail::winograd_large_tiles(etl::dim<2>(conv), etl::dim<3>(conv))) {
+            detail::winograd_conv4<4, false, true>(input, kernel, conv, 2, 2);
+        } else {
+            detail::winograd_conv4<2, false, true>(input, kernel, conv, 2, 2);
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::winograd_conv4_full_flipped");
+    }
+}
+
+/*!
+ * \brief Compute a 4D valid filter convolution producing 3x3 kernels using the Winograd algorithm
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void winograd_conv4_valid_filter([[maybe_unused]] I_T&& input,
+                                 [[maybe_unused]] K_T&& kernel,
+                                 [[maybe_unused]] C_T&& conv,
+                                 [[maybe_unused]] size_t s1,
+                                 [[maybe_unused]] size_t s2,
+                                 [[maybe_unused]] size_t p1,
+                                 [[maybe_unused]] size_t p2) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        cpp_assert(s1 == 1 && s2 == 1, "Winograd convolution is only possible with unit strides");
+        cpp_assert(etl::dim<2>(conv) == 3 && etl::dim<3>(conv) == 3, "Winograd convolution is only possible with 3x3 kernels");
+
+        if (detail::winograd_large_tiles(etl::dim<2>(kernel), etl::dim<3>(kernel))) {
+            detail::winograd_conv4_filter<4, true>(input, kernel, conv, p1, p2);
+        } else {
+            detail::winograd_conv4_filter<2, true>(input, kernel, conv, p1, p2);
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::winograd_conv4_valid_filter");
+    }
+}
+
+/*!
+ * \brief Compute a 4D valid filter convolution producing 3x3 flipped kernels using the Winograd algorithm
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void winograd_conv4_valid_filter_flipped([[maybe_unused]] I_T&& input,
+                                         [[maybe_unused]] K_T&& kernel,
+                                         [[maybe_unused]] C_T&& conv,
+                                         [[maybe_unused]] size_t s1,
+                                         [[maybe_unused]] size_t s2,
+                                         [[maybe_unused]] size_t p1,
+                                         [[maybe_unused]] size_t p2) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        cpp_assert(s1 == 1 && s2 == 1, "Winograd convolution is only possible with unit strides");
+        cpp_assert(etl::dim<2>(conv) == 3 && etl::dim<3>(conv) == 3, "Winograd convolution is only possible with 3x3 kernels");
+
+        if (detail::winograd_large_tiles(etl::dim<2>(kernel), etl::dim<3>(kernel))) {
+            detail::winograd_conv4_filter<4, false>(input, kernel, conv, p1, p2);
+        } else {
+            detail::winograd_conv4_filter<2, false>(input, kernel, conv, p1, p2);
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::winograd_conv4_valid_filter_flipped");
+    }
+}
+
+} //end of namespace etl::impl::vec
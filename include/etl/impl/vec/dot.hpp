@@ -137,8 +137,13 @@ value_t<L> dot(const L& lhs, const R& rhs) {
     lhs.ensure_cpu_up_to_date();
     rhs.ensure_cpu_up_to_date();
 
-    // The default vectorization scheme should be sufficient
-    return dot_impl<default_vec>(lhs, rhs);
+    if constexpr (is_float16_t<value_t<L>>) {
+        // 16-bit floating point are not vectorizable, but must be accumulated in single precision
+        return etl::impl::standard::dot(lhs, rhs);
+    } else {
+        // The default vectorization scheme should be sufficient
+        return dot_impl<default_vec>(lhs, rhs);
+    }
 }
 
 } //end of namespace etl::impl::vec
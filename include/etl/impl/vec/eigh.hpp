@@ -0,0 +1,168 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the eigendecomposition of symmetric
+ * matrices.
+ *
+ * The algorithms are the ones of the standard implementation, with
+ * vectorized row kernels: the products applying the blocks of reflectors,
+ * the rotations of the QL iterations and the updates of the reductions.
+ */
+
+#pragma once
+
+#include "etl/impl/std/eigh.hpp"
+#include "etl/impl/vec/qr.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized eigendecomposition is possible
+ * for the given value type.
+ *
+ * \tparam V The vector mode
+ * \tparam T The value type
+ */
+template <vector_mode_t V, typename T>
+constexpr bool eigh_possible = qr_possible<V, T>;
+
+namespace detail {
+
+/*!
+ * \brief The vectorized kernels of the reductions to condensed form and of
+ * the QL and QR iterations
+ *
+ * \tparam V The vectorization mode
+ */
+template <typename V>
+struct eigen_kernels {
+    using vec_type = V; ///< The vectorization mode
+
+    /*!
+     * \brief Compute C -= A * B on blocks of row-major matrices
+     * \param args The blocks and their dimensions
+     */
+    template <typename... Args>
+    static void update(Args&&... args) {
+        block_update<V>(args...);
+    }
+
+    /*!
+     * \brief Rotate two rows: (x, y) = (c x + s y, c y - s x)
+     * \param x The first row
+     * \param y The second row
+     * \param c The cosine of the rotation
+     * \param s The sine of the rotation
+     * \param n The number of elements
+     */
+    template <typename T>
+    static void rotate(T* x, T* y, T c, T s, size_t n) {
+        static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+        auto c1 = vec_type::set(c);
+        auto s1 = vec_type::set(s);
+        auto s2 = vec_type::set(-s);
+
+        size_t k = 0;
+
+        for (; k + vec_size - 1 < n; k += vec_size) {
+            auto a = vec_type::loadu(x + k);
+            auto b = vec_type::loadu(y + k);
+
+            vec_type::storeu(x + k, vec_type::fmadd(c1, a, vec_type::mul(s1, b)));
+            vec_type::storeu(y + k, vec_type::fmadd(c1, b, vec_type::mul(s2, a)));
+        }
+
+        for (; k < n; ++k) {
+            const T a = x[k];
+            const T b = y[k];
+
+            x[k] = c * a + s * b;
+            y[k] = c * b - s * a;
+        }
+    }
+
+    /*!
+     * \brief Compute y += alpha * x
+     * \param y The vector to update
+     * \param x The vector to add
+     * \param alpha The scaling factor
+     * \param n The number of elements
+     */
+    template <typename T>
+    static void axpy(T* y, const T* x, T alpha, size_t n) {
+        static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+        auto a1 = vec_type::set(alpha);
+
+        size_t k = 0;
+
+        for (; k + 2 * vec_size - 1 < n; k += 2 * vec_size) {
+            auto y1 = vec_type::fmadd(a1, vec_type::loadu(x + k), vec_type::loadu(y + k));
+            auto y2 = vec_type::fmadd(a1, vec_type::loadu(x + k + vec_size), vec_type::loadu(y + k + vec_size));
+
+            vec_type::storeu(y + k, y1);
+            vec_type::storeu(y + k + vec_size, y2);
+        }
+
+        for (; k + vec_size - 1 < n; k += vec_size) {
+            vec_type::storeu(y + k, vec_type::fmadd(a1, vec_type::loadu(x + k), vec_type::loadu(y + k)));
+        }
+
+        for (; k < n; ++k) {
+            y[k] += alpha * x[k];
+        }
+    }
+
+    /*!
+     * \brief Compute the dot product of two vectors
+     * \param x The first vector
+     * \param y The second vector
+     * \param n The number of elements
+     * \return the dot product of x and y
+     */
+    template <typename T>
+    static T dot(const T* x, const T* y, size_t n) {
+        static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+        auto r1 = vec_type::template zero<T>();
+        auto r2 = vec_type::template zero<T>();
+
+        size_t k = 0;
+
+        for (; k + 2 * vec_size - 1 < n; k += 2 * vec_size) {
+            r1 = vec_type::fmadd(vec_type::loadu(x + k), vec_type::loadu(y + k), r1);
+            r2 = vec_type::fmadd(vec_type::loadu(x + k + vec_size), vec_type::loadu(y + k + vec_size), r2);
+        }
+
+        for (; k + vec_size - 1 < n; k += vec_size) {
+            r1 = vec_type::fmadd(vec_type::loadu(x + k), vec_type::loadu(y + k), r1);
+        }
+
+        T acc = vec_type::hadd(vec_type::add(r1, r2));
+
+        for (; k < n; ++k) {
+            acc += x[k] * y[k];
+        }
+
+        return acc;
+    }
+};
+
+} //end of namespace detail
+
+/*!
+ * \copydoc etl::impl::standard::eigh
+ */
+template <typename T>
+bool eigh(T* a, T* w, T* v, size_t n) {
+    return etl::impl::standard::detail::eigh_blocked<detail::eigen_kernels<default_vec>>(a, w, v, n);
+}
+
+} //end of namespace etl::impl::vec
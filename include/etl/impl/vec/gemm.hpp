@@ -7,7 +7,8 @@
 
 #pragma once
 
-#include "etl/impl/vec/gemm_blis.hpp" // BLIS-Like optimized kernel
+#include "etl/impl/vec/gemm_blis.hpp"     // BLIS-Like optimized kernel
+#include "etl/impl/vec/gemm_epilogue.hpp" // Epilogue of the row-major kernels
 
 // Allocations to row major
 #include "etl/impl/vec/gemm_rr_to_r.hpp"
@@ -94,6 +95,83 @@ void gemm(A&& a, B&& b, C&& c, [[maybe_unused]] T alpha) {
     }
 }
 
+/*!
+ * \brief Optimized version of GEMM for C += alpha * (A * B) where all
+ * matrices are stored in row-major order.
+ *
+ * The accumulation is fused into the kernels.
+ *
+ * \param a The lhs matrix
+ * \param b The rhs matrix
+ * \param c The result matrix
+ * \param alpha The multiplicator of A * B
+ */
+template <typename A, typename B, typename C, typename T>
+void gemm_add([[maybe_unused]] A&& a, [[maybe_unused]] B&& b, [[maybe_unused]] C&& c, [[maybe_unused]] T alpha) {
+    if constexpr (gemm_epilogue_possible<vector_mode, void, A, B, C>) {
+        using VT = value_t<A>;
+
+        a.ensure_cpu_up_to_date();
+        b.ensure_cpu_up_to_date();
+        c.ensure_cpu_up_to_date();
+
+        const size_t M = etl::rows(a);
+        const size_t N = etl::columns(b);
+        const size_t K = etl::columns(a);
+
+        gemm_epilogue<default_vec, VT, true> epilogue(alpha, VT(1));
+
+        gemm_rr_to_r_epilogue(a.memory_start(), b.memory_start(), c.memory_start(), M, N, K, epilogue);
+
+        c.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::gemm_add");
+    }
+}
+
+/*!
+ * \brief Optimized version of GEMM for C = Op(alpha * (A * B) + bias), or
+ * C += alpha * (A * B) + bias when Beta is set, where all matrices are stored
+ * in row-major order.
+ *
+ * The bias (added to each row of the result) and the activation function are
+ * fused into the kernels.
+ *
+ * \param a The lhs matrix
+ * \param b The rhs matrix
+ * \param bias The vector of biases
+ * \param c The result matrix
+ * \param alpha The multiplicator of A * B
+ * \tparam Op The activation unary operator, void for none
+ * \tparam Beta Indicates if the result is accumulated into C
+ */
+template <typename Op, bool Beta, typename A, typename B, typename Bias, typename C, typename T>
+void gemm_bias([[maybe_unused]] A&& a, [[maybe_unused]] B&& b, [[maybe_unused]] Bias&& bias, [[maybe_unused]] C&& c, [[maybe_unused]] T alpha) {
+    if constexpr (gemm_epilogue_possible<vector_mode, Op, A, B, C> && all_homogeneous<A, Bias> && all_vectorizable<vector_mode, Bias>) {
+        using VT = value_t<A>;
+
+        a.ensure_cpu_up_to_date();
+        b.ensure_cpu_up_to_date();
+        bias.ensure_cpu_up_to_date();
+
+        if constexpr (Beta) {
+            c.ensure_cpu_up_to_date();
+        }
+
+        const size_t M = etl::rows(a);
+        const size_t N = etl::columns(b);
+        const size_t K = etl::columns(a);
+
+        gemm_epilogue<default_vec, VT, Beta, true, Op> epilogue(alpha, Beta ? VT(1) : VT(0), bias.memory_start());
+
+        gemm_rr_to_r_epilogue(a.memory_start(), b.memory_start(), c.memory_start(), M, N, K, epilogue);
+
+        c.invalidate_gpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::gemm_bias");
+    }
+}
+
 /*!
  * \brief Optimized version of GEMM for C = trans(A) * B where all matrices are
  * stored in row-major order.
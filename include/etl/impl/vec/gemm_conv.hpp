@@ -802,4 +802,688 @@ void blas_conv4_valid_back_flipped([[maybe_unused]] I_T&& input,
     }
 }
 
+/*!
+ * \brief Compute a 4D valid dilated convolution, with prepared kernels, using a vectorized matrix multiplication kernel
+ *
+ * The kernels must be prepared as a single matrix with one row per output
+ * channel and one column per (input channel, kernel row, kernel column).
+ *
+ * \param input The input matrix
+ * \param kernels The prepared (flipped) kernels
+ * \param conv The output matrix
+ * \param k1 The first dimension of the kernels
+ * \param k2 The second dimension of the kernels
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I_T, typename KS_T, typename C_T>
+void blas_conv4_valid_dilated_prepared(I_T&& input, KS_T&& kernels, C_T&& conv, size_t k1, size_t k2, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    using T = value_t<I_T>;
+
+    const auto N  = etl::dim<0>(input);   // The number of images
+    const auto C  = etl::dim<1>(input);   // The number of input channels
+    const auto CO = etl::dim<0>(kernels); // The number of output channels
+
+    const auto c1 = etl::dim<2>(conv);
+    const auto c2 = etl::dim<3>(conv);
+
+    input.ensure_cpu_up_to_date();
+
+    auto batch_fun_n = [&](const size_t first, const size_t last) {
+        if (last - first) {
+            etl::dyn_matrix<T, 2> input_col(C * k1 * k2, c1 * c2);
+
+            for (size_t i = first; i < last; ++i) {
+                im2col_direct_tr_dilated(input_col, input(i), k1, k2, s1, s2, p1, p2, d1, d2);
+
+                gemm_large_kernel_rr_to_r<default_vec>(kernels.memory_start(), input_col.memory_start(), conv(i).memory_start(), CO, c1 * c2, C * k1 * k2,
+                                                       T(1), T(0));
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun_n, 0, N, 2UL);
+
+    conv.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute a 4D valid dilated convolution using a vectorized matrix multiplication kernel
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv4_valid_dilated([[maybe_unused]] I_T&& input,
+                              [[maybe_unused]] K_T&& kernel,
+                              [[maybe_unused]] C_T&& conv,
+                              [[maybe_unused]] size_t s1,
+                              [[maybe_unused]] size_t s2,
+                              [[maybe_unused]] size_t p1,
+                              [[maybe_unused]] size_t p2,
+                              [[maybe_unused]] size_t d1,
+                              [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        const auto K = etl::dim<0>(kernel); // The number of kernels
+        const auto C = etl::dim<1>(kernel); // The number of channels
+
+        const auto k1 = etl::dim<2>(kernel);
+        const auto k2 = etl::dim<3>(kernel);
+
+        kernel.ensure_cpu_up_to_date();
+
+        etl::dyn_matrix<value_t<I_T>, 2> kernels(K, C * k1 * k2);
+
+        for (size_t k = 0; k < K; ++k) {
+            for (size_t c = 0; c < C; ++c) {
+                std::reverse_copy(kernel(k)(c).memory_start(), kernel(k)(c).memory_end(), kernels.memory_start() + (k * C + c) * k1 * k2);
+            }
+        }
+
+        blas_conv4_valid_dilated_prepared(input, kernels, conv, k1, k2, s1, s2, p1, p2, d1, d2);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv4_valid_dilated");
+    }
+}
+
+/*!
+ * \brief Compute a 4D valid dilated convolution using a vectorized matrix multiplication kernel, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv4_valid_dilated_flipped([[maybe_unused]] I_T&& input,
+                                      [[maybe_unused]] K_T&& kernel,
+                                      [[maybe_unused]] C_T&& conv,
+                                      [[maybe_unused]] size_t s1,
+                                      [[maybe_unused]] size_t s2,
+                                      [[maybe_unused]] size_t p1,
+                                      [[maybe_unused]] size_t p2,
+                                      [[maybe_unused]] size_t d1,
+                                      [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        const auto K = etl::dim<0>(kernel); // The number of kernels
+        const auto C = etl::dim<1>(kernel); // The number of channels
+
+        const auto k1 = etl::dim<2>(kernel);
+        const auto k2 = etl::dim<3>(kernel);
+
+        kernel.ensure_cpu_up_to_date();
+
+        // The flipped kernels are already laid out as the GEMM needs them
+        etl::dyn_matrix<value_t<I_T>, 2> kernels(K, C * k1 * k2);
+
+        direct_copy_n(kernel.memory_start(), kernels.memory_start(), K * C * k1 * k2);
+
+        blas_conv4_valid_dilated_prepared(input, kernels, conv, k1, k2, s1, s2, p1, p2, d1, d2);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv4_valid_dilated_flipped");
+    }
+}
+
+/*!
+ * \brief Compute the backward pass of a 4D valid dilated convolution using a vectorized matrix multiplication kernel
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv4_valid_back_dilated([[maybe_unused]] I_T&& input,
+                                   [[maybe_unused]] K_T&& kernel,
+                                   [[maybe_unused]] C_T&& conv,
+                                   [[maybe_unused]] size_t s1,
+                                   [[maybe_unused]] size_t s2,
+                                   [[maybe_unused]] size_t p1,
+                                   [[maybe_unused]] size_t p2,
+                                   [[maybe_unused]] size_t d1,
+                                   [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        const auto K = etl::dim<0>(kernel); // The number of kernels
+        const auto C = etl::dim<1>(kernel); // The number of channels
+
+        const auto k1 = etl::dim<2>(kernel);
+        const auto k2 = etl::dim<3>(kernel);
+
+        kernel.ensure_cpu_up_to_date();
+
+        etl::dyn_matrix<value_t<I_T>, 2> kernels(C, K * k1 * k2);
+
+        for (size_t c = 0; c < C; ++c) {
+            for (size_t k = 0; k < K; ++k) {
+                std::reverse_copy(kernel(k)(c).memory_start(), kernel(k)(c).memory_end(), kernels.memory_start() + (c * K + k) * k1 * k2);
+            }
+        }
+
+        blas_conv4_valid_dilated_prepared(input, kernels, conv, k1, k2, s1, s2, p1, p2, d1, d2);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv4_valid_back_dilated");
+    }
+}
+
+/*!
+ * \brief Compute the backward pass of a 4D valid dilated convolution using a vectorized matrix multiplication kernel, with flipped kernels
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv4_valid_back_dilated_flipped([[maybe_unused]] I_T&& input,
+                                           [[maybe_unused]] K_T&& kernel,
+                                           [[maybe_unused]] C_T&& conv,
+                                           [[maybe_unused]] size_t s1,
+                                           [[maybe_unused]] size_t s2,
+                                           [[maybe_unused]] size_t p1,
+                                           [[maybe_unused]] size_t p2,
+                                           [[maybe_unused]] size_t d1,
+                                           [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        const auto K = etl::dim<0>(kernel); // The number of kernels
+        const auto C = etl::dim<1>(kernel); // The number of channels
+
+        const auto k1 = etl::dim<2>(kernel);
+        const auto k2 = etl::dim<3>(kernel);
+
+        kernel.ensure_cpu_up_to_date();
+
+        etl::dyn_matrix<value_t<I_T>, 2> kernels(C, K * k1 * k2);
+
+        for (size_t c = 0; c < C; ++c) {
+            for (size_t k = 0; k < K; ++k) {
+                direct_copy_n(kernel(k)(c).memory_start(), kernels.memory_start() + (c * K + k) * k1 * k2, k1 * k2);
+            }
+        }
+
+        blas_conv4_valid_dilated_prepared(input, kernels, conv, k1, k2, s1, s2, p1, p2, d1, d2);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv4_valid_back_dilated_flipped");
+    }
+}
+
+/*!
+ * \brief Compute the filter gradients of a 4D valid dilated convolution, with prepared kernels, using a vectorized matrix multiplication kernel
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution), already flipped
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv4_valid_filter_dilated_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    using T = value_t<I_T>;
+
+    const auto N = etl::dim<0>(input); // The number of images
+    const auto K = etl::dim<0>(conv);  // The number of kernels
+    const auto C = etl::dim<1>(conv);  // The number of channels
+
+    const auto k1 = etl::dim<2>(kernel);
+    const auto k2 = etl::dim<3>(kernel);
+
+    const auto f1 = etl::dim<2>(conv);
+    const auto f2 = etl::dim<3>(conv);
+
+    input.ensure_cpu_up_to_date();
+
+    auto batch_fun_c = [&](const size_t first, const size_t last) {
+        if (last - first) {
+            etl::dyn_matrix<T, 2> input_col(k1 * k2, f1 * f2);
+            etl::dyn_matrix<T, 2> tmp_result(K, f1 * f2);
+
+            for (size_t c = first; c < last; ++c) {
+                for (size_t i = 0; i < N; ++i) {
+                    im2col_direct_tr_dilated(input_col, input(i)(c), k1, k2, s1, s2, p1, p2, d1, d2);
+
+                    gemm_large_kernel_rr_to_r<default_vec>(kernel(i).memory_start(), input_col.memory_start(), tmp_result.memory_start(), K, f1 * f2,
+                                                           k1 * k2, T(1), i ? T(1) : T(0));
+                }
+
+                for (size_t k = 0; k < K; ++k) {
+                    direct_copy_n(tmp_result.memory_start() + k * f1 * f2, conv(k)(c).memory_start(), f1 * f2);
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun_c, 0, C, 2UL);
+
+    conv.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the filter gradients of a 4D valid dilated convolution using a vectorized matrix multiplication kernel
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv4_valid_filter_dilated([[maybe_unused]] I_T&& input,
+                                     [[maybe_unused]] K_T&& kernel,
+                                     [[maybe_unused]] C_T&& conv,
+                                     [[maybe_unused]] size_t s1,
+                                     [[maybe_unused]] size_t s2,
+                                     [[maybe_unused]] size_t p1,
+                                     [[maybe_unused]] size_t p2,
+                                     [[maybe_unused]] size_t d1,
+                                     [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        blas_conv4_valid_filter_dilated_prepared(input, common::pad_right_flip_multi(kernel, 0), conv, s1, s2, p1, p2, d1, d2);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv4_valid_filter_dilated");
+    }
+}
+
+/*!
+ * \brief Compute the filter gradients of a 4D valid dilated convolution using a vectorized matrix multiplication kernel, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv4_valid_filter_dilated_flipped([[maybe_unused]] I_T&& input,
+                                             [[maybe_unused]] K_T&& kernel,
+                                             [[maybe_unused]] C_T&& conv,
+                                             [[maybe_unused]] size_t s1,
+                                             [[maybe_unused]] size_t s2,
+                                             [[maybe_unused]] size_t p1,
+                                             [[maybe_unused]] size_t p2,
+                                             [[maybe_unused]] size_t d1,
+                                             [[maybe_unused]] size_t d2) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        kernel.ensure_cpu_up_to_date();
+
+        blas_conv4_valid_filter_dilated_prepared(input, kernel, conv, s1, s2, p1, p2, d1, d2);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv4_valid_filter_dilated_flipped");
+    }
+}
+
+/*!
+ * \brief Compute a 5D valid convolution, with prepared kernels, using a vectorized matrix multiplication kernel
+ *
+ * The kernels must be flipped and laid out as a (CO, C * k1 * k2 * k3) matrix.
+ *
+ * \param input The input matrix
+ * \param kernels The prepared kernels
+ * \param conv The output matrix
+ * \param k1 The first dimension of the kernels
+ * \param k2 The second dimension of the kernels
+ * \param k3 The third dimension of the kernels
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param s3 The stride of the third dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param p3 The padding of the third dimension
+ */
+template <typename I_T, typename KS_T, typename C_T>
+void blas_conv5_valid_prepared(
+    I_T&& input, KS_T&& kernels, C_T&& conv, size_t k1, size_t k2, size_t k3, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    using T = value_t<I_T>;
+
+    const auto N  = etl::dim<0>(input);   // The number of images
+    const auto C  = etl::dim<1>(input);   // The number of input channels
+    const auto CO = etl::dim<0>(kernels); // The number of output channels
+
+    const auto c1 = etl::dim<2>(conv);
+    const auto c2 = etl::dim<3>(conv);
+    const auto c3 = etl::dim<4>(conv);
+
+    input.ensure_cpu_up_to_date();
+
+    auto batch_fun_n = [&](const size_t first, const size_t last) {
+        if (last - first) {
+            etl::dyn_matrix<T, 2> input_col(C * k1 * k2 * k3, c1 * c2 * c3);
+
+            for (size_t i = first; i < last; ++i) {
+                vol2col_direct_tr(input_col, input(i), k1, k2, k3, s1, s2, s3, p1, p2, p3);
+
+                gemm_large_kernel_rr_to_r<default_vec>(kernels.memory_start(), input_col.memory_start(), conv(i).memory_start(), CO, c1 * c2 * c3,
+                                                       C * k1 * k2 * k3, T(1), T(0));
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun_n, 0, N, 2UL);
+
+    conv.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute a 5D valid convolution using a vectorized matrix multiplication kernel
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param s3 The stride of the third dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param p3 The padding of the third dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv5_valid([[maybe_unused]] I_T&& input,
+                      [[maybe_unused]] K_T&& kernel,
+                      [[maybe_unused]] C_T&& conv,
+                      [[maybe_unused]] size_t s1,
+                      [[maybe_unused]] size_t s2,
+                      [[maybe_unused]] size_t s3,
+                      [[maybe_unused]] size_t p1,
+                      [[maybe_unused]] size_t p2,
+                      [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        const auto K = etl::dim<0>(kernel); // The number of kernels
+        const auto C = etl::dim<1>(kernel); // The number of channels
+
+        const auto k1 = etl::dim<2>(kernel);
+        const auto k2 = etl::dim<3>(kernel);
+        const auto k3 = etl::dim<4>(kernel);
+
+        kernel.ensure_cpu_up_to_date();
+
+        etl::dyn_matrix<value_t<I_T>, 2> kernels(K, C * k1 * k2 * k3);
+
+        for (size_t k = 0; k < K; ++k) {
+            for (size_t c = 0; c < C; ++c) {
+                std::reverse_copy(kernel(k)(c).memory_start(), kernel(k)(c).memory_end(), kernels.memory_start() + (k * C + c) * k1 * k2 * k3);
+            }
+        }
+
+        blas_conv5_valid_prepared(input, kernels, conv, k1, k2, k3, s1, s2, s3, p1, p2, p3);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv5_valid");
+    }
+}
+
+/*!
+ * \brief Compute a 5D valid convolution using a vectorized matrix multiplication kernel, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param s3 The stride of the third dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param p3 The padding of the third dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv5_valid_flipped([[maybe_unused]] I_T&& input,
+                              [[maybe_unused]] K_T&& kernel,
+                              [[maybe_unused]] C_T&& conv,
+                              [[maybe_unused]] size_t s1,
+                              [[maybe_unused]] size_t s2,
+                              [[maybe_unused]] size_t s3,
+                              [[maybe_unused]] size_t p1,
+                              [[maybe_unused]] size_t p2,
+                              [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        const auto K = etl::dim<0>(kernel); // The number of kernels
+        const auto C = etl::dim<1>(kernel); // The number of channels
+
+        const auto k1 = etl::dim<2>(kernel);
+        const auto k2 = etl::dim<3>(kernel);
+        const auto k3 = etl::dim<4>(kernel);
+
+        kernel.ensure_cpu_up_to_date();
+
+        // The flipped kernels are already laid out as the GEMM needs them
+        etl::dyn_matrix<value_t<I_T>, 2> kernels(K, C * k1 * k2 * k3);
+
+        direct_copy_n(kernel.memory_start(), kernels.memory_start(), K * C * k1 * k2 * k3);
+
+        blas_conv5_valid_prepared(input, kernels, conv, k1, k2, k3, s1, s2, s3, p1, p2, p3);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv5_valid_flipped");
+    }
+}
+
+/*!
+ * \brief Compute the backward pass of a 5D valid convolution using a vectorized matrix multiplication kernel
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param s3 The stride of the third dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param p3 The padding of the third dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv5_valid_back([[maybe_unused]] I_T&& input,
+                           [[maybe_unused]] K_T&& kernel,
+                           [[maybe_unused]] C_T&& conv,
+                           [[maybe_unused]] size_t s1,
+                           [[maybe_unused]] size_t s2,
+                           [[maybe_unused]] size_t s3,
+                           [[maybe_unused]] size_t p1,
+                           [[maybe_unused]] size_t p2,
+                           [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        const auto K = etl::dim<0>(kernel); // The number of kernels
+        const auto C = etl::dim<1>(kernel); // The number of channels
+
+        const auto k1 = etl::dim<2>(kernel);
+        const auto k2 = etl::dim<3>(kernel);
+        const auto k3 = etl::dim<4>(kernel);
+
+        kernel.ensure_cpu_up_to_date();
+
+        etl::dyn_matrix<value_t<I_T>, 2> kernels(C, K * k1 * k2 * k3);
+
+        for (size_t c = 0; c < C; ++c) {
+            for (size_t k = 0; k < K; ++k) {
+                std::reverse_copy(kernel(k)(c).memory_start(), kernel(k)(c).memory_end(), kernels.memory_start() + (c * K + k) * k1 * k2 * k3);
+            }
+        }
+
+        blas_conv5_valid_prepared(input, kernels, conv, k1, k2, k3, s1, s2, s3, p1, p2, p3);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv5_valid_back");
+    }
+}
+
+/*!
+ * \brief Compute the backward pass of a 5D valid convolution using a vectorized matrix multiplication kernel, with flipped kernels
+ * \param input The input matrix (the errors of the convolution)
+ * \param kernel The kernel matrix
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param s3 The stride of the third dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param p3 The padding of the third dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv5_valid_back_flipped([[maybe_unused]] I_T&& input,
+                                   [[maybe_unused]] K_T&& kernel,
+                                   [[maybe_unused]] C_T&& conv,
+                                   [[maybe_unused]] size_t s1,
+                                   [[maybe_unused]] size_t s2,
+                                   [[maybe_unused]] size_t s3,
+                                   [[maybe_unused]] size_t p1,
+                                   [[maybe_unused]] size_t p2,
+                                   [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        const auto K = etl::dim<0>(kernel); // The number of kernels
+        const auto C = etl::dim<1>(kernel); // The number of channels
+
+        const auto k1 = etl::dim<2>(kernel);
+        const auto k2 = etl::dim<3>(kernel);
+        const auto k3 = etl::dim<4>(kernel);
+
+        kernel.ensure_cpu_up_to_date();
+
+        etl::dyn_matrix<value_t<I_T>, 2> kernels(C, K * k1 * k2 * k3);
+
+        for (size_t c = 0; c < C; ++c) {
+            for (size_t k = 0; k < K; ++k) {
+                direct_copy_n(kernel(k)(c).memory_start(), kernels.memory_start() + (c * K + k) * k1 * k2 * k3, k1 * k2 * k3);
+            }
+        }
+
+        blas_conv5_valid_prepared(input, kernels, conv, k1, k2, k3, s1, s2, s3, p1, p2, p3);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv5_valid_back_flipped");
+    }
+}
+
+/*!
+ * \brief Compute the filter gradients of a 5D valid convolution, with prepared kernels, using a vectorized matrix multiplication kernel
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution), already flipped
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param s3 The stride of the third dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param p3 The padding of the third dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv5_valid_filter_prepared(I_T&& input, K_T&& kernel, C_T&& conv, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    using T = value_t<I_T>;
+
+    const auto N = etl::dim<0>(input); // The number of images
+    const auto K = etl::dim<0>(conv);  // The number of kernels
+    const auto C = etl::dim<1>(conv);  // The number of channels
+
+    const auto k1 = etl::dim<2>(kernel);
+    const auto k2 = etl::dim<3>(kernel);
+    const auto k3 = etl::dim<4>(kernel);
+
+    const auto f_size = etl::dim<2>(conv) * etl::dim<3>(conv) * etl::dim<4>(conv);
+
+    input.ensure_cpu_up_to_date();
+
+    auto batch_fun_c = [&](const size_t first, const size_t last) {
+        if (last - first) {
+            etl::dyn_matrix<T, 2> input_col(k1 * k2 * k3, f_size);
+            etl::dyn_matrix<T, 2> tmp_result(K, f_size);
+
+            for (size_t c = first; c < last; ++c) {
+                for (size_t i = 0; i < N; ++i) {
+                    vol2col_direct_tr(input_col, input(i)(c), k1, k2, k3, s1, s2, s3, p1, p2, p3);
+
+                    gemm_large_kernel_rr_to_r<default_vec>(kernel(i).memory_start(), input_col.memory_start(), tmp_result.memory_start(), K, f_size,
+                                                           k1 * k2 * k3, T(1), i ? T(1) : T(0));
+                }
+
+                for (size_t k = 0; k < K; ++k) {
+                    direct_copy_n(tmp_result.memory_start() + k * f_size, conv(k)(c).memory_start(), f_size);
+                }
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun_c, 0, C, 2UL);
+
+    conv.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the filter gradients of a 5D valid convolution using a vectorized matrix multiplication kernel
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param s3 The stride of the third dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param p3 The padding of the third dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv5_valid_filter([[maybe_unused]] I_T&& input,
+                             [[maybe_unused]] K_T&& kernel,
+                             [[maybe_unused]] C_T&& conv,
+                             [[maybe_unused]] size_t s1,
+                             [[maybe_unused]] size_t s2,
+                             [[maybe_unused]] size_t s3,
+                             [[maybe_unused]] size_t p1,
+                             [[maybe_unused]] size_t p2,
+                             [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        blas_conv5_valid_filter_prepared(input, common::flip_multi_3d(kernel), conv, s1, s2, s3, p1, p2, p3);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv5_valid_filter");
+    }
+}
+
+/*!
+ * \brief Compute the filter gradients of a 5D valid convolution using a vectorized matrix multiplication kernel, with flipped kernels
+ * \param input The input matrix
+ * \param kernel The kernel matrix (the errors of the convolution)
+ * \param conv The output matrix
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param s3 The stride of the third dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param p3 The padding of the third dimension
+ */
+template <typename I_T, typename K_T, typename C_T>
+void blas_conv5_valid_filter_flipped([[maybe_unused]] I_T&& input,
+                                     [[maybe_unused]] K_T&& kernel,
+                                     [[maybe_unused]] C_T&& conv,
+                                     [[maybe_unused]] size_t s1,
+                                     [[maybe_unused]] size_t s2,
+                                     [[maybe_unused]] size_t s3,
+                                     [[maybe_unused]] size_t p1,
+                                     [[maybe_unused]] size_t p2,
+                                     [[maybe_unused]] size_t p3) {
+    if constexpr (conv2_possible<vector_mode, I_T, K_T, C_T>) {
+        kernel.ensure_cpu_up_to_date();
+
+        blas_conv5_valid_filter_prepared(input, kernel, conv, s1, s2, s3, p1, p2, p3);
+    } else {
+        cpp_unreachable("Invalid call to vec::blas_conv5_valid_filter_flipped");
+    }
+}
+
 } //end of namespace etl::impl::vec
@@ -0,0 +1,207 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Epilogue of the vectorized row-major GEMM kernels.
+ *
+ * The epilogue is applied by the kernels on the results before they are
+ * written to C. This allows to fuse the scaling, the accumulation into C,
+ * the bias and the activation function with the matrix multiplication
+ * instead of going over C once more for each of these operations.
+ */
+
+#pragma once
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the given activation operator can be used in
+ * the epilogue of the vectorized GEMM kernels.
+ *
+ * \tparam V The vector mode
+ * \tparam Op The activation unary operator, void for none
+ */
+template <vector_mode_t V, typename Op>
+constexpr bool gemm_activation_vectorizable = Op::template vectorizable<V>;
+
+/*!
+ * \copydoc gemm_activation_vectorizable
+ */
+template <vector_mode_t V>
+constexpr bool gemm_activation_vectorizable<V, void> = true;
+
+/*!
+ * \brief Traits indicating if the vectorized GEMM with a fused epilogue is
+ * possible for the given expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam Op The activation unary operator, void for none
+ * \tparam A The lhs expression
+ * \tparam B The rhs expression
+ * \tparam C The result expression
+ */
+template <vector_mode_t V, typename Op, typename A, typename B, typename C>
+constexpr bool gemm_epilogue_possible = vec_enabled&& vectorize_impl&& all_homogeneous<A, B, C>&& all_vectorizable<V, A, B, C>&& all_row_major<A, B, C>&&
+                                            gemm_activation_vectorizable<V, Op>;
+
+/*!
+ * \brief Epilogue of the vectorized GEMM kernels.
+ *
+ * The final value of C is Op(alpha * (A * B) + beta * C + bias), where the
+ * bias is added to each row of C.
+ *
+ * \tparam V The vectorization mode
+ * \tparam T The value type
+ * \tparam Beta Indicates if the previous value of C is accumulated
+ * \tparam Bias Indicates if a bias is added to each row
+ * \tparam Op The activation unary operator, void for none
+ */
+template <typename V, typename T, bool Beta = false, bool Bias = false, typename Op = void>
+struct gemm_epilogue {
+    using vec_type  = V;                                ///< The vectorization mode
+    using simd_type = typename V::template vec_type<T>; ///< The type of the vectors
+
+    static constexpr bool activation = !std::is_void_v<Op>; ///< Indicates if an activation function is applied
+    static constexpr bool post       = Bias || activation;  ///< Indicates if something must be done after scaling
+
+    const T alpha; ///< The multiplicator of A * B
+    const T beta;  ///< The multiplicator of the previous value of C
+    const T* bias; ///< The bias vector (of the size of the columns of C)
+
+    /*!
+     * \brief Construct a new epilogue
+     * \param alpha The multiplicator of A * B
+     * \param beta The multiplicator of the previous value of C
+     * \param bias The bias vector
+     */
+    explicit gemm_epilogue(T alpha, T beta = T(0), const T* bias = nullptr)
+            : alpha(alpha), beta(beta), bias(bias), alpha_vec(vec_type::set(alpha)), beta_vec(vec_type::set(beta)) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Add the bias and apply the activation function on a vector of the
+     * given columns
+     * \param r The vector of values
+     * \param j The column of the first value
+     * \return the final values
+     */
+    ETL_STRONG_INLINE(simd_type) finish(simd_type r, [[maybe_unused]] size_t j) const {
+        if constexpr (Bias) {
+            r = vec_type::add(r, vec_type::loadu(bias + j));
+        }
+
+        if constexpr (activation) {
+            r = Op::template load<vec_type>(r);
+        }
+
+        return r;
+    }
+
+    /*!
+     * \brief Add the bias and apply the activation function on the value of
+     * the given column
+     * \param r The value
+     * \param j The column of the value
+     * \return the final value
+     */
+    ETL_STRONG_INLINE(T) finish(T r, [[maybe_unused]] size_t j) const {
+        if constexpr (Bias) {
+            r += bias[j];
+        }
+
+        if constexpr (activation) {
+            r = Op::apply(r);
+        }
+
+        return r;
+    }
+
+    /*!
+     * \brief Store the final values of a vector of results of A * B
+     * \param c The position in C
+     * \param j The column of the first value
+     * \param r The vector of results of A * B
+     */
+    ETL_STRONG_INLINE(void) storeu(T* c, size_t j, simd_type r) const {
+        r = vec_type::mul(alpha_vec, r);
+
+        if constexpr (Beta) {
+            r = vec_type::fmadd(beta_vec, vec_type::loadu(c), r);
+        }
+
+        if constexpr (post) {
+            r = finish(r, j);
+        }
+
+        vec_type::storeu(c, r);
+    }
+
+    /*!
+     * \brief Store the final value of a result of A * B
+     * \param c The position in C
+     * \param j The column of the value
+     * \param r The result of A * B
+     */
+    ETL_STRONG_INLINE(void) store(T* c, size_t j, T r) const {
+        r = alpha * r;
+
+        if constexpr (Beta) {
+            r += beta * *c;
+        }
+
+        if constexpr (post) {
+            r = finish(r, j);
+        }
+
+        *c = r;
+    }
+
+    /*!
+     * \brief Add the bias and apply the activation function in place on a
+     * block of C that has already been scaled and accumulated.
+     *
+     * This is used by the blocked kernels, once the block is completely
+     * computed and still in cache.
+     *
+     * \param c The C matrix
+     * \param N The number of columns of C
+     * \param i_first The first row of the block
+     * \param i_last The end of the rows of the block
+     * \param j_first The first column of the block
+     * \param j_last The end of the columns of the block
+     */
+    void apply([[maybe_unused]] T* c,
+               [[maybe_unused]] size_t N,
+               [[maybe_unused]] size_t i_first,
+               [[maybe_unused]] size_t i_last,
+               [[maybe_unused]] size_t j_first,
+               [[maybe_unused]] size_t j_last) const {
+        if constexpr (post) {
+            static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+            for (size_t i = i_first; i < i_last; ++i) {
+                size_t j = j_first;
+
+                for (; j + vec_size - 1 < j_last; j += vec_size) {
+                    vec_type::storeu(c + i * N + j, finish(vec_type::loadu(c + i * N + j), j));
+                }
+
+                for (; j < j_last; ++j) {
+                    c[i * N + j] = finish(c[i * N + j], j);
+                }
+            }
+        }
+    }
+
+private:
+    const simd_type alpha_vec; ///< The vector of alpha
+    const simd_type beta_vec;  ///< The vector of beta
+};
+
+} //end of namespace etl::impl::vec
@@ -27,12 +27,16 @@ namespace etl::impl::vec {
 
 /*!
  * \brief Optimized version of small GEMM for row major version
+ *
+ * The results are directly finished by the epilogue when they are stored.
+ *
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
+ * \param epilogue The epilogue to apply to the results
  */
-template <typename V, typename T>
-void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t M, size_t N, size_t K, T alpha) {
+template <typename V, typename T, typename E>
+void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t M, size_t N, size_t K, const E& epilogue) {
     using vec_type = V;
 
     static constexpr size_t vec_size = vec_type::template traits<T>::size;
@@ -41,8 +45,6 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
 
     size_t j = 0;
 
-    auto alpha_vec = vec_type::set(alpha);
-
     // As an optimization, we directly do the first iteration of the K-loop
     // since K cannot be zero. This avoids having to preset the vector with zero
 
@@ -76,14 +78,14 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r8 = vec_type::fmadd(a1, vec_type::loadu(b + k * N + j + vec_size * 7), r8);
             }
 
-            vec_type::storeu(c + i * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r1));
-            vec_type::storeu(c + i * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r2));
-            vec_type::storeu(c + i * N + j + 2 * vec_size, vec_type::mul(alpha_vec, r3));
-            vec_type::storeu(c + i * N + j + 3 * vec_size, vec_type::mul(alpha_vec, r4));
-            vec_type::storeu(c + i * N + j + 4 * vec_size, vec_type::mul(alpha_vec, r5));
-            vec_type::storeu(c + i * N + j + 5 * vec_size, vec_type::mul(alpha_vec, r6));
-            vec_type::storeu(c + i * N + j + 6 * vec_size, vec_type::mul(alpha_vec, r7));
-            vec_type::storeu(c + i * N + j + 7 * vec_size, vec_type::mul(alpha_vec, r8));
+            epilogue.storeu(c + i * N + j + 0 * vec_size, j + 0 * vec_size, r1);
+            epilogue.storeu(c + i * N + j + 1 * vec_size, j + 1 * vec_size, r2);
+            epilogue.storeu(c + i * N + j + 2 * vec_size, j + 2 * vec_size, r3);
+            epilogue.storeu(c + i * N + j + 3 * vec_size, j + 3 * vec_size, r4);
+            epilogue.storeu(c + i * N + j + 4 * vec_size, j + 4 * vec_size, r5);
+            epilogue.storeu(c + i * N + j + 5 * vec_size, j + 5 * vec_size, r6);
+            epilogue.storeu(c + i * N + j + 6 * vec_size, j + 6 * vec_size, r7);
+            epilogue.storeu(c + i * N + j + 7 * vec_size, j + 7 * vec_size, r8);
         }
     }
 #endif
@@ -146,17 +148,17 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r52 = vec_type::fmadd(a2, b5, r52);
             }
 
-            vec_type::storeu(c + (i + 0) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r11));
-            vec_type::storeu(c + (i + 0) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r21));
-            vec_type::storeu(c + (i + 0) * N + j + 2 * vec_size, vec_type::mul(alpha_vec, r31));
-            vec_type::storeu(c + (i + 0) * N + j + 3 * vec_size, vec_type::mul(alpha_vec, r41));
-            vec_type::storeu(c + (i + 0) * N + j + 4 * vec_size, vec_type::mul(alpha_vec, r51));
-
-            vec_type::storeu(c + (i + 1) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r12));
-            vec_type::storeu(c + (i + 1) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r22));
-            vec_type::storeu(c + (i + 1) * N + j + 2 * vec_size, vec_type::mul(alpha_vec, r32));
-            vec_type::storeu(c + (i + 1) * N + j + 3 * vec_size, vec_type::mul(alpha_vec, r42));
-            vec_type::storeu(c + (i + 1) * N + j + 4 * vec_size, vec_type::mul(alpha_vec, r52));
+            epilogue.storeu(c + (i + 0) * N + j + 0 * vec_size, j + 0 * vec_size, r11);
+            epilogue.storeu(c + (i + 0) * N + j + 1 * vec_size, j + 1 * vec_size, r21);
+            epilogue.storeu(c + (i + 0) * N + j + 2 * vec_size, j + 2 * vec_size, r31);
+            epilogue.storeu(c + (i + 0) * N + j + 3 * vec_size, j + 3 * vec_size, r41);
+            epilogue.storeu(c + (i + 0) * N + j + 4 * vec_size, j + 4 * vec_size, r51);
+
+            epilogue.storeu(c + (i + 1) * N + j + 0 * vec_size, j + 0 * vec_size, r12);
+            epilogue.storeu(c + (i + 1) * N + j + 1 * vec_size, j + 1 * vec_size, r22);
+            epilogue.storeu(c + (i + 1) * N + j + 2 * vec_size, j + 2 * vec_size, r32);
+            epilogue.storeu(c + (i + 1) * N + j + 3 * vec_size, j + 3 * vec_size, r42);
+            epilogue.storeu(c + (i + 1) * N + j + 4 * vec_size, j + 4 * vec_size, r52);
         }
 
         if (i < M) {
@@ -180,11 +182,11 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r51 = vec_type::fmadd(a1, vec_type::loadu(b + k * N + j + vec_size * 4), r51);
             }
 
-            vec_type::storeu(c + i * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r11));
-            vec_type::storeu(c + i * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r21));
-            vec_type::storeu(c + i * N + j + 2 * vec_size, vec_type::mul(alpha_vec, r31));
-            vec_type::storeu(c + i * N + j + 3 * vec_size, vec_type::mul(alpha_vec, r41));
-            vec_type::storeu(c + i * N + j + 4 * vec_size, vec_type::mul(alpha_vec, r51));
+            epilogue.storeu(c + i * N + j + 0 * vec_size, j + 0 * vec_size, r11);
+            epilogue.storeu(c + i * N + j + 1 * vec_size, j + 1 * vec_size, r21);
+            epilogue.storeu(c + i * N + j + 2 * vec_size, j + 2 * vec_size, r31);
+            epilogue.storeu(c + i * N + j + 3 * vec_size, j + 3 * vec_size, r41);
+            epilogue.storeu(c + i * N + j + 4 * vec_size, j + 4 * vec_size, r51);
         }
     }
 
@@ -237,15 +239,15 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r42 = vec_type::fmadd(a2, b4, r42);
             }
 
-            vec_type::storeu(c + (i + 0) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r11));
-            vec_type::storeu(c + (i + 0) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r21));
-            vec_type::storeu(c + (i + 0) * N + j + 2 * vec_size, vec_type::mul(alpha_vec, r31));
-            vec_type::storeu(c + (i + 0) * N + j + 3 * vec_size, vec_type::mul(alpha_vec, r41));
+            epilogue.storeu(c + (i + 0) * N + j + 0 * vec_size, j + 0 * vec_size, r11);
+            epilogue.storeu(c + (i + 0) * N + j + 1 * vec_size, j + 1 * vec_size, r21);
+            epilogue.storeu(c + (i + 0) * N + j + 2 * vec_size, j + 2 * vec_size, r31);
+            epilogue.storeu(c + (i + 0) * N + j + 3 * vec_size, j + 3 * vec_size, r41);
 
-            vec_type::storeu(c + (i + 1) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r12));
-            vec_type::storeu(c + (i + 1) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r22));
-            vec_type::storeu(c + (i + 1) * N + j + 2 * vec_size, vec_type::mul(alpha_vec, r32));
-            vec_type::storeu(c + (i + 1) * N + j + 3 * vec_size, vec_type::mul(alpha_vec, r42));
+            epilogue.storeu(c + (i + 1) * N + j + 0 * vec_size, j + 0 * vec_size, r12);
+            epilogue.storeu(c + (i + 1) * N + j + 1 * vec_size, j + 1 * vec_size, r22);
+            epilogue.storeu(c + (i + 1) * N + j + 2 * vec_size, j + 2 * vec_size, r32);
+            epilogue.storeu(c + (i + 1) * N + j + 3 * vec_size, j + 3 * vec_size, r42);
         }
 
         if (i < M) {
@@ -267,10 +269,10 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r41 = vec_type::fmadd(a1, vec_type::loadu(b + k * N + j + vec_size * 3), r41);
             }
 
-            vec_type::storeu(c + i * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r11));
-            vec_type::storeu(c + i * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r21));
-            vec_type::storeu(c + i * N + j + 2 * vec_size, vec_type::mul(alpha_vec, r31));
-            vec_type::storeu(c + i * N + j + 3 * vec_size, vec_type::mul(alpha_vec, r41));
+            epilogue.storeu(c + i * N + j + 0 * vec_size, j + 0 * vec_size, r11);
+            epilogue.storeu(c + i * N + j + 1 * vec_size, j + 1 * vec_size, r21);
+            epilogue.storeu(c + i * N + j + 2 * vec_size, j + 2 * vec_size, r31);
+            epilogue.storeu(c + i * N + j + 3 * vec_size, j + 3 * vec_size, r41);
         }
     }
 
@@ -315,13 +317,13 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r32 = vec_type::fmadd(a2, b3, r32);
             }
 
-            vec_type::storeu(c + (i + 0) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r11));
-            vec_type::storeu(c + (i + 0) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r21));
-            vec_type::storeu(c + (i + 0) * N + j + 2 * vec_size, vec_type::mul(alpha_vec, r31));
+            epilogue.storeu(c + (i + 0) * N + j + 0 * vec_size, j + 0 * vec_size, r11);
+            epilogue.storeu(c + (i + 0) * N + j + 1 * vec_size, j + 1 * vec_size, r21);
+            epilogue.storeu(c + (i + 0) * N + j + 2 * vec_size, j + 2 * vec_size, r31);
 
-            vec_type::storeu(c + (i + 1) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r12));
-            vec_type::storeu(c + (i + 1) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r22));
-            vec_type::storeu(c + (i + 1) * N + j + 2 * vec_size, vec_type::mul(alpha_vec, r32));
+            epilogue.storeu(c + (i + 1) * N + j + 0 * vec_size, j + 0 * vec_size, r12);
+            epilogue.storeu(c + (i + 1) * N + j + 1 * vec_size, j + 1 * vec_size, r22);
+            epilogue.storeu(c + (i + 1) * N + j + 2 * vec_size, j + 2 * vec_size, r32);
         }
 
         if (i < M) {
@@ -341,9 +343,9 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r31 = vec_type::fmadd(a1, vec_type::loadu(b + k * N + j + vec_size * 2), r31);
             }
 
-            vec_type::storeu(c + i * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r11));
-            vec_type::storeu(c + i * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r21));
-            vec_type::storeu(c + i * N + j + 2 * vec_size, vec_type::mul(alpha_vec, r31));
+            epilogue.storeu(c + i * N + j + 0 * vec_size, j + 0 * vec_size, r11);
+            epilogue.storeu(c + i * N + j + 1 * vec_size, j + 1 * vec_size, r21);
+            epilogue.storeu(c + i * N + j + 2 * vec_size, j + 2 * vec_size, r31);
         }
     }
 
@@ -392,17 +394,17 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r24 = vec_type::fmadd(a4, b2, r24);
             }
 
-            vec_type::storeu(c + (i + 0) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r11));
-            vec_type::storeu(c + (i + 0) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r21));
+            epilogue.storeu(c + (i + 0) * N + j + 0 * vec_size, j + 0 * vec_size, r11);
+            epilogue.storeu(c + (i + 0) * N + j + 1 * vec_size, j + 1 * vec_size, r21);
 
-            vec_type::storeu(c + (i + 1) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r12));
-            vec_type::storeu(c + (i + 1) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r22));
+            epilogue.storeu(c + (i + 1) * N + j + 0 * vec_size, j + 0 * vec_size, r12);
+            epilogue.storeu(c + (i + 1) * N + j + 1 * vec_size, j + 1 * vec_size, r22);
 
-            vec_type::storeu(c + (i + 2) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r13));
-            vec_type::storeu(c + (i + 2) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r23));
+            epilogue.storeu(c + (i + 2) * N + j + 0 * vec_size, j + 0 * vec_size, r13);
+            epilogue.storeu(c + (i + 2) * N + j + 1 * vec_size, j + 1 * vec_size, r23);
 
-            vec_type::storeu(c + (i + 3) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r14));
-            vec_type::storeu(c + (i + 3) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r24));
+            epilogue.storeu(c + (i + 3) * N + j + 0 * vec_size, j + 0 * vec_size, r14);
+            epilogue.storeu(c + (i + 3) * N + j + 1 * vec_size, j + 1 * vec_size, r24);
         }
 
         for (; i + 1 < M; i += 2) {
@@ -434,11 +436,11 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r22 = vec_type::fmadd(a2, b2, r22);
             }
 
-            vec_type::storeu(c + (i + 0) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r11));
-            vec_type::storeu(c + (i + 0) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r21));
+            epilogue.storeu(c + (i + 0) * N + j + 0 * vec_size, j + 0 * vec_size, r11);
+            epilogue.storeu(c + (i + 0) * N + j + 1 * vec_size, j + 1 * vec_size, r21);
 
-            vec_type::storeu(c + (i + 1) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r12));
-            vec_type::storeu(c + (i + 1) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r22));
+            epilogue.storeu(c + (i + 1) * N + j + 0 * vec_size, j + 0 * vec_size, r12);
+            epilogue.storeu(c + (i + 1) * N + j + 1 * vec_size, j + 1 * vec_size, r22);
         }
 
         if (i < M) {
@@ -462,8 +464,8 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r21 = vec_type::fmadd(a1, b2, r21);
             }
 
-            vec_type::storeu(c + (i + 0) * N + j + 0 * vec_size, vec_type::mul(alpha_vec, r11));
-            vec_type::storeu(c + (i + 0) * N + j + 1 * vec_size, vec_type::mul(alpha_vec, r21));
+            epilogue.storeu(c + (i + 0) * N + j + 0 * vec_size, j + 0 * vec_size, r11);
+            epilogue.storeu(c + (i + 0) * N + j + 1 * vec_size, j + 1 * vec_size, r21);
         }
     }
 
@@ -492,8 +494,8 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r2 = vec_type::fmadd(a2, b1, r2);
             }
 
-            vec_type::storeu(c + (i + 0) * N + j, vec_type::mul(alpha_vec, r1));
-            vec_type::storeu(c + (i + 1) * N + j, vec_type::mul(alpha_vec, r2));
+            epilogue.storeu(c + (i + 0) * N + j, j, r1);
+            epilogue.storeu(c + (i + 1) * N + j, j, r2);
         }
 
         if (i < M) {
@@ -509,7 +511,7 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r1 = vec_type::fmadd(a1, vec_type::loadu(b + k * N + j + vec_size * 0), r1);
             }
 
-            vec_type::storeu(c + (i + 0) * N + j, vec_type::mul(alpha_vec, r1));
+            epilogue.storeu(c + (i + 0) * N + j, j, r1);
         }
     }
 
@@ -535,10 +537,10 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r22 += a[(i + 1) * K + k] * b[k * N + j2];
             }
 
-            c[(i + 0) * N + j1] = alpha * r11;
-            c[(i + 0) * N + j2] = alpha * r21;
-            c[(i + 1) * N + j1] = alpha * r12;
-            c[(i + 1) * N + j2] = alpha * r22;
+            epilogue.store(c + (i + 0) * N + j1, j1, r11);
+            epilogue.store(c + (i + 0) * N + j2, j2, r21);
+            epilogue.store(c + (i + 1) * N + j1, j1, r12);
+            epilogue.store(c + (i + 1) * N + j2, j2, r22);
         }
 
         if (i < M) {
@@ -552,8 +554,8 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r2 += a[i * K + k] * b[k * N + j2];
             }
 
-            c[i * N + j1] = alpha * r1;
-            c[i * N + j2] = alpha * r2;
+            epilogue.store(c + i * N + j1, j1, r1);
+            epilogue.store(c + i * N + j2, j2, r2);
         }
     }
 
@@ -572,8 +574,8 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r2 += a[(i + 1) * K + k] * b[k * N + j];
             }
 
-            c[(i + 0) * N + j] = alpha * r1;
-            c[(i + 1) * N + j] = alpha * r2;
+            epilogue.store(c + (i + 0) * N + j, j, r1);
+            epilogue.store(c + (i + 1) * N + j, j, r2);
         }
 
         if (i < M) {
@@ -585,20 +587,26 @@ void gemm_small_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                 r1 += a[i * K + k] * b[k * N + j];
             }
 
-            c[i * N + j] = alpha * r1;
+            epilogue.store(c + i * N + j, j, r1);
         }
     }
 }
 
 /*!
  * \brief Optimized version of large GEMM for row major version
+ *
+ * Each block of C is finished by the epilogue once it is completely
+ * computed, while it is still in cache.
+ *
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
+ * \param alpha The multiplicator of A * B
  * \param beta The multipliying of the previous value
+ * \param epilogue The epilogue to apply to the blocks
  */
-template <typename V, typename T>
-void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t M, size_t N, size_t K, T alpha, T beta) {
+template <typename V, typename T, typename E>
+void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t M, size_t N, size_t K, T alpha, T beta, const E& epilogue) {
     using vec_type = V;
 
     static constexpr size_t vec_size = vec_type::template traits<T>::size;
@@ -607,8 +615,6 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
     const size_t m_block_size = 64;
     const size_t k_block_size = 128;
 
-    auto alpha_vec = vec_type::set(alpha);
-
     // Note: There is a small benefit to parallelize this
     // However, most of the parallel benefit is in larger matrices and the
     // larger algorithm
@@ -625,7 +631,7 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                         c[i * N + j] = 0;
                     }
                 }
-            } else {
+            } else if (beta != T(1.0)) {
                 for (size_t i = block_i; i < i_end; ++i) {
                     for (size_t j = block_j; j < j_end; ++j) {
                         c[i * N + j] = beta * c[i * N + j];
@@ -657,8 +663,8 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                         auto r24 = vec_type::loadu(c + (i + 1) * N + j3);
 
                         for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a[(i + 0) * K + k]);
-                            auto a2 = vec_type::set(a[(i + 1) * K + k]);
+                            auto a1 = vec_type::set(alpha * a[(i + 0) * K + k]);
+                            auto a2 = vec_type::set(alpha * a[(i + 1) * K + k]);
 
                             auto b1 = vec_type::loadu(b + k * N + j);
                             auto b2 = vec_type::loadu(b + k * N + j1);
@@ -676,14 +682,14 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                             r24 = vec_type::fmadd(a2, b4, r24);
                         }
 
-                        vec_type::storeu(c + (i + 0) * N + j, vec_type::mul(alpha_vec, r11));
-                        vec_type::storeu(c + (i + 0) * N + j1, vec_type::mul(alpha_vec, r12));
-                        vec_type::storeu(c + (i + 0) * N + j2, vec_type::mul(alpha_vec, r13));
-                        vec_type::storeu(c + (i + 0) * N + j3, vec_type::mul(alpha_vec, r14));
-                        vec_type::storeu(c + (i + 1) * N + j, vec_type::mul(alpha_vec, r21));
-                        vec_type::storeu(c + (i + 1) * N + j1, vec_type::mul(alpha_vec, r22));
-                        vec_type::storeu(c + (i + 1) * N + j2, vec_type::mul(alpha_vec, r23));
-                        vec_type::storeu(c + (i + 1) * N + j3, vec_type::mul(alpha_vec, r24));
+                        vec_type::storeu(c + (i + 0) * N + j, r11);
+                        vec_type::storeu(c + (i + 0) * N + j1, r12);
+                        vec_type::storeu(c + (i + 0) * N + j2, r13);
+                        vec_type::storeu(c + (i + 0) * N + j3, r14);
+                        vec_type::storeu(c + (i + 1) * N + j, r21);
+                        vec_type::storeu(c + (i + 1) * N + j1, r22);
+                        vec_type::storeu(c + (i + 1) * N + j2, r23);
+                        vec_type::storeu(c + (i + 1) * N + j3, r24);
                     }
 
                     if (i < i_end) {
@@ -693,7 +699,7 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                         auto r4 = vec_type::loadu(c + (i + 0) * N + j3);
 
                         for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a[(i + 0) * K + k]);
+                            auto a1 = vec_type::set(alpha * a[(i + 0) * K + k]);
 
                             auto b1 = vec_type::loadu(b + k * N + j);
                             auto b2 = vec_type::loadu(b + k * N + j1);
@@ -706,10 +712,10 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                             r4 = vec_type::fmadd(a1, b4, r4);
                         }
 
-                        vec_type::storeu(c + (i + 0) * N + j, vec_type::mul(alpha_vec, r1));
-                        vec_type::storeu(c + (i + 0) * N + j1, vec_type::mul(alpha_vec, r2));
-                        vec_type::storeu(c + (i + 0) * N + j2, vec_type::mul(alpha_vec, r3));
-                        vec_type::storeu(c + (i + 0) * N + j3, vec_type::mul(alpha_vec, r4));
+                        vec_type::storeu(c + (i + 0) * N + j, r1);
+                        vec_type::storeu(c + (i + 0) * N + j1, r2);
+                        vec_type::storeu(c + (i + 0) * N + j2, r3);
+                        vec_type::storeu(c + (i + 0) * N + j3, r4);
                     }
                 }
 
@@ -732,10 +738,10 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                         auto r42 = vec_type::loadu(c + (i + 3) * N + j1);
 
                         for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a[(i + 0) * K + k]);
-                            auto a2 = vec_type::set(a[(i + 1) * K + k]);
-                            auto a3 = vec_type::set(a[(i + 2) * K + k]);
-                            auto a4 = vec_type::set(a[(i + 3) * K + k]);
+                            auto a1 = vec_type::set(alpha * a[(i + 0) * K + k]);
+                            auto a2 = vec_type::set(alpha * a[(i + 1) * K + k]);
+                            auto a3 = vec_type::set(alpha * a[(i + 2) * K + k]);
+                            auto a4 = vec_type::set(alpha * a[(i + 3) * K + k]);
 
                             auto b1 = vec_type::loadu(b + k * N + j);
                             auto b2 = vec_type::loadu(b + k * N + j1);
@@ -753,14 +759,14 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                             r42 = vec_type::fmadd(a4, b2, r42);
                         }
 
-                        vec_type::storeu(c + (i + 0) * N + j, vec_type::mul(alpha_vec, r11));
-                        vec_type::storeu(c + (i + 0) * N + j1, vec_type::mul(alpha_vec, r12));
-                        vec_type::storeu(c + (i + 1) * N + j, vec_type::mul(alpha_vec, r21));
-                        vec_type::storeu(c + (i + 1) * N + j1, vec_type::mul(alpha_vec, r22));
-                        vec_type::storeu(c + (i + 2) * N + j, vec_type::mul(alpha_vec, r31));
-                        vec_type::storeu(c + (i + 2) * N + j1, vec_type::mul(alpha_vec, r32));
-                        vec_type::storeu(c + (i + 3) * N + j, vec_type::mul(alpha_vec, r41));
-                        vec_type::storeu(c + (i + 3) * N + j1, vec_type::mul(alpha_vec, r42));
+                        vec_type::storeu(c + (i + 0) * N + j, r11);
+                        vec_type::storeu(c + (i + 0) * N + j1, r12);
+                        vec_type::storeu(c + (i + 1) * N + j, r21);
+                        vec_type::storeu(c + (i + 1) * N + j1, r22);
+                        vec_type::storeu(c + (i + 2) * N + j, r31);
+                        vec_type::storeu(c + (i + 2) * N + j1, r32);
+                        vec_type::storeu(c + (i + 3) * N + j, r41);
+                        vec_type::storeu(c + (i + 3) * N + j1, r42);
                     }
 
                     for (; i + 2 - 1 < i_end; i += 2) {
@@ -771,8 +777,8 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                         auto r22 = vec_type::loadu(c + (i + 1) * N + j1);
 
                         for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a[(i + 0) * K + k]);
-                            auto a2 = vec_type::set(a[(i + 1) * K + k]);
+                            auto a1 = vec_type::set(alpha * a[(i + 0) * K + k]);
+                            auto a2 = vec_type::set(alpha * a[(i + 1) * K + k]);
 
                             auto b1 = vec_type::loadu(b + k * N + j);
                             auto b2 = vec_type::loadu(b + k * N + j1);
@@ -784,10 +790,10 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                             r22 = vec_type::fmadd(a2, b2, r22);
                         }
 
-                        vec_type::storeu(c + (i + 0) * N + j, vec_type::mul(alpha_vec, r11));
-                        vec_type::storeu(c + (i + 0) * N + j1, vec_type::mul(alpha_vec, r12));
-                        vec_type::storeu(c + (i + 1) * N + j, vec_type::mul(alpha_vec, r21));
-                        vec_type::storeu(c + (i + 1) * N + j1, vec_type::mul(alpha_vec, r22));
+                        vec_type::storeu(c + (i + 0) * N + j, r11);
+                        vec_type::storeu(c + (i + 0) * N + j1, r12);
+                        vec_type::storeu(c + (i + 1) * N + j, r21);
+                        vec_type::storeu(c + (i + 1) * N + j1, r22);
                     }
 
                     if (i < i_end) {
@@ -795,7 +801,7 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                         auto r2 = vec_type::loadu(c + (i + 0) * N + j1);
 
                         for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a[(i + 0) * K + k]);
+                            auto a1 = vec_type::set(alpha * a[(i + 0) * K + k]);
 
                             auto b1 = vec_type::loadu(b + k * N + j);
                             auto b2 = vec_type::loadu(b + k * N + j1);
@@ -804,8 +810,8 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                             r2 = vec_type::fmadd(a1, b2, r2);
                         }
 
-                        vec_type::storeu(c + (i + 0) * N + j, vec_type::mul(alpha_vec, r1));
-                        vec_type::storeu(c + (i + 0) * N + j1, vec_type::mul(alpha_vec, r2));
+                        vec_type::storeu(c + (i + 0) * N + j, r1);
+                        vec_type::storeu(c + (i + 0) * N + j1, r2);
                     }
                 }
 
@@ -814,12 +820,12 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                         auto r1 = vec_type::loadu(c + (i + 0) * N + j);
 
                         for (size_t k = block_k; k < k_end; ++k) {
-                            auto a1 = vec_type::set(a[(i + 0) * K + k]);
+                            auto a1 = vec_type::set(alpha * a[(i + 0) * K + k]);
                             auto b1 = vec_type::loadu(b + k * N + j);
                             r1      = vec_type::fmadd(a1, b1, r1);
                         }
 
-                        vec_type::storeu(c + (i + 0) * N + j, vec_type::mul(alpha_vec, r1));
+                        vec_type::storeu(c + (i + 0) * N + j, r1);
                     }
                 }
 
@@ -828,17 +834,32 @@ void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t
                         auto value = c[i * N + j];
 
                         for (size_t k = block_k; k < k_end; ++k) {
-                            value += a[i * K + k] * b[k * N + j];
+                            value += alpha * a[i * K + k] * b[k * N + j];
                         }
 
-                        c[i * N + j] = alpha * value;
+                        c[i * N + j] = value;
                     }
                 }
             }
+
+            epilogue.apply(c, N, block_i, i_end, block_j, j_end);
         }
     }
 }
 
+/*!
+ * \brief Optimized version of large GEMM for row major version
+ * \param a The lhs matrix
+ * \param b The rhs matrix
+ * \param c The result matrix
+ * \param alpha The multiplicator of A * B
+ * \param beta The multipliying of the previous value
+ */
+template <typename V, typename T>
+void gemm_large_kernel_rr_to_r(const T* a, const T* b, T* ETL_RESTRICT c, size_t M, size_t N, size_t K, T alpha, T beta) {
+    gemm_large_kernel_rr_to_r<V>(a, b, c, M, N, K, alpha, beta, gemm_epilogue<V, T>(alpha, beta));
+}
+
 template <size_t vec_size>
 inline constexpr size_t prev_vec_block(size_t value) noexcept {
     return value - (value % vec_size);
@@ -849,10 +870,12 @@ inline constexpr size_t prev_vec_block(size_t value) noexcept {
  * \param a The lhs matrix
  * \param b The rhs matrix
  * \param c The result matrix
+ * \param alpha The multiplicator of A * B
  * \param beta The multipliying of the previous value
+ * \param epilogue The epilogue to apply to each panel of columns
  */
-template <typename V, typename T>
-void gemm_large_kernel_rr_to_r_temp(const T* a, const T* b, T* ETL_RESTRICT c, size_t M, size_t N, size_t K, T alpha, T beta) {
+template <typename V, typename T, typename E>
+void gemm_large_kernel_rr_to_r_temp(const T* a, const T* b, T* ETL_RESTRICT c, size_t M, size_t N, size_t K, T alpha, T beta, const E& epilogue) {
     using vec_type = V;
 
     constexpr size_t vec_size = vec_type::template traits<T>::size;
@@ -866,7 +889,7 @@ void gemm_large_kernel_rr_to_r_temp(const T* a, const T* b, T* ETL_RESTRICT c, s
 
     if (beta == T(0)) {
         C = 0;
-    } else {
+    } else if (beta != T(1)) {
         C = beta * C;
     }
 
@@ -1188,7 +1211,7 @@ void gemm_large_kernel_rr_to_r_temp(const T* a, const T* b, T* ETL_RESTRICT c, s
                 }
             }
 
-            size_t jj     = 0;
+            size_t jj     = jfirst;
             size_t jblock = 0;
 
             for (; jj < jlast; jj += jblock) {
@@ -1270,6 +1293,8 @@ void gemm_large_kernel_rr_to_r_temp(const T* a, const T* b, T* ETL_RESTRICT c, s
                 }
             }
         }
+
+        epilogue.apply(c, N, 0, M, jfirst, jlast);
     };
 
     engine_dispatch_1d(batch_fun_j, 0, N, J_BLOCK);
@@ -1277,7 +1302,8 @@ void gemm_large_kernel_rr_to_r_temp(const T* a, const T* b, T* ETL_RESTRICT c, s
 
 /*!
  * \brief Vectorized implementation of row-major matrix - row-major matrix
- * multiplication and assignment into a row-major matrix.
+ * multiplication and assignment into a row-major matrix, with the given
+ * epilogue fused into the kernels.
  *
  * \param a The lhs matrix
  * \param b The rhs matrix
@@ -1286,21 +1312,39 @@ void gemm_large_kernel_rr_to_r_temp(const T* a, const T* b, T* ETL_RESTRICT c, s
  * \param M The number of rows of the matrix A and rows of the matrix C
  * \param N The number of columns of the matrix B and columns of the matrix C
  * \param K The number of columns of the matrix A and rows of the matrix B
+ * \param epilogue The epilogue (scaling, accumulation, bias and activation)
  */
-template <typename T>
-void gemm_rr_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K, T alpha) {
+template <typename T, typename E>
+void gemm_rr_to_r_epilogue(const T* a, const T* b, T* c, size_t M, size_t N, size_t K, const E& epilogue) {
     cpp_assert(vec_enabled, "At least one vector mode must be enabled for impl::VEC");
     cpp_assert(vectorize_impl, "vectorize_impl must be enabled for impl::VEC");
 
     // Dispatch to the best kernel
 
     if (K * N <= gemm_rr_small_threshold) {
-        gemm_small_kernel_rr_to_r<default_vec>(a, b, c, M, N, K, alpha);
+        gemm_small_kernel_rr_to_r<default_vec>(a, b, c, M, N, K, epilogue);
     } else if (K * N <= gemm_rr_medium_threshold) {
-        gemm_large_kernel_rr_to_r<default_vec>(a, b, c, M, N, K, alpha, T(0));
+        gemm_large_kernel_rr_to_r<default_vec>(a, b, c, M, N, K, epilogue.alpha, epilogue.beta, epilogue);
     } else {
-        gemm_large_kernel_rr_to_r_temp<default_vec>(a, b, c, M, N, K, alpha, T(0));
+        gemm_large_kernel_rr_to_r_temp<default_vec>(a, b, c, M, N, K, epilogue.alpha, epilogue.beta, epilogue);
     }
 }
 
+/*!
+ * \brief Vectorized implementation of row-major matrix - row-major matrix
+ * multiplication and assignment into a row-major matrix.
+ *
+ * \param a The lhs matrix
+ * \param b The rhs matrix
+ * \param c The result matrix
+ *
+ * \param M The number of rows of the matrix A and rows of the matrix C
+ * \param N The number of columns of the matrix B and columns of the matrix C
+ * \param K The number of columns of the matrix A and rows of the matrix B
+ */
+template <typename T>
+void gemm_rr_to_r(const T* a, const T* b, T* c, size_t M, size_t N, size_t K, T alpha) {
+    gemm_rr_to_r_epilogue(a, b, c, M, N, K, gemm_epilogue<default_vec, T>(alpha));
+}
+
 } //end of namespace etl::impl::vec
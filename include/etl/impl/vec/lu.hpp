@@ -0,0 +1,51 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the blocked LU decomposition and of
+ * the associated solver.
+ *
+ * Only the updates of the trailing matrices (C -= A * B) are vectorized,
+ * they are where almost all the time is spent. The panels and the diagonal
+ * blocks are done with the standard implementation.
+ */
+
+#pragma once
+
+#include "etl/impl/std/lu.hpp"
+#include "etl/impl/vec/trsm.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized LU decomposition is possible
+ * for the given value type.
+ *
+ * \tparam V The vector mode
+ * \tparam T The value type
+ */
+template <vector_mode_t V, typename T>
+constexpr bool lu_possible = trsm_possible<V, T>;
+
+/*!
+ * \copydoc etl::impl::standard::lu_factor
+ */
+template <typename T>
+bool lu_factor(T* a, size_t* piv, size_t n) {
+    return etl::impl::standard::detail::lu_blocked(a, piv, n, [](auto&&... args) { detail::block_update<default_vec>(args...); });
+}
+
+/*!
+ * \copydoc etl::impl::standard::lu_solve
+ */
+template <typename T>
+void lu_solve(const T* lu, const size_t* piv, T* b, size_t n, size_t m) {
+    etl::impl::standard::detail::lu_solve_blocked(lu, piv, b, n, m, [](auto&&... args) { detail::block_update<default_vec>(args...); });
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,193 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the Mean Squared Error reduction
+ *
+ * The loss and the error are reduced over ranges of elements, each range
+ * being possibly handled by a different thread. When both are needed, they
+ * are computed in the same pass.
+ */
+
+#pragma once
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized MSE is possible for the given
+ * expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam O The output expression
+ * \tparam L The labels expression
+ */
+template <vector_mode_t V, typename O, typename L>
+constexpr bool mse_possible = vec_enabled&& vectorize_impl&& all_homogeneous<O, L>&& all_floating<O, L>&& all_vectorizable<V, O, L>&& all_row_major<O, L>;
+
+namespace detail {
+
+/*!
+ * \brief Compute the squared and the absolute differences between the output
+ * and the labels over a range
+ * \param output The output
+ * \param labels The labels
+ * \param first The first element of the range
+ * \param last The end of the range
+ * \tparam Loss Indicates if the loss must be computed
+ * \tparam Error Indicates if the error must be computed
+ * \return The unscaled loss and error over the range
+ */
+template <typename V, bool Loss, bool Error, typename T>
+std::pair<T, T> mse_kernel(const T* output, const T* labels, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto zero = vec_type::template zero<T>();
+
+    auto r1 = vec_type::template zero<T>();
+    auto r2 = vec_type::template zero<T>();
+    auto r3 = vec_type::template zero<T>();
+    auto r4 = vec_type::template zero<T>();
+
+    size_t i = first;
+
+    for (; i + 2 * vec_size - 1 < last; i += 2 * vec_size) {
+        auto d1 = vec_type::sub(vec_type::loadu(output + i), vec_type::loadu(labels + i));
+        auto d2 = vec_type::sub(vec_type::loadu(output + i + vec_size), vec_type::loadu(labels + i + vec_size));
+
+        if constexpr (Loss) {
+            r1 = vec_type::fmadd(d1, d1, r1);
+            r2 = vec_type::fmadd(d2, d2, r2);
+        }
+
+        if constexpr (Error) {
+            r3 = vec_type::add(r3, vec_type::max(d1, vec_type::sub(zero, d1)));
+            r4 = vec_type::add(r4, vec_type::max(d2, vec_type::sub(zero, d2)));
+        }
+    }
+
+    for (; i + vec_size - 1 < last; i += vec_size) {
+        auto d1 = vec_type::sub(vec_type::loadu(output + i), vec_type::loadu(labels + i));
+
+        if constexpr (Loss) {
+            r1 = vec_type::fmadd(d1, d1, r1);
+        }
+
+        if constexpr (Error) {
+            r3 = vec_type::add(r3, vec_type::max(d1, vec_type::sub(zero, d1)));
+        }
+    }
+
+    T loss  = vec_type::hadd(vec_type::add(r1, r2));
+    T error = vec_type::hadd(vec_type::add(r3, r4));
+
+    for (; i < last; ++i) {
+        const T d = output[i] - labels[i];
+
+        if constexpr (Loss) {
+            loss += d * d;
+        }
+
+        if constexpr (Error) {
+            error += std::abs(d);
+        }
+    }
+
+    return std::make_pair(loss, error);
+}
+
+/*!
+ * \brief Reduce the output and labels with the MSE kernel
+ * \param output The output expression
+ * \param labels The labels expression
+ * \tparam Loss Indicates if the loss must be computed
+ * \tparam Error Indicates if the error must be computed
+ * \return The unscaled loss and error
+ */
+template <bool Loss, bool Error, typename O, typename L>
+std::pair<value_t<O>, value_t<O>> mse_reduce(const O& output, const L& labels) {
+    using T = value_t<O>;
+
+    output.ensure_cpu_up_to_date();
+    labels.ensure_cpu_up_to_date();
+
+    const T* o = output.memory_start();
+    const T* l = labels.memory_start();
+
+    std::pair<T, T> acc(0, 0);
+
+    auto acc_functor = [&acc](std::pair<T, T> value) {
+        acc.first += value.first;
+        acc.second += value.second;
+    };
+
+    auto batch_fun = [o, l](size_t first, size_t last) { return mse_kernel<default_vec, Loss, Error>(o, l, first, last); };
+
+    engine_dispatch_1d_acc<std::pair<T, T>>(batch_fun, acc_functor, 0, etl::size(output), vec_sum_parallel_threshold);
+
+    return acc;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the Mean Squared Error loss of the output and labels
+ * \param output The output expression
+ * \param labels The labels expression
+ * \param scale The scale to apply to the loss
+ * \return The MSE loss
+ */
+template <typename O, typename L>
+value_t<O> mse_loss([[maybe_unused]] const O& output, [[maybe_unused]] const L& labels, [[maybe_unused]] value_t<O> scale) {
+    if constexpr (mse_possible<vector_mode, O, L>) {
+        return scale * detail::mse_reduce<true, false>(output, labels).first;
+    } else {
+        cpp_unreachable("Invalid call to vec::mse_loss");
+    }
+}
+
+/*!
+ * \brief Compute the Mean Squared Error error of the output and labels
+ * \param output The output expression
+ * \param labels The labels expression
+ * \param scale The scale to apply to the error
+ * \return The MSE error
+ */
+template <typename O, typename L>
+value_t<O> mse_error([[maybe_unused]] const O& output, [[maybe_unused]] const L& labels, [[maybe_unused]] value_t<O> scale) {
+    if constexpr (mse_possible<vector_mode, O, L>) {
+        return scale * detail::mse_reduce<false, true>(output, labels).second;
+    } else {
+        cpp_unreachable("Invalid call to vec::mse_error");
+    }
+}
+
+/*!
+ * \brief Compute the Mean Squared Error loss and error of the output and
+ * labels
+ * \param output The output expression
+ * \param labels The labels expression
+ * \param alpha The scale to apply to the loss
+ * \param beta The scale to apply to the error
+ * \return The MSE loss and error
+ */
+template <typename O, typename L>
+std::pair<value_t<O>, value_t<O>> mse([[maybe_unused]] const O& output,
+                                      [[maybe_unused]] const L& labels,
+                                      [[maybe_unused]] value_t<O> alpha,
+                                      [[maybe_unused]] value_t<O> beta) {
+    if constexpr (mse_possible<vector_mode, O, L>) {
+        auto result = detail::mse_reduce<true, true>(output, labels);
+        return std::make_pair(alpha * result.first, beta * result.second);
+    } else {
+        cpp_unreachable("Invalid call to vec::mse");
+    }
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,763 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementations of the 2D pooling, of its derivative and
+ * of its upsampling.
+ *
+ * Every image of the input (all the leading dimensions are flattened) is
+ * pooled independently, which allows to parallelize over batch and
+ * channels. For each output row, the rows of the pooling window are first
+ * reduced together with vector instructions and the reduced row is then
+ * reduced horizontally. The 2x2 and 3x3 stride-2 windows have their own
+ * kernels.
+ *
+ * Padded pooling is delegated to the standard implementation.
+ */
+
+#pragma once
+
+#include "etl/impl/std/max_pooling.hpp"
+#include "etl/impl/std/avg_pooling.hpp"
+#include "etl/impl/std/max_pooling_upsample.hpp"
+#include "etl/impl/std/avg_pooling_upsample.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if vectorized pooling is possible for the given
+ * expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam E The expressions
+ */
+template <vector_mode_t V, typename... E>
+constexpr bool pool_possible = vec_enabled&& vectorize_impl&& all_homogeneous<E...>&& all_floating<E...>&& all_vectorizable<V, E...>&& all_row_major<E...>;
+
+namespace detail {
+
+/*!
+ * \brief Reduce c1 consecutive rows into a single row
+ * \param in The first row to reduce
+ * \param n2 The distance between two rows
+ * \param c1 The number of rows to reduce
+ * \param width The number of columns to reduce
+ * \param buffer The output row
+ * \tparam Max true for a max reduction, false for a sum reduction
+ */
+template <typename V, bool Max, typename T>
+void pool_rows(const T* in, size_t n2, size_t c1, size_t width, T* buffer) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto op = [](auto a, auto b) {
+        if constexpr (Max) {
+            return vec_type::max(a, b);
+        } else {
+            return vec_type::add(a, b);
+        }
+    };
+
+    size_t x = 0;
+
+    for (; x + 2 * vec_size - 1 < width; x += 2 * vec_size) {
+        auto r1 = vec_type::loadu(in + x);
+        auto r2 = vec_type::loadu(in + x + vec_size);
+
+        for (size_t ii = 1; ii < c1; ++ii) {
+            r1 = op(r1, vec_type::loadu(in + ii * n2 + x));
+            r2 = op(r2, vec_type::loadu(in + ii * n2 + x + vec_size));
+        }
+
+        vec_type::storeu(buffer + x, r1);
+        vec_type::storeu(buffer + x + vec_size, r2);
+    }
+
+    for (; x + vec_size - 1 < width; x += vec_size) {
+        auto r1 = vec_type::loadu(in + x);
+
+        for (size_t ii = 1; ii < c1; ++ii) {
+            r1 = op(r1, vec_type::loadu(in + ii * n2 + x));
+        }
+
+        vec_type::storeu(buffer + x, r1);
+    }
+
+    for (; x < width; ++x) {
+        auto r1 = in[x];
+
+        for (size_t ii = 1; ii < c1; ++ii) {
+            if constexpr (Max) {
+                r1 = std::max(r1, in[ii * n2 + x]);
+            } else {
+                r1 += in[ii * n2 + x];
+            }
+        }
+
+        buffer[x] = r1;
+    }
+}
+
+/*!
+ * \brief Reduce the windows of an already vertically reduced row
+ * \param buffer The vertically reduced row
+ * \param out The output row
+ * \param o2 The number of output columns
+ * \param c2 The width of the pooling window
+ * \param s2 The horizontal stride
+ * \param div The divisor of the window (only used for average)
+ * \tparam Max true for a max reduction, false for an average reduction
+ */
+template <typename V, bool Max, typename T>
+void pool_columns(const T* buffer, T* out, size_t o2, size_t c2, size_t s2, T div) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t j = 0;
+
+    // With a unit stride, the windows of consecutive outputs are contiguous
+    if (s2 == 1) {
+        auto vdiv = vec_type::set(div);
+
+        for (; j + vec_size - 1 < o2; j += vec_size) {
+            auto r1 = vec_type::loadu(buffer + j);
+
+            for (size_t jj = 1; jj < c2; ++jj) {
+                if constexpr (Max) {
+                    r1 = vec_type::max(r1, vec_type::loadu(buffer + j + jj));
+                } else {
+                    r1 = vec_type::add(r1, vec_type::loadu(buffer + j + jj));
+                }
+            }
+
+            if constexpr (Max) {
+                vec_type::storeu(out + j, r1);
+            } else {
+                vec_type::storeu(out + j, vec_type::div(r1, vdiv));
+            }
+        }
+    }
+
+    for (; j < o2; ++j) {
+        auto r1 = buffer[j * s2];
+
+        for (size_t jj = 1; jj < c2; ++jj) {
+            if constexpr (Max) {
+                r1 = std::max(r1, buffer[j * s2 + jj]);
+            } else {
+                r1 += buffer[j * s2 + jj];
+            }
+        }
+
+        if constexpr (Max) {
+            out[j] = r1;
+        } else {
+            out[j] = r1 / div;
+        }
+    }
+}
+
+/*!
+ * \brief Pool a single image with a 2x2 window and a stride of 2
+ * \param in The input image
+ * \param out The output image
+ * \param n2 The number of columns of the input
+ * \param o1 The number of rows of the output
+ * \param o2 The number of columns of the output
+ * \param buffer A row buffer of at least n2 elements
+ */
+template <typename V, bool Max, typename T>
+void pool_image_2x2s2(const T* in, T* out, size_t n2, size_t o1, size_t o2, T* buffer) {
+    for (size_t i = 0; i < o1; ++i) {
+        pool_rows<V, Max>(in + 2 * i * n2, n2, 2, 2 * o2, buffer);
+
+        T* out_row = out + i * o2;
+
+        for (size_t j = 0; j < o2; ++j) {
+            if constexpr (Max) {
+                out_row[j] = std::max(buffer[2 * j], buffer[2 * j + 1]);
+            } else {
+                out_row[j] = (buffer[2 * j] + buffer[2 * j + 1]) / T(4);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Pool a single image with a 3x3 window and a stride of 2
+ * \param in The input image
+ * \param out The output image
+ * \param n2 The number of columns of the input
+ * \param o1 The number of rows of the output
+ * \param o2 The number of columns of the output
+ * \param buffer A row buffer of at least n2 elements
+ */
+template <typename V, bool Max, typename T>
+void pool_image_3x3s2(const T* in, T* out, size_t n2, size_t o1, size_t o2, T* buffer) {
+    for (size_t i = 0; i < o1; ++i) {
+        pool_rows<V, Max>(in + 2 * i * n2, n2, 3, 2 * o2 + 1, buffer);
+
+        T* out_row = out + i * o2;
+
+        for (size_t j = 0; j < o2; ++j) {
+            if constexpr (Max) {
+                out_row[j] = std::max(std::max(buffer[2 * j], buffer[2 * j + 1]), buffer[2 * j + 2]);
+            } else {
+                out_row[j] = (buffer[2 * j] + buffer[2 * j + 1] + buffer[2 * j + 2]) / T(9);
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Pool a single image with any window and stride
+ * \param in The input image
+ * \param out The output image
+ * \param n2 The number of columns of the input
+ * \param o1 The number of rows of the output
+ * \param o2 The number of columns of the output
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param buffer A row buffer of at least n2 elements
+ */
+template <typename V, bool Max, typename T>
+void pool_image(const T* in, T* out, size_t n2, size_t o1, size_t o2, size_t c1, size_t c2, size_t s1, size_t s2, T* buffer) {
+    const size_t width = (o2 - 1) * s2 + c2;
+    const T div        = T(c1 * c2);
+
+    for (size_t i = 0; i < o1; ++i) {
+        pool_rows<V, Max>(in + i * s1 * n2, n2, c1, width, buffer);
+        pool_columns<V, Max>(buffer, out + i * o2, o2, c2, s2, div);
+    }
+}
+
+/*!
+ * \brief Pool all the images of x into y, in parallel
+ * \param x The expression to pool
+ * \param y The expression in which to store the result
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \tparam Max true for max pooling, false for average pooling
+ */
+template <typename V, bool Max, typename X, typename Y>
+void pool_2d(const X& x, Y&& y, size_t c1, size_t c2, size_t s1, size_t s2) {
+    using T = value_t<X>;
+
+    static constexpr size_t D = decay_traits<X>::dimensions();
+
+    const size_t n1 = etl::dim(x, D - 2);
+    const size_t n2 = etl::dim(x, D - 1);
+    const size_t o1 = etl::dim(y, D - 2);
+    const size_t o2 = etl::dim(y, D - 1);
+    const size_t B  = etl::size(x) / (n1 * n2);
+
+    x.ensure_cpu_up_to_date();
+
+    const T* in = x.memory_start();
+    T* out      = y.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        etl::dyn_vector<T> buffer(n2);
+
+        for (size_t b = first; b < last; ++b) {
+            const T* in_b = in + b * n1 * n2;
+            T* out_b      = out + b * o1 * o2;
+
+            if (c1 == 2 && c2 == 2 && s1 == 2 && s2 == 2) {
+                pool_image_2x2s2<V, Max>(in_b, out_b, n2, o1, o2, buffer.memory_start());
+            } else if (c1 == 3 && c2 == 3 && s1 == 2 && s2 == 2) {
+                pool_image_3x3s2<V, Max>(in_b, out_b, n2, o1, o2, buffer.memory_start());
+            } else {
+                pool_image<V, Max>(in_b, out_b, n2, o1, o2, c1, c2, s1, s2, buffer.memory_start());
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, B, 2UL);
+
+    y.invalidate_gpu();
+    y.validate_cpu();
+}
+
+/*!
+ * \brief Upsample a single image of the errors (or the derivative) of a 2D pooling
+ * \param in The input image of the pooling
+ * \param out The output image of the pooling
+ * \param errors The errors image
+ * \param m The output image
+ * \param n1 The number of rows of the input
+ * \param n2 The number of columns of the input
+ * \param o1 The number of rows of the output
+ * \param o2 The number of columns of the output
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ * \param out_row A row buffer of at least n2 elements
+ * \param err_row A row buffer of at least n2 elements
+ * \tparam Max true for max pooling, false for average pooling
+ * \tparam Derivative true to compute the derivative (the errors are all ones)
+ */
+template <typename V, bool Max, bool Derivative, typename T>
+void pool_upsample_image(const T* in,
+                         const T* out,
+                         const T* errors,
+                         T* m,
+                         size_t n1,
+                         size_t n2,
+                         size_t o1,
+                         size_t o2,
+                         size_t c1,
+                         size_t c2,
+                         size_t s1,
+                         size_t s2,
+                         T* out_row,
+                         T* err_row) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    const T div     = T(c1 * c2);
+    const size_t w2 = c2 * o2;
+
+    auto error = [&](size_t i, size_t j) -> T {
+        if constexpr (Derivative) {
+            return Max ? T(1) : T(1) / div;
+        } else {
+            return Max ? errors[i * o2 + j] : errors[i * o2 + j] / div;
+        }
+    };
+
+    if (c1 == s1 && c2 == s2) {
+        // Non-overlapping windows: each input cell belongs to exactly one
+        // window, so the pooled values can be expanded to full rows once and
+        // then compared (or copied) with the input rows
+
+        for (size_t i = 0; i < o1; ++i) {
+            for (size_t j = 0; j < o2; ++j) {
+                for (size_t jj = 0; jj < c2; ++jj) {
+                    if constexpr (Max) {
+                        out_row[j * c2 + jj] = out[i * o2 + j];
+                    }
+
+                    err_row[j * c2 + jj] = error(i, j);
+                }
+            }
+
+            for (size_t ii = 0; ii < c1; ++ii) {
+                const T* in_r = in + (i * c1 + ii) * n2;
+                T* m_r        = m + (i * c1 + ii) * n2;
+
+                if constexpr (Max) {
+                    for (size_t x = 0; x < w2; ++x) {
+                        m_r[x] = in_r[x] == out_row[x] ? err_row[x] : T(0);
+                    }
+                } else {
+                    size_t x = 0;
+
+                    for (; x + vec_size - 1 < w2; x += vec_size) {
+                        vec_type::storeu(m_r + x, vec_type::loadu(err_row + x));
+                    }
+
+                    for (; x < w2; ++x) {
+                        m_r[x] = err_row[x];
+                    }
+                }
+            }
+        }
+    } else {
+        std::fill(m, m + n1 * n2, T(0));
+
+        for (size_t i = 0; i < o1; ++i) {
+            for (size_t j = 0; j < o2; ++j) {
+                const T max = out[i * o2 + j];
+                const T err = error(i, j);
+
+                for (size_t ii = 0; ii < c1; ++ii) {
+                    const T* in_r = in + (i * s1 + ii) * n2 + j * s2;
+                    T* m_r        = m + (i * s1 + ii) * n2 + j * s2;
+
+                    for (size_t jj = 0; jj < c2; ++jj) {
+                        if constexpr (Max) {
+                            if (in_r[jj] == max) {
+                                m_r[jj] += err;
+                            }
+                        } else {
+                            m_r[jj] += err;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Upsample the errors (or the derivative) of a 2D pooling, in parallel
+ * over all the images.
+ *
+ * \param in The input of the pooling
+ * \param out The output of the pooling
+ * \param errors The errors (unused for the derivative)
+ * \param m The output
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ *
+ * \tparam Max true for max pooling, false for average pooling
+ * \tparam Derivative true to compute the derivative (the errors are all ones)
+ */
+template <typename V, bool Max, bool Derivative, typename A, typename B, typename C, typename M>
+void pool_upsample_2d(const A& in, const B& out, const C& errors, M&& m, size_t c1, size_t c2, size_t s1, size_t s2) {
+    using T = value_t<A>;
+
+    static constexpr size_t D = decay_traits<A>::dimensions();
+
+    const size_t n1 = etl::dim(in, D - 2);
+    const size_t n2 = etl::dim(in, D - 1);
+    const size_t o1 = etl::dim(out, D - 2);
+    const size_t o2 = etl::dim(out, D - 1);
+    const size_t N  = etl::size(in) / (n1 * n2);
+
+    in.ensure_cpu_up_to_date();
+    out.ensure_cpu_up_to_date();
+    errors.ensure_cpu_up_to_date();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        etl::dyn_vector<T> out_row(n2);
+        etl::dyn_vector<T> err_row(n2);
+
+        for (size_t b = first; b < last; ++b) {
+            pool_upsample_image<V, Max, Derivative>(in.memory_start() + b * n1 * n2, out.memory_start() + b * o1 * o2,
+                                                    errors.memory_start() + b * o1 * o2, m.memory_start() + b * n1 * n2, n1, n2, o1, o2, c1, c2,
+                                                    s1, s2, out_row.memory_start(), err_row.memory_start());
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, N, 2UL);
+
+    m.invalidate_gpu();
+    m.validate_cpu();
+}
+
+} // end of namespace detail
+
+/*!
+ * \brief Functor for vectorized 2D Max Pooling
+ */
+struct max_pool_2d {
+    /*!
+     * \brief Pool x into y
+     *
+     * \param x The expression to pol
+     * \param y The expression in which to store the result
+     *
+     * \tparam C1 The first dimension pooling ratio
+     * \tparam C2 The second dimension pooling ratio
+     *
+     * \tparam S1 The first dimension stride
+     * \tparam S2 The second dimension stride
+     *
+     * \tparam P1 The first dimension padding
+     * \tparam P2 The second dimension padding
+     */
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename X, typename Y>
+    static void apply([[maybe_unused]] const X& x, [[maybe_unused]] Y&& y) {
+        if constexpr (pool_possible<vector_mode, X, Y>) {
+            if constexpr (P1 || P2) {
+                etl::impl::standard::max_pool_2d::apply<C1, C2, S1, S2, P1, P2>(x, y);
+            } else {
+                detail::pool_2d<default_vec, true>(x, y, C1, C2, S1, S2);
+            }
+        } else {
+            cpp_unreachable("Invalid call to vec::max_pool_2d");
+        }
+    }
+
+    /*!
+     * \brief Pool x into y
+     *
+     * \param x The expression to pol
+     * \param y The expression in which to store the result
+     * \param c1 The first dimension pooling ratio
+     * \param c2 The second dimension pooling ratio
+     * \param s1 The first dimension stride
+     * \param s2 The second dimension stride
+     * \param p1 The first dimension padding
+     * \param p2 The second dimension padding
+     */
+    template <typename X, typename Y>
+    static void apply([[maybe_unused]] const X& x,
+                      [[maybe_unused]] Y&&      y,
+                      [[maybe_unused]] size_t   c1,
+                      [[maybe_unused]] size_t   c2,
+                      [[maybe_unused]] size_t   s1,
+                      [[maybe_unused]] size_t   s2,
+                      [[maybe_unused]] size_t   p1,
+                      [[maybe_unused]] size_t   p2) {
+        if constexpr (pool_possible<vector_mode, X, Y>) {
+            if (p1 || p2) {
+                etl::impl::standard::max_pool_2d::apply(x, y, c1, c2, s1, s2, p1, p2);
+            } else {
+                detail::pool_2d<default_vec, true>(x, y, c1, c2, s1, s2);
+            }
+        } else {
+            cpp_unreachable("Invalid call to vec::max_pool_2d");
+        }
+    }
+};
+
+/*!
+ * \brief Functor for vectorized 2D Average Pooling
+ */
+struct avg_pool_2d {
+    /*!
+     * \brief Pool x into y
+     *
+     * \param x The expression to pol
+     * \param y The expression in which to store the result
+     *
+     * \tparam C1 The first dimension pooling ratio
+     * \tparam C2 The second dimension pooling ratio
+     *
+     * \tparam S1 The first dimension stride
+     * \tparam S2 The second dimension stride
+     *
+     * \tparam P1 The first dimension padding
+     * \tparam P2 The second dimension padding
+     */
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename X, typename Y>
+    static void apply([[maybe_unused]] const X& x, [[maybe_unused]] Y&& y) {
+        if constexpr (pool_possible<vector_mode, X, Y>) {
+            if constexpr (P1 || P2) {
+                etl::impl::standard::avg_pool_2d::apply<C1, C2, S1, S2, P1, P2>(x, y);
+            } else {
+                detail::pool_2d<default_vec, false>(x, y, C1, C2, S1, S2);
+            }
+        } else {
+            cpp_unreachable("Invalid call to vec::avg_pool_2d");
+        }
+    }
+
+    /*!
+     * \brief Pool x into y
+     *
+     * \param x The expression to pol
+     * \param y The expression in which to store the result
+     * \param c1 The first dimension pooling ratio
+     * \param c2 The second dimension pooling ratio
+     * \param s1 The first dimension stride
+     * \param s2 The second dimension stride
+     * \param p1 The first dimension padding
+     * \param p2 The second dimension padding
+     */
+    template <typename X, typename Y>
+    static void apply([[maybe_unused]] const X& x,
+                      [[maybe_unused]] Y&&      y,
+                      [[maybe_unused]] size_t   c1,
+                      [[maybe_unused]] size_t   c2,
+                      [[maybe_unused]] size_t   s1,
+                      [[maybe_unused]] size_t   s2,
+                      [[maybe_unused]] size_t   p1,
+                      [[maybe_unused]] size_t   p2) {
+        if constexpr (pool_possible<vector_mode, X, Y>) {
+            if (p1 || p2) {
+                etl::impl::standard::avg_pool_2d::apply(x, y, c1, c2, s1, s2, p1, p2);
+            } else {
+                detail::pool_2d<default_vec, false>(x, y, c1, c2, s1, s2);
+            }
+        } else {
+            cpp_unreachable("Invalid call to vec::avg_pool_2d");
+        }
+    }
+};
+
+/*!
+ * \brief Functor for the vectorized upsampling of 2D Max Pooling
+ */
+struct max_pool_upsample_2d {
+    /*!
+     * \brief Upsample the errors of the pooling of in into m
+     * \param in The input of the pooling
+     * \param out The output of the pooling
+     * \param errors The errors
+     * \param m The storage matrix
+     */
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename B, typename C, typename M>
+    static void apply([[maybe_unused]] A&& in, [[maybe_unused]] B&& out, [[maybe_unused]] C&& errors, [[maybe_unused]] M&& m) {
+        if constexpr (pool_possible<vector_mode, A, B, C, M>) {
+            if constexpr (P1 || P2) {
+                etl::impl::standard::max_pool_upsample_2d::apply<C1, C2, S1, S2, P1, P2>(in, out, errors, m);
+            } else {
+                detail::pool_upsample_2d<default_vec, true, false>(in, out, errors, m, C1, C2, S1, S2);
+            }
+        } else {
+            cpp_unreachable("Invalid call to vec::max_pool_upsample_2d");
+        }
+    }
+
+    /*!
+     * \brief Upsample the errors of the pooling of in into m
+     * \param in The input of the pooling
+     * \param out The output of the pooling
+     * \param errors The errors
+     * \param m The storage matrix
+     * \param c1 The first dimension pooling ratio
+     * \param c2 The second dimension pooling ratio
+     * \param s1 The first dimension stride
+     * \param s2 The second dimension stride
+     * \param p1 The first dimension padding
+     * \param p2 The second dimension padding
+     */
+    template <typename A, typename B, typename C, typename M>
+    static void apply([[maybe_unused]] A&&    in,
+                      [[maybe_unused]] B&&    out,
+                      [[maybe_unused]] C&&    errors,
+                      [[maybe_unused]] M&&    m,
+                      [[maybe_unused]] size_t c1,
+                      [[maybe_unused]] size_t c2,
+                      [[maybe_unused]] size_t s1,
+                      [[maybe_unused]] size_t s2,
+                      [[maybe_unused]] size_t p1,
+                      [[maybe_unused]] size_t p2) {
+        if constexpr (pool_possible<vector_mode, A, B, C, M>) {
+            if (p1 || p2) {
+                etl::impl::standard::max_pool_upsample_2d::apply(in, out, errors, m, c1, c2, s1, s2, p1, p2);
+            } else {
+                detail::pool_upsample_2d<default_vec, true, false>(in, out, errors, m, c1, c2, s1, s2);
+            }
+        } else {
+            cpp_unreachable("Invalid call to vec::max_pool_upsample_2d");
+        }
+    }
+};
+
+/*!
+ * \brief Functor for the vectorized upsampling of 2D Average Pooling
+ */
+struct avg_pool_upsample_2d {
+    /*!
+     * \brief Upsample the errors of the pooling of in into m
+     * \param in The input of the pooling
+     * \param out The output of the pooling
+     * \param errors The errors
+     * \param m The storage matrix
+     */
+    template <size_t C1, size_t C2, size_t S1, size_t S2, size_t P1, size_t P2, typename A, typename B, typename C, typename M>
+    static void apply([[maybe_unused]] A&& in, [[maybe_unused]] B&& out, [[maybe_unused]] C&& errors, [[maybe_unused]] M&& m) {
+        if constexpr (pool_possible<vector_mode, A, B, C, M>) {
+            if constexpr (P1 || P2) {
+                etl::impl::standard::avg_pool_upsample_2d::apply<C1, C2, S1, S2, P1, P2>(in, out, errors, m);
+            } else {
+                detail::pool_upsample_2d<default_vec, false, false>(in, out, errors, m, C1, C2, S1, S2);
+            }
+        } else {
+            cpp_unreachable("Invalid call to vec::avg_pool_upsample_2d");
+        }
+    }
+
+    /*!
+     * \brief Upsample the errors of the pooling of in into m
+     * \param in The input of the pooling
+     * \param out The output of the pooling
+     * \param errors The errors
+     * \param m The storage matrix
+     * \param c1 The first dimension pooling ratio
+     * \param c2 The second dimension pooling ratio
+     * \param s1 The first dimension stride
+     * \param s2 The second dimension stride
+     * \param p1 The first dimension padding
+     * \param p2 The second dimension padding
+     */
+    template <typename A, typename B, typename C, typename M>
+    static void apply([[maybe_unused]] A&&    in,
+                      [[maybe_unused]] B&&    out,
+                      [[maybe_unused]] C&&    errors,
+                      [[maybe_unused]] M&&    m,
+                      [[maybe_unused]] size_t c1,
+                      [[maybe_unused]] size_t c2,
+                      [[maybe_unused]] size_t s1,
+                      [[maybe_unused]] size_t s2,
+                      [[maybe_unused]] size_t p1,
+                      [[maybe_unused]] size_t p2) {
+        if constexpr (pool_possible<vector_mode, A, B, C, M>) {
+            if (p1 || p2) {
+                etl::impl::standard::avg_pool_upsample_2d::apply(in, out, errors, m, c1, c2, s1, s2, p1, p2);
+            } else {
+                detail::pool_upsample_2d<default_vec, false, false>(in, out, errors, m, c1, c2, s1, s2);
+            }
+        } else {
+            cpp_unreachable("Invalid call to vec::avg_pool_upsample_2d");
+        }
+    }
+};
+
+/*!
+ * \brief Compute the derivative of the 2D max pooling of in into m.
+ *
+ * This does not support padding.
+ *
+ * \param in The input of the pooling
+ * \param out The output of the pooling
+ * \param m The storage matrix
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ */
+template <typename A, typename B, typename M>
+void max_pool_derivative_2d([[maybe_unused]] const A& in,
+                            [[maybe_unused]] const B& out,
+                            [[maybe_unused]] M&       m,
+                            [[maybe_unused]] size_t   c1,
+                            [[maybe_unused]] size_t   c2,
+                            [[maybe_unused]] size_t   s1,
+                            [[maybe_unused]] size_t   s2) {
+    if constexpr (pool_possible<vector_mode, A, B, M>) {
+        detail::pool_upsample_2d<default_vec, true, true>(in, out, out, m, c1, c2, s1, s2);
+    } else {
+        cpp_unreachable("Invalid call to vec::max_pool_derivative_2d");
+    }
+}
+
+/*!
+ * \brief Compute the derivative of the 2D average pooling of in into m.
+ *
+ * This does not support padding.
+ *
+ * \param in The input of the pooling
+ * \param out The output of the pooling
+ * \param m The storage matrix
+ * \param c1 The first dimension pooling ratio
+ * \param c2 The second dimension pooling ratio
+ * \param s1 The first dimension stride
+ * \param s2 The second dimension stride
+ */
+template <typename A, typename B, typename M>
+void avg_pool_derivative_2d([[maybe_unused]] const A& in,
+                            [[maybe_unused]] const B& out,
+                            [[maybe_unused]] M&       m,
+                            [[maybe_unused]] size_t   c1,
+                            [[maybe_unused]] size_t   c2,
+                            [[maybe_unused]] size_t   s1,
+                            [[maybe_unused]] size_t   s2) {
+    if constexpr (pool_possible<vector_mode, A, B, M>) {
+        detail::pool_upsample_2d<default_vec, false, true>(in, out, out, m, c1, c2, s1, s2);
+    } else {
+        cpp_unreachable("Invalid call to vec::avg_pool_derivative_2d");
+    }
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,413 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the quantized (int8) matrix-matrix and
+ * matrix-vector multiplications.
+ *
+ * The rhs is first packed into zero-padded rows of int8, transposed so that
+ * each of its columns is contiguous. The lhs is packed the same way when its
+ * rows are not already padded. The kernels then compute blocks of dot
+ * products with int32 accumulators:
+ *
+ * - With AVX-512 VNNI, vpdpbusd multiplies unsigned by signed bytes. The lhs
+ * is packed with an offset of 128 to be unsigned and the offset is removed
+ * with the column sums of the rhs.
+ * - With AVX2, the bytes are sign-extended to 16 bits and multiplied with
+ * vpmaddwd, which cannot saturate, contrary to vpmaddubsw.
+ *
+ * The epilogue (dequantization or requantization) is applied directly on the
+ * accumulators, while they are still in registers.
+ */
+
+#pragma once
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+#endif
+
+namespace etl::impl::vec {
+
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+
+/*!
+ * \brief Indicates if the VNNI kernels are used for quantized products
+ */
+constexpr bool qgemm_vnni = true;
+
+#else
+
+/*!
+ * \brief Indicates if the VNNI kernels are used for quantized products
+ */
+constexpr bool qgemm_vnni = false;
+
+#endif
+
+/*!
+ * \brief Indicates if a vectorized kernel is available for quantized products
+ */
+#ifdef __AVX2__
+constexpr bool qgemm_kernels = true;
+#else
+constexpr bool qgemm_kernels = false;
+#endif
+
+/*!
+ * \brief Traits indicating if the vectorized quantized product is possible
+ * for the given types.
+ */
+template <typename A, typename B, typename C>
+constexpr bool qgemm_possible = qgemm_kernels && vectorize_impl && all_dma<A, B, C> && all_row_major<A, B, C>
+                                && std::is_same_v<value_t<A>, int8_t> && std::is_same_v<value_t<B>, int8_t>;
+
+namespace detail {
+
+/*!
+ * \brief The padding of the packed rows, in bytes
+ */
+constexpr size_t qgemm_k_padding = 64;
+
+#ifdef __AVX2__
+
+/*!
+ * \brief Horizontal sum of eight int32
+ */
+inline int32_t qgemm_hadd(__m256i x) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+    s         = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+    s         = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+    return _mm_cvtsi128_si32(s);
+}
+
+/*!
+ * \brief Accumulate the products of sixteen bytes of a and b into r
+ */
+inline __m256i qgemm_madd(__m256i r, __m256i a, const int8_t* b) {
+    const __m256i bw = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(b)));
+    return _mm256_add_epi32(r, _mm256_madd_epi16(a, bw));
+}
+
+/*!
+ * \brief Load sixteen bytes sign-extended to 16 bits
+ */
+inline __m256i qgemm_load(const int8_t* a) {
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a)));
+}
+
+/*!
+ * \brief AVX2 kernel for a range of rows of the output
+ * \param ap The packed lhs
+ * \param bp The packed (transposed) rhs
+ * \param c The output
+ * \param N The number of columns of the output
+ * \param Kp The padded size of the packed rows
+ * \param first The first row
+ * \param last The end of the range of rows
+ * \param epi The epilogue
+ */
+template <typename T>
+void qgemm_avx2_kernel(const int8_t* ap, const int8_t* bp, T* c, size_t N, size_t Kp, size_t first, size_t last, standard::qgemm_epilogue<T> epi) {
+    size_t i = first;
+
+    for (; i + 1 < last; i += 2) {
+        const int8_t* a1 = ap + (i + 0) * Kp;
+        const int8_t* a2 = ap + (i + 1) * Kp;
+
+        size_t j = 0;
+
+        for (; j + 3 < N; j += 4) {
+            const int8_t* b1 = bp + (j + 0) * Kp;
+            const int8_t* b2 = bp + (j + 1) * Kp;
+            const int8_t* b3 = bp + (j + 2) * Kp;
+            const int8_t* b4 = bp + (j + 3) * Kp;
+
+            __m256i r11 = _mm256_setzero_si256();
+            __m256i r12 = _mm256_setzero_si256();
+            __m256i r13 = _mm256_setzero_si256();
+            __m256i r14 = _mm256_setzero_si256();
+            __m256i r21 = _mm256_setzero_si256();
+            __m256i r22 = _mm256_setzero_si256();
+            __m256i r23 = _mm256_setzero_si256();
+            __m256i r24 = _mm256_setzero_si256();
+
+            for (size_t k = 0; k < Kp; k += 16) {
+                const __m256i x1 = qgemm_load(a1 + k);
+                const __m256i x2 = qgemm_load(a2 + k);
+
+                const __m256i y1 = qgemm_load(b1 + k);
+                const __m256i y2 = qgemm_load(b2 + k);
+                const __m256i y3 = qgemm_load(b3 + k);
+                const __m256i y4 = qgemm_load(b4 + k);
+
+                r11 = _mm256_add_epi32(r11, _mm256_madd_epi16(x1, y1));
+                r12 = _mm256_add_epi32(r12, _mm256_madd_epi16(x1, y2));
+                r13 = _mm256_add_epi32(r13, _mm256_madd_epi16(x1, y3));
+                r14 = _mm256_add_epi32(r14, _mm256_madd_epi16(x1, y4));
+                r21 = _mm256_add_epi32(r21, _mm256_madd_epi16(x2, y1));
+                r22 = _mm256_add_epi32(r22, _mm256_madd_epi16(x2, y2));
+                r23 = _mm256_add_epi32(r23, _mm256_madd_epi16(x2, y3));
+                r24 = _mm256_add_epi32(r24, _mm256_madd_epi16(x2, y4));
+            }
+
+            c[(i + 0) * N + j + 0] = epi.apply(qgemm_hadd(r11));
+            c[(i + 0) * N + j + 1] = epi.apply(qgemm_hadd(r12));
+            c[(i + 0) * N + j + 2] = epi.apply(qgemm_hadd(r13));
+            c[(i + 0) * N + j + 3] = epi.apply(qgemm_hadd(r14));
+            c[(i + 1) * N + j + 0] = epi.apply(qgemm_hadd(r21));
+            c[(i + 1) * N + j + 1] = epi.apply(qgemm_hadd(r22));
+            c[(i + 1) * N + j + 2] = epi.apply(qgemm_hadd(r23));
+            c[(i + 1) * N + j + 3] = epi.apply(qgemm_hadd(r24));
+        }
+
+        for (; j < N; ++j) {
+            const int8_t* b1 = bp + j * Kp;
+
+            __m256i r1 = _mm256_setzero_si256();
+            __m256i r2 = _mm256_setzero_si256();
+
+            for (size_t k = 0; k < Kp; k += 16) {
+                r1 = qgemm_madd(r1, qgemm_load(a1 + k), b1 + k);
+                r2 = qgemm_madd(r2, qgemm_load(a2 + k), b1 + k);
+            }
+
+            c[(i + 0) * N + j] = epi.apply(qgemm_hadd(r1));
+            c[(i + 1) * N + j] = epi.apply(qgemm_hadd(r2));
+        }
+    }
+
+    for (; i < last; ++i) {
+        const int8_t* a1 = ap + i * Kp;
+
+        for (size_t j = 0; j < N; ++j) {
+            const int8_t* b1 = bp + j * Kp;
+
+            __m256i r1 = _mm256_setzero_si256();
+            __m256i r2 = _mm256_setzero_si256();
+
+            for (size_t k = 0; k < Kp; k += 32) {
+                r1 = qgemm_madd(r1, qgemm_load(a1 + k), b1 + k);
+                r2 = qgemm_madd(r2, qgemm_load(a1 + k + 16), b1 + k + 16);
+            }
+
+            c[i * N + j] = epi.apply(qgemm_hadd(_mm256_add_epi32(r1, r2)));
+        }
+    }
+}
+
+#endif
+
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+
+/*!
+ * \brief AVX-512 VNNI kernel for a range of rows of the output
+ *
+ * The lhs must have been packed with an offset of 128.
+ *
+ * \param ap The packed lhs, as unsigned bytes
+ * \param bp The packed (transposed) rhs
+ * \param b_sums The sums of the columns of the rhs, scaled by 128
+ * \param c The output
+ * \param N The number of columns of the output
+ * \param Kp The padded size of the packed rows
+ * \param first The first row
+ * \param last The end of the range of rows
+ * \param epi The epilogue
+ */
+template <typename T>
+void qgemm_vnni_kernel(const int8_t* ap, const int8_t* bp, const int32_t* b_sums, T* c, size_t N, size_t Kp, size_t first, size_t last, standard::qgemm_epilogue<T> epi) {
+    auto load = [](const int8_t* p) { return _mm512_loadu_si512(reinterpret_cast<const void*>(p)); };
+
+    size_t i = first;
+
+    for (; i + 3 < last; i += 4) {
+        const int8_t* a1 = ap + (i + 0) * Kp;
+        const int8_t* a2 = ap + (i + 1) * Kp;
+        const int8_t* a3 = ap + (i + 2) * Kp;
+        const int8_t* a4 = ap + (i + 3) * Kp;
+
+        size_t j = 0;
+
+        for (; j + 3 < N; j += 4) {
+            const int8_t* b1 = bp + (j + 0) * Kp;
+            const int8_t* b2 = bp + (j + 1) * Kp;
+            const int8_t* b3 = bp + (j + 2) * Kp;
+            const int8_t* b4 = bp + (j + 3) * Kp;
+
+            __m512i r[4][4];
+
+            for (auto& rr : r) {
+                for (auto& x : rr) {
+                    x = _mm512_setzero_si512();
+                }
+            }
+
+            for (size_t k = 0; k < Kp; k += 64) {
+                const __m512i y1 = load(b1 + k);
+                const __m512i y2 = load(b2 + k);
+                const __m512i y3 = load(b3 + k);
+                const __m512i y4 = load(b4 + k);
+
+                const __m512i x1 = load(a1 + k);
+                const __m512i x2 = load(a2 + k);
+                const __m512i x3 = load(a3 + k);
+                const __m512i x4 = load(a4 + k);
+
+                r[0][0] = _mm512_dpbusd_epi32(r[0][0], x1, y1);
+                r[0][1] = _mm512_dpbusd_epi32(r[0][1], x1, y2);
+                r[0][2] = _mm512_dpbusd_epi32(r[0][2], x1, y3);
+                r[0][3] = _mm512_dpbusd_epi32(r[0][3], x1, y4);
+                r[1][0] = _mm512_dpbusd_epi32(r[1][0], x2, y1);
+                r[1][1] = _mm512_dpbusd_epi32(r[1][1], x2, y2);
+                r[1][2] = _mm512_dpbusd_epi32(r[1][2], x2, y3);
+                r[1][3] = _mm512_dpbusd_epi32(r[1][3], x2, y4);
+                r[2][0] = _mm512_dpbusd_epi32(r[2][0], x3, y1);
+                r[2][1] = _mm512_dpbusd_epi32(r[2][1], x3, y2);
+                r[2][2] = _mm512_dpbusd_epi32(r[2][2], x3, y3);
+                r[2][3] = _mm512_dpbusd_epi32(r[2][3], x3, y4);
+                r[3][0] = _mm512_dpbusd_epi32(r[3][0], x4, y1);
+                r[3][1] = _mm512_dpbusd_epi32(r[3][1], x4, y2);
+                r[3][2] = _mm512_dpbusd_epi32(r[3][2], x4, y3);
+                r[3][3] = _mm512_dpbusd_epi32(r[3][3], x4, y4);
+            }
+
+            for (size_t ii = 0; ii < 4; ++ii) {
+                for (size_t jj = 0; jj < 4; ++jj) {
+                    c[(i + ii) * N + j + jj] = epi.apply(_mm512_reduce_add_epi32(r[ii][jj]) - b_sums[j + jj]);
+                }
+            }
+        }
+
+        for (; j < N; ++j) {
+            const int8_t* b1 = bp + j * Kp;
+
+            __m512i r1 = _mm512_setzero_si512();
+            __m512i r2 = _mm512_setzero_si512();
+            __m512i r3 = _mm512_setzero_si512();
+            __m512i r4 = _mm512_setzero_si512();
+
+            for (size_t k = 0; k < Kp; k += 64) {
+                const __m512i y1 = load(b1 + k);
+
+                r1 = _mm512_dpbusd_epi32(r1, load(a1 + k), y1);
+                r2 = _mm512_dpbusd_epi32(r2, load(a2 + k), y1);
+                r3 = _mm512_dpbusd_epi32(r3, load(a3 + k), y1);
+                r4 = _mm512_dpbusd_epi32(r4, load(a4 + k), y1);
+            }
+
+            c[(i + 0) * N + j] = epi.apply(_mm512_reduce_add_epi32(r1) - b_sums[j]);
+            c[(i + 1) * N + j] = epi.apply(_mm512_reduce_add_epi32(r2) - b_sums[j]);
+            c[(i + 2) * N + j] = epi.apply(_mm512_reduce_add_epi32(r3) - b_sums[j]);
+            c[(i + 3) * N + j] = epi.apply(_mm512_reduce_add_epi32(r4) - b_sums[j]);
+        }
+    }
+
+    for (; i < last; ++i) {
+        const int8_t* a1 = ap + i * Kp;
+
+        for (size_t j = 0; j < N; ++j) {
+            const int8_t* b1 = bp + j * Kp;
+
+            __m512i r1 = _mm512_setzero_si512();
+
+            for (size_t k = 0; k < Kp; k += 64) {
+                r1 = _mm512_dpbusd_epi32(r1, load(a1 + k), load(b1 + k));
+            }
+
+            c[i * N + j] = epi.apply(_mm512_reduce_add_epi32(r1) - b_sums[j]);
+        }
+    }
+}
+
+#endif
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the quantized product of a (M,K) and b (K,N) or (K)
+ * \param a The lhs matrix
+ * \param b The rhs matrix or vector
+ * \param c The output
+ * \param epi The epilogue
+ */
+template <typename A, typename B, typename C, typename T>
+void qgemm([[maybe_unused]] const A& a, [[maybe_unused]] const B& b, [[maybe_unused]] C&& c, [[maybe_unused]] standard::qgemm_epilogue<T> epi) {
+    if constexpr (qgemm_possible<A, B, C>) {
+        const size_t M  = etl::dim<0>(a);
+        const size_t K  = etl::dim<1>(a);
+        const size_t N  = standard::qgemm_columns(b);
+        const size_t Kp = ((K + detail::qgemm_k_padding - 1) / detail::qgemm_k_padding) * detail::qgemm_k_padding;
+
+        const int8_t* a_m = a.memory_start();
+        const int8_t* b_m = b.memory_start();
+        auto* c_m         = c.memory_start();
+
+        // With VNNI, the lhs is packed as unsigned bytes (a + 128)
+        static constexpr int8_t a_offset = qgemm_vnni ? int8_t(-128) : int8_t(0);
+
+        // The lhs only needs to be packed if its rows are not already padded
+        const bool pack_a = qgemm_vnni || K != Kp;
+
+        std::vector<int8_t> ap(pack_a ? M * Kp : 0);
+        std::vector<int8_t> bp(N * Kp);
+
+        if (pack_a) {
+            for (size_t i = 0; i < M; ++i) {
+                for (size_t k = 0; k < K; ++k) {
+                    ap[i * Kp + k] = int8_t(a_m[i * K + k] ^ a_offset);
+                }
+
+                for (size_t k = K; k < Kp; ++k) {
+                    ap[i * Kp + k] = a_offset;
+                }
+            }
+        }
+
+        const int8_t* ap_m = pack_a ? ap.data() : a_m;
+
+        // The rhs is transposed, every column becoming contiguous
+
+        for (size_t k = 0; k < K; ++k) {
+            for (size_t j = 0; j < N; ++j) {
+                bp[j * Kp + k] = b_m[k * N + j];
+            }
+        }
+
+        if constexpr (qgemm_vnni) {
+#if defined(__AVX512VNNI__) && defined(__AVX512BW__)
+            std::vector<int32_t> b_sums(N);
+
+            for (size_t j = 0; j < N; ++j) {
+                int32_t sum = 0;
+
+                for (size_t k = 0; k < K; ++k) {
+                    sum += bp[j * Kp + k];
+                }
+
+                b_sums[j] = 128 * sum;
+            }
+
+            auto batch_fun = [&](size_t first, size_t last) { detail::qgemm_vnni_kernel(ap_m, bp.data(), b_sums.data(), c_m, N, Kp, first, last, epi); };
+
+            engine_dispatch_1d_serial(batch_fun, 0, M, M * N * K >= parallel_threshold);
+#endif
+        } else {
+#ifdef __AVX2__
+            auto batch_fun = [&](size_t first, size_t last) { detail::qgemm_avx2_kernel(ap_m, bp.data(), c_m, N, Kp, first, last, epi); };
+
+            engine_dispatch_1d_serial(batch_fun, 0, M, M * N * K >= parallel_threshold);
+#endif
+        }
+    } else {
+        cpp_unreachable("Invalid call to vec::qgemm");
+    }
+}
+
+} //end of namespace etl::impl::vec
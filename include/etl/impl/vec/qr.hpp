@@ -0,0 +1,58 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the blocked Householder QR
+ * decomposition and of the application of its Q factor.
+ *
+ * Only the matrix products applying the blocks of reflectors are vectorized,
+ * the panels are done with the standard implementation.
+ */
+
+#pragma once
+
+#include "etl/impl/std/qr.hpp"
+#include "etl/impl/vec/trsm.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized QR decomposition is possible
+ * for the given value type.
+ *
+ * \tparam V The vector mode
+ * \tparam T The value type
+ */
+template <vector_mode_t V, typename T>
+constexpr bool qr_possible = trsm_possible<V, T>;
+
+/*!
+ * \copydoc etl::impl::standard::qr_factor
+ */
+template <typename T>
+void qr_factor(T* a, T* t, size_t m, size_t n) {
+    etl::impl::standard::detail::qr_blocked(a, t, m, n, [](auto&&... args) { detail::block_update<default_vec>(args...); });
+}
+
+/*!
+ * \copydoc etl::impl::standard::qr_apply_q
+ */
+template <typename T>
+void qr_apply_q(const T* qr, const T* t, size_t m, size_t n, T* c, size_t k) {
+    etl::impl::standard::detail::qr_apply_blocked<false>(qr, t, m, n, c, k, [](auto&&... args) { detail::block_update<default_vec>(args...); });
+}
+
+/*!
+ * \copydoc etl::impl::standard::qr_apply_qt
+ */
+template <typename T>
+void qr_apply_qt(const T* qr, const T* t, size_t m, size_t n, T* c, size_t k) {
+    etl::impl::standard::detail::qr_apply_blocked<true>(qr, t, m, n, c, k, [](auto&&... args) { detail::block_update<default_vec>(args...); });
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,293 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the gate passes of the recurrent cells
+ *
+ * The vectors are made of consecutive hidden units of the same sample. The
+ * hidden units that do not fill a vector are computed by the standard
+ * implementation.
+ */
+
+#pragma once
+
+#include "etl/impl/std/rnn.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized gate passes of the recurrent
+ * cells are possible for the given value type.
+ *
+ * \tparam V The vector mode
+ * \tparam T The value type
+ */
+template <vector_mode_t V, typename T>
+constexpr bool rnn_possible = vec_enabled&& vectorize_impl&& is_floating_t<T>&& sigmoid_unary_op<T>::template vectorizable<V>&& tanh_unary_op<T>::template vectorizable<V>;
+
+namespace detail {
+
+/*!
+ * \brief Compute the LSTM gate pass of a sample
+ * \param g The pre-activations of the gates of the sample, replaced by the activations
+ * \param c_prev The previous cell state of the sample
+ * \param c The cell state of the sample (output)
+ * \param h The hidden state of the sample (output)
+ * \param H The number of hidden units
+ */
+template <typename V, typename T>
+void lstm_forward_units(T* g, const T* c_prev, T* c, T* h, size_t H) {
+    using vec_type = V;
+    using sigmoid  = sigmoid_unary_op<T>;
+    using tanh     = tanh_unary_op<T>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t j = 0;
+
+    for (; j + vec_size - 1 < H; j += vec_size) {
+        auto i  = sigmoid::template load<vec_type>(vec_type::loadu(g + j));
+        auto f  = sigmoid::template load<vec_type>(vec_type::loadu(g + H + j));
+        auto gg = tanh::template load<vec_type>(vec_type::loadu(g + 2 * H + j));
+        auto o  = sigmoid::template load<vec_type>(vec_type::loadu(g + 3 * H + j));
+
+        auto cc = vec_type::fmadd(f, vec_type::loadu(c_prev + j), vec_type::mul(i, gg));
+
+        vec_type::storeu(g + j, i);
+        vec_type::storeu(g + H + j, f);
+        vec_type::storeu(g + 2 * H + j, gg);
+        vec_type::storeu(g + 3 * H + j, o);
+
+        vec_type::storeu(c + j, cc);
+        vec_type::storeu(h + j, vec_type::mul(o, tanh::template load<vec_type>(cc)));
+    }
+
+    etl::impl::standard::detail::lstm_forward_units(g, c_prev, c, h, H, j, H);
+}
+
+/*!
+ * \brief Compute the LSTM backward gate pass of a sample
+ * \param g The activations of the gates of the sample
+ * \param c_prev The previous cell state of the sample
+ * \param c The cell state of the sample
+ * \param dh The gradients of the hidden state of the sample
+ * \param dc The gradients of the cell state coming from the next step
+ * \param dg The gradients of the pre-activations of the gates (output)
+ * \param dc_prev The gradients of the previous cell state (output)
+ * \param H The number of hidden units
+ */
+template <typename V, typename T>
+void lstm_backward_units(const T* g, const T* c_prev, const T* c, const T* dh, const T* dc, T* dg, T* dc_prev, size_t H) {
+    using vec_type = V;
+    using tanh     = tanh_unary_op<T>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto one = vec_type::set(T(1));
+
+    size_t j = 0;
+
+    for (; j + vec_size - 1 < H; j += vec_size) {
+        auto i  = vec_type::loadu(g + j);
+        auto f  = vec_type::loadu(g + H + j);
+        auto gg = vec_type::loadu(g + 2 * H + j);
+        auto o  = vec_type::loadu(g + 3 * H + j);
+
+        auto dhj = vec_type::loadu(dh + j);
+
+        auto tc = tanh::template load<vec_type>(vec_type::loadu(c + j));
+        auto dt = vec_type::fmadd(vec_type::mul(dhj, o), vec_type::sub(one, vec_type::mul(tc, tc)), vec_type::loadu(dc + j));
+
+        auto di  = vec_type::mul(vec_type::mul(dt, gg), vec_type::mul(i, vec_type::sub(one, i)));
+        auto df  = vec_type::mul(vec_type::mul(dt, vec_type::loadu(c_prev + j)), vec_type::mul(f, vec_type::sub(one, f)));
+        auto dg2 = vec_type::mul(vec_type::mul(dt, i), vec_type::sub(one, vec_type::mul(gg, gg)));
+        auto d_o = vec_type::mul(vec_type::mul(dhj, tc), vec_type::mul(o, vec_type::sub(one, o)));
+
+        vec_type::storeu(dg + j, di);
+        vec_type::storeu(dg + H + j, df);
+        vec_type::storeu(dg + 2 * H + j, dg2);
+        vec_type::storeu(dg + 3 * H + j, d_o);
+
+        vec_type::storeu(dc_prev + j, vec_type::mul(dt, f));
+    }
+
+    etl::impl::standard::detail::lstm_backward_units(g, c_prev, c, dh, dc, dg, dc_prev, H, j, H);
+}
+
+/*!
+ * \brief Compute the GRU gate pass of a sample
+ * \param gx The input projection of the gates of the sample (with bias)
+ * \param gh The recurrent projection of the gates of the sample (with bias)
+ * \param h_prev The previous hidden state of the sample
+ * \param cache The activations (r, z, n) and the recurrent projection of n (output)
+ * \param h The hidden state of the sample (output)
+ * \param H The number of hidden units
+ */
+template <typename V, typename T>
+void gru_forward_units(const T* gx, const T* gh, const T* h_prev, T* cache, T* h, size_t H) {
+    using vec_type = V;
+    using sigmoid  = sigmoid_unary_op<T>;
+    using tanh     = tanh_unary_op<T>;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    size_t j = 0;
+
+    for (; j + vec_size - 1 < H; j += vec_size) {
+        auto ghn = vec_type::loadu(gh + 2 * H + j);
+
+        auto r = sigmoid::template load<vec_type>(vec_type::add(vec_type::loadu(gx + j), vec_type::loadu(gh + j)));
+        auto z = sigmoid::template load<vec_type>(vec_type::add(vec_type::loadu(gx + H + j), vec_type::loadu(gh + H + j)));
+        auto n = tanh::template load<vec_type>(vec_type::fmadd(r, ghn, vec_type::loadu(gx + 2 * H + j)));
+
+        vec_type::storeu(cache + j, r);
+        vec_type::storeu(cache + H + j, z);
+        vec_type::storeu(cache + 2 * H + j, n);
+        vec_type::storeu(cache + 3 * H + j, ghn);
+
+        vec_type::storeu(h + j, vec_type::fmadd(z, vec_type::sub(vec_type::loadu(h_prev + j), n), n));
+    }
+
+    etl::impl::standard::detail::gru_forward_units(gx, gh, h_prev, cache, h, H, j, H);
+}
+
+/*!
+ * \brief Compute the GRU backward gate pass of a sample
+ * \param cache The activations (r, z, n) and the recurrent projection of n
+ * \param h_prev The previous hidden state of the sample
+ * \param dh The gradients of the hidden state of the sample
+ * \param dgx The gradients of the input projection of the gates (output)
+ * \param dgh The gradients of the recurrent projection of the gates (output)
+ * \param dh_prev The direct gradients of the previous hidden state (output)
+ * \param H The number of hidden units
+ */
+template <typename V, typename T>
+void gru_backward_units(const T* cache, const T* h_prev, const T* dh, T* dgx, T* dgh, T* dh_prev, size_t H) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto one = vec_type::set(T(1));
+
+    size_t j = 0;
+
+    for (; j + vec_size - 1 < H; j += vec_size) {
+        auto r   = vec_type::loadu(cache + j);
+        auto z   = vec_type::loadu(cache + H + j);
+        auto n   = vec_type::loadu(cache + 2 * H + j);
+        auto ghn = vec_type::loadu(cache + 3 * H + j);
+
+        auto dhj = vec_type::loadu(dh + j);
+
+        auto dn = vec_type::mul(vec_type::mul(dhj, vec_type::sub(one, z)), vec_type::sub(one, vec_type::mul(n, n)));
+        auto dz = vec_type::mul(vec_type::mul(dhj, vec_type::sub(vec_type::loadu(h_prev + j), n)), vec_type::mul(z, vec_type::sub(one, z)));
+        auto dr = vec_type::mul(vec_type::mul(dn, ghn), vec_type::mul(r, vec_type::sub(one, r)));
+
+        vec_type::storeu(dgx + j, dr);
+        vec_type::storeu(dgx + H + j, dz);
+        vec_type::storeu(dgx + 2 * H + j, dn);
+
+        vec_type::storeu(dgh + j, dr);
+        vec_type::storeu(dgh + H + j, dz);
+        vec_type::storeu(dgh + 2 * H + j, vec_type::mul(dn, r));
+
+        vec_type::storeu(dh_prev + j, vec_type::mul(dhj, z));
+    }
+
+    etl::impl::standard::detail::gru_backward_units(cache, h_prev, dh, dgx, dgh, dh_prev, H, j, H);
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the LSTM gate pass of a time step
+ * \param g The [B, 4H] pre-activations of the gates, replaced by the activations
+ * \param c_prev The [B, H] previous cell state
+ * \param c The [B, H] cell state (output)
+ * \param h The [B, H] hidden state (output)
+ * \param B The number of samples
+ * \param H The number of hidden units
+ */
+template <typename T>
+void lstm_forward_gates(T* g, const T* c_prev, T* c, T* h, size_t B, size_t H) {
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            detail::lstm_forward_units<default_vec>(g + b * 4 * H, c_prev + b * H, c + b * H, h + b * H, H);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, B, B * H >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute the LSTM backward gate pass of a time step
+ * \param g The [B, 4H] activations of the gates
+ * \param c_prev The [B, H] previous cell state
+ * \param c The [B, H] cell state
+ * \param dh The [B, H] gradients of the hidden state
+ * \param dc The [B, H] gradients of the cell state coming from the next step
+ * \param dg The [B, 4H] gradients of the pre-activations of the gates (output)
+ * \param dc_prev The [B, H] gradients of the previous cell state (output, can be dc)
+ * \param B The number of samples
+ * \param H The number of hidden units
+ */
+template <typename T>
+void lstm_backward_gates(const T* g, const T* c_prev, const T* c, const T* dh, const T* dc, T* dg, T* dc_prev, size_t B, size_t H) {
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            detail::lstm_backward_units<default_vec>(g + b * 4 * H, c_prev + b * H, c + b * H, dh + b * H, dc + b * H, dg + b * 4 * H, dc_prev + b * H, H);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, B, B * H >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute the GRU gate pass of a time step
+ * \param gx The [B, 3H] input projection of the gates (with bias)
+ * \param gh The [B, 3H] recurrent projection of the gates (with bias)
+ * \param h_prev The [B, H] previous hidden state
+ * \param cache The [B, 4H] activations (r, z, n) and recurrent projection of n (output)
+ * \param h The [B, H] hidden state (output)
+ * \param B The number of samples
+ * \param H The number of hidden units
+ */
+template <typename T>
+void gru_forward_gates(const T* gx, const T* gh, const T* h_prev, T* cache, T* h, size_t B, size_t H) {
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            detail::gru_forward_units<default_vec>(gx + b * 3 * H, gh + b * 3 * H, h_prev + b * H, cache + b * 4 * H, h + b * H, H);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, B, B * H >= parallel_threshold);
+}
+
+/*!
+ * \brief Compute the GRU backward gate pass of a time step
+ * \param cache The [B, 4H] activations (r, z, n) and recurrent projection of n
+ * \param h_prev The [B, H] previous hidden state
+ * \param dh The [B, H] gradients of the hidden state
+ * \param dgx The [B, 3H] gradients of the input projection of the gates (output)
+ * \param dgh The [B, 3H] gradients of the recurrent projection of the gates (output)
+ * \param dh_prev The [B, H] direct gradients of the previous hidden state (output, can be dh)
+ * \param B The number of samples
+ * \param H The number of hidden units
+ */
+template <typename T>
+void gru_backward_gates(const T* cache, const T* h_prev, const T* dh, T* dgx, T* dgh, T* dh_prev, size_t B, size_t H) {
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t b = first; b < last; ++b) {
+            detail::gru_backward_units<default_vec>(cache + b * 4 * H, h_prev + b * H, dh + b * H, dgx + b * 3 * H, dgh + b * 3 * H, dh_prev + b * H, H);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, B, B * H >= parallel_threshold);
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,172 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the (batch) softmax.
+ *
+ * Each row is computed independently, which allows to parallelize over the
+ * rows of the batch. For each row, the maximum is first computed, then the
+ * exponentials of the shifted inputs are written directly into the output
+ * while being summed, and finally the output is scaled by the inverse of
+ * the sum. This computes only one exponential per element.
+ */
+
+#pragma once
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if vectorized softmax is possible for the given
+ * expressions.
+ *
+ * \tparam V The vector mode
+ * \tparam A The input expression
+ * \tparam C The output expression
+ */
+template <vector_mode_t V, typename A, typename C>
+constexpr bool softmax_possible = vec_enabled&& vectorize_impl&& all_homogeneous<A, C>&& all_floating<A, C>&& all_vectorizable<V, A, C>&& all_row_major<A, C>&&
+                                      exp_unary_op<value_t<A>>::template vectorizable<V>;
+
+namespace detail {
+
+/*!
+ * \brief Compute the softmax of a single row
+ * \param in The input row
+ * \param out The output row
+ * \param n The number of elements of the row
+ */
+template <typename V, typename T>
+void softmax_row(const T* in, T* out, size_t n) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    // 1. Compute the maximum of the row
+
+    T m = in[0];
+
+    size_t i = 0;
+
+    if (n >= vec_size) {
+        auto m1 = vec_type::loadu(in);
+        auto m2 = m1;
+
+        i = vec_size;
+
+        for (; i + 2 * vec_size - 1 < n; i += 2 * vec_size) {
+            m1 = vec_type::max(m1, vec_type::loadu(in + i));
+            m2 = vec_type::max(m2, vec_type::loadu(in + i + vec_size));
+        }
+
+        for (; i + vec_size - 1 < n; i += vec_size) {
+            m1 = vec_type::max(m1, vec_type::loadu(in + i));
+        }
+
+        T tmp[vec_size];
+        vec_type::storeu(tmp, vec_type::max(m1, m2));
+
+        for (size_t k = 0; k < vec_size; ++k) {
+            m = std::max(m, tmp[k]);
+        }
+    }
+
+    for (; i < n; ++i) {
+        m = std::max(m, in[i]);
+    }
+
+    // 2. Compute exp(x - m) into the output and accumulate the sum
+
+    auto vm = vec_type::set(m);
+
+    auto s1 = vec_type::template zero<T>();
+    auto s2 = vec_type::template zero<T>();
+
+    i = 0;
+
+    for (; i + 2 * vec_size - 1 < n; i += 2 * vec_size) {
+        auto e1 = vec_type::exp(vec_type::sub(vec_type::loadu(in + i), vm));
+        auto e2 = vec_type::exp(vec_type::sub(vec_type::loadu(in + i + vec_size), vm));
+
+        vec_type::storeu(out + i, e1);
+        vec_type::storeu(out + i + vec_size, e2);
+
+        s1 = vec_type::add(s1, e1);
+        s2 = vec_type::add(s2, e2);
+    }
+
+    for (; i + vec_size - 1 < n; i += vec_size) {
+        auto e1 = vec_type::exp(vec_type::sub(vec_type::loadu(in + i), vm));
+
+        vec_type::storeu(out + i, e1);
+
+        s1 = vec_type::add(s1, e1);
+    }
+
+    T s = vec_type::hadd(vec_type::add(s1, s2));
+
+    for (; i < n; ++i) {
+        out[i] = std::exp(in[i] - m);
+        s += out[i];
+    }
+
+    // 3. Normalize the output
+
+    const T inv = T(1) / s;
+
+    auto vinv = vec_type::set(inv);
+
+    i = 0;
+
+    for (; i + vec_size - 1 < n; i += vec_size) {
+        vec_type::storeu(out + i, vec_type::mul(vec_type::loadu(out + i), vinv));
+    }
+
+    for (; i < n; ++i) {
+        out[i] *= inv;
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the softmax of each row of a into c
+ *
+ * A vector is considered as a single row.
+ *
+ * \param a The input expression
+ * \param c The output expression
+ */
+template <typename A, typename C>
+void softmax([[maybe_unused]] const A& a, [[maybe_unused]] C&& c) {
+    if constexpr (softmax_possible<vector_mode, A, C>) {
+        using T = value_t<A>;
+
+        const size_t rows = decay_traits<A>::dimensions() == 1 ? 1 : etl::dim<0>(a);
+        const size_t n    = etl::size(a) / rows;
+
+        a.ensure_cpu_up_to_date();
+
+        const T* in = a.memory_start();
+        T* out      = c.memory_start();
+
+        auto batch_fun = [&](size_t first, size_t last) {
+            for (size_t r = first; r < last; ++r) {
+                detail::softmax_row<default_vec>(in + r * n, out + r * n, n);
+            }
+        };
+
+        engine_dispatch_1d_serial(batch_fun, 0, rows, 2UL);
+
+        c.invalidate_gpu();
+        c.validate_cpu();
+    } else {
+        cpp_unreachable("Invalid call to vec::softmax");
+    }
+}
+
+} //end of namespace etl::impl::vec
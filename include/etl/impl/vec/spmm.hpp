@@ -0,0 +1,112 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the products between compressed sparse
+ * matrices and dense matrices.
+ *
+ * The indices of the sparse matrix are not contiguous, so only the columns
+ * of the dense matrices are vectorized: each non-zero scales a row of the
+ * right-hand side into a row of the result. The products with vectors are
+ * not vectorized.
+ */
+
+#pragma once
+
+#include "etl/impl/std/spmm.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized sparse-dense products are
+ * possible for the given value type.
+ *
+ * \tparam V The vector mode
+ * \tparam T The value type
+ */
+template <vector_mode_t V, typename T>
+constexpr bool spmm_possible = vec_enabled&& vectorize_impl&& is_floating_t<T>&& get_intrinsic_traits<V>::template type<T>::vectorizable;
+
+namespace detail {
+
+/*!
+ * \brief Compute y[first:last] += alpha * x[first:last]
+ * \param alpha The scale of x
+ * \param x The input vector
+ * \param y The output vector
+ * \param first The first element to compute
+ * \param last The end of the elements to compute
+ */
+template <typename V, typename T>
+void spmm_axpy(T alpha, const T* x, T* y, size_t first, size_t last) {
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    auto a1 = vec_type::set(alpha);
+
+    size_t j = first;
+
+    for (; j + 2 * vec_size - 1 < last; j += 2 * vec_size) {
+        auto y1 = vec_type::fmadd(a1, vec_type::loadu(x + j), vec_type::loadu(y + j));
+        auto y2 = vec_type::fmadd(a1, vec_type::loadu(x + j + vec_size), vec_type::loadu(y + j + vec_size));
+
+        vec_type::storeu(y + j, y1);
+        vec_type::storeu(y + j + vec_size, y2);
+    }
+
+    for (; j + vec_size - 1 < last; j += vec_size) {
+        vec_type::storeu(y + j, vec_type::fmadd(a1, vec_type::loadu(x + j), vec_type::loadu(y + j)));
+    }
+
+    etl::impl::standard::detail::spmm_axpy(alpha, x, y, j, last);
+}
+
+} //end of namespace detail
+
+/*!
+ * \copydoc etl::impl::standard::csr_mm
+ */
+template <typename T, typename I>
+void csr_mm(const etl::impl::standard::compressed_view<T, I>& a, const T* b, T* c, size_t n) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = first; i < last; ++i) {
+            T* c_row = c + i * n;
+
+            std::fill_n(c_row, n, T(0));
+
+            for (size_t p = a.outer[i]; p < a.outer[i + 1]; ++p) {
+                detail::spmm_axpy<default_vec>(a.values[p], b + size_t(a.inner[p]) * n, c_row, 0, n);
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, a.outers, a.non_zeros() * n >= parallel_threshold);
+}
+
+/*!
+ * \copydoc etl::impl::standard::csc_mm
+ */
+template <typename T, typename I>
+void csc_mm(const etl::impl::standard::compressed_view<T, I>& a, const T* b, T* c, size_t m, size_t n) {
+    auto batch_fun = [&](const size_t first, const size_t last) {
+        for (size_t i = 0; i < m; ++i) {
+            std::fill(c + i * n + first, c + i * n + last, T(0));
+        }
+
+        for (size_t k = 0; k < a.outers; ++k) {
+            for (size_t p = a.outer[k]; p < a.outer[k + 1]; ++p) {
+                detail::spmm_axpy<default_vec>(a.values[p], b + k * n, c + size_t(a.inner[p]) * n, first, last);
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, n, a.non_zeros() * n >= parallel_threshold);
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,42 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the singular value decomposition of
+ * square matrices.
+ *
+ * The algorithms are the ones of the standard implementation, with the
+ * vectorized row kernels of the symmetric eigendecomposition.
+ */
+
+#pragma once
+
+#include "etl/impl/std/svd.hpp"
+#include "etl/impl/vec/eigh.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized singular value decomposition
+ * is possible for the given value type.
+ *
+ * \tparam V The vector mode
+ * \tparam T The value type
+ */
+template <vector_mode_t V, typename T>
+constexpr bool svd_possible = eigh_possible<V, T>;
+
+/*!
+ * \copydoc etl::impl::standard::svd
+ */
+template <typename T>
+bool svd(T* a, T* s, T* u, T* v, size_t n) {
+    return etl::impl::standard::detail::svd_blocked<detail::eigen_kernels<default_vec>>(a, s, u, v, n);
+}
+
+} //end of namespace etl::impl::vec
@@ -0,0 +1,200 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the triangular products (TRMM), of the
+ * diagonal scaling and of the symmetric rank-k products (SYRK).
+ *
+ * The triangular and symmetric products are done by blocks of rows with the
+ * dense GEMM kernels, skipping the blocks that are known to be zero or that
+ * are known by symmetry.
+ */
+
+#pragma once
+
+#include "etl/impl/std/trmm.hpp"
+#include "etl/impl/vec/gemm.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized structured products are
+ * possible for the given value type.
+ *
+ * \tparam V The vector mode
+ * \tparam T The value type
+ */
+template <vector_mode_t V, typename T>
+constexpr bool trmm_possible = vec_enabled&& vectorize_impl&& is_floating_t<T>&& get_intrinsic_traits<V>::template type<T>::vectorizable;
+
+/*!
+ * \brief The number of rows of the blocks of the triangular and symmetric
+ * products
+ */
+constexpr size_t trmm_block_size = 128;
+
+/*!
+ * \brief The number of columns of the tiles used to copy the transposition
+ * of a triangular matrix in a panel
+ */
+constexpr size_t trmm_tile_size = 16;
+
+/*!
+ * \copydoc etl::impl::standard::trmm_lower
+ */
+template <bool Trans, typename T>
+void trmm_lower(const T* l, const T* b, T* c, size_t n, size_t m) {
+    std::vector<T> panel(std::min(trmm_block_size, n) * n);
+
+    for (size_t k = 0; k < n; k += trmm_block_size) {
+        const size_t h = std::min(trmm_block_size, n - k);
+        const size_t e = k + h;
+
+        // C(k:e) = L(k:e, 0:e) * B(0:e), the diagonal block is completed with zeros
+
+        if constexpr (Trans) {
+            for (size_t jj = 0; jj < e; jj += trmm_tile_size) {
+                for (size_t i = 0; i < h; ++i) {
+                    for (size_t j = jj; j < std::min(jj + trmm_tile_size, e); ++j) {
+                        panel[i * e + j] = j <= k + i ? l[j * n + k + i] : T(0);
+                    }
+                }
+            }
+        } else {
+            for (size_t i = 0; i < h; ++i) {
+                T* p_i = panel.data() + i * e;
+
+                std::copy_n(l + (k + i) * n, k + i + 1, p_i);
+                std::fill(p_i + k + i + 1, p_i + e, T(0));
+            }
+        }
+
+        gemm_rr_to_r(panel.data(), b, c + k * m, h, m, e, T(1));
+    }
+}
+
+/*!
+ * \copydoc etl::impl::standard::trmm_upper
+ */
+template <bool Trans, typename T>
+void trmm_upper(const T* u, const T* b, T* c, size_t n, size_t m) {
+    std::vector<T> panel(std::min(trmm_block_size, n) * n);
+
+    for (size_t k = 0; k < n; k += trmm_block_size) {
+        const size_t h = std::min(trmm_block_size, n - k);
+        const size_t w = n - k;
+
+        // C(k:e) = U(k:e, k:n) * B(k:n), the diagonal block is completed with zeros
+
+        if constexpr (Trans) {
+            for (size_t jj = 0; jj < w; jj += trmm_tile_size) {
+                for (size_t i = 0; i < h; ++i) {
+                    for (size_t j = jj; j < std::min(jj + trmm_tile_size, w); ++j) {
+                        panel[i * w + j] = i <= j ? u[(k + j) * n + k + i] : T(0);
+                    }
+                }
+            }
+        } else {
+            for (size_t i = 0; i < h; ++i) {
+                T* p_i = panel.data() + i * w;
+
+                std::fill_n(p_i, i, T(0));
+                std::copy_n(u + (k + i) * n + k + i, w - i, p_i + i);
+            }
+        }
+
+        gemm_rr_to_r(panel.data(), b + k * m, c + k * m, h, m, w, T(1));
+    }
+}
+
+/*!
+ * \copydoc etl::impl::standard::diag_scale_left
+ */
+template <typename T>
+void diag_scale_left(const T* d, const T* b, T* c, size_t n, size_t m) {
+    using vec_type = default_vec;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    for (size_t i = 0; i < n; ++i) {
+        const T* b_i = b + i * m;
+        T* c_i       = c + i * m;
+
+        auto d1 = vec_type::set(d[i]);
+
+        size_t j = 0;
+
+        for (; j + vec_size - 1 < m; j += vec_size) {
+            vec_type::storeu(c_i + j, vec_type::mul(d1, vec_type::loadu(b_i + j)));
+        }
+
+        for (; j < m; ++j) {
+            c_i[j] = d[i] * b_i[j];
+        }
+    }
+}
+
+/*!
+ * \copydoc etl::impl::standard::diag_scale_right
+ */
+template <typename T>
+void diag_scale_right(const T* b, const T* d, T* c, size_t m, size_t n) {
+    using vec_type = default_vec;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+
+    for (size_t i = 0; i < m; ++i) {
+        const T* b_i = b + i * n;
+        T* c_i       = c + i * n;
+
+        size_t j = 0;
+
+        for (; j + vec_size - 1 < n; j += vec_size) {
+            vec_type::storeu(c_i + j, vec_type::mul(vec_type::loadu(b_i + j), vec_type::loadu(d + j)));
+        }
+
+        for (; j < n; ++j) {
+            c_i[j] = b_i[j] * d[j];
+        }
+    }
+}
+
+/*!
+ * \copydoc etl::impl::standard::syrk
+ */
+template <typename T>
+void syrk(const T* a, T* c, size_t m, size_t k, T alpha) {
+    const size_t block = std::min(trmm_block_size, m);
+
+    std::vector<T> at(k * block);
+    std::vector<T> x(m * block);
+
+    for (size_t kk = 0; kk < m; kk += trmm_block_size) {
+        const size_t h = std::min(trmm_block_size, m - kk);
+        const size_t e = kk + h;
+
+        // X = alpha * A(0:e) * A(kk:e)^T are the columns kk:e of C, up to the diagonal
+
+        for (size_t i = 0; i < h; ++i) {
+            for (size_t p = 0; p < k; ++p) {
+                at[p * h + i] = a[(kk + i) * k + p];
+            }
+        }
+
+        gemm_rr_to_r(a, at.data(), x.data(), e, h, k, alpha);
+
+        for (size_t j = 0; j < e; ++j) {
+            for (size_t i = 0; i < h; ++i) {
+                c[j * m + kk + i]   = x[j * h + i];
+                c[(kk + i) * m + j] = x[j * h + i];
+            }
+        }
+    }
+}
+
+} //end of namespace etl::impl::vec
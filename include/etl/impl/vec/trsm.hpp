@@ -0,0 +1,141 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Vectorized implementation of the triangular solves (TRSM) and of the
+ * block update shared by the dense factorizations.
+ *
+ * Only the updates (C -= A * B) are vectorized, they are computed by the
+ * vectorized GEMM kernels. The diagonal blocks are done with the standard
+ * implementation.
+ */
+
+#pragma once
+
+#include "etl/impl/std/trsm.hpp"
+#include "etl/impl/vec/gemm.hpp"
+
+namespace etl::impl::vec {
+
+/*!
+ * \brief Traits indicating if the vectorized triangular solves are possible
+ * for the given value type.
+ *
+ * \tparam V The vector mode
+ * \tparam T The value type
+ */
+template <vector_mode_t V, typename T>
+constexpr bool trsm_possible = vec_enabled&& vectorize_impl&& is_floating_t<T>&& get_intrinsic_traits<V>::template type<T>::vectorizable;
+
+namespace detail {
+
+/*!
+ * \brief Pack a block of a row-major matrix into contiguous memory, if
+ * necessary.
+ *
+ * \param a The block [M, N]
+ * \param lda The distance between two rows of the block
+ * \param m The number of rows of the block
+ * \param n The number of columns of the block
+ * \param buffer The buffer used to pack the block
+ *
+ * \return a pointer to the contiguous block
+ */
+template <typename T>
+const T* pack_block(const T* a, size_t lda, size_t m, size_t n, std::vector<T>& buffer) {
+    if (lda == n) {
+        return a;
+    }
+
+    buffer.resize(m * n);
+
+    for (size_t i = 0; i < m; ++i) {
+        std::copy_n(a + i * lda, n, buffer.data() + i * n);
+    }
+
+    return buffer.data();
+}
+
+/*!
+ * \brief Compute C -= A * B on blocks of row-major matrices
+ *
+ * The product is computed by the vectorized GEMM kernel, panel of rows by
+ * panel of rows, into a temporary that is then subtracted from C. The inner
+ * dimension of the updates is the block size of the factorizations, for
+ * which the small kernel is faster than the BLAS-like ones.
+ *
+ * \param a The A block [M, K]
+ * \param lda The distance between two rows of A
+ * \param b The B block [K, N]
+ * \param ldb The distance between two rows of B
+ * \param c The C block [M, N]
+ * \param ldc The distance between two rows of C
+ * \param m The number of rows of A and C
+ * \param n The number of columns of B and C
+ * \param k The number of columns of A and rows of B
+ */
+template <typename V, typename T>
+void block_update(const T* a, size_t lda, const T* b, size_t ldb, T* c, size_t ldc, size_t m, size_t n, size_t k) {
+    if (!m || !n || !k) {
+        return;
+    }
+
+    using vec_type = V;
+
+    static constexpr size_t vec_size = vec_type::template traits<T>::size;
+    static constexpr size_t panel    = 64;
+
+    std::vector<T> a_buffer;
+    std::vector<T> b_buffer;
+
+    const T* ap = pack_block(a, lda, m, k, a_buffer);
+    const T* bp = pack_block(b, ldb, k, n, b_buffer);
+
+    auto x = aligned_allocate_auto<T>(std::min(m, panel) * n);
+
+    for (size_t ii = 0; ii < m; ii += panel) {
+        const size_t mm = std::min(panel, m - ii);
+
+        gemm_small_kernel_rr_to_r<V>(ap + ii * k, bp, x.get(), mm, n, k, gemm_epilogue<V, T>(T(1)));
+
+        for (size_t i = 0; i < mm; ++i) {
+            const T* x_i = x.get() + i * n;
+            T* c_i       = c + (ii + i) * ldc;
+
+            size_t j = 0;
+
+            for (; j + vec_size - 1 < n; j += vec_size) {
+                vec_type::storeu(c_i + j, vec_type::sub(vec_type::loadu(c_i + j), vec_type::loadu(x_i + j)));
+            }
+
+            for (; j < n; ++j) {
+                c_i[j] -= x_i[j];
+            }
+        }
+    }
+}
+
+} //end of namespace detail
+
+/*!
+ * \copydoc etl::impl::standard::trsm_lower
+ */
+template <bool Unit, typename T>
+void trsm_lower(const T* l, T* b, size_t n, size_t m) {
+    etl::impl::standard::detail::trsm_lower_blocked<Unit>(l, b, n, m, [](auto&&... args) { detail::block_update<default_vec>(args...); });
+}
+
+/*!
+ * \copydoc etl::impl::standard::trsm_upper
+ */
+template <bool Unit, typename T>
+void trsm_upper(const T* u, T* b, size_t n, size_t m) {
+    etl::impl::standard::detail::trsm_upper_blocked<Unit>(u, b, n, m, [](auto&&... args) { detail::block_update<default_vec>(args...); });
+}
+
+} //end of namespace etl::impl::vec
@@ -546,6 +546,159 @@ void im2col_direct_tr_multi(M& m, A&& sub, size_t k1, size_t k2) {
     }
 }
 
+/*!
+ * \brief Convert an image (or a sequence of channels) to a sequence of image columns to be multiplied by dilated kernels of size (k1,k2).
+ *
+ * The strides, the zero-padding and the dilation are directly applied during
+ * the conversion, each column holds exactly the input pixels of one output
+ * pixel. This version does not require any transposition when used.
+ *
+ * \param m The output matrix
+ * \param sub The input image (2D) or channels (3D)
+ * \param k1 The first dimension of the kernel
+ * \param k2 The second dimension of the kernel
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param d1 The dilation of the first dimension
+ * \param d2 The dilation of the second dimension
+ */
+template <typename A, typename M>
+void im2col_direct_tr_dilated(M& m, A&& sub, size_t k1, size_t k2, size_t s1, size_t s2, size_t p1, size_t p2, size_t d1, size_t d2) {
+    static_assert(all_dma<A, M>, "im2col_direct_tr_dilated has only been implemented for direct memory access");
+
+    using T = value_t<A>;
+
+    constexpr size_t D = decay_traits<A>::dimensions();
+
+    const size_t C  = D == 3 ? etl::dim(sub, 0) : 1;
+    const size_t i1 = etl::dim(sub, D - 2);
+    const size_t i2 = etl::dim(sub, D - 1);
+
+    const auto height = (i1 + 2 * p1 - (k1 - 1) * d1 - 1) / s1 + 1;
+    const auto width  = (i2 + 2 * p2 - (k2 - 1) * d2 - 1) / s2 + 1;
+
+    const auto mm = m.memory_start();
+    const auto ss = sub.memory_start();
+
+    for (size_t c = 0; c < C * k1 * k2; ++c) {
+        const size_t w_source = c % k2;
+        const size_t h_source = (c / k2) % k1;
+        const size_t c_source = c / (k1 * k2);
+
+        // The output columns in [w_first, w_last) are inside the input
+        const size_t offset  = w_source * d2;
+        const size_t w_first = std::min(width, offset >= p2 ? 0 : (p2 - offset + s2 - 1) / s2);
+        const size_t w_last  = i2 + p2 > offset ? std::max(w_first, std::min(width, (i2 + p2 - offset - 1) / s2 + 1)) : w_first;
+
+        for (size_t h = 0; h < height; ++h) {
+            const size_t row = h * s1 + h_source * d1;
+
+            T* target = mm + (c * height + h) * width;
+
+            if (row < p1 || row - p1 >= i1) {
+                std::fill_n(target, width, T(0));
+                continue;
+            }
+
+            const T* source = ss + (c_source * i1 + row - p1) * i2;
+
+            std::fill_n(target, w_first, T(0));
+
+            if (s2 == 1) {
+                direct_copy_n(source + w_first + offset - p2, target + w_first, w_last - w_first);
+            } else {
+                for (size_t w = w_first; w < w_last; ++w) {
+                    target[w] = source[w * s2 + offset - p2];
+                }
+            }
+
+            std::fill_n(target + w_last, width - w_last, T(0));
+        }
+    }
+}
+
+/*!
+ * \brief Convert a volume (or a sequence of channels of volumes) to a sequence of volume columns to be multiplied by kernels of size (k1,k2,k3).
+ *
+ * The strides and the zero-padding are directly applied during the
+ * conversion, each column holds exactly the input voxels of one output voxel.
+ * This version does not require any transposition when used.
+ *
+ * \param m The output matrix
+ * \param sub The input volume (3D) or channels (4D)
+ * \param k1 The first dimension of the kernel
+ * \param k2 The second dimension of the kernel
+ * \param k3 The third dimension of the kernel
+ * \param s1 The stride of the first dimension
+ * \param s2 The stride of the second dimension
+ * \param s3 The stride of the third dimension
+ * \param p1 The padding of the first dimension
+ * \param p2 The padding of the second dimension
+ * \param p3 The padding of the third dimension
+ */
+template <typename A, typename M>
+void vol2col_direct_tr(M& m, A&& sub, size_t k1, size_t k2, size_t k3, size_t s1, size_t s2, size_t s3, size_t p1, size_t p2, size_t p3) {
+    static_assert(all_dma<A, M>, "vol2col_direct_tr has only been implemented for direct memory access");
+
+    using T = value_t<A>;
+
+    constexpr size_t D = decay_traits<A>::dimensions();
+
+    const size_t C  = D == 4 ? etl::dim(sub, 0) : 1;
+    const size_t i1 = etl::dim(sub, D - 3);
+    const size_t i2 = etl::dim(sub, D - 2);
+    const size_t i3 = etl::dim(sub, D - 1);
+
+    const auto depth  = (i1 + 2 * p1 - k1) / s1 + 1;
+    const auto height = (i2 + 2 * p2 - k2) / s2 + 1;
+    const auto width  = (i3 + 2 * p3 - k3) / s3 + 1;
+
+    const auto mm = m.memory_start();
+    const auto ss = sub.memory_start();
+
+    for (size_t c = 0; c < C * k1 * k2 * k3; ++c) {
+        const size_t w_source = c % k3;
+        const size_t h_source = (c / k3) % k2;
+        const size_t d_source = (c / (k2 * k3)) % k1;
+        const size_t c_source = c / (k1 * k2 * k3);
+
+        // The output columns in [w_first, w_last) are inside the input
+        const size_t w_first = std::min(width, w_source >= p3 ? 0 : (p3 - w_source + s3 - 1) / s3);
+        const size_t w_last  = i3 + p3 > w_source ? std::max(w_first, std::min(width, (i3 + p3 - w_source - 1) / s3 + 1)) : w_first;
+
+        for (size_t d = 0; d < depth; ++d) {
+            const size_t plane = d * s1 + d_source;
+
+            for (size_t h = 0; h < height; ++h) {
+                const size_t row = h * s2 + h_source;
+
+                T* target = mm + ((c * depth + d) * height + h) * width;
+
+                if (plane < p1 || plane - p1 >= i1 || row < p2 || row - p2 >= i2) {
+                    std::fill_n(target, width, T(0));
+                    continue;
+                }
+
+                const T* source = ss + ((c_source * i1 + plane - p1) * i2 + row - p2) * i3;
+
+                std::fill_n(target, w_first, T(0));
+
+                if (s3 == 1) {
+                    direct_copy_n(source + w_first + w_source - p3, target + w_first, w_last - w_first);
+                } else {
+                    for (size_t w = w_first; w < w_last; ++w) {
+                        target[w] = source[w * s3 + w_source - p3];
+                    }
+                }
+
+                std::fill_n(target + w_last, width - w_last, T(0));
+            }
+        }
+    }
+}
+
 /*!
  * \brief Specialization for mm_mul_transformer
  */
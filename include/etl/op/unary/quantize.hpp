@@ -0,0 +1,153 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief Round and saturate a scaled value into a quantized value
+ * \param x The floating point value, already scaled
+ * \param zero_point The zero point of the quantized value
+ * \tparam Q The quantized type
+ * \return The quantized value
+ */
+template <typename Q, typename T>
+Q saturate_quantized(T x, int32_t zero_point) noexcept {
+    const auto v = int64_t(std::nearbyint(x)) + zero_point;
+
+    return Q(std::min<int64_t>(std::max<int64_t>(v, std::numeric_limits<Q>::min()), std::numeric_limits<Q>::max()));
+}
+
+/*!
+ * \brief Unary operation that quantizes floating point values into integers
+ *
+ * q = saturate(round(x / scale) + zero_point)
+ *
+ * \tparam T the type of the input values
+ * \tparam Q the quantized type
+ */
+template <typename T, typename Q>
+struct quantize_op {
+    static constexpr bool linear      = true; ///< Indicates if the operator is linear or not
+    static constexpr bool thread_safe = true; ///< Indicates if the operator is thread safe or not
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = false;
+
+    /*!
+     * \brief Indicates if the operator can be computed on GPU
+     */
+    template <typename E>
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Estimate the complexity of operator
+     * \return An estimation of the complexity of the operator
+     */
+    static constexpr int complexity() {
+        return 1;
+    }
+
+    T inv_scale;        ///< The inverse of the quantization scale
+    int32_t zero_point; ///< The quantization zero point
+
+    /*!
+     * \brief Builds a new operator
+     * \param scale The quantization scale
+     * \param zero_point The quantization zero point
+     */
+    quantize_op(T scale, int32_t zero_point) : inv_scale(T(1) / scale), zero_point(zero_point) {}
+
+    /*!
+     * \brief Apply the unary operator on x
+     * \param x The value on which to apply the operator
+     * \return The result of applying the unary operator on x
+     */
+    Q apply(const T& x) const noexcept {
+        return saturate_quantized<Q>(x * inv_scale, zero_point);
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operator
+     * \return a string representing the operator
+     */
+    static std::string desc() noexcept {
+        return "quantize";
+    }
+};
+
+/*!
+ * \brief Unary operation that converts quantized integers back into
+ * floating point values
+ *
+ * x = scale * (q - zero_point)
+ *
+ * \tparam Q the quantized type
+ * \tparam T the type of the output values
+ */
+template <typename Q, typename T>
+struct dequantize_op {
+    static constexpr bool linear      = true; ///< Indicates if the operator is linear or not
+    static constexpr bool thread_safe = true; ///< Indicates if the operator is thread safe or not
+
+    /*!
+     * \brief Indicates if the expression is vectorizable using the
+     * given vector mode
+     * \tparam V The vector mode
+     */
+    template <vector_mode_t V>
+    static constexpr bool vectorizable = false;
+
+    /*!
+     * \brief Indicates if the operator can be computed on GPU
+     */
+    template <typename E>
+    static constexpr bool gpu_computable = false;
+
+    /*!
+     * \brief Estimate the complexity of operator
+     * \return An estimation of the complexity of the operator
+     */
+    static constexpr int complexity() {
+        return 1;
+    }
+
+    T scale;            ///< The quantization scale
+    int32_t zero_point; ///< The quantization zero point
+
+    /*!
+     * \brief Builds a new operator
+     * \param scale The quantization scale
+     * \param zero_point The quantization zero point
+     */
+    dequantize_op(T scale, int32_t zero_point) : scale(scale), zero_point(zero_point) {}
+
+    /*!
+     * \brief Apply the unary operator on x
+     * \param x The value on which to apply the operator
+     * \return The result of applying the unary operator on x
+     */
+    T apply(const Q& x) const noexcept {
+        return scale * T(int32_t(x) - zero_point);
+    }
+
+    /*!
+     * \brief Returns a textual representation of the operator
+     * \return a string representing the operator
+     */
+    static std::string desc() noexcept {
+        return "dequantize";
+    }
+};
+
+} //end of namespace etl
@@ -53,3 +53,4 @@
 #include "etl/op/unary/bernoulli.hpp"
 #include "etl/op/unary/noise.hpp"
 #include "etl/op/unary/clip.hpp"
+#include "etl/op/unary/quantize.hpp"
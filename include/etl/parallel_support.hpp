@@ -611,7 +611,8 @@ inline void engine_dispatch_1d_acc_slice(E&& expr, Functor&& functor, AccFunctor
         if (engine_select_parallel(n, threshold)) {
             const size_t T = std::min(n, threads);
 
-            std::vector<TT> futures(T);
+            // The partial results are kept in the accumulation type
+            std::vector<accumulate_t<TT>> futures(T);
 
             auto sub_functor = [&futures, &functor](size_t t, auto&& sub_expr) { futures[t] = functor(sub_expr); };
 
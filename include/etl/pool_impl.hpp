@@ -20,6 +20,7 @@ namespace etl {
  */
 enum class pool_impl {
     STD,  ///< Standard implementation
+    VEC,  ///< Vectorized implementation
     CUDNN ///< CUDNN (GPU) implementation
 };
 
@@ -0,0 +1,363 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Householder QR decomposition with an implicit Q factor
+ *
+ * Q is never formed explicitly: the Householder vectors are kept in compact
+ * WY form and Q or Q^T are applied with matrix products. For tall and skinny
+ * matrices, the TSQR variant decomposes blocks of rows independently, on the
+ * thread engine, and then decomposes the stacked R factors of the blocks.
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief A QR decomposition, A = Q * R, of a [M, N] matrix
+ *
+ * \tparam T The type of value
+ */
+template <typename T>
+struct qr_decomposition {
+    static_assert(std::is_floating_point_v<T>, "QR decomposition is only implemented for floating point types");
+
+    using value_type = T; ///< The type of value
+
+private:
+    /*!
+     * \brief The compact QR decomposition of a block of rows
+     */
+    struct qr_block {
+        size_t first = 0;    ///< The first row of the block
+        size_t rows  = 0;    ///< The number of rows of the block
+        dyn_matrix<T, 2> qr; ///< R and the Householder vectors
+        std::vector<T> t;    ///< The T factors of the panels
+
+        /*!
+         * \brief Decompose the block in place
+         */
+        void factorize() {
+            const size_t n = etl::dim<1>(qr);
+
+            t.resize(std::min(rows, n) * impl::standard::qr_block_size);
+
+            detail::qr_factor(qr.memory_start(), t.data(), rows, n);
+        }
+    };
+
+    size_t _rows;                 ///< The number of rows of the decomposed matrix
+    size_t _columns;              ///< The number of columns of the decomposed matrix
+    std::vector<qr_block> leaves; ///< The decompositions of the blocks of rows
+    qr_block top;                 ///< The decomposition of the stacked R of the leaves (only with several leaves)
+
+    /*!
+     * \brief Returns the decomposition holding R
+     */
+    const qr_block& root() const {
+        return leaves.size() > 1 ? top : leaves.front();
+    }
+
+    /*!
+     * \brief Apply Q, or Q^T, to a row-major matrix in place
+     * \param c The matrix to transform [M, K]
+     * \param k The number of columns of c
+     */
+    template <bool Trans>
+    void apply(T* c, size_t k) const {
+        const size_t n = _columns;
+
+        auto leaves_fun = [&](const size_t first, const size_t last) {
+            for (size_t b = first; b < last; ++b) {
+                auto& leaf = leaves[b];
+
+                if constexpr (Trans) {
+                    detail::qr_apply_qt(leaf.qr.memory_start(), leaf.t.data(), leaf.rows, n, c + leaf.first * k, k);
+                } else {
+                    detail::qr_apply_q(leaf.qr.memory_start(), leaf.t.data(), leaf.rows, n, c + leaf.first * k, k);
+                }
+            }
+        };
+
+        if (leaves.size() == 1) {
+            leaves_fun(0, 1);
+            return;
+        }
+
+        // Q = diag(Q_1, ..., Q_p) * Q_top, where Q_top acts on the first N
+        // rows of each block
+
+        if constexpr (Trans) {
+            engine_dispatch_1d_serial(leaves_fun, 0, leaves.size(), true);
+        }
+
+        std::vector<T> s(top.rows * k);
+
+        for (size_t b = 0; b < leaves.size(); ++b) {
+            std::copy_n(c + leaves[b].first * k, n * k, s.data() + b * n * k);
+        }
+
+        if constexpr (Trans) {
+            detail::qr_apply_qt(top.qr.memory_start(), top.t.data(), top.rows, n, s.data(), k);
+        } else {
+            detail::qr_apply_q(top.qr.memory_start(), top.t.data(), top.rows, n, s.data(), k);
+        }
+
+        for (size_t b = 0; b < leaves.size(); ++b) {
+            std::copy_n(s.data() + b * n * k, n * k, c + leaves[b].first * k);
+        }
+
+        if constexpr (!Trans) {
+            engine_dispatch_1d_serial(leaves_fun, 0, leaves.size(), true);
+        }
+    }
+
+    /*!
+     * \brief Apply Q, or Q^T, to a vector or a matrix in place
+     * \param b The vector or matrix to transform
+     */
+    template <bool Trans, typename B>
+    void apply_to(B&& b) const {
+        static_assert(is_etl_expr<B>, "QR decomposition can only be applied to ETL expressions");
+        static_assert(is_1d<B> || is_2d<B>, "QR decomposition can only be applied to vectors and matrices");
+
+        cpp_assert(etl::dim<0>(b) == _rows, "Invalid number of rows for the application of Q");
+
+        const size_t k = is_1d<B> ? 1 : etl::dim(b, 1);
+
+        if constexpr (is_dma<B> && is_row_major<B> && std::is_same_v<value_t<B>, T> && !is_adapter<B>) {
+            b.ensure_cpu_up_to_date();
+
+            apply<Trans>(b.memory_start(), k);
+
+            b.invalidate_gpu();
+        } else {
+            dyn_matrix<T, decay_traits<B>::dimensions()> tmp;
+
+            if constexpr (is_1d<B>) {
+                tmp.resize(_rows);
+            } else {
+                tmp.resize(_rows, k);
+            }
+
+            tmp = b;
+
+            apply<Trans>(tmp.memory_start(), k);
+
+            b = tmp;
+        }
+    }
+
+public:
+    /*!
+     * \brief Decompose the given matrix
+     *
+     * With several blocks, the rows are split in blocks (of at least N rows)
+     * that are decomposed in parallel, this is the TSQR decomposition.
+     *
+     * \param a The matrix to decompose
+     * \param blocks The maximum number of blocks of rows
+     */
+    template <typename E, cpp_enable_iff(is_etl_expr<E>)>
+    explicit qr_decomposition(E&& a, size_t blocks = 1) : _rows(etl::dim<0>(a)), _columns(etl::dim<1>(a)) {
+        static_assert(is_2d<E>, "QR decomposition is only defined for matrices");
+
+        const size_t m = _rows;
+        const size_t n = _columns;
+
+        // Each block must have at least as many rows as columns
+        const size_t p = std::max(size_t(1), std::min(blocks, n ? m / n : size_t(1)));
+
+        leaves.resize(p);
+
+        if (p == 1) {
+            leaves[0].rows = m;
+            leaves[0].qr.resize(m, n);
+            leaves[0].qr = a;
+            leaves[0].factorize();
+            return;
+        }
+
+        for (size_t b = 0; b < p; ++b) {
+            auto& leaf = leaves[b];
+
+            leaf.first = b * m / p;
+            leaf.rows  = (b + 1) * m / p - leaf.first;
+
+            leaf.qr.resize(leaf.rows, n);
+            leaf.qr = slice(a, leaf.first, leaf.first + leaf.rows);
+        }
+
+        engine_dispatch_1d_serial([&](const size_t first, const size_t last) {
+            for (size_t b = first; b < last; ++b) {
+                leaves[b].factorize();
+            }
+        }, 0, p, true);
+
+        // Decompose the stacked R factors
+
+        top.rows = p * n;
+        top.qr.resize(p * n, n);
+        top.qr = T(0);
+
+        for (size_t b = 0; b < p; ++b) {
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = i; j < n; ++j) {
+                    top.qr(b * n + i, j) = leaves[b].qr(i, j);
+                }
+            }
+        }
+
+        top.factorize();
+    }
+
+    /*!
+     * \brief Returns the number of rows of the decomposed matrix
+     */
+    size_t rows() const noexcept {
+        return _rows;
+    }
+
+    /*!
+     * \brief Returns the number of columns of the decomposed matrix
+     */
+    size_t columns() const noexcept {
+        return _columns;
+    }
+
+    /*!
+     * \brief Returns the upper triangular factor R [min(M, N), N]
+     */
+    dyn_matrix<T, 2> r() const {
+        const size_t k = std::min(_rows, _columns);
+
+        dyn_matrix<T, 2> r(k, _columns, T(0));
+
+        for (size_t i = 0; i < k; ++i) {
+            for (size_t j = i; j < _columns; ++j) {
+                r(i, j) = root().qr(i, j);
+            }
+        }
+
+        return r;
+    }
+
+    /*!
+     * \brief Returns the first min(M, N) columns of the orthogonal factor Q
+     */
+    dyn_matrix<T, 2> q() const {
+        const size_t k = std::min(_rows, _columns);
+
+        dyn_matrix<T, 2> q(_rows, k, T(0));
+
+        for (size_t i = 0; i < k; ++i) {
+            q(i, i) = 1;
+        }
+
+        apply<false>(q.memory_start(), k);
+
+        return q;
+    }
+
+    /*!
+     * \brief Replace b by Q * b
+     * \param b The vector [M] or matrix [M, K] to transform
+     */
+    template <typename B>
+    void apply_q(B&& b) const {
+        apply_to<false>(b);
+    }
+
+    /*!
+     * \brief Replace b by Q^T * b
+     * \param b The vector [M] or matrix [M, K] to transform
+     */
+    template <typename B>
+    void apply_qt(B&& b) const {
+        apply_to<true>(b);
+    }
+
+    /*!
+     * \brief Solve the least squares problem min ||A * x - b||
+     *
+     * A must have at least as many rows as columns and be of full rank.
+     *
+     * \param b The right-hand side vector [M] or matrix [M, K]
+     * \return the solution [N] or [N, K]
+     */
+    template <typename B>
+    dyn_matrix<T, decay_traits<B>::dimensions()> solve(B&& b) const {
+        static_assert(is_etl_expr<B>, "QR decomposition can only solve ETL expressions");
+        static_assert(is_1d<B> || is_2d<B>, "QR decomposition can only solve vectors and matrices");
+
+        cpp_assert(_rows >= _columns, "Least squares are only solved for M >= N");
+        cpp_assert(etl::dim<0>(b) == _rows, "Invalid number of rows for the right-hand side");
+
+        const size_t n = _columns;
+        const size_t k = is_1d<B> ? 1 : etl::dim(b, 1);
+
+        dyn_matrix<T, decay_traits<B>::dimensions()> c;
+        dyn_matrix<T, decay_traits<B>::dimensions()> x;
+
+        if constexpr (is_1d<B>) {
+            c.resize(_rows);
+            x.resize(n);
+        } else {
+            c.resize(_rows, k);
+            x.resize(n, k);
+        }
+
+        c = b;
+
+        // R * x = (Q^T * b)[0:N]
+
+        apply<true>(c.memory_start(), k);
+
+        detail::trsm_upper<false>(root().qr.memory_start(), c.memory_start(), n, k);
+
+        std::copy_n(c.memory_start(), n * k, x.memory_start());
+
+        return x;
+    }
+};
+
+/*!
+ * \brief Compute the blocked Householder QR decomposition of the given
+ * matrix, with an implicit Q factor.
+ *
+ * \param a The matrix to decompose
+ * \return the QR decomposition of a
+ */
+template <typename E>
+qr_decomposition<value_t<E>> qr(E&& a) {
+    static_assert(is_etl_expr<E>, "QR decomposition only supported for ETL expressions");
+
+    return qr_decomposition<value_t<E>>(a);
+}
+
+/*!
+ * \brief Compute the tall and skinny QR decomposition (TSQR) of the given
+ * matrix, with an implicit Q factor.
+ *
+ * The rows are split in blocks that are decomposed in parallel and the
+ * stacked R factors of the blocks are then decomposed. Each block has at
+ * least as many rows as the matrix has columns.
+ *
+ * \param a The matrix to decompose
+ * \param blocks The maximum number of blocks of rows
+ * \return the QR decomposition of a
+ */
+template <typename E>
+qr_decomposition<value_t<E>> tsqr(E&& a, size_t blocks = etl::threads) {
+    static_assert(is_etl_expr<E>, "QR decomposition only supported for ETL expressions");
+
+    return qr_decomposition<value_t<E>>(a, blocks);
+}
+
+} //end of namespace etl
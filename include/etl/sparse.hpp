@@ -199,6 +199,42 @@ bool is_non_zero(T value) {
     return !is_zero(value);
 }
 
+/*!
+ * \brief Traits indicating if a sparse matrix can be assigned to the given
+ * expression by scattering its non-zeros directly into its memory.
+ * \tparam L The left hand side expression
+ */
+template <typename L>
+constexpr bool direct_scatter = is_dma<L> && decay_traits<L>::dimensions() == 2;
+
+/*!
+ * \brief Assign a sparse matrix to a dense matrix, only writing the
+ * non-zeros after clearing the dense matrix
+ * \param sparse The sparse matrix
+ * \param lhs The dense matrix
+ */
+template <typename S, typename L>
+void scatter_to_dense(const S& sparse, L&& lhs) {
+    using lhs_value_type = value_t<L>;
+
+    auto* memory = lhs.memory_start();
+
+    std::fill_n(memory, etl::size(lhs), lhs_value_type(0));
+
+    if constexpr (decay_traits<L>::storage_order == order::RowMajor) {
+        const size_t columns = etl::dim<1>(lhs);
+
+        sparse.for_each_non_zero([memory, columns](size_t i, size_t j, auto v) { memory[i * columns + j] = v; });
+    } else {
+        const size_t rows = etl::dim<0>(lhs);
+
+        sparse.for_each_non_zero([memory, rows](size_t i, size_t j, auto v) { memory[i + j * rows] = v; });
+    }
+
+    lhs.validate_cpu();
+    lhs.invalidate_gpu();
+}
+
 } //end of namespace sparse_detail
 
 /*!
@@ -206,23 +242,25 @@ bool is_non_zero(T value) {
  * \tparam T The type of value
  * \tparam SS The storage type
  * \tparam D The number of dimensions
+ * \tparam I The type used to store the indices
  */
-template <typename T, sparse_storage SS, size_t D>
+template <typename T, sparse_storage SS, size_t D, typename I>
 struct sparse_matrix_impl;
 
 /*!
  * \brief Sparse matrix implementation with COO storage type
  * \tparam T The type of value
  * \tparam D The number of dimensions
+ * \tparam I The type used to store the indices
  */
-template <typename T, size_t D>
-struct sparse_matrix_impl<T, sparse_storage::COO, D> final : dyn_base<sparse_matrix_impl<T, sparse_storage::COO, D>, T, D> {
+template <typename T, size_t D, typename I>
+struct sparse_matrix_impl<T, sparse_storage::COO, D, I> final : dyn_base<sparse_matrix_impl<T, sparse_storage::COO, D, I>, T, D> {
     static constexpr size_t n_dimensions           = D;                                      ///< The number of dimensions
     static constexpr sparse_storage storage_format = sparse_storage::COO;                    ///< The sparse storage scheme
     static constexpr order storage_order           = order::RowMajor;                        ///< The storage order
     static constexpr size_t alignment              = default_intrinsic_traits<T>::alignment; ///< The alignment
 
-    using this_type              = sparse_matrix_impl<T, sparse_storage::COO, D>;    ///< this type
+    using this_type              = sparse_matrix_impl<T, sparse_storage::COO, D, I>; ///< this type
     using base_type              = dyn_base<this_type, T, D>;                        ///< The base type
     using reference_type         = sparse_detail::sparse_reference<this_type>;       ///< The type of reference returned by the functions
     using const_reference_type   = sparse_detail::sparse_reference<const this_type>; ///< The type of const reference returned by the functions
@@ -230,7 +268,7 @@ struct sparse_matrix_impl<T, sparse_storage::COO, D> final : dyn_base<sparse_mat
     using dimension_storage_impl = std::array<size_t, n_dimensions>;                 ///< The type used to store the dimensions
     using memory_type            = value_type*;                                      ///< The memory type
     using const_memory_type      = const value_type*;                                ///< The const memory type
-    using index_type             = size_t;                                           ///< The type used to store the COO index
+    using index_type             = I;                                                ///< The type used to store the COO index
     using index_memory_type      = index_type*;                                      ///< The memory type to the COO index
 
     friend struct sparse_detail::sparse_reference<this_type>;
@@ -245,46 +283,135 @@ private:
     index_memory_type _row_index; ///< The row index
     index_memory_type _col_index; ///< The column index
     size_t nnz;                   ///< The number of nonzeros in the matrix
+    size_t capacity;              ///< The number of values that can be stored without reallocation
 
     using base_type::allocate;
     using base_type::check_invariants;
     using base_type::release;
 
+    template <typename T2, typename I2>
+    friend struct sparse_builder;
+
+    /*!
+     * \brief Release all the memory of the matrix
+     */
+    void release_all() noexcept {
+        if (_memory) {
+            release(_memory, capacity);
+            release(_row_index, capacity);
+            release(_col_index, capacity);
+        }
+
+        _memory    = nullptr;
+        _row_index = nullptr;
+        _col_index = nullptr;
+        nnz        = 0;
+        capacity   = 0;
+    }
+
+    /*!
+     * \brief Build the content of the sparse matrix from a source of
+     * non-zeros.
+     *
+     * The source is a functor that emits each non-zero, as (i, j, value), to
+     * the functor it is given. It is called twice, once to count the non-zeros
+     * of each row and once to store them. For each row, the source must emit
+     * the non-zeros by increasing column.
+     *
+     * \param source The source of non-zeros
+     */
+    template <typename Source>
+    void build_from_source(Source&& source) {
+        // 1. Count the non-zeros of each row
+
+        std::vector<size_t> next(rows() + 1, 0);
+
+        source([&next](size_t i, size_t, value_type) { ++next[i + 1]; });
+
+        std::partial_sum(next.begin(), next.end(), next.begin());
+
+        const size_t new_nnz = next.back();
+
+        cpp_assert(new_nnz <= size_t(std::numeric_limits<index_type>::max()), "Too many non-zeros for the index type");
+
+        // 2. Store the non-zeros sorted by rows
+
+        memory_type new_memory          = nullptr;
+        index_memory_type new_row_index = nullptr;
+        index_memory_type new_col_index = nullptr;
+
+        if (new_nnz) {
+            new_memory    = allocate(new_nnz);
+            new_row_index = base_type::template allocate<index_type>(new_nnz);
+            new_col_index = base_type::template allocate<index_type>(new_nnz);
+
+            source([&](size_t i, size_t j, value_type v) {
+                auto n = next[i]++;
+
+                new_memory[n]    = v;
+                new_row_index[n] = i;
+                new_col_index[n] = j;
+            });
+        }
+
+        release_all();
+
+        _memory    = new_memory;
+        _row_index = new_row_index;
+        _col_index = new_col_index;
+        nnz        = new_nnz;
+        capacity   = new_nnz;
+    }
+
     /*!
      * \brief Build the content of the sparse matrix from an
      * iterable collection
      */
     template <typename It>
     void build_from_iterable(const It& iterable) {
-        nnz = 0;
-        for (auto v : iterable) {
-            if (sparse_detail::is_non_zero(v)) {
-                ++nnz;
-            }
-        }
+        const size_t n = columns();
 
-        if (nnz > 0) {
-            //Allocate space for the three arrays
-            _memory    = allocate(nnz);
-            _row_index = base_type::template allocate<index_type>(nnz);
-            _col_index = base_type::template allocate<index_type>(nnz);
+        build_from_source([&iterable, n](auto&& emit) {
+            size_t k = 0;
 
-            auto it  = iterable.begin();
-            size_t n = 0;
+            for (auto v : iterable) {
+                if (sparse_detail::is_non_zero(v)) {
+                    emit(k / n, k % n, value_type(v));
+                }
 
-            for (size_t i = 0; i < rows(); ++i) {
-                for (size_t j = 0; j < columns(); ++j) {
-                    if (sparse_detail::is_non_zero(*it)) {
-                        _memory[n]    = *it;
-                        _row_index[n] = i;
-                        _col_index[n] = j;
-                        ++n;
-                    }
+                ++k;
+            }
+        });
+    }
+
+    /*!
+     * \brief Build the content of the sparse matrix from another sparse
+     * matrix, possibly of another storage format.
+     */
+    template <typename S>
+    void build_from_sparse(const S& rhs) {
+        build_from_source([&rhs](auto&& emit) { rhs.for_each_non_zero(emit); });
+    }
 
-                    ++it;
+    /*!
+     * \brief Build the content of the sparse matrix from a structural
+     * expression of sparse matrices, without going through the zeros of the
+     * expression.
+     *
+     * All the non-zeros are computed before the current content is released,
+     * so the expression can use this matrix.
+     */
+    template <typename E>
+    void build_from_structural(const E& e) {
+        const sparse_detail::structural_node<std::decay_t<E>> node(e);
+
+        build_from_source([&node, m = rows()](auto&& emit) {
+            sparse_detail::structural_for_each(node, m, [&emit](size_t i, size_t j, value_type v) {
+                if (sparse_detail::is_non_zero(v)) {
+                    emit(i, j, v);
                 }
-            }
-        }
+            });
+        });
     }
 
     /*!
@@ -293,43 +420,35 @@ private:
     void reserve_hint(size_t hint) {
         cpp_assert(hint < nnz + 1, "Invalid hint for reserve_hint");
 
-        if (_memory) {
-            auto new_memory    = allocate(nnz + 1);
-            auto new_row_index = base_type::template allocate<index_type>(nnz + 1);
-            auto new_col_index = base_type::template allocate<index_type>(nnz + 1);
+        if (nnz == capacity) {
+            // Grow geometrically, for amortized constant-time reallocation
+            const size_t new_capacity = std::max(size_t(8), 2 * capacity);
+
+            auto new_memory    = allocate(new_capacity);
+            auto new_row_index = base_type::template allocate<index_type>(new_capacity);
+            auto new_col_index = base_type::template allocate<index_type>(new_capacity);
 
-            if (hint == nnz) {
-                //Copy the elements
+            if (_memory) {
                 std::copy_n(_memory, nnz, new_memory);
                 std::copy_n(_row_index, nnz, new_row_index);
                 std::copy_n(_col_index, nnz, new_col_index);
-            } else {
-                //Copy the elements before hint
-                std::copy(_memory, _memory + hint, new_memory);
-                std::copy(_row_index, _row_index + hint, new_row_index);
-                std::copy(_col_index, _col_index + hint, new_col_index);
-
-                //Copy the elements after hint
-                std::copy(_memory + hint, _memory + nnz, new_memory + hint + 1);
-                std::copy(_row_index + hint, _row_index + nnz, new_row_index + hint + 1);
-                std::copy(_col_index + hint, _col_index + nnz, new_col_index + hint + 1);
-            }
 
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
+                release(_memory, capacity);
+                release(_row_index, capacity);
+                release(_col_index, capacity);
+            }
 
             _memory    = new_memory;
-            _col_index = new_col_index;
             _row_index = new_row_index;
-        } else {
-            cpp_assert(hint == 0, "Invalid hint for reserve_hint");
-
-            _memory    = allocate(nnz + 1);
-            _row_index = base_type::template allocate<index_type>(nnz + 1);
-            _col_index = base_type::template allocate<index_type>(nnz + 1);
+            _col_index = new_col_index;
+            capacity   = new_capacity;
         }
 
+        //Make room for the new element
+        std::copy_backward(_memory + hint, _memory + nnz, _memory + nnz + 1);
+        std::copy_backward(_row_index + hint, _row_index + nnz, _row_index + nnz + 1);
+        std::copy_backward(_col_index + hint, _col_index + nnz, _col_index + nnz + 1);
+
         ++nnz;
     }
 
@@ -339,41 +458,9 @@ private:
     void erase_hint(size_t n) {
         cpp_assert(nnz > 0, "Invalid erase_hint call (no non-zero elements");
 
-        if (nnz == 1) {
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
-
-            _memory    = nullptr;
-            _row_index = nullptr;
-            _col_index = nullptr;
-        } else {
-            auto new_memory    = allocate(nnz - 1);
-            auto new_row_index = base_type::template allocate<index_type>(nnz - 1);
-            auto new_col_index = base_type::template allocate<index_type>(nnz - 1);
-
-            if (n == nnz - 1) {
-                std::copy_n(_memory, nnz - 1, new_memory);
-                std::copy_n(_row_index, nnz - 1, new_row_index);
-                std::copy_n(_col_index, nnz - 1, new_col_index);
-            } else {
-                std::copy(_memory, _memory + n, new_memory);
-                std::copy(_row_index, _row_index + n, new_row_index);
-                std::copy(_col_index, _col_index + n, new_col_index);
-
-                std::copy(_memory + n + 1, _memory + nnz, new_memory + n);
-                std::copy(_row_index + n + 1, _row_index + nnz, new_row_index + n);
-                std::copy(_col_index + n + 1, _col_index + nnz, new_col_index + n);
-            }
-
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
-
-            _memory    = new_memory;
-            _row_index = new_row_index;
-            _col_index = new_col_index;
-        }
+        std::copy(_memory + n + 1, _memory + nnz, _memory + n);
+        std::copy(_row_index + n + 1, _row_index + nnz, _row_index + n);
+        std::copy(_col_index + n + 1, _col_index + nnz, _col_index + n);
 
         --nnz;
     }
@@ -384,19 +471,21 @@ private:
      * already taken if its place of insertion is already taken.
      */
     size_t find_n(size_t i, size_t j) const noexcept {
-        for (size_t n = 0; n < nnz; ++n) {
-            //The value exists, modify it
-            if (_row_index[n] == i && _col_index[n] == j) {
-                return n;
-            }
+        // Binary search of the first element not before (i,j)
+        size_t first = 0;
+        size_t last  = nnz;
 
-            //The insertion point has been found
-            if ((_row_index[n] == i && _col_index[n] > j) || _row_index[n] > i) {
-                return n;
+        while (first < last) {
+            const size_t n = first + (last - first) / 2;
+
+            if (_row_index[n] < i || (_row_index[n] == i && _col_index[n] < j)) {
+                first = n + 1;
+            } else {
+                last = n;
             }
         }
 
-        return nnz;
+        return first;
     }
 
     /*!
@@ -510,7 +599,7 @@ public:
     /*!
      * \brief Constructs a new empty sparse matrix
      */
-    sparse_matrix_impl() noexcept : base_type(), _memory(nullptr), _row_index(nullptr), _col_index(nullptr), nnz(0) {
+    sparse_matrix_impl() noexcept : base_type(), _memory(nullptr), _row_index(nullptr), _col_index(nullptr), nnz(0), capacity(0) {
         //Nothing else to init
     }
 
@@ -520,7 +609,7 @@ public:
      */
     template <typename... S, cpp_enable_iff(sizeof...(S) == D && cpp::all_convertible_to_v<size_t, S...>)>
     explicit sparse_matrix_impl(S... sizes) noexcept
-            : base_type(util::size(sizes...), {{static_cast<size_t>(sizes)...}}), _memory(nullptr), _row_index(nullptr), _col_index(nullptr), nnz(0) {
+            : base_type(util::size(sizes...), {{static_cast<size_t>(sizes)...}}), _memory(nullptr), _row_index(nullptr), _col_index(nullptr), nnz(0), capacity(0) {
         //Nothing else to init
     }
 
@@ -531,7 +620,12 @@ public:
     template <typename... S, cpp_enable_iff(dyn_detail::is_initializer_list_constructor<S...>::value)>
     explicit sparse_matrix_impl(S... sizes) noexcept
             : base_type(util::size(std::make_index_sequence<(sizeof...(S) - 1)>(), sizes...),
-                        dyn_detail::sizes(std::make_index_sequence<(sizeof...(S) - 1)>(), sizes...)) {
+                        dyn_detail::sizes(std::make_index_sequence<(sizeof...(S) - 1)>(), sizes...)),
+              _memory(nullptr),
+              _row_index(nullptr),
+              _col_index(nullptr),
+              nnz(0),
+              capacity(0) {
         static_assert(sizeof...(S) == D + 1, "Invalid number of dimensions");
 
         auto list = cpp::last_value(sizes...);
@@ -545,11 +639,46 @@ public:
     template <typename S1, typename... S, cpp_enable_iff((sizeof...(S) == D) && cpp::is_specialization_of_v<values_t, typename cpp::last_type<S1, S...>::type>)>
     explicit sparse_matrix_impl(S1 s1, S... sizes) noexcept
             : base_type(util::size(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...),
-                        dyn_detail::sizes(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...)) {
+                        dyn_detail::sizes(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...)),
+              _memory(nullptr),
+              _row_index(nullptr),
+              _col_index(nullptr),
+              nnz(0),
+              capacity(0) {
         auto list = cpp::last_value(sizes...).template list<value_type>();
         build_from_iterable(list);
     }
 
+    /*!
+     * \brief Copy construct a sparse matrix
+     * \param rhs The matrix to copy from
+     */
+    sparse_matrix_impl(const sparse_matrix_impl& rhs)
+            : base_type(rhs), _memory(nullptr), _row_index(nullptr), _col_index(nullptr), nnz(rhs.nnz), capacity(rhs.nnz) {
+        if (nnz) {
+            _memory    = allocate(nnz);
+            _row_index = base_type::template allocate<index_type>(nnz);
+            _col_index = base_type::template allocate<index_type>(nnz);
+
+            std::copy_n(rhs._memory, nnz, _memory);
+            std::copy_n(rhs._row_index, nnz, _row_index);
+            std::copy_n(rhs._col_index, nnz, _col_index);
+        }
+    }
+
+    /*!
+     * \brief Move construct a sparse matrix
+     * \param rhs The matrix to move from
+     */
+    sparse_matrix_impl(sparse_matrix_impl&& rhs) noexcept
+            : base_type(std::move(rhs)), _memory(rhs._memory), _row_index(rhs._row_index), _col_index(rhs._col_index), nnz(rhs.nnz), capacity(rhs.capacity) {
+        rhs._memory    = nullptr;
+        rhs._row_index = nullptr;
+        rhs._col_index = nullptr;
+        rhs.nnz        = 0;
+        rhs.capacity   = 0;
+    }
+
     /*!
      * \brief Copy assign from another matrix
      *
@@ -566,9 +695,7 @@ public:
                 validate_assign(*this, rhs);
             }
 
-            // Note: The const_cast is necessary in order to call assign_to
-            // and the parameter cannot be made non-const
-            const_cast<sparse_matrix_impl&>(rhs).assign_to(*this);
+            build_from_sparse(rhs);
         }
 
         check_invariants();
@@ -576,11 +703,33 @@ public:
         return *this;
     }
 
+    /*!
+     * \brief Move assign from another matrix
+     * \param rhs The matrix to move from
+     * \return A reference to the matrix
+     */
+    sparse_matrix_impl& operator=(sparse_matrix_impl&& rhs) noexcept {
+        if (this != &rhs) {
+            release_all();
+
+            _size       = rhs._size;
+            _dimensions = rhs._dimensions;
+
+            std::swap(_memory, rhs._memory);
+            std::swap(_row_index, rhs._row_index);
+            std::swap(_col_index, rhs._col_index);
+            std::swap(nnz, rhs.nnz);
+            std::swap(capacity, rhs.capacity);
+        }
+
+        return *this;
+    }
+
     /*!
      * \brief Assign an ETL expression to the sparse matrix
      */
     template <typename E,
-              cpp_enable_iff(!std::is_same_v<std::decay_t<E>, sparse_matrix_impl<T, storage_format, D>>
+              cpp_enable_iff(!std::is_same_v<std::decay_t<E>, this_type>
                              && std::is_convertible_v<value_t<E>, value_type> && is_etl_expr<E>)>
     sparse_matrix_impl& operator=(E&& e) noexcept {
         // It is possible that the matrix was not initialized before
@@ -592,8 +741,14 @@ public:
             validate_assign(*this, e);
         }
 
-        // Avoid aliasing issues
-        if constexpr (!decay_traits<E>::is_linear) {
+        // Other sparse formats are converted directly
+        if constexpr (is_sparse_matrix<E>) {
+            build_from_sparse(e);
+        } else if constexpr (is_sparse_structural<E>) {
+            // The result stays sparse, only the non-zeros of the operands are computed
+            build_from_structural(e);
+        } else if constexpr (!decay_traits<E>::is_linear) {
+            // Avoid aliasing issues
             if (e.alias(*this)) {
                 // Create a temporary to hold the result
                 this_type tmp(*this);
@@ -709,6 +864,18 @@ public:
         return nnz;
     }
 
+    /*!
+     * \brief Apply the given functor to each non-zero of the matrix, in
+     * row-major order.
+     * \param fun The functor to apply, called with (i, j, value)
+     */
+    template <typename F>
+    void for_each_non_zero(F&& fun) const {
+        for (size_t n = 0; n < nnz; ++n) {
+            fun(size_t(_row_index[n]), size_t(_col_index[n]), _memory[n]);
+        }
+    }
+
     /*!
      * \brief Sets the element at the given position (i, j) to the given value
      * \param i The first index
@@ -767,7 +934,10 @@ public:
     template <typename E>
     bool alias(const E& rhs) const noexcept {
         if constexpr (is_sparse_matrix<E>) {
-            return this == &rhs;
+            return static_cast<const void*>(this) == static_cast<const void*>(&rhs);
+        } else if constexpr (is_dma<E>) {
+            // A dense matrix never shares memory with a sparse matrix
+            return false;
         } else {
             return rhs.alias(*this);
         }
@@ -786,11 +956,7 @@ public:
      * \brief Destructs the matrix and releases all its memory
      */
     ~sparse_matrix_impl() noexcept {
-        if (_memory) {
-            release(_memory, nnz);
-            release(_row_index, nnz);
-            release(_col_index, nnz);
-        }
+        release_all();
     }
 
     /*!
@@ -815,7 +981,11 @@ public:
      */
     template <typename L>
     void assign_to(L&& lhs) const {
-        std_assign_evaluate(*this, lhs);
+        if constexpr (sparse_detail::direct_scatter<L>) {
+            sparse_detail::scatter_to_dense(*this, lhs);
+        } else {
+            std_assign_evaluate(*this, lhs);
+        }
     }
 
     /*!
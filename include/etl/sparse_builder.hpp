@@ -0,0 +1,256 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Bulk builder for sparse matrices
+ *
+ * Inserting elements one by one in a sparse matrix has to keep the storage
+ * sorted, which moves the following elements on each insertion. The builder
+ * accumulates unordered (i, j, value) triplets instead and sorts them only
+ * once, when the matrix is built.
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief Builder of sparse matrices from unordered triplets.
+ *
+ * The triplets can be inserted in any order and the same position can be
+ * inserted several times, in which case the values are summed. The matrix is
+ * built in O(nnz log nnz).
+ *
+ * \tparam T The type of value
+ * \tparam I The type used to store the indices
+ */
+template <typename T, typename I>
+struct sparse_builder {
+    using value_type = T; ///< The type of value
+    using index_type = I; ///< The type used to store the indices
+
+private:
+    /*!
+     * \brief A triplet inserted in the builder
+     */
+    struct entry {
+        index_type row;    ///< The row of the element
+        index_type column; ///< The column of the element
+        value_type value;  ///< The value of the element
+    };
+
+    /*!
+     * \brief The current order of the triplets
+     */
+    enum class entries_order {
+        NONE,    ///< Not sorted
+        ROWS,    ///< Sorted by rows (and then columns), without duplicates
+        COLUMNS, ///< Sorted by columns (and then rows), without duplicates
+    };
+
+    size_t _rows;               ///< The number of rows of the matrix
+    size_t _columns;            ///< The number of columns of the matrix
+    std::vector<entry> entries; ///< The triplets
+    entries_order sorted_order; ///< The current order of the triplets
+
+    /*!
+     * \brief Sort the triplets by rows (or by columns), sum the duplicates
+     * and remove the zeros.
+     *
+     * The triplets are first distributed by outer index with a counting sort
+     * and then each slice is sorted by inner index.
+     */
+    template <bool Rows>
+    void compact() {
+        if (sorted_order == (Rows ? entries_order::ROWS : entries_order::COLUMNS)) {
+            return;
+        }
+
+        auto outer = [](const entry& e) -> size_t { return Rows ? e.row : e.column; };
+        auto inner = [](const entry& e) -> size_t { return Rows ? e.column : e.row; };
+
+        const size_t outers = Rows ? _rows : _columns;
+
+        // 1. Distribute the triplets by outer index
+
+        std::vector<size_t> start(outers + 1, 0);
+
+        for (auto& e : entries) {
+            ++start[outer(e) + 1];
+        }
+
+        std::partial_sum(start.begin(), start.end(), start.begin());
+
+        std::vector<entry> sorted(entries.size());
+
+        {
+            std::vector<size_t> next(start.begin(), start.end() - 1);
+
+            for (auto& e : entries) {
+                sorted[next[outer(e)]++] = e;
+            }
+        }
+
+        // 2. Sort each slice by inner index
+
+        auto sort_fun = [&](const size_t first, const size_t last) {
+            for (size_t k = first; k < last; ++k) {
+                std::sort(sorted.begin() + start[k], sorted.begin() + start[k + 1], [&inner](const entry& lhs, const entry& rhs) { return inner(lhs) < inner(rhs); });
+            }
+        };
+
+        engine_dispatch_1d_serial(sort_fun, 0, outers, sorted.size() >= parallel_threshold);
+
+        // 3. Sum the duplicates and remove the zeros
+
+        size_t n = 0;
+
+        for (size_t k = 0; k < outers; ++k) {
+            const size_t first = n;
+
+            for (size_t p = start[k]; p < start[k + 1]; ++p) {
+                if (n > first && inner(sorted[n - 1]) == inner(sorted[p])) {
+                    sorted[n - 1].value += sorted[p].value;
+                } else {
+                    sorted[n++] = sorted[p];
+                }
+            }
+
+            auto last = std::remove_if(sorted.begin() + first, sorted.begin() + n, [](const entry& e) { return sparse_detail::is_zero(e.value); });
+
+            n = last - sorted.begin();
+        }
+
+        sorted.resize(n);
+
+        entries      = std::move(sorted);
+        sorted_order = Rows ? entries_order::ROWS : entries_order::COLUMNS;
+    }
+
+public:
+    /*!
+     * \brief Construct a builder for a matrix of the given dimensions
+     * \param rows The number of rows of the matrix
+     * \param columns The number of columns of the matrix
+     */
+    sparse_builder(size_t rows, size_t columns) : _rows(rows), _columns(columns), sorted_order(entries_order::NONE) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Returns the number of rows of the matrix
+     */
+    size_t rows() const noexcept {
+        return _rows;
+    }
+
+    /*!
+     * \brief Returns the number of columns of the matrix
+     */
+    size_t columns() const noexcept {
+        return _columns;
+    }
+
+    /*!
+     * \brief Returns the number of triplets currently stored in the builder.
+     *
+     * This may be more than the number of non-zeros of the matrix, since
+     * the duplicates are only summed when the matrix is built.
+     */
+    size_t size() const noexcept {
+        return entries.size();
+    }
+
+    /*!
+     * \brief Reserve space for the given number of triplets
+     * \param n The number of triplets
+     */
+    void reserve(size_t n) {
+        entries.reserve(n);
+    }
+
+    /*!
+     * \brief Remove all the triplets of the builder
+     */
+    void clear() {
+        entries.clear();
+        sorted_order = entries_order::NONE;
+    }
+
+    /*!
+     * \brief Insert a triplet in the builder. If there is already a
+     * value at the same position, the values are summed.
+     * \param i The row of the element
+     * \param j The column of the element
+     * \param value The value of the element
+     */
+    void insert(size_t i, size_t j, value_type value) {
+        cpp_assert(i < _rows, "Out of bounds");
+        cpp_assert(j < _columns, "Out of bounds");
+        cpp_assert(std::max(i, j) <= size_t(std::numeric_limits<index_type>::max()), "Index too large for the index type");
+
+        entries.push_back({index_type(i), index_type(j), value});
+        sorted_order = entries_order::NONE;
+    }
+
+    /*!
+     * \brief Insert a range of triplets in the builder.
+     *
+     * The range can contain any tuple-like (i, j, value) elements, such as
+     * std::tuple or an aggregate of three members.
+     *
+     * \param first The beginning of the range
+     * \param last The end of the range
+     */
+    template <typename It>
+    void insert_range(It first, It last) {
+        using category = typename std::iterator_traits<It>::iterator_category;
+
+        if constexpr (std::is_base_of_v<std::random_access_iterator_tag, category>) {
+            // Keep the growth geometric when the ranges are small
+            const size_t needed = entries.size() + size_t(std::distance(first, last));
+
+            if (needed > entries.capacity()) {
+                entries.reserve(std::max(needed, 2 * entries.capacity()));
+            }
+        }
+
+        for (; first != last; ++first) {
+            const auto& [i, j, value] = *first;
+
+            insert(i, j, value);
+        }
+    }
+
+    /*!
+     * \brief Build the sparse matrix from the triplets.
+     *
+     * The triplets are sorted in the order of the storage format, the
+     * duplicates are summed and the zeros are removed. The triplets remain in
+     * the builder, so that it can be used again.
+     *
+     * \tparam SS The storage format of the matrix
+     * \return The sparse matrix
+     */
+    template <sparse_storage SS = sparse_storage::CSR>
+    sparse_matrix_impl<T, SS, 2, I> build() {
+        compact<SS != sparse_storage::CSC>();
+
+        sparse_matrix_impl<T, SS, 2, I> matrix(_rows, _columns);
+
+        matrix.build_from_source([this](auto&& emit) {
+            for (auto& e : entries) {
+                emit(size_t(e.row), size_t(e.column), e.value);
+            }
+        });
+
+        return matrix;
+    }
+};
+
+} //end of namespace etl
@@ -0,0 +1,1088 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Sparse matrix implementation with compressed storage (CSR and CSC)
+ *
+ * The non-zeros are stored by outer slices, the rows in CSR and the columns
+ * in CSC. For each slice, the non-zeros are contiguous and sorted by inner
+ * index (the column in CSR and the row in CSC). The position of the first
+ * non-zero of each slice is stored in the outer index.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace sparse_detail {
+
+/*!
+ * \brief A contiguous slice of the non-zeros of a compressed sparse matrix,
+ * a row of a CSR matrix or a column of a CSC matrix.
+ *
+ * \tparam V The type of value (possibly const)
+ * \tparam I The type used to store the indices
+ */
+template <typename V, typename I>
+struct compressed_slice {
+    using value_type = V; ///< The type of value
+    using index_type = I; ///< The type of index
+
+    /*!
+     * \brief Iterator over the (index, value) pairs of the slice
+     */
+    struct iterator {
+        using iterator_category = std::forward_iterator_tag; ///< The iterator category
+        using value_type        = std::pair<size_t, V&>;     ///< The value type
+        using difference_type   = std::ptrdiff_t;            ///< The type used for differences
+        using pointer           = void;                      ///< The pointer type
+        using reference         = std::pair<size_t, V&>;     ///< The reference type
+
+        V* values;        ///< Pointer to the current value
+        const I* indices; ///< Pointer to the current index
+
+        /*!
+         * \brief Returns the (index, value) pair at the current position
+         */
+        reference operator*() const {
+            return {size_t(*indices), *values};
+        }
+
+        /*!
+         * \brief Advance the iterator
+         * \return a reference to the iterator
+         */
+        iterator& operator++() {
+            ++values;
+            ++indices;
+            return *this;
+        }
+
+        /*!
+         * \brief Advance the iterator
+         * \return the iterator before it was advanced
+         */
+        iterator operator++(int) {
+            iterator prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        /*!
+         * \brief Compare two iterators for equality
+         */
+        bool operator==(const iterator& rhs) const {
+            return indices == rhs.indices;
+        }
+
+        /*!
+         * \brief Compare two iterators for inequality
+         */
+        bool operator!=(const iterator& rhs) const {
+            return indices != rhs.indices;
+        }
+    };
+
+    V* _values;        ///< The values of the slice
+    const I* _indices; ///< The inner indices of the slice
+    size_t _size;      ///< The number of non-zeros of the slice
+
+    /*!
+     * \brief Returns the number of non-zeros of the slice
+     */
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    /*!
+     * \brief Returns a pointer to the contiguous values of the slice
+     */
+    V* values() const noexcept {
+        return _values;
+    }
+
+    /*!
+     * \brief Returns a pointer to the contiguous inner indices of the slice
+     */
+    const I* indices() const noexcept {
+        return _indices;
+    }
+
+    /*!
+     * \brief Returns the inner index of the nth non-zero of the slice
+     */
+    size_t index(size_t n) const noexcept {
+        return _indices[n];
+    }
+
+    /*!
+     * \brief Returns the value of the nth non-zero of the slice
+     */
+    V& value(size_t n) const noexcept {
+        return _values[n];
+    }
+
+    /*!
+     * \brief Returns an iterator to the first non-zero of the slice
+     */
+    iterator begin() const noexcept {
+        return {_values, _indices};
+    }
+
+    /*!
+     * \brief Returns an iterator past the last non-zero of the slice
+     */
+    iterator end() const noexcept {
+        return {_values + _size, _indices + _size};
+    }
+};
+
+} //end of namespace sparse_detail
+
+/*!
+ * \brief Sparse matrix implementation with compressed storage (CSR or CSC)
+ *
+ * The COO storage format is implemented as a specialization.
+ *
+ * \tparam T The type of value
+ * \tparam SS The storage type
+ * \tparam D The number of dimensions
+ * \tparam I The type used to store the indices
+ */
+template <typename T, sparse_storage SS, size_t D, typename I>
+struct sparse_matrix_impl final : dyn_base<sparse_matrix_impl<T, SS, D, I>, T, D> {
+    static constexpr size_t n_dimensions           = D;                                      ///< The number of dimensions
+    static constexpr sparse_storage storage_format = SS;                                     ///< The sparse storage scheme
+    static constexpr order storage_order           = order::RowMajor;                        ///< The storage order
+    static constexpr size_t alignment              = default_intrinsic_traits<T>::alignment; ///< The alignment
+    static constexpr bool row_compressed           = SS == sparse_storage::CSR;              ///< Indicates if the rows are the outer slices
+
+    using this_type              = sparse_matrix_impl<T, SS, D, I>;                               ///< this type
+    using base_type              = dyn_base<this_type, T, D>;                                     ///< The base type
+    using reference_type         = sparse_detail::sparse_reference<this_type>;                    ///< The type of reference returned by the functions
+    using const_reference_type   = sparse_detail::sparse_reference<const this_type>;              ///< The type of const reference returned by the functions
+    using value_type             = T;                                                             ///< The type of value returned by the function
+    using dimension_storage_impl = std::array<size_t, n_dimensions>;                              ///< The type used to store the dimensions
+    using memory_type            = value_type*;                                                   ///< The memory type
+    using const_memory_type      = const value_type*;                                             ///< The const memory type
+    using index_type             = I;                                                             ///< The type used to store the indices
+    using index_memory_type      = index_type*;                                                   ///< The memory type to the indices
+    using slice_type             = sparse_detail::compressed_slice<value_type, index_type>;       ///< The type of a slice
+    using const_slice_type       = sparse_detail::compressed_slice<const value_type, index_type>; ///< The type of a const slice
+
+    friend struct sparse_detail::sparse_reference<this_type>;
+    friend struct sparse_detail::sparse_reference<const this_type>;
+
+    static_assert(SS == sparse_storage::CSR || SS == sparse_storage::CSC, "Invalid compressed storage format");
+    static_assert(n_dimensions == 2, "Only 2D sparse matrix are supported");
+    static_assert(std::is_integral_v<index_type> && std::is_unsigned_v<index_type>, "The indices must be unsigned integers");
+
+private:
+    using base_type::_dimensions;
+    using base_type::_size;
+    memory_type _memory;            ///< The values
+    index_memory_type _inner_index; ///< The inner index of each value
+    index_memory_type _outer_index; ///< The position of the first value of each outer slice
+    size_t nnz;                     ///< The number of nonzeros in the matrix
+    size_t capacity;                ///< The number of values that can be stored without reallocation
+
+    using base_type::allocate;
+    using base_type::check_invariants;
+    using base_type::release;
+
+    template <typename T2, typename I2>
+    friend struct sparse_builder;
+
+    /*!
+     * \brief Returns the number of outer slices
+     */
+    size_t outer_size() const noexcept {
+        return row_compressed ? _dimensions[0] : _dimensions[1];
+    }
+
+    /*!
+     * \brief Returns the outer index of the element (i,j)
+     */
+    static size_t outer(size_t i, size_t j) noexcept {
+        return row_compressed ? i : j;
+    }
+
+    /*!
+     * \brief Returns the inner index of the element (i,j)
+     */
+    static size_t inner(size_t i, size_t j) noexcept {
+        return row_compressed ? j : i;
+    }
+
+    /*!
+     * \brief Release all the memory of the matrix
+     */
+    void release_all() noexcept {
+        if (_memory) {
+            release(_memory, capacity);
+            release(_inner_index, capacity);
+        }
+
+        if (_outer_index) {
+            release(_outer_index, outer_size() + 1);
+        }
+
+        _memory      = nullptr;
+        _inner_index = nullptr;
+        _outer_index = nullptr;
+        nnz          = 0;
+        capacity     = 0;
+    }
+
+    /*!
+     * \brief Allocate the outer index of an empty matrix
+     */
+    void init_outer_index() {
+        if (_size) {
+            _outer_index = base_type::template allocate<index_type>(outer_size() + 1);
+            std::fill_n(_outer_index, outer_size() + 1, index_type(0));
+        }
+    }
+
+    /*!
+     * \brief Build the content of the sparse matrix from a source of
+     * non-zeros.
+     *
+     * The source is a functor that emits each non-zero, as (i, j, value), to
+     * the functor it is given. It is called twice, once to count the non-zeros
+     * of each outer slice and once to store them. For each outer slice, the
+     * source must emit the non-zeros by increasing inner index.
+     *
+     * \param source The source of non-zeros
+     */
+    template <typename Source>
+    void build_from_source(Source&& source) {
+        const size_t outers = outer_size();
+
+        auto new_outer_index = base_type::template allocate<index_type>(outers + 1);
+        std::fill_n(new_outer_index, outers + 1, index_type(0));
+
+        // 1. Count the non-zeros of each outer slice
+
+        size_t new_nnz = 0;
+
+        source([&](size_t i, size_t j, value_type) {
+            ++new_outer_index[outer(i, j) + 1];
+            ++new_nnz;
+        });
+
+        cpp_assert(new_nnz <= size_t(std::numeric_limits<index_type>::max()), "Too many non-zeros for the index type");
+
+        std::partial_sum(new_outer_index, new_outer_index + outers + 1, new_outer_index);
+
+        // 2. Store the non-zeros in their slices
+
+        memory_type new_memory            = nullptr;
+        index_memory_type new_inner_index = nullptr;
+
+        if (new_nnz) {
+            new_memory      = allocate(new_nnz);
+            new_inner_index = base_type::template allocate<index_type>(new_nnz);
+
+            std::vector<size_t> next(new_outer_index, new_outer_index + outers);
+
+            source([&](size_t i, size_t j, value_type v) {
+                auto n = next[outer(i, j)]++;
+
+                new_memory[n]      = v;
+                new_inner_index[n] = inner(i, j);
+            });
+        }
+
+        release_all();
+
+        _memory      = new_memory;
+        _inner_index = new_inner_index;
+        _outer_index = new_outer_index;
+        nnz          = new_nnz;
+        capacity     = new_nnz;
+    }
+
+    /*!
+     * \brief Build the content of the sparse matrix from an ETL expression
+     * \param e The expression to build from
+     */
+    template <typename E>
+    void build_from_expr(E&& e) {
+        if constexpr (is_sparse_matrix<E>) {
+            build_from_source([&e](auto&& emit) { e.for_each_non_zero(emit); });
+        } else if constexpr (is_sparse_structural<E>) {
+            // The result stays sparse, only the non-zeros of the operands are
+            // computed, before the current content is released
+            const sparse_detail::structural_node<std::decay_t<E>> node(e);
+
+            build_from_source([&node, m = rows()](auto&& emit) {
+                sparse_detail::structural_for_each(node, m, [&emit](size_t i, size_t j, value_type v) {
+                    if (sparse_detail::is_non_zero(v)) {
+                        emit(i, j, v);
+                    }
+                });
+            });
+        } else if constexpr (decay_traits<E>::is_generator) {
+            // A generator must only be evaluated once
+            dyn_matrix<value_type, 2> tmp(rows(), columns());
+            tmp = e;
+            build_from_expr(tmp);
+        } else {
+            // Allocate temporaries and evaluate sub expressions
+            standard_evaluator::pre_assign_rhs(e);
+
+            e.ensure_cpu_up_to_date();
+
+            const size_t m = rows();
+            const size_t n = columns();
+
+            build_from_source([&e, m, n](auto&& emit) {
+                for (size_t k = 0; k < m * n; ++k) {
+                    const value_type v = e.read_flat(k);
+
+                    if (sparse_detail::is_non_zero(v)) {
+                        if constexpr (decay_traits<E>::storage_order == order::RowMajor) {
+                            emit(k / n, k % n, v);
+                        } else {
+                            emit(k % m, k / m, v);
+                        }
+                    }
+                }
+            });
+        }
+    }
+
+    /*!
+     * \brief Build the content of the sparse matrix from an
+     * iterable collection
+     */
+    template <typename It>
+    void build_from_iterable(const It& iterable) {
+        const size_t n = columns();
+
+        build_from_source([&iterable, n](auto&& emit) {
+            size_t k = 0;
+
+            for (auto v : iterable) {
+                if (sparse_detail::is_non_zero(v)) {
+                    emit(k / n, k % n, value_type(v));
+                }
+
+                ++k;
+            }
+        });
+    }
+
+    /*!
+     * \brief Reserve enough space to put a value in position hint
+     * \param k The outer slice of the new value
+     * \param hint The position of the new value
+     */
+    void reserve_hint(size_t k, size_t hint) {
+        cpp_assert(hint < nnz + 1, "Invalid hint for reserve_hint");
+
+        if (nnz == capacity) {
+            // Grow geometrically, for amortized constant-time reallocation
+            const size_t new_capacity = std::max(size_t(8), 2 * capacity);
+
+            cpp_assert(new_capacity <= size_t(std::numeric_limits<index_type>::max()), "Too many non-zeros for the index type");
+
+            auto new_memory      = allocate(new_capacity);
+            auto new_inner_index = base_type::template allocate<index_type>(new_capacity);
+
+            if (_memory) {
+                std::copy_n(_memory, nnz, new_memory);
+                std::copy_n(_inner_index, nnz, new_inner_index);
+
+                release(_memory, capacity);
+                release(_inner_index, capacity);
+            }
+
+            _memory      = new_memory;
+            _inner_index = new_inner_index;
+            capacity     = new_capacity;
+        }
+
+        std::copy_backward(_memory + hint, _memory + nnz, _memory + nnz + 1);
+        std::copy_backward(_inner_index + hint, _inner_index + nnz, _inner_index + nnz + 1);
+
+        for (size_t o = k + 1; o < outer_size() + 1; ++o) {
+            ++_outer_index[o];
+        }
+
+        ++nnz;
+    }
+
+    /*!
+     * \brief Erase the value in position n
+     * \param k The outer slice of the value
+     * \param n The position of the value
+     */
+    void erase_hint(size_t k, size_t n) {
+        cpp_assert(nnz > 0, "Invalid erase_hint call (no non-zero elements");
+
+        std::copy(_memory + n + 1, _memory + nnz, _memory + n);
+        std::copy(_inner_index + n + 1, _inner_index + nnz, _inner_index + n);
+
+        for (size_t o = k + 1; o < outer_size() + 1; ++o) {
+            --_outer_index[o];
+        }
+
+        --nnz;
+    }
+
+    /*!
+     * \brief Indicates if the value at position n is the value at (i,j)
+     */
+    bool is_hint(size_t i, size_t j, size_t n) const noexcept {
+        return n < _outer_index[outer(i, j) + 1] && _inner_index[n] == inner(i, j);
+    }
+
+    /*!
+     * \brief Find the position of the value at (i,j). If the value is not
+     * present, returns the position where it would be inserted.
+     */
+    size_t find_n(size_t i, size_t j) const noexcept {
+        const size_t k = outer(i, j);
+
+        auto first = _inner_index + _outer_index[k];
+        auto last  = _inner_index + _outer_index[k + 1];
+
+        return std::lower_bound(first, last, inner(i, j)) - _inner_index;
+    }
+
+    /*!
+     * \brief Set the value at index (i,j) and position n
+     * \param value The new value to set
+     */
+    void unsafe_set_hint(size_t i, size_t j, size_t n, value_type value) {
+        //The value exists, modify it
+        if (is_hint(i, j, n)) {
+            _memory[n] = value;
+            return;
+        }
+
+        reserve_hint(outer(i, j), n);
+
+        _memory[n]      = value;
+        _inner_index[n] = inner(i, j);
+    }
+
+    /*!
+     * \brief Get the value at index (i,j) and position n
+     */
+    value_type get_hint(size_t i, size_t j, size_t n) const noexcept {
+        if (is_hint(i, j, n)) {
+            return _memory[n];
+        }
+
+        return value_type(0);
+    }
+
+    /*!
+     * \brief Set the value at index (i,j) and position n.
+     */
+    void set_hint(size_t i, size_t j, size_t n, value_type value) {
+        if (is_hint(i, j, n)) {
+            //At this point, there is already a value for (i,j)
+            //If zero, we remove it, otherwise edit it
+            if (sparse_detail::is_non_zero(value)) {
+                _memory[n] = value;
+            } else {
+                erase_hint(outer(i, j), n);
+            }
+        } else if (sparse_detail::is_non_zero(value)) {
+            //At this point, the value does not exist
+            //We insert it if not zero
+            unsafe_set_hint(i, j, n, value);
+        }
+    }
+
+    /*!
+     * \brief Get a direct reference to the element at position n
+     */
+    value_type& unsafe_ref_hint(size_t n) {
+        return _memory[n];
+    }
+
+    /*!
+     * \brief Get a direct const reference to the element at position n
+     */
+    const value_type& unsafe_ref_hint(size_t n) const {
+        return _memory[n];
+    }
+
+    /*!
+     * \brief Inherit the dimensions of an ETL expressions.
+     * This must only be called when the matrix has no dimensions
+     * \param e The expression to get the dimensions from.
+     */
+    template <typename E, cpp_enable_iff(etl::decay_traits<E>::is_generator)>
+    void inherit([[maybe_unused]] const E& e) {
+        cpp_unreachable("Impossible to inherit dimensions from generators");
+    }
+
+    /*!
+     * \brief Inherit the dimensions of an ETL expressions.
+     * This must only be called when the matrix has no dimensions
+     * \param e The expression to get the dimensions from.
+     */
+    template <typename E, cpp_disable_iff(etl::decay_traits<E>::is_generator)>
+    void inherit(const E& e) {
+        cpp_assert(n_dimensions == etl::dimensions(e), "Invalid number of dimensions");
+
+        release_all();
+
+        // Compute the size and new dimensions
+        _size = 1;
+        for (size_t d = 0; d < n_dimensions; ++d) {
+            _dimensions[d] = etl::dim(e, d);
+            _size *= _dimensions[d];
+        }
+
+        init_outer_index();
+    }
+
+public:
+    using base_type::columns;
+    using base_type::dim;
+    using base_type::rows;
+    using base_type::size;
+
+    // Construction
+
+    /*!
+     * \brief Constructs a new empty sparse matrix
+     */
+    sparse_matrix_impl() noexcept : base_type(), _memory(nullptr), _inner_index(nullptr), _outer_index(nullptr), nnz(0), capacity(0) {
+        //Nothing else to init
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions,
+     * filled with zeroes
+     */
+    template <typename... S, cpp_enable_iff(sizeof...(S) == D && cpp::all_convertible_to_v<size_t, S...>)>
+    explicit sparse_matrix_impl(S... sizes) noexcept
+            : base_type(util::size(sizes...), {{static_cast<size_t>(sizes)...}}), _memory(nullptr), _inner_index(nullptr), _outer_index(nullptr), nnz(0), capacity(0) {
+        init_outer_index();
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions
+     * and use the initializer list to fill the matrix
+     */
+    template <typename... S, cpp_enable_iff(dyn_detail::is_initializer_list_constructor<S...>::value)>
+    explicit sparse_matrix_impl(S... sizes) noexcept
+            : base_type(util::size(std::make_index_sequence<(sizeof...(S) - 1)>(), sizes...),
+                        dyn_detail::sizes(std::make_index_sequence<(sizeof...(S) - 1)>(), sizes...)),
+              _memory(nullptr),
+              _inner_index(nullptr),
+              _outer_index(nullptr),
+              nnz(0),
+              capacity(0) {
+        static_assert(sizeof...(S) == D + 1, "Invalid number of dimensions");
+
+        auto list = cpp::last_value(sizes...);
+        build_from_iterable(list);
+    }
+
+    /*!
+     * \brief Construct a new sparse matrix of the given dimensions
+     * and use the list of values list to fill the matrix
+     */
+    template <typename S1, typename... S, cpp_enable_iff((sizeof...(S) == D) && cpp::is_specialization_of_v<values_t, typename cpp::last_type<S1, S...>::type>)>
+    explicit sparse_matrix_impl(S1 s1, S... sizes) noexcept
+            : base_type(util::size(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...),
+                        dyn_detail::sizes(std::make_index_sequence<(sizeof...(S))>(), s1, sizes...)),
+              _memory(nullptr),
+              _inner_index(nullptr),
+              _outer_index(nullptr),
+              nnz(0),
+              capacity(0) {
+        auto list = cpp::last_value(sizes...).template list<value_type>();
+        build_from_iterable(list);
+    }
+
+    /*!
+     * \brief Construct a sparse matrix from an ETL expression, either a
+     * dense expression or a sparse matrix of another format.
+     * \param e The expression to build from
+     */
+    template <typename E, cpp_enable_iff(!std::is_same_v<std::decay_t<E>, this_type> && is_etl_expr<E>)>
+    explicit sparse_matrix_impl(E&& e)
+            : base_type(e), _memory(nullptr), _inner_index(nullptr), _outer_index(nullptr), nnz(0), capacity(0) {
+        build_from_expr(e);
+    }
+
+    /*!
+     * \brief Copy construct a sparse matrix
+     * \param rhs The matrix to copy from
+     */
+    sparse_matrix_impl(const sparse_matrix_impl& rhs)
+            : base_type(rhs), _memory(nullptr), _inner_index(nullptr), _outer_index(nullptr), nnz(rhs.nnz), capacity(rhs.nnz) {
+        if (rhs._outer_index) {
+            _outer_index = base_type::template allocate<index_type>(outer_size() + 1);
+            std::copy_n(rhs._outer_index, outer_size() + 1, _outer_index);
+        }
+
+        if (nnz) {
+            _memory      = allocate(nnz);
+            _inner_index = base_type::template allocate<index_type>(nnz);
+
+            std::copy_n(rhs._memory, nnz, _memory);
+            std::copy_n(rhs._inner_index, nnz, _inner_index);
+        }
+    }
+
+    /*!
+     * \brief Move construct a sparse matrix
+     * \param rhs The matrix to move from
+     */
+    sparse_matrix_impl(sparse_matrix_impl&& rhs) noexcept
+            : base_type(std::move(rhs)), _memory(rhs._memory), _inner_index(rhs._inner_index), _outer_index(rhs._outer_index), nnz(rhs.nnz), capacity(rhs.capacity) {
+        rhs._memory      = nullptr;
+        rhs._inner_index = nullptr;
+        rhs._outer_index = nullptr;
+        rhs.nnz          = 0;
+        rhs.capacity     = 0;
+    }
+
+    /*!
+     * \brief Copy assign from another matrix
+     *
+     * This operator can change the dimensions of the matrix
+     *
+     * \param rhs The matrix to copy from
+     * \return A reference to the matrix
+     */
+    sparse_matrix_impl& operator=(const sparse_matrix_impl& rhs) {
+        if (this != &rhs) {
+            if (!_size) {
+                inherit(rhs);
+            } else {
+                validate_assign(*this, rhs);
+            }
+
+            build_from_expr(rhs);
+        }
+
+        check_invariants();
+
+        return *this;
+    }
+
+    /*!
+     * \brief Move assign from another matrix
+     * \param rhs The matrix to move from
+     * \return A reference to the matrix
+     */
+    sparse_matrix_impl& operator=(sparse_matrix_impl&& rhs) noexcept {
+        if (this != &rhs) {
+            release_all();
+
+            _size       = rhs._size;
+            _dimensions = rhs._dimensions;
+
+            std::swap(_memory, rhs._memory);
+            std::swap(_inner_index, rhs._inner_index);
+            std::swap(_outer_index, rhs._outer_index);
+            std::swap(nnz, rhs.nnz);
+            std::swap(capacity, rhs.capacity);
+        }
+
+        return *this;
+    }
+
+    /*!
+     * \brief Assign an ETL expression to the sparse matrix
+     *
+     * The expression is evaluated only once, the new content is built
+     * before the previous one is released, so aliasing is not an issue.
+     */
+    template <typename E,
+              cpp_enable_iff(!std::is_same_v<std::decay_t<E>, this_type>
+                             && std::is_convertible_v<value_t<E>, value_type> && is_etl_expr<E>)>
+    sparse_matrix_impl& operator=(E&& e) {
+        // It is possible that the matrix was not initialized before
+        // In the case, get the the dimensions from the expression and
+        // initialize the matrix
+        if (!_size) {
+            inherit(e);
+        } else {
+            validate_assign(*this, e);
+        }
+
+        build_from_expr(e);
+
+        check_invariants();
+
+        return *this;
+    }
+
+    /*!
+     * \brief Returns the value at the given (i,j) position in the matrix.
+     *
+     * This function will never insert a new element in the matrix. It is
+     * suited when only reading the matrix and not neeeding references.
+     *
+     * \param i The row
+     * \param j The column
+     *
+     * \return The value at the (i,j) position.
+     */
+    value_type get(size_t i, size_t j) const noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+        return get_hint(i, j, n);
+    }
+
+    /*!
+     * \brief Returns a reference to the element at the position (i,j)
+     * \param i The first index
+     * \param j The second index
+     * \return a sparse reference (proxy reference) to the element at position (i,j)
+     */
+    reference_type operator()(size_t i, size_t j) noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        return {*this, i, j};
+    }
+
+    /*!
+     * \brief Returns a reference to the element at the position (i,j)
+     * \param i The first index
+     * \param j The second index
+     * \return a sparse reference (proxy reference) to the element at position (i,j)
+     */
+    const_reference_type operator()(size_t i, size_t j) const noexcept(assert_nothrow) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        return {*this, i, j};
+    }
+
+    /*!
+     * \brief Returns the element at the given index
+     * This function may result in insertion of deletion of elements
+     * in the matrix and therefore invalidation of some references.
+     * \param n The index
+     * \return a reference to the element at the given index.
+     */
+    reference_type operator[](size_t n) noexcept(assert_nothrow) {
+        cpp_assert(n < size(), "Out of bounds");
+
+        return {*this, n / columns(), n % columns()};
+    }
+
+    /*!
+     * \brief Returns the element at the given index
+     * This function may result in insertion of deletion of elements
+     * in the matrix and therefore invalidation of some references.
+     * \param n The index
+     * \return a reference to the element at the given index.
+     */
+    const_reference_type operator[](size_t n) const noexcept(assert_nothrow) {
+        cpp_assert(n < size(), "Out of bounds");
+
+        return {*this, n / columns(), n % columns()};
+    }
+
+    /*!
+     * \brief Returns the value at the given index
+     * This function never alters the state of the container.
+     * \param n The index
+     * \return the value at the given index.
+     */
+    value_type read_flat(size_t n) const noexcept {
+        return get(n / columns(), n % columns());
+    }
+
+    /*!
+     * \brief Returns Returns the number of non zeros entries in the sparse matrix.
+     *
+     * This is a constant time O(1) operation.
+     *
+     * \return The number of non zeros entries in the sparse matrix.
+     */
+    size_t non_zeros() const noexcept {
+        return nnz;
+    }
+
+    /*!
+     * \brief Apply the given functor to each non-zero of the matrix, in
+     * storage order (row-major for CSR and column-major for CSC).
+     * \param fun The functor to apply, called with (i, j, value)
+     */
+    template <typename F>
+    void for_each_non_zero(F&& fun) const {
+        for (size_t k = 0; k < outer_size(); ++k) {
+            for (size_t n = _outer_index[k]; n < _outer_index[k + 1]; ++n) {
+                if constexpr (row_compressed) {
+                    fun(k, size_t(_inner_index[n]), _memory[n]);
+                } else {
+                    fun(size_t(_inner_index[n]), k, _memory[n]);
+                }
+            }
+        }
+    }
+
+    /*!
+     * \brief Returns a pointer to the values of the matrix
+     */
+    memory_type values() noexcept {
+        return _memory;
+    }
+
+    /*!
+     * \copydoc values
+     */
+    const_memory_type values() const noexcept {
+        return _memory;
+    }
+
+    /*!
+     * \brief Returns a pointer to the inner indices (the columns in CSR and
+     * the rows in CSC) of the values of the matrix
+     */
+    const index_type* inner_index() const noexcept {
+        return _inner_index;
+    }
+
+    /*!
+     * \brief Returns a pointer to the position of the first value of each
+     * outer slice (the rows in CSR and the columns in CSC). The position past
+     * the last value of the slice k is given at position k + 1.
+     */
+    const index_type* outer_index() const noexcept {
+        return _outer_index;
+    }
+
+    /*!
+     * \brief Returns the contiguous non-zeros of the given row of a CSR matrix
+     * \param i The row
+     * \return the slice of the non-zeros of the row
+     */
+    slice_type row_entries(size_t i) noexcept(assert_nothrow) {
+        static_assert(row_compressed, "row_entries() is only available on CSR matrices");
+        cpp_assert(i < rows(), "Out of bounds");
+
+        return {_memory + _outer_index[i], _inner_index + _outer_index[i], size_t(_outer_index[i + 1] - _outer_index[i])};
+    }
+
+    /*!
+     * \copydoc row_entries
+     */
+    const_slice_type row_entries(size_t i) const noexcept(assert_nothrow) {
+        static_assert(row_compressed, "row_entries() is only available on CSR matrices");
+        cpp_assert(i < rows(), "Out of bounds");
+
+        return {_memory + _outer_index[i], _inner_index + _outer_index[i], size_t(_outer_index[i + 1] - _outer_index[i])};
+    }
+
+    /*!
+     * \brief Returns the contiguous non-zeros of the given column of a CSC matrix
+     * \param j The column
+     * \return the slice of the non-zeros of the column
+     */
+    slice_type column_entries(size_t j) noexcept(assert_nothrow) {
+        static_assert(!row_compressed, "column_entries() is only available on CSC matrices");
+        cpp_assert(j < columns(), "Out of bounds");
+
+        return {_memory + _outer_index[j], _inner_index + _outer_index[j], size_t(_outer_index[j + 1] - _outer_index[j])};
+    }
+
+    /*!
+     * \copydoc column_entries
+     */
+    const_slice_type column_entries(size_t j) const noexcept(assert_nothrow) {
+        static_assert(!row_compressed, "column_entries() is only available on CSC matrices");
+        cpp_assert(j < columns(), "Out of bounds");
+
+        return {_memory + _outer_index[j], _inner_index + _outer_index[j], size_t(_outer_index[j + 1] - _outer_index[j])};
+    }
+
+    /*!
+     * \brief Sets the element at the given position (i, j) to the given value
+     * \param i The first index
+     * \param j The second index
+     * \param value The new value
+     */
+    void set(size_t i, size_t j, value_type value) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+        set_hint(i, j, n, value);
+    }
+
+    /*!
+     * \brief Sets the element at the given position (i, j) to the given value
+     *
+     * This function will always set the element to the given value, even if it
+     * is zero (the normal behaviour would have been to erase it). This must be
+     * used when we need a pointer to the element in memory.
+     *
+     * \param i The first index
+     * \param j The second index
+     * \param value The new value
+     */
+    void unsafe_set(size_t i, size_t j, value_type value) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+
+        unsafe_set_hint(i, j, n, value);
+    }
+
+    /*!
+     * \brief Erases (sets to zero) the element at the given position (i, j)
+     * \param i The first index
+     * \param j The second index
+     */
+    void erase(size_t i, size_t j) {
+        cpp_assert(i < dim(0), "Out of bounds");
+        cpp_assert(j < dim(1), "Out of bounds");
+
+        auto n = find_n(i, j);
+
+        if (is_hint(i, j, n)) {
+            erase_hint(outer(i, j), n);
+        }
+    }
+
+    /*!
+     * \brief Test if this expression aliases with the given expression
+     * \param rhs The other expression to test
+     * \return true if the two expressions aliases, false otherwise
+     */
+    template <typename E>
+    bool alias(const E& rhs) const noexcept {
+        if constexpr (is_sparse_matrix<E>) {
+            return static_cast<const void*>(this) == static_cast<const void*>(&rhs);
+        } else if constexpr (is_dma<E>) {
+            // A dense matrix never shares memory with a sparse matrix
+            return false;
+        } else {
+            return rhs.alias(*this);
+        }
+    }
+
+    // Internals
+
+    /*!
+     * \brief Apply the given visitor to this expression and its descendants.
+     * \param visitor The visitor to apply
+     */
+    template <typename V>
+    void visit([[maybe_unused]] V&& visitor) const {}
+
+    /*!
+     * \brief Destructs the matrix and releases all its memory
+     */
+    ~sparse_matrix_impl() noexcept {
+        release_all();
+    }
+
+    /*!
+     * \brief Ensures that the GPU memory is allocated and that the GPU memory
+     * is up to date (to undefined value).
+     */
+    void ensure_cpu_up_to_date() const {
+        // No GPU support for sparse matrix so far
+    }
+
+    /*!
+     * \brief Copy back from the GPU to the expression memory if
+     * necessary.
+     */
+    void ensure_gpu_up_to_date() const {
+        // No GPU support for sparse matrix so far
+    }
+
+    /*!
+     * \brief Assign to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_to(L&& lhs) const {
+        if constexpr (sparse_detail::direct_scatter<L>) {
+            sparse_detail::scatter_to_dense(*this, lhs);
+        } else {
+            std_assign_evaluate(*this, lhs);
+        }
+    }
+
+    /*!
+     * \brief Add to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_add_to(L&& lhs) const {
+        std_add_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief sub to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_sub_to(L&& lhs) const {
+        std_sub_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief mul to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mul_to(L&& lhs) const {
+        std_mul_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Div to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_div_to(L&& lhs) const {
+        std_div_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Mod to the given left-hand-side expression
+     * \param lhs The expression to which assign
+     */
+    template <typename L>
+    void assign_mod_to(L&& lhs) const {
+        std_mod_evaluate(*this, lhs);
+    }
+
+    /*!
+     * \brief Prints a fast matrix type (not the contents) to the given stream
+     * \param os The output stream
+     * \param matrix The fast matrix to print
+     * \return the output stream
+     */
+    friend std::ostream& operator<<(std::ostream& os, const sparse_matrix_impl& matrix) {
+        os << (row_compressed ? "CSR[" : "CSC[") << matrix.dim(0);
+
+        for (size_t i = 1; i < D; ++i) {
+            os << "," << matrix.dim(i);
+        }
+
+        return os << "]";
+    }
+};
+
+} //end of namespace etl
@@ -0,0 +1,186 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Row-wise sparse gradients of embedding vocabularies.
+ *
+ * For large vocabularies, only a few rows are referenced by a batch. Instead
+ * of computing the gradients in a dense matrix of the size of the
+ * vocabulary, the sparse gradients only hold the rows that are referenced.
+ */
+
+#pragma once
+
+namespace etl {
+
+/*!
+ * \brief Row-wise sparse gradients of a vocabulary.
+ *
+ * The ith row of values holds the gradients of the row ids[i] of the
+ * vocabulary. The ids are unique and sorted.
+ *
+ * \tparam T The value type
+ */
+template <typename T>
+struct sparse_row_gradients {
+    std::vector<size_t> ids; ///< The unique row ids
+    dyn_matrix<T, 2> values; ///< The gradients of each row
+
+    /*!
+     * \brief Returns the number of rows with gradients
+     * \return the number of rows with gradients
+     */
+    size_t rows() const noexcept {
+        return ids.size();
+    }
+};
+
+namespace detail {
+
+/*!
+ * \brief Compute the sparse gradients of a vocabulary
+ * \param ids The indices, of any dimensions
+ * \param errors The errors, one row of D elements for each index
+ * \param D The size of the embeddings
+ * \return The sparse gradients
+ */
+template <typename I, typename E>
+sparse_row_gradients<value_t<E>> sparse_embedding_gradients_impl(const I& ids, const E& errors, size_t D) {
+    standard_evaluator::pre_assign_rhs(ids);
+    standard_evaluator::pre_assign_rhs(errors);
+
+    decltype(auto) ids_f    = smart_forward(ids);
+    decltype(auto) errors_f = smart_forward(errors);
+
+    ids_f.ensure_cpu_up_to_date();
+    errors_f.ensure_cpu_up_to_date();
+
+    const size_t n = etl::size(ids_f);
+
+    auto* ids_m    = ids_f.memory_start();
+    auto* errors_m = errors_f.memory_start();
+
+    std::vector<size_t> order;
+    std::vector<size_t> starts;
+
+    impl::standard::detail::embedding_groups(ids_m, n, order, starts);
+
+    const size_t U = starts.size() - 1;
+
+    sparse_row_gradients<value_t<E>> gradients;
+
+    gradients.ids.resize(U);
+    gradients.values = dyn_matrix<value_t<E>, 2>(U, D);
+
+    auto* values_m = gradients.values.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t g = first; g < last; ++g) {
+            gradients.ids[g] = size_t(ids_m[order[starts[g]]]);
+
+            impl::standard::detail::embedding_accumulate(errors_m, order.data(), starts[g], starts[g + 1], values_m + g * D, D);
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, U, n * D >= parallel_threshold);
+
+    gradients.values.invalidate_gpu();
+
+    return gradients;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the row-wise sparse gradients of an embedding vocabulary.
+ *
+ * The errors of duplicate indices are accumulated into the same row.
+ *
+ * \param ids The input sequence
+ * \param errors The errors of the embeddings of the sequence
+ * \return The sparse gradients of the vocabulary
+ */
+template <typename I, typename E>
+sparse_row_gradients<value_t<E>> sparse_embedding_gradients(const I& ids, const E& errors) {
+    static_assert(all_etl_expr<I, E>, "etl::sparse_embedding_gradients can only be used on ETL expressions");
+    static_assert(is_1d<I>, "etl::sparse_embedding_gradients is only defined for 1d input");
+    static_assert(is_2d<E>, "etl::sparse_embedding_gradients is only defined for 2d errors");
+
+    cpp_assert(etl::dim<0>(ids) == etl::dim<0>(errors), "Invalid dimensions for sparse_embedding_gradients");
+
+    return detail::sparse_embedding_gradients_impl(ids, errors, etl::dim<1>(errors));
+}
+
+/*!
+ * \brief Compute the row-wise sparse gradients of an embedding vocabulary
+ * for a batch of sequences.
+ *
+ * The errors of duplicate indices are accumulated into the same row.
+ *
+ * \param ids The batch of input sequences
+ * \param errors The errors of the embeddings of the sequences
+ * \return The sparse gradients of the vocabulary
+ */
+template <typename I, typename E>
+sparse_row_gradients<value_t<E>> batch_sparse_embedding_gradients(const I& ids, const E& errors) {
+    static_assert(all_etl_expr<I, E>, "etl::batch_sparse_embedding_gradients can only be used on ETL expressions");
+    static_assert(is_2d<I>, "etl::batch_sparse_embedding_gradients is only defined for 2d input");
+    static_assert(is_3d<E>, "etl::batch_sparse_embedding_gradients is only defined for 3d errors");
+
+    cpp_assert(etl::dim<0>(ids) == etl::dim<0>(errors), "Invalid dimensions for batch_sparse_embedding_gradients");
+    cpp_assert(etl::dim<1>(ids) == etl::dim<1>(errors), "Invalid dimensions for batch_sparse_embedding_gradients");
+
+    return detail::sparse_embedding_gradients_impl(ids, errors, etl::dim<2>(errors));
+}
+
+/*!
+ * \brief Add the scaled sparse gradients to the rows of the vocabulary.
+ *
+ * Since the row ids are unique, the rows are updated in parallel without
+ * any conflict and the other rows of the vocabulary are not touched.
+ *
+ * \param vocab The vocabulary to update
+ * \param gradients The sparse gradients
+ * \param alpha The scaling factor of the gradients
+ */
+template <typename V, typename T>
+void embedding_scatter_add(V&& vocab, const sparse_row_gradients<T>& gradients, value_t<V> alpha = value_t<V>(1)) {
+    static_assert(is_dma<V>, "etl::embedding_scatter_add is only defined for vocabulary with direct memory access");
+    static_assert(is_2d<V>, "etl::embedding_scatter_add is only defined for 2d vocabulary");
+
+    const size_t U = gradients.rows();
+    const size_t D = etl::dim<1>(vocab);
+
+    cpp_assert(!U || etl::dim<1>(gradients.values) == D, "Invalid dimensions for embedding_scatter_add");
+
+    vocab.ensure_cpu_up_to_date();
+    gradients.values.ensure_cpu_up_to_date();
+
+    auto* vocab_m  = vocab.memory_start();
+    auto* values_m = gradients.values.memory_start();
+
+    auto batch_fun = [&](size_t first, size_t last) {
+        for (size_t g = first; g < last; ++g) {
+            cpp_assert(gradients.ids[g] < etl::dim<0>(vocab), "Invalid row id for embedding_scatter_add");
+
+            auto* row       = vocab_m + gradients.ids[g] * D;
+            const auto* src = values_m + g * D;
+
+            for (size_t j = 0; j < D; ++j) {
+                row[j] += alpha * src[j];
+            }
+        }
+    };
+
+    engine_dispatch_1d_serial(batch_fun, 0, U, U * D >= parallel_threshold);
+
+    vocab.validate_cpu();
+    vocab.invalidate_gpu();
+}
+
+} //end of namespace etl
@@ -18,7 +18,9 @@ namespace etl {
  * \brief Enumeration for sparse storage formats
  */
 enum class sparse_storage {
-    COO ///< Coordinate Format (COO)
+    COO, ///< Coordinate Format (COO)
+    CSR, ///< Compressed Sparse Row Format (CSR)
+    CSC  ///< Compressed Sparse Column Format (CSC)
 };
 
 } //end of namespace etl
@@ -0,0 +1,611 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Structural evaluation of expressions of sparse matrices.
+ *
+ * An expression is structural when its result can only be non-zero where one
+ * of its sparse operands is non-zero: zero-preserving unary operations and
+ * scaling by a scalar only transform the non-zeros, additions and
+ * subtractions merge the union of the non-zeros of both sides and
+ * element-wise multiplications their intersection.
+ *
+ * Such an expression is evaluated row by row, with one cursor per sparse
+ * operand, instead of through all the rows x columns elements.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace sparse_detail {
+
+/*!
+ * \brief Traits indicating if a unary operator maps zero to zero
+ * \tparam Op The unary operator
+ */
+template <typename Op>
+struct zero_preserving_unary : std::false_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<minus_unary_op<T>> : std::true_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<plus_unary_op<T>> : std::true_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<abs_unary_op<T>> : std::true_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<sqrt_unary_op<T>> : std::true_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<cbrt_unary_op<T>> : std::true_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<sign_unary_op<T>> : std::true_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<relu_unary_op<T>> : std::true_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<sin_unary_op<T>> : std::true_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<sinh_unary_op<T>> : std::true_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<tan_unary_op<T>> : std::true_type {};
+
+/*!
+ * \copydoc zero_preserving_unary
+ */
+template <typename T>
+struct zero_preserving_unary<tanh_unary_op<T>> : std::true_type {};
+
+/*!
+ * \brief Traits indicating if an expression can be evaluated structurally
+ * \tparam E The (decayed) expression type
+ */
+template <typename E>
+struct structural_expr : std::false_type {};
+
+/*!
+ * \brief A sparse matrix is the leaf of a structural expression
+ */
+template <typename T, sparse_storage SS, typename I>
+struct structural_expr<sparse_matrix_impl<T, SS, 2, I>> : std::true_type {};
+
+/*!
+ * \brief A zero-preserving unary operation of a structural expression
+ */
+template <typename T, typename E, typename Op>
+struct structural_expr<unary_expr<T, E, Op>> : std::bool_constant<zero_preserving_unary<Op>::value && structural_expr<std::decay_t<E>>::value> {};
+
+/*!
+ * \brief The addition of two structural expressions (union)
+ */
+template <typename T, typename L, typename R>
+struct structural_expr<binary_expr<T, L, plus_binary_op<T>, R>>
+        : std::bool_constant<structural_expr<std::decay_t<L>>::value && structural_expr<std::decay_t<R>>::value> {};
+
+/*!
+ * \brief The subtraction of two structural expressions (union)
+ */
+template <typename T, typename L, typename R>
+struct structural_expr<binary_expr<T, L, minus_binary_op<T>, R>>
+        : std::bool_constant<structural_expr<std::decay_t<L>>::value && structural_expr<std::decay_t<R>>::value> {};
+
+/*!
+ * \brief The scaling of a structural expression or the element-wise
+ * multiplication of two structural expressions (intersection)
+ */
+template <typename T, typename L, typename R>
+struct structural_expr<binary_expr<T, L, mul_binary_op<T>, R>>
+        : std::bool_constant<(structural_expr<std::decay_t<L>>::value && (is_scalar<R> || structural_expr<std::decay_t<R>>::value))
+                             || (is_scalar<L> && structural_expr<std::decay_t<R>>::value)> {};
+
+/*!
+ * \brief The division of a structural expression by a scalar
+ */
+template <typename T, typename L, typename R>
+struct structural_expr<binary_expr<T, L, div_binary_op<T>, R>> : std::bool_constant<structural_expr<std::decay_t<L>>::value && is_scalar<R>> {};
+
+/*!
+ * \brief Cursor over the non-zeros of a row of a row-compressed matrix
+ * \tparam T The value type
+ * \tparam I The index type
+ */
+template <typename T, typename I>
+struct leaf_cursor {
+    const T* values; ///< The non-zero values
+    const I* inner;  ///< The column of each non-zero
+    size_t p;        ///< The current non-zero
+    size_t last;     ///< The end of the row
+
+    /*!
+     * \brief Indicates if the cursor points to a non-zero
+     */
+    bool valid() const noexcept {
+        return p < last;
+    }
+
+    /*!
+     * \brief Returns the column of the current non-zero
+     */
+    size_t index() const noexcept {
+        return inner[p];
+    }
+
+    /*!
+     * \brief Returns the value of the current non-zero
+     */
+    T value() const noexcept {
+        return values[p];
+    }
+
+    /*!
+     * \brief Move to the next non-zero of the row
+     */
+    void next() noexcept {
+        ++p;
+    }
+};
+
+/*!
+ * \brief Cursor applying a unary operator to the non-zeros of another cursor
+ */
+template <typename T, typename C, typename Op>
+struct unary_cursor {
+    C c; ///< The sub cursor
+
+    /*!
+     * \copydoc leaf_cursor::valid
+     */
+    bool valid() const noexcept {
+        return c.valid();
+    }
+
+    /*!
+     * \copydoc leaf_cursor::index
+     */
+    size_t index() const noexcept {
+        return c.index();
+    }
+
+    /*!
+     * \copydoc leaf_cursor::value
+     */
+    T value() const {
+        return Op::apply(T(c.value()));
+    }
+
+    /*!
+     * \copydoc leaf_cursor::next
+     */
+    void next() noexcept {
+        c.next();
+    }
+};
+
+/*!
+ * \brief Cursor applying a binary operator between a scalar and the
+ * non-zeros of another cursor
+ * \tparam Left Indicates if the scalar is the left operand
+ */
+template <typename T, typename C, typename Op, bool Left>
+struct scalar_cursor {
+    T s; ///< The scalar
+    C c; ///< The sub cursor
+
+    /*!
+     * \copydoc leaf_cursor::valid
+     */
+    bool valid() const noexcept {
+        return c.valid();
+    }
+
+    /*!
+     * \copydoc leaf_cursor::index
+     */
+    size_t index() const noexcept {
+        return c.index();
+    }
+
+    /*!
+     * \copydoc leaf_cursor::value
+     */
+    T value() const {
+        if constexpr (Left) {
+            return Op::apply(s, T(c.value()));
+        } else {
+            return Op::apply(T(c.value()), s);
+        }
+    }
+
+    /*!
+     * \copydoc leaf_cursor::next
+     */
+    void next() noexcept {
+        c.next();
+    }
+};
+
+/*!
+ * \brief Cursor over the union of the non-zeros of two cursors.
+ *
+ * A non-zero present on a single side is combined with a zero.
+ */
+template <typename T, typename LC, typename RC, typename Op>
+struct union_cursor {
+    LC l; ///< The left cursor
+    RC r; ///< The right cursor
+
+    /*!
+     * \copydoc leaf_cursor::valid
+     */
+    bool valid() const noexcept {
+        return l.valid() || r.valid();
+    }
+
+    /*!
+     * \copydoc leaf_cursor::index
+     */
+    size_t index() const noexcept {
+        if (!l.valid()) {
+            return r.index();
+        } else if (!r.valid()) {
+            return l.index();
+        } else {
+            return std::min(l.index(), r.index());
+        }
+    }
+
+    /*!
+     * \copydoc leaf_cursor::value
+     */
+    T value() const {
+        const size_t j = index();
+
+        const T a = l.valid() && l.index() == j ? T(l.value()) : T(0);
+        const T b = r.valid() && r.index() == j ? T(r.value()) : T(0);
+
+        return Op::apply(a, b);
+    }
+
+    /*!
+     * \copydoc leaf_cursor::next
+     */
+    void next() noexcept {
+        const size_t j = index();
+
+        if (l.valid() && l.index() == j) {
+            l.next();
+        }
+
+        if (r.valid() && r.index() == j) {
+            r.next();
+        }
+    }
+};
+
+/*!
+ * \brief Cursor over the intersection of the non-zeros of two cursors
+ */
+template <typename T, typename LC, typename RC, typename Op>
+struct intersection_cursor {
+    LC l; ///< The left cursor
+    RC r; ///< The right cursor
+
+    /*!
+     * \brief Construct a new cursor pointing to the first common non-zero
+     */
+    intersection_cursor(LC l, RC r) : l(l), r(r) {
+        align();
+    }
+
+    /*!
+     * \copydoc leaf_cursor::valid
+     */
+    bool valid() const noexcept {
+        return l.valid() && r.valid();
+    }
+
+    /*!
+     * \copydoc leaf_cursor::index
+     */
+    size_t index() const noexcept {
+        return l.index();
+    }
+
+    /*!
+     * \copydoc leaf_cursor::value
+     */
+    T value() const {
+        return Op::apply(T(l.value()), T(r.value()));
+    }
+
+    /*!
+     * \copydoc leaf_cursor::next
+     */
+    void next() noexcept {
+        l.next();
+        r.next();
+        align();
+    }
+
+private:
+    /*!
+     * \brief Advance both cursors until they point to the same column
+     */
+    void align() noexcept {
+        while (l.valid() && r.valid() && l.index() != r.index()) {
+            if (l.index() < r.index()) {
+                l.next();
+            } else {
+                r.next();
+            }
+        }
+    }
+};
+
+/*!
+ * \brief Node of the structural evaluation of an expression.
+ *
+ * Each node gives a cursor over the non-zeros of any row of its
+ * sub-expression, by increasing column.
+ *
+ * \tparam E The (decayed) expression type
+ */
+template <typename E>
+struct structural_node;
+
+/*!
+ * \brief Node of a scalar operand
+ */
+template <typename T>
+struct structural_node<scalar<T>> {
+    T value; ///< The scalar value
+
+    /*!
+     * \brief Construct a new node for the given scalar
+     */
+    explicit structural_node(const scalar<T>& s) : value(s.value) {}
+};
+
+/*!
+ * \brief Node of a sparse matrix.
+ *
+ * The rows of a CSR matrix are accessed directly, the other formats are
+ * first converted to CSR.
+ */
+template <typename T, sparse_storage SS, typename I>
+struct structural_node<sparse_matrix_impl<T, SS, 2, I>> {
+    using matrix_type = sparse_matrix_impl<T, SS, 2, I>;                  ///< The matrix type
+    using csr_type    = sparse_matrix_impl<T, sparse_storage::CSR, 2, I>; ///< The row-compressed matrix type
+
+    csr_type converted;  ///< The converted matrix, if necessary
+    const csr_type* csr; ///< The row-compressed matrix
+
+    /*!
+     * \brief Construct a new node for the given sparse matrix
+     */
+    explicit structural_node(const matrix_type& m) {
+        if constexpr (SS == sparse_storage::CSR) {
+            csr = &m;
+        } else {
+            converted = m;
+            csr       = &converted;
+        }
+    }
+
+    structural_node(const structural_node& rhs) = delete;
+    structural_node& operator=(const structural_node& rhs) = delete;
+
+    /*!
+     * \brief Returns a cursor over the non-zeros of the given row
+     */
+    leaf_cursor<T, I> row(size_t i) const noexcept {
+        const I* outer = csr->outer_index();
+
+        // An empty matrix has no outer index
+        if (!outer) {
+            return {nullptr, nullptr, 0, 0};
+        }
+
+        return {csr->values(), csr->inner_index(), outer[i], outer[i + 1]};
+    }
+};
+
+/*!
+ * \brief Node of a zero-preserving unary operation
+ */
+template <typename T, typename E, typename Op>
+struct structural_node<unary_expr<T, E, Op>> {
+    structural_node<std::decay_t<E>> sub; ///< The node of the sub expression
+
+    /*!
+     * \brief Construct a new node for the given expression
+     */
+    explicit structural_node(const unary_expr<T, E, Op>& e) : sub(e.get_value()) {}
+
+    /*!
+     * \copydoc structural_node<sparse_matrix_impl<T, SS, 2, I>>::row
+     */
+    auto row(size_t i) const {
+        return unary_cursor<T, decltype(sub.row(i)), Op>{sub.row(i)};
+    }
+};
+
+/*!
+ * \brief Node of a binary operation, with at least one structural side
+ */
+template <typename T, typename L, typename Op, typename R>
+struct structural_node<binary_expr<T, L, Op, R>> {
+    structural_node<std::decay_t<L>> lhs; ///< The node of the left expression
+    structural_node<std::decay_t<R>> rhs; ///< The node of the right expression
+
+    /*!
+     * \brief Construct a new node for the given expression
+     */
+    explicit structural_node(const binary_expr<T, L, Op, R>& e) : lhs(e.get_lhs()), rhs(e.get_rhs()) {}
+
+    /*!
+     * \copydoc structural_node<sparse_matrix_impl<T, SS, 2, I>>::row
+     */
+    auto row(size_t i) const {
+        if constexpr (is_scalar<L>) {
+            return scalar_cursor<T, decltype(rhs.row(i)), Op, true>{lhs.value, rhs.row(i)};
+        } else if constexpr (is_scalar<R>) {
+            return scalar_cursor<T, decltype(lhs.row(i)), Op, false>{rhs.value, lhs.row(i)};
+        } else if constexpr (std::is_same_v<Op, mul_binary_op<T>>) {
+            return intersection_cursor<T, decltype(lhs.row(i)), decltype(rhs.row(i)), Op>(lhs.row(i), rhs.row(i));
+        } else {
+            return union_cursor<T, decltype(lhs.row(i)), decltype(rhs.row(i)), Op>{lhs.row(i), rhs.row(i)};
+        }
+    }
+};
+
+/*!
+ * \brief Apply the given functor to each structural non-zero of an
+ * expression, in row-major order.
+ *
+ * The values are computed from the non-zeros of the sparse operands, some of
+ * them can still be zero (for instance a - a).
+ *
+ * \param node The node of the expression
+ * \param rows The number of rows of the expression
+ * \param fun The functor to apply, called with (i, j, value)
+ */
+template <typename N, typename F>
+void structural_for_each(const N& node, size_t rows, F&& fun) {
+    for (size_t i = 0; i < rows; ++i) {
+        for (auto c = node.row(i); c.valid(); c.next()) {
+            fun(i, c.index(), c.value());
+        }
+    }
+}
+
+/*!
+ * \brief Assign a structural expression to a dense matrix, only computing
+ * the structural non-zeros after clearing the dense matrix
+ * \param e The structural expression
+ * \param lhs The dense matrix
+ */
+template <typename E, typename L>
+void structural_scatter(const E& e, L&& lhs) {
+    using lhs_value_type = value_t<L>;
+
+    const structural_node<std::decay_t<E>> node(e);
+
+    auto* memory = lhs.memory_start();
+
+    std::fill_n(memory, etl::size(lhs), lhs_value_type(0));
+
+    const size_t rows    = etl::dim<0>(lhs);
+    const size_t columns = etl::dim<1>(lhs);
+
+    if constexpr (decay_traits<L>::storage_order == order::RowMajor) {
+        structural_for_each(node, rows, [memory, columns](size_t i, size_t j, auto v) { memory[i * columns + j] = v; });
+    } else {
+        structural_for_each(node, rows, [memory, rows](size_t i, size_t j, auto v) { memory[i + j * rows] = v; });
+    }
+
+    lhs.validate_cpu();
+    lhs.invalidate_gpu();
+}
+
+/*!
+ * \brief Compute the sum of a structural expression, only reducing its
+ * structural non-zeros
+ * \param e The structural expression
+ * \return The sum of the values of the expression
+ */
+template <typename E>
+value_t<E> structural_sum(const E& e) {
+    value_t<E> acc(0);
+
+    auto reduce = [&acc](size_t, size_t, auto v) { acc += v; };
+
+    if constexpr (is_sparse_matrix<E>) {
+        e.for_each_non_zero(reduce);
+    } else {
+        structural_for_each(structural_node<std::decay_t<E>>(e), etl::dim<0>(e), reduce);
+    }
+
+    return acc;
+}
+
+/*!
+ * \brief Compute the sum of the absolute values of a structural expression,
+ * only reducing its structural non-zeros
+ * \param e The structural expression
+ * \return The sum of the absolute values of the expression
+ */
+template <typename E>
+value_t<E> structural_asum(const E& e) {
+    using T = value_t<E>;
+
+    T acc(0);
+
+    auto reduce = [&acc](size_t, size_t, auto v) {
+        using std::abs;
+        acc += abs(T(v));
+    };
+
+    if constexpr (is_sparse_matrix<E>) {
+        e.for_each_non_zero(reduce);
+    } else {
+        structural_for_each(structural_node<std::decay_t<E>>(e), etl::dim<0>(e), reduce);
+    }
+
+    return acc;
+}
+
+} //end of namespace sparse_detail
+
+/*!
+ * \brief Traits indicating if the given expression is a sparse matrix or an
+ * expression of sparse matrices that can be evaluated from their non-zeros
+ * only.
+ * \tparam E The expression type
+ */
+template <typename E>
+constexpr bool is_sparse_structural = sparse_detail::structural_expr<std::decay_t<E>>::value;
+
+} //end of namespace etl
@@ -0,0 +1,272 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+/*!
+ * \file
+ * \brief Singular value decomposition, complete or truncated
+ *
+ * Rectangular matrices are first decomposed with a QR decomposition (of A or
+ * of A^T), the singular value decomposition of the square R factor is then
+ * computed with a bidiagonal reduction and the implicit QR algorithm.
+ */
+
+#pragma once
+
+namespace etl {
+
+namespace detail {
+
+/*!
+ * \brief Compute the thin singular value decomposition, A = U * diag(s) * V^T
+ *
+ * \param A The matrix to decompose [M, N]
+ * \param s The singular values, in descending order [K]
+ * \param U The left singular vectors, or nullptr [M, K]
+ * \param V The right singular vectors, or nullptr [N, K]
+ *
+ * \return true if the algorithm converged, false otherwise
+ */
+template <typename T, typename AT>
+bool svd_thin(const AT& A, dyn_vector<T>& s, dyn_matrix<T, 2>* U, dyn_matrix<T, 2>* V) {
+    const size_t m = etl::dim<0>(A);
+    const size_t n = etl::dim<1>(A);
+
+    if (m < n) {
+        // A^T = V * diag(s) * U^T
+        dyn_matrix<T, 2> at(n, m);
+        at = etl::transpose(A);
+
+        return svd_thin(at, s, V, U);
+    }
+
+    s.resize(n);
+
+    dyn_matrix<T, 2> u;
+    dyn_matrix<T, 2> v;
+
+    if (U) {
+        u.resize(n, n);
+    }
+
+    if (V) {
+        v.resize(n, n);
+    }
+
+    auto square = [&](dyn_matrix<T, 2>& a) {
+        return detail::svd(a.memory_start(), s.memory_start(), U ? u.memory_start() : nullptr, V ? v.memory_start() : nullptr, n);
+    };
+
+    bool converged;
+
+    if (m == n) {
+        dyn_matrix<T, 2> a(n, n);
+        a = A;
+
+        converged = square(a);
+
+        if (U) {
+            *U = u;
+        }
+    } else {
+        // A = Q * R, R = U_R * diag(s) * V^T, U = Q * U_R
+
+        auto decomposition = etl::qr(A);
+
+        dyn_matrix<T, 2> r = decomposition.r();
+
+        converged = square(r);
+
+        if (U) {
+            U->resize(m, n);
+            *U = T(0);
+
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    (*U)(i, j) = u(i, j);
+                }
+            }
+
+            decomposition.apply_q(*U);
+        }
+    }
+
+    if (V) {
+        *V = v;
+    }
+
+    return converged;
+}
+
+} //end of namespace detail
+
+/*!
+ * \brief Compute the singular values of a matrix
+ *
+ * \param A The matrix to decompose [M, N]
+ * \param s The singular values, in descending order [min(M, N)]
+ * \return true if the decomposition suceeded, false otherwise
+ */
+template <typename AT, typename ST>
+bool svd(const AT& A, ST& s) {
+    static_assert(is_etl_expr<AT> && is_etl_expr<ST>, "svd only supported for ETL expressions");
+    static_assert(is_2d<AT> && is_1d<ST>, "svd computes the singular values of a matrix in a vector");
+
+    using T = value_t<AT>;
+
+    static_assert(std::is_floating_point_v<T>, "svd is only implemented for floating point types");
+
+    if (etl::size(s) != std::min(etl::dim<0>(A), etl::dim<1>(A))) {
+        return false;
+    }
+
+    dyn_vector<T> values;
+
+    const bool converged = detail::svd_thin<T>(A, values, nullptr, nullptr);
+
+    s = values;
+
+    return converged;
+}
+
+/*!
+ * \brief Compute the thin singular value decomposition of a matrix,
+ * A = U * diag(s) * V^T
+ *
+ * \param A The matrix to decompose [M, N]
+ * \param U The left singular vectors, in columns [M, min(M, N)]
+ * \param s The singular values, in descending order [min(M, N)]
+ * \param V The right singular vectors, in columns [N, min(M, N)]
+ * \return true if the decomposition suceeded, false otherwise
+ */
+template <typename AT, typename UT, typename ST, typename VT>
+bool svd(const AT& A, UT& U, ST& s, VT& V) {
+    static_assert(all_etl_expr<AT, UT, ST, VT>, "svd only supported for ETL expressions");
+    static_assert(is_2d<AT> && is_2d<UT> && is_1d<ST> && is_2d<VT>, "svd decomposes a matrix into two matrices and a vector");
+
+    using T = value_t<AT>;
+
+    static_assert(std::is_floating_point_v<T>, "svd is only implemented for floating point types");
+
+    const size_t m = etl::dim<0>(A);
+    const size_t n = etl::dim<1>(A);
+    const size_t k = std::min(m, n);
+
+    if (etl::size(s) != k || etl::dim(U, 0) != m || etl::dim(U, 1) != k || etl::dim(V, 0) != n || etl::dim(V, 1) != k) {
+        return false;
+    }
+
+    dyn_vector<T> values;
+    dyn_matrix<T, 2> left;
+    dyn_matrix<T, 2> right;
+
+    const bool converged = detail::svd_thin(A, values, &left, &right);
+
+    U = left;
+    s = values;
+    V = right;
+
+    return converged;
+}
+
+/*!
+ * \brief Compute a truncated singular value decomposition of a matrix,
+ * with a randomized algorithm, A ~= U * diag(s) * V^T
+ *
+ * The number of singular values to compute is given by the size of s. The
+ * range of A is approximated by the product of A with a random gaussian
+ * matrix, refined with power iterations, and the decomposition of the
+ * projection of A on this range is computed. The power iterations improve
+ * the accuracy when the singular values decay slowly.
+ *
+ * \param A The matrix to decompose [M, N]
+ * \param U The left singular vectors, in columns [M, K]
+ * \param s The largest singular values, in descending order [K]
+ * \param V The right singular vectors, in columns [N, K]
+ * \param oversampling The number of additional random vectors
+ * \param iterations The number of power iterations
+ * \return true if the decomposition suceeded, false otherwise
+ */
+template <typename AT, typename UT, typename ST, typename VT>
+bool svd_truncated(const AT& A, UT& U, ST& s, VT& V, size_t oversampling = 10, size_t iterations = 2) {
+    static_assert(all_etl_expr<AT, UT, ST, VT>, "svd_truncated only supported for ETL expressions");
+    static_assert(is_2d<AT> && is_2d<UT> && is_1d<ST> && is_2d<VT>, "svd_truncated decomposes a matrix into two matrices and a vector");
+
+    using T = value_t<AT>;
+
+    static_assert(std::is_floating_point_v<T>, "svd_truncated is only implemented for floating point types");
+
+    const size_t m = etl::dim<0>(A);
+    const size_t n = etl::dim<1>(A);
+    const size_t k = etl::size(s);
+
+    if (k > std::min(m, n) || etl::dim(U, 0) != m || etl::dim(U, 1) != k || etl::dim(V, 0) != n || etl::dim(V, 1) != k) {
+        return false;
+    }
+
+    const size_t l = std::min(k + oversampling, std::min(m, n));
+
+    dyn_matrix<T, 2> a(m, n);
+    a = A;
+
+    // 1. Orthonormal basis Q of the range of A * Omega
+
+    random_engine g;
+
+    dyn_matrix<T, 2> omega(n, l);
+    omega = normal_generator<T>(g, T(0), T(1));
+
+    dyn_matrix<T, 2> y(m, l);
+    y = a * omega;
+
+    dyn_matrix<T, 2> q = etl::qr(y).q();
+
+    dyn_matrix<T, 2> z(n, l);
+
+    for (size_t i = 0; i < iterations; ++i) {
+        z = transpose(a) * q;
+        z = etl::qr(z).q();
+
+        y = a * z;
+        q = etl::qr(y).q();
+    }
+
+    // 2. Decomposition of B = Q^T * A = U_B * diag(s) * V^T
+
+    dyn_matrix<T, 2> b(l, n);
+    b = transpose(q) * a;
+
+    dyn_vector<T> values;
+    dyn_matrix<T, 2> left;
+    dyn_matrix<T, 2> right;
+
+    const bool converged = detail::svd_thin(b, values, &left, &right);
+
+    // 3. U = Q * U_B, only the first K singular values are kept
+
+    dyn_matrix<T, 2> u(m, l);
+    u = q * left;
+
+    for (size_t i = 0; i < k; ++i) {
+        s[i] = values[i];
+    }
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < k; ++j) {
+            U(i, j) = u(i, j);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < k; ++j) {
+            V(i, j) = right(i, j);
+        }
+    }
+
+    return converged;
+}
+
+} //end of namespace etl
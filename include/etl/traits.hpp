@@ -86,8 +86,40 @@ struct is_sparse_matrix_impl : std::false_type {};
 /*!
  * \copydoc is_sparse_matrix_impl
  */
-template <typename V1, sparse_storage V2, size_t V3>
-struct is_sparse_matrix_impl<sparse_matrix_impl<V1, V2, V3>> : std::true_type {};
+template <typename V1, sparse_storage V2, size_t V3, typename V4>
+struct is_sparse_matrix_impl<sparse_matrix_impl<V1, V2, V3, V4>> : std::true_type {};
+
+/*!
+ * \brief Special traits helper to detect if type is the transposition of a
+ * sparse_matrix
+ * \tparam T The type to test
+ */
+template <typename T>
+struct is_transposed_sparse_matrix_impl : std::false_type {};
+
+/*!
+ * \copydoc is_transposed_sparse_matrix_impl
+ */
+template <typename A>
+struct is_transposed_sparse_matrix_impl<transpose_expr<A>> : is_sparse_matrix_impl<std::decay_t<A>> {};
+
+/*!
+ * \brief Special traits helper to get the type transposed by a
+ * transpose_expr, void for the other types
+ * \tparam T The type to inspect
+ */
+template <typename T>
+struct transposed_type_impl {
+    using type = void; ///< The transposed type
+};
+
+/*!
+ * \copydoc transposed_type_impl
+ */
+template <typename A>
+struct transposed_type_impl<transpose_expr<A>> {
+    using type = std::decay_t<A>; ///< The transposed type
+};
 
 /*!
  * \brief Special traits helper to detect if type is a dyn_matrix_view
@@ -303,6 +335,31 @@ constexpr bool is_uni_lower_matrix = cpp::is_specialization_of_v<etl::uni_lower_
 template <typename T>
 constexpr bool is_uni_upper_matrix = cpp::is_specialization_of_v<etl::uni_upper_matrix, std::decay_t<T>>;
 
+/*!
+ * \brief Traits indicating if the given ETL type is a lower triangular
+ * adapter (lower_matrix or uni_lower_matrix)
+ * \tparam T The type to test
+ */
+template <typename T>
+constexpr bool is_lower_adapter = is_lower_matrix<T> || is_uni_lower_matrix<T>;
+
+/*!
+ * \brief Traits indicating if the given ETL type is an upper triangular
+ * adapter (upper_matrix or uni_upper_matrix)
+ * \tparam T The type to test
+ */
+template <typename T>
+constexpr bool is_upper_adapter = is_upper_matrix<T> || is_uni_upper_matrix<T>;
+
+/*!
+ * \brief Traits indicating if the given ETL type is an adapter, enforcing a
+ * structure on the adapted matrix
+ * \tparam T The type to test
+ */
+template <typename T>
+constexpr bool is_adapter = is_symmetric_matrix<T> || is_hermitian_matrix<T> || is_diagonal_matrix<T> || is_lower_adapter<T> || is_upper_adapter<T>
+                            || is_strictly_lower_matrix<T> || is_strictly_upper_matrix<T>;
+
 /*!
  * \brief Traits indicating if the given ETL type is a unary expression.
  * \tparam T The type to test
@@ -419,6 +476,57 @@ constexpr bool is_etl_expr = decay_traits<T>::is_etl;
 template <typename T>
 constexpr bool is_transpose_expr = cpp::is_specialization_of_v<etl::transpose_expr, std::decay_t<T>>;
 
+/*!
+ * \brief Traits indicating if the given type is a sparse matrix or the
+ * transposition of a sparse matrix.
+ * \tparam T The type to test
+ */
+template <typename T>
+constexpr bool is_sparse_operand = is_sparse_matrix<T> || traits_detail::is_transposed_sparse_matrix_impl<std::decay_t<T>>::value;
+
+/*!
+ * \brief Traits indicating if the product of the two given types has exactly
+ * one sparse operand and is computed by the sparse kernels.
+ * \tparam A The left type
+ * \tparam B The right type
+ */
+template <typename A, typename B>
+constexpr bool is_sparse_mul = is_sparse_operand<A> != is_sparse_operand<B>;
+
+/*!
+ * \brief The type transposed by the given transpose expression, void for
+ * the other types
+ * \tparam T The type to inspect
+ */
+template <typename T>
+using transposed_t = typename traits_detail::transposed_type_impl<std::decay_t<T>>::type;
+
+/*!
+ * \brief Traits indicating if the given type is a diagonal or a triangular
+ * adapter, whose products are computed by the structured kernels.
+ * \tparam T The type to test
+ */
+template <typename T>
+constexpr bool is_structured_matrix =
+    is_diagonal_matrix<T> || is_lower_adapter<T> || is_upper_adapter<T> || is_strictly_lower_matrix<T> || is_strictly_upper_matrix<T>;
+
+/*!
+ * \brief Traits indicating if the given type is a structured matrix or the
+ * transposition of a structured or symmetric matrix.
+ * \tparam T The type to test
+ */
+template <typename T>
+constexpr bool is_structured_operand = is_structured_matrix<T> || is_structured_matrix<transposed_t<T>> || is_symmetric_matrix<transposed_t<T>>;
+
+/*!
+ * \brief Traits indicating if the product of the two given types exploits
+ * the structure of one of the operands, without being a sparse product.
+ * \tparam A The left type
+ * \tparam B The right type
+ */
+template <typename A, typename B>
+constexpr bool is_structured_mul = !is_sparse_mul<A, B> && (is_structured_operand<A> || is_structured_operand<B>);
+
 /*!
  * \brief Traits indicating if the given type is a temporary expression.
  * \tparam T The type to test
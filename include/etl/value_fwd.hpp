@@ -103,9 +103,12 @@ struct gpu_dyn_matrix_impl;
 template <typename T, order SO, size_t D = 2>
 struct custom_dyn_matrix_impl;
 
-template <typename T, sparse_storage SS, size_t D>
+template <typename T, sparse_storage SS, size_t D, typename I = size_t>
 struct sparse_matrix_impl;
 
+template <typename T, typename I = size_t>
+struct sparse_builder;
+
 template <typename Stream>
 struct serializer;
 
@@ -305,4 +308,18 @@ using custom_fast_matrix = custom_fast_matrix_impl<T, cpp::array_wrapper<T>, ord
 template <typename T, size_t D = 2>
 using sparse_matrix = sparse_matrix_impl<T, sparse_storage::COO, D>;
 
+/*!
+ * \brief A sparse matrix in Compressed Sparse Row (CSR) format
+ * \tparam I The type used to store the indices
+ */
+template <typename T, typename I = size_t>
+using csr_matrix = sparse_matrix_impl<T, sparse_storage::CSR, 2, I>;
+
+/*!
+ * \brief A sparse matrix in Compressed Sparse Column (CSC) format
+ * \tparam I The type used to store the indices
+ */
+template <typename T, typename I = size_t>
+using csc_matrix = sparse_matrix_impl<T, sparse_storage::CSC, 2, I>;
+
 } //end of namespace etl
@@ -0,0 +1,198 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+namespace {
+
+/*!
+ * \brief Reference attention, computing the full matrix of scores of each
+ * group
+ */
+template <typename Q, typename K, typename V, typename C>
+void attention_reference(const Q& q, const K& k, const V& v, C& c, etl::value_t<Q> scale, bool causal) {
+    using T = etl::value_t<Q>;
+
+    constexpr size_t DD = etl::dimensions<Q>();
+
+    const size_t Sq = etl::dim(q, DD - 2);
+    const size_t Sk = etl::dim(k, DD - 2);
+    const size_t D  = etl::dim(q, DD - 1);
+    const size_t Dv = etl::dim(v, DD - 1);
+    const size_t N  = etl::size(q) / (Sq * D);
+
+    std::vector<T> s(Sk);
+
+    for (size_t n = 0; n < N; ++n) {
+        for (size_t i = 0; i < Sq; ++i) {
+            const size_t last = causal ? std::min(Sk, i + 1) : Sk;
+
+            T m = -std::numeric_limits<T>::infinity();
+
+            for (size_t j = 0; j < last; ++j) {
+                s[j] = 0;
+
+                for (size_t d = 0; d < D; ++d) {
+                    s[j] += q[(n * Sq + i) * D + d] * k[(n * Sk + j) * D + d];
+                }
+
+                s[j] *= scale;
+                m = std::max(m, s[j]);
+            }
+
+            T sum = 0;
+
+            for (size_t j = 0; j < last; ++j) {
+                s[j] = std::exp(s[j] - m);
+                sum += s[j];
+            }
+
+            for (size_t dv = 0; dv < Dv; ++dv) {
+                T acc = 0;
+
+                for (size_t j = 0; j < last; ++j) {
+                    acc += s[j] * v[(n * Sk + j) * Dv + dv];
+                }
+
+                c[(n * Sq + i) * Dv + dv] = acc / sum;
+            }
+        }
+    }
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("attention/2d/0", "[attention]", Z, float, double) {
+    etl::fast_matrix<Z, 7, 16> q;
+    etl::fast_matrix<Z, 9, 16> k;
+    etl::fast_matrix<Z, 9, 12> v;
+
+    q = etl::uniform_generator(-1.0, 1.0);
+    k = etl::uniform_generator(-1.0, 1.0);
+    v = etl::uniform_generator(-1.0, 1.0);
+
+    etl::fast_matrix<Z, 7, 12> c;
+    etl::fast_matrix<Z, 7, 9> p;
+    etl::fast_matrix<Z, 7, 12> ref;
+
+    c = etl::attention(q, k, v, Z(0.25));
+
+    p   = etl::softmax(Z(0.25) * (q * trans(k)));
+    ref = p * v;
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("attention/2d/1", "[attention]", Z, float, double) {
+    // Several blocks of queries and several tiles of keys
+    etl::dyn_matrix<Z, 2> q(70, 24);
+    etl::dyn_matrix<Z, 2> k(300, 24);
+    etl::dyn_matrix<Z, 2> v(300, 20);
+
+    q = etl::uniform_generator(-1.0, 1.0);
+    k = etl::uniform_generator(-1.0, 1.0);
+    v = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z, 2> c(70, 20);
+    etl::dyn_matrix<Z, 2> ref(70, 20);
+
+    c = etl::attention(q, k, v, Z(1.0) / std::sqrt(Z(24)));
+
+    attention_reference(q, k, v, ref, Z(1.0) / std::sqrt(Z(24)), false);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("attention/2d/2", "[attention]", Z, float, double) {
+    etl::dyn_matrix<Z, 2> q(200, 16);
+    etl::dyn_matrix<Z, 2> k(200, 16);
+    etl::dyn_matrix<Z, 2> v(200, 9);
+
+    // Large scores check the stability of the online softmax
+    q = etl::uniform_generator(-4.0, 4.0);
+    k = etl::uniform_generator(-4.0, 4.0);
+    v = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z, 2> c(200, 9);
+    etl::dyn_matrix<Z, 2> ref(200, 9);
+
+    c = etl::attention(q, k, v, Z(1.0), true);
+
+    attention_reference(q, k, v, ref, Z(1.0), true);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps * 10);
+    }
+
+    // The first query only attends to the first key
+    for (size_t j = 0; j < 9; ++j) {
+        REQUIRE_EQUALS_APPROX(c(0, j), v(0, j));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("attention/3d/0", "[attention]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> q(3, 33, 8);
+    etl::dyn_matrix<Z, 3> k(3, 33, 8);
+    etl::dyn_matrix<Z, 3> v(3, 33, 8);
+
+    q = etl::uniform_generator(-1.0, 1.0);
+    k = etl::uniform_generator(-1.0, 1.0);
+    v = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z, 3> c(3, 33, 8);
+    etl::dyn_matrix<Z, 3> ref(3, 33, 8);
+
+    c = etl::attention(q, k, v, Z(0.5));
+
+    attention_reference(q, k, v, ref, Z(0.5), false);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    c = etl::attention(q, k, v, Z(0.5), true);
+
+    attention_reference(q, k, v, ref, Z(0.5), true);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("attention/4d/0", "[attention]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> q(2, 3, 130, 16);
+    etl::dyn_matrix<Z, 4> k(2, 3, 150, 16);
+    etl::dyn_matrix<Z, 4> v(2, 3, 150, 32);
+
+    q = etl::uniform_generator(-1.0, 1.0);
+    k = etl::uniform_generator(-1.0, 1.0);
+    v = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z, 4> c(2, 3, 130, 32);
+    etl::dyn_matrix<Z, 4> ref(2, 3, 130, 32);
+
+    c = etl::attention(q, k, v, Z(0.25), true);
+
+    attention_reference(q, k, v, ref, Z(0.25), true);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+    }
+
+    // Each head is independent
+    etl::dyn_matrix<Z, 2> c_1(130, 32);
+
+    c_1 = etl::attention(q(1)(2), k(1)(2), v(1)(2), Z(0.25), true);
+
+    for (size_t i = 0; i < etl::size(c_1); ++i) {
+        REQUIRE_EQUALS_APPROX(c(1)(2)[i], c_1[i]);
+    }
+}
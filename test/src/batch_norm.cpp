@@ -0,0 +1,348 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+namespace {
+
+/*!
+ * \brief Reference batch normalization, computed with the existing
+ * bias_batch expressions
+ */
+template <typename X, typename G, typename B, typename M, typename V, typename Y>
+void batch_norm_reference(const X& x, const G& gamma, const B& beta, M& mean, V& var, Y& y, etl::value_t<X> eps) {
+    if constexpr (etl::is_2d<X>) {
+        mean = etl::bias_batch_mean_2d(x);
+        var  = etl::bias_batch_var_2d(x, mean);
+    } else {
+        mean = etl::bias_batch_mean_4d(x);
+        var  = etl::bias_batch_var_4d(x, mean);
+    }
+
+    const size_t N = etl::dim<0>(x);
+    const size_t K = etl::dim<1>(x);
+    const size_t S = etl::size(x) / (N * K);
+
+    for (size_t b = 0; b < N; ++b) {
+        for (size_t k = 0; k < K; ++k) {
+            for (size_t i = 0; i < S; ++i) {
+                const size_t p = (b * K + k) * S + i;
+                y[p]           = gamma[k] * (x[p] - mean[k]) / std::sqrt(var[k] + eps) + beta[k];
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Reference batch normalization gradients
+ */
+template <typename X, typename E, typename G, typename M, typename V, typename DX, typename DG, typename DB>
+void batch_norm_backward_reference(const X& x, const E& dy, const G& gamma, const M& mean, const V& var, DX& dx, DG& dgamma, DB& dbeta, etl::value_t<X> eps) {
+    using T = etl::value_t<X>;
+
+    const size_t N = etl::dim<0>(x);
+    const size_t K = etl::dim<1>(x);
+    const size_t S = etl::size(x) / (N * K);
+
+    for (size_t k = 0; k < K; ++k) {
+        const T inv_std = T(1) / std::sqrt(var[k] + eps);
+
+        dgamma[k] = 0;
+        dbeta[k]  = 0;
+
+        for (size_t b = 0; b < N; ++b) {
+            for (size_t i = 0; i < S; ++i) {
+                const size_t p = (b * K + k) * S + i;
+                dgamma[k] += dy[p] * (x[p] - mean[k]) * inv_std;
+                dbeta[k] += dy[p];
+            }
+        }
+
+        for (size_t b = 0; b < N; ++b) {
+            for (size_t i = 0; i < S; ++i) {
+                const size_t p = (b * K + k) * S + i;
+                const T x_hat  = (x[p] - mean[k]) * inv_std;
+                dx[p]          = gamma[k] * inv_std * (dy[p] - dbeta[k] / T(N * S) - x_hat * dgamma[k] / T(N * S));
+            }
+        }
+    }
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("batch_norm/forward_2d/0", "[batch_norm]", Z, float, double) {
+    etl::fast_matrix<Z, 5, 37> x;
+    etl::fast_matrix<Z, 37> gamma;
+    etl::fast_matrix<Z, 37> beta;
+
+    x     = etl::uniform_generator(-2.0, 3.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::fast_matrix<Z, 37> mean;
+    etl::fast_matrix<Z, 37> var;
+    etl::fast_matrix<Z, 5, 37> y;
+
+    etl::fast_matrix<Z, 37> ref_mean;
+    etl::fast_matrix<Z, 37> ref_var;
+    etl::fast_matrix<Z, 5, 37> ref_y;
+
+    y = etl::batch_norm_forward_2d(x, gamma, beta, mean, var, Z(1e-5));
+
+    batch_norm_reference(x, gamma, beta, ref_mean, ref_var, ref_y, Z(1e-5));
+
+    for (size_t i = 0; i < etl::size(mean); ++i) {
+        REQUIRE_EQUALS_APPROX(mean[i], ref_mean[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(var); ++i) {
+        REQUIRE_EQUALS_APPROX(var[i], ref_var[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], ref_y[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_norm/forward_2d/1", "[batch_norm]", Z, float, double) {
+    etl::dyn_matrix<Z, 2> x(64, 75);
+    etl::dyn_vector<Z> gamma(75);
+    etl::dyn_vector<Z> beta(75);
+
+    // A large offset checks the stability of the reduction
+    x     = etl::uniform_generator(99.0, 101.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_vector<Z> mean(75);
+    etl::dyn_vector<Z> var(75);
+    etl::dyn_matrix<Z, 2> y(64, 75);
+
+    etl::dyn_vector<Z> ref_mean(75);
+    etl::dyn_vector<Z> ref_var(75);
+    etl::dyn_matrix<Z, 2> ref_y(64, 75);
+
+    y = etl::batch_norm_forward_2d(x, gamma, beta, mean, var, Z(1e-5));
+
+    batch_norm_reference(x, gamma, beta, ref_mean, ref_var, ref_y, Z(1e-5));
+
+    for (size_t i = 0; i < etl::size(mean); ++i) {
+        REQUIRE_EQUALS_APPROX(mean[i], ref_mean[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(var); ++i) {
+        REQUIRE_EQUALS_APPROX_E(var[i], ref_var[i], base_eps_etl_large);
+    }
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX_E(y[i], ref_y[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_norm/forward_4d/0", "[batch_norm]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 5, 5, 7> x;
+    etl::fast_matrix<Z, 5> gamma;
+    etl::fast_matrix<Z, 5> beta;
+
+    x     = etl::uniform_generator(-2.0, 3.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::fast_matrix<Z, 5> mean;
+    etl::fast_matrix<Z, 5> var;
+    etl::fast_matrix<Z, 3, 5, 5, 7> y;
+
+    etl::fast_matrix<Z, 5> ref_mean;
+    etl::fast_matrix<Z, 5> ref_var;
+    etl::fast_matrix<Z, 3, 5, 5, 7> ref_y;
+
+    y = etl::batch_norm_forward_4d(x, gamma, beta, mean, var, Z(1e-5));
+
+    batch_norm_reference(x, gamma, beta, ref_mean, ref_var, ref_y, Z(1e-5));
+
+    for (size_t i = 0; i < etl::size(mean); ++i) {
+        REQUIRE_EQUALS_APPROX(mean[i], ref_mean[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(var); ++i) {
+        REQUIRE_EQUALS_APPROX(var[i], ref_var[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], ref_y[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_norm/forward_4d/1", "[batch_norm]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> x(4, 3, 2, 3);
+    etl::dyn_vector<Z> gamma(3);
+    etl::dyn_vector<Z> beta(3);
+
+    x     = etl::uniform_generator(-2.0, 3.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_vector<Z> mean(3);
+    etl::dyn_vector<Z> var(3);
+    etl::dyn_matrix<Z, 4> y(4, 3, 2, 3);
+
+    etl::dyn_vector<Z> ref_mean(3);
+    etl::dyn_vector<Z> ref_var(3);
+    etl::dyn_matrix<Z, 4> ref_y(4, 3, 2, 3);
+
+    y = etl::batch_norm_forward_4d(x + 1.0, gamma, beta, mean, var, Z(1e-5));
+
+    x += 1.0;
+
+    batch_norm_reference(x, gamma, beta, ref_mean, ref_var, ref_y, Z(1e-5));
+
+    for (size_t i = 0; i < etl::size(mean); ++i) {
+        REQUIRE_EQUALS_APPROX(mean[i], ref_mean[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(var); ++i) {
+        REQUIRE_EQUALS_APPROX(var[i], ref_var[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(y); ++i) {
+        REQUIRE_EQUALS_APPROX(y[i], ref_y[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_norm/inference_2d/0", "[batch_norm]", Z, float, double) {
+    etl::fast_matrix<Z, 7, 19> x;
+    etl::fast_matrix<Z, 19> gamma;
+    etl::fast_matrix<Z, 19> beta;
+    etl::fast_matrix<Z, 19> mean;
+    etl::fast_matrix<Z, 19> var;
+
+    x     = etl::uniform_generator(-2.0, 3.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+    mean  = etl::uniform_generator(-1.0, 1.0);
+    var   = etl::uniform_generator(0.5, 2.0);
+
+    etl::fast_matrix<Z, 7, 19> y;
+
+    y = etl::batch_norm_inference_2d(x, gamma, beta, mean, var, Z(1e-5));
+
+    for (size_t b = 0; b < 7; ++b) {
+        for (size_t k = 0; k < 19; ++k) {
+            REQUIRE_EQUALS_APPROX(y(b, k), gamma(k) * (x(b, k) - mean(k)) / std::sqrt(var(k) + Z(1e-5)) + beta(k));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_norm/inference_4d/0", "[batch_norm]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 3, 4, 5> x;
+    etl::fast_matrix<Z, 3> gamma;
+    etl::fast_matrix<Z, 3> beta;
+    etl::fast_matrix<Z, 3> mean;
+    etl::fast_matrix<Z, 3> var;
+
+    x     = etl::uniform_generator(-2.0, 3.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+    mean  = etl::uniform_generator(-1.0, 1.0);
+    var   = etl::uniform_generator(0.5, 2.0);
+
+    etl::fast_matrix<Z, 2, 3, 4, 5> y;
+
+    y = etl::batch_norm_inference_4d(x, gamma, beta, mean, 2.0 * var, Z(1e-5));
+
+    for (size_t b = 0; b < 2; ++b) {
+        for (size_t k = 0; k < 3; ++k) {
+            for (size_t i = 0; i < 4; ++i) {
+                for (size_t j = 0; j < 5; ++j) {
+                    REQUIRE_EQUALS_APPROX(y(b, k, i, j), gamma(k) * (x(b, k, i, j) - mean(k)) / std::sqrt(2.0 * var(k) + Z(1e-5)) + beta(k));
+                }
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_norm/backward_2d/0", "[batch_norm]", Z, float, double) {
+    etl::fast_matrix<Z, 6, 35> x;
+    etl::fast_matrix<Z, 6, 35> dy;
+    etl::fast_matrix<Z, 35> gamma;
+    etl::fast_matrix<Z, 35> beta;
+    etl::fast_matrix<Z, 35> mean;
+    etl::fast_matrix<Z, 35> var;
+    etl::fast_matrix<Z, 6, 35> y;
+
+    x     = etl::uniform_generator(-2.0, 3.0);
+    dy    = etl::uniform_generator(-1.0, 1.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    y = etl::batch_norm_forward_2d(x, gamma, beta, mean, var, Z(1e-5));
+
+    etl::fast_matrix<Z, 6, 35> dx;
+    etl::fast_matrix<Z, 35> dgamma;
+    etl::fast_matrix<Z, 35> dbeta;
+
+    etl::fast_matrix<Z, 6, 35> ref_dx;
+    etl::fast_matrix<Z, 35> ref_dgamma;
+    etl::fast_matrix<Z, 35> ref_dbeta;
+
+    dx = etl::batch_norm_backward(x, dy, gamma, mean, var, dgamma, dbeta, Z(1e-5));
+
+    batch_norm_backward_reference(x, dy, gamma, mean, var, ref_dx, ref_dgamma, ref_dbeta, Z(1e-5));
+
+    for (size_t i = 0; i < etl::size(dx); ++i) {
+        REQUIRE_EQUALS_APPROX(dx[i], ref_dx[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(dgamma); ++i) {
+        REQUIRE_EQUALS_APPROX(dgamma[i], ref_dgamma[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(dbeta); ++i) {
+        REQUIRE_EQUALS_APPROX(dbeta[i], ref_dbeta[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_norm/backward_4d/0", "[batch_norm]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> x(3, 4, 5, 7);
+    etl::dyn_matrix<Z, 4> dy(3, 4, 5, 7);
+    etl::dyn_vector<Z> gamma(4);
+    etl::dyn_vector<Z> beta(4);
+    etl::dyn_vector<Z> mean(4);
+    etl::dyn_vector<Z> var(4);
+    etl::dyn_matrix<Z, 4> y(3, 4, 5, 7);
+
+    x     = etl::uniform_generator(-2.0, 3.0);
+    dy    = etl::uniform_generator(-1.0, 1.0);
+    gamma = etl::uniform_generator(0.5, 1.5);
+    beta  = etl::uniform_generator(-1.0, 1.0);
+
+    y = etl::batch_norm_forward_4d(x, gamma, beta, mean, var, Z(1e-5));
+
+    etl::dyn_matrix<Z, 4> dx(3, 4, 5, 7);
+    etl::dyn_vector<Z> dgamma(4);
+    etl::dyn_vector<Z> dbeta(4);
+
+    etl::dyn_matrix<Z, 4> ref_dx(3, 4, 5, 7);
+    etl::dyn_vector<Z> ref_dgamma(4);
+    etl::dyn_vector<Z> ref_dbeta(4);
+
+    dx = etl::batch_norm_backward(x, dy, gamma, mean, var, dgamma, dbeta, Z(1e-5));
+
+    batch_norm_backward_reference(x, dy, gamma, mean, var, ref_dx, ref_dgamma, ref_dbeta, Z(1e-5));
+
+    for (size_t i = 0; i < etl::size(dx); ++i) {
+        REQUIRE_EQUALS_APPROX(dx[i], ref_dx[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(dgamma); ++i) {
+        REQUIRE_EQUALS_APPROX(dgamma[i], ref_dgamma[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(dbeta); ++i) {
+        REQUIRE_EQUALS_APPROX(dbeta[i], ref_dbeta[i]);
+    }
+}
@@ -0,0 +1,338 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("conv_3d/valid_1", "[conv][conv3]", T, float, double) {
+    etl::dyn_matrix<T, 3> I(6, 7, 19);
+    etl::dyn_matrix<T, 3> K(3, 2, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 3> ref(4, 6, 17);
+    etl::dyn_matrix<T, 3> c(4, 6, 17);
+    etl::dyn_matrix<T, 3> c_std(4, 6, 17);
+
+    ref = 0;
+
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t a = 0; a < 3; ++a) {
+            ref(i) += etl::conv_2d_valid(I(i + a), K(2 - a), 1, 1, 0, 0);
+        }
+    }
+
+    c     = etl::conv_3d_valid(I, K);
+    c_std = selected_helper(etl::conv_impl::STD, etl::conv_3d_valid(I, K));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_3d/valid_2", "[conv][conv3]", T, float, double) {
+    etl::dyn_matrix<T, 3> I(5, 9, 20);
+    etl::dyn_matrix<T, 3> K(2, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 3> ref(4, 5, 20);
+    etl::dyn_matrix<T, 3> c(4, 5, 20);
+
+    ref = 0;
+
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t a = 0; a < 2; ++a) {
+            ref(i) += etl::conv_2d_valid_flipped(I(i + a), K(a), 2, 1, 1, 1);
+        }
+    }
+
+    c = etl::conv_3d_valid_flipped(I, K, 1, 2, 1, 0, 1, 1);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_3d/valid_3", "[conv][conv3]", T, float, double) {
+    etl::dyn_matrix<T, 3> I(7, 6, 13);
+    etl::dyn_matrix<T, 3> K(3, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    // Padding and stride on the first dimension are checked against a padded input
+    etl::dyn_matrix<T, 3> I_pad(9, 6, 13);
+
+    I_pad = 0;
+
+    for (size_t i = 0; i < 7; ++i) {
+        I_pad(i + 1) = I(i);
+    }
+
+    etl::dyn_matrix<T, 3> ref(4, 6, 13);
+    etl::dyn_matrix<T, 3> c(4, 6, 13);
+    etl::dyn_matrix<T, 3> c_std(4, 6, 13);
+
+    ref = 0;
+
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t a = 0; a < 3; ++a) {
+            ref(i) += etl::conv_2d_valid(I_pad(2 * i + a), K(2 - a), 1, 1, 1, 1);
+        }
+    }
+
+    c     = etl::conv_3d_valid(I, K, 2, 1, 1, 1, 1, 1);
+    c_std = selected_helper(etl::conv_impl::STD, etl::conv_3d_valid(I, K, 2, 1, 1, 1, 1, 1));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_3d/full", "[conv][conv3]", T, float, double) {
+    etl::dyn_matrix<T, 3> I(4, 5, 11);
+    etl::dyn_matrix<T, 3> K(3, 3, 2);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 3> ref(6, 7, 12);
+    etl::dyn_matrix<T, 3> c(6, 7, 12);
+    etl::dyn_matrix<T, 3> ref_f(6, 7, 12);
+    etl::dyn_matrix<T, 3> c_f(6, 7, 12);
+
+    ref   = 0;
+    ref_f = 0;
+
+    for (size_t i = 0; i < 6; ++i) {
+        for (size_t a = 0; a < 3; ++a) {
+            if (i >= a && i - a < 4) {
+                ref(i) += etl::conv_2d_full(I(i - a), K(a));
+                ref_f(i) += etl::conv_2d_full_flipped(I(i - a), K(2 - a));
+            }
+        }
+    }
+
+    c   = etl::conv_3d_full(I, K);
+    c_f = etl::conv_3d_full_flipped(I, K);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_3d/same", "[conv][conv3]", T, float, double) {
+    etl::dyn_matrix<T, 3> I(5, 6, 12);
+    etl::dyn_matrix<T, 3> K(3, 4, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 3> full(7, 9, 14);
+    etl::dyn_matrix<T, 3> full_f(7, 9, 14);
+    etl::dyn_matrix<T, 3> c(5, 6, 12);
+    etl::dyn_matrix<T, 3> c_f(5, 6, 12);
+    etl::dyn_matrix<T, 3> c_std(5, 6, 12);
+
+    full   = etl::conv_3d_full(I, K);
+    full_f = etl::conv_3d_full_flipped(I, K);
+    c      = etl::conv_3d_same(I, K);
+    c_f    = etl::conv_3d_same_flipped(I, K);
+    c_std  = selected_helper(etl::conv_impl::STD, etl::conv_3d_same(I, K));
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 6; ++j) {
+            for (size_t k = 0; k < 12; ++k) {
+                REQUIRE_EQUALS_APPROX_E(c(i, j, k), full(i + 1, j + 2, k + 1), base_eps_etl_large);
+                REQUIRE_EQUALS_APPROX_E(c_f(i, j, k), full_f(i + 1, j + 2, k + 1), base_eps_etl_large);
+                REQUIRE_EQUALS_APPROX_E(c_std(i, j, k), full(i + 1, j + 2, k + 1), base_eps_etl_large);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_5d/valid_1", "[conv][conv5]", T, float, double) {
+    etl::dyn_matrix<T, 5> I(2, 3, 5, 6, 10);
+    etl::dyn_matrix<T, 5> K(4, 3, 3, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 5> ref(2, 4, 3, 4, 8);
+    etl::dyn_matrix<T, 5> c(2, 4, 3, 4, 8);
+    etl::dyn_matrix<T, 5> c_std(2, 4, 3, 4, 8);
+    etl::dyn_matrix<T, 5> c_vec(2, 4, 3, 4, 8);
+    etl::dyn_matrix<T, 5> c_blas(2, 4, 3, 4, 8);
+
+    ref = 0;
+
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t k = 0; k < 4; ++k) {
+            for (size_t cc = 0; cc < 3; ++cc) {
+                ref(i)(k) += etl::conv_3d_valid(I(i)(cc), K(k)(cc));
+            }
+        }
+    }
+
+    c      = etl::conv_5d_valid(I, K);
+    c_std  = selected_helper(etl::conv4_impl::STD, etl::conv_5d_valid(I, K));
+    c_vec  = selected_helper(etl::conv4_impl::VEC, etl::conv_5d_valid(I, K));
+    c_blas = selected_helper(etl::conv4_impl::BLAS_VEC, etl::conv_5d_valid(I, K));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_vec[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_blas[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_5d/valid_2", "[conv][conv5]", T, float, double) {
+    etl::dyn_matrix<T, 5> I(2, 9, 6, 7, 11);
+    etl::dyn_matrix<T, 5> K(3, 9, 3, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 5> ref(2, 3, 6, 4, 6);
+    etl::dyn_matrix<T, 5> c(2, 3, 6, 4, 6);
+    etl::dyn_matrix<T, 5> c_vec(2, 3, 6, 4, 6);
+
+    ref = 0;
+
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            for (size_t cc = 0; cc < 9; ++cc) {
+                ref(i)(k) += etl::conv_3d_valid_flipped(I(i)(cc), K(k)(cc), 1, 2, 2, 1, 1, 1);
+            }
+        }
+    }
+
+    c     = etl::conv_5d_valid_flipped(I, K, 1, 2, 2, 1, 1, 1);
+    c_vec = selected_helper(etl::conv4_impl::VEC, etl::conv_5d_valid_flipped(I, K, 1, 2, 2, 1, 1, 1));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_vec[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_5d/back", "[conv][conv5][back]", T, float, double) {
+    etl::dyn_matrix<T, 5> E(2, 4, 4, 5, 9);
+    etl::dyn_matrix<T, 5> K(4, 3, 2, 3, 3);
+
+    E = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 5> ref(2, 3, 5, 5, 9);
+    etl::dyn_matrix<T, 5> ref_f(2, 3, 5, 5, 9);
+    etl::dyn_matrix<T, 5> c(2, 3, 5, 5, 9);
+    etl::dyn_matrix<T, 5> c_f(2, 3, 5, 5, 9);
+    etl::dyn_matrix<T, 5> c_std(2, 3, 5, 5, 9);
+    etl::dyn_matrix<T, 5> c_blas(2, 3, 5, 5, 9);
+
+    ref   = 0;
+    ref_f = 0;
+
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t cc = 0; cc < 3; ++cc) {
+            for (size_t k = 0; k < 4; ++k) {
+                ref(i)(cc) += etl::conv_3d_valid(E(i)(k), K(k)(cc), 1, 1, 1, 1, 1, 1);
+                ref_f(i)(cc) += etl::conv_3d_valid_flipped(E(i)(k), K(k)(cc), 1, 1, 1, 1, 1, 1);
+            }
+        }
+    }
+
+    c      = etl::conv_5d_valid_back(E, K, 1, 1, 1, 1, 1, 1);
+    c_f    = etl::conv_5d_valid_back_flipped(E, K, 1, 1, 1, 1, 1, 1);
+    c_std  = selected_helper(etl::conv4_impl::STD, etl::conv_5d_valid_back(E, K, 1, 1, 1, 1, 1, 1));
+    c_blas = selected_helper(etl::conv4_impl::BLAS_VEC, etl::conv_5d_valid_back(E, K, 1, 1, 1, 1, 1, 1));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_blas[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_5d/full", "[conv][conv5][back]", T, float, double) {
+    etl::dyn_matrix<T, 5> E(3, 2, 3, 4, 8);
+    etl::dyn_matrix<T, 5> K(2, 3, 3, 2, 3);
+
+    E = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 5> ref(3, 3, 5, 5, 10);
+    etl::dyn_matrix<T, 5> ref_f(3, 3, 5, 5, 10);
+    etl::dyn_matrix<T, 5> c(3, 3, 5, 5, 10);
+    etl::dyn_matrix<T, 5> c_f(3, 3, 5, 5, 10);
+
+    ref   = 0;
+    ref_f = 0;
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t cc = 0; cc < 3; ++cc) {
+            for (size_t k = 0; k < 2; ++k) {
+                ref(i)(cc) += etl::conv_3d_full(E(i)(k), K(k)(cc));
+                ref_f(i)(cc) += etl::conv_3d_full_flipped(E(i)(k), K(k)(cc));
+            }
+        }
+    }
+
+    c   = etl::conv_5d_full(E, K);
+    c_f = etl::conv_5d_full_flipped(E, K);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_5d/filter", "[conv][conv5][filter]", T, float, double) {
+    etl::dyn_matrix<T, 5> I(3, 2, 6, 7, 9);
+    etl::dyn_matrix<T, 5> E(3, 4, 4, 5, 7);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    E = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 5> ref(4, 2, 3, 3, 3);
+    etl::dyn_matrix<T, 5> ref_f(4, 2, 3, 3, 3);
+    etl::dyn_matrix<T, 5> c(4, 2, 3, 3, 3);
+    etl::dyn_matrix<T, 5> c_f(4, 2, 3, 3, 3);
+    etl::dyn_matrix<T, 5> c_std(4, 2, 3, 3, 3);
+    etl::dyn_matrix<T, 5> c_vec(4, 2, 3, 3, 3);
+
+    ref   = 0;
+    ref_f = 0;
+
+    for (size_t k = 0; k < 4; ++k) {
+        for (size_t cc = 0; cc < 2; ++cc) {
+            for (size_t i = 0; i < 3; ++i) {
+                ref(k)(cc) += etl::conv_3d_valid(I(i)(cc), E(i)(k));
+                ref_f(k)(cc) += etl::conv_3d_valid_flipped(I(i)(cc), E(i)(k));
+            }
+        }
+    }
+
+    c     = etl::conv_5d_valid_filter(I, E);
+    c_f   = etl::conv_5d_valid_filter_flipped(I, E);
+    c_std = selected_helper(etl::conv4_impl::STD, etl::conv_5d_valid_filter(I, E));
+    c_vec = selected_helper(etl::conv4_impl::VEC, etl::conv_5d_valid_filter_flipped(I, E));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_vec[i], ref_f[i], base_eps_etl_large);
+    }
+}
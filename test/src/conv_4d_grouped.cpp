@@ -0,0 +1,228 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("conv_4d/grouped/valid_1", "[conv][conv4][grouped]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(3, 4, 8, 7);
+    etl::dyn_matrix<T, 4> K(6, 2, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(3, 6, 6, 5);
+    etl::dyn_matrix<T, 4> c(3, 6, 6, 5);
+    etl::dyn_matrix<T, 4> c_std(3, 6, 6, 5);
+
+    ref = 0;
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t k = 0; k < 6; ++k) {
+            for (size_t cc = 0; cc < 2; ++cc) {
+                ref(i)(k) += etl::conv_2d_valid(I(i)((k / 3) * 2 + cc), K(k)(cc), 1, 1, 0, 0);
+            }
+        }
+    }
+
+    c     = etl::conv_4d_valid_grouped(I, K, 2);
+    c_std = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid_grouped(I, K, 2));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/grouped/valid_2", "[conv][conv4][grouped]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 6, 9, 9);
+    etl::dyn_matrix<T, 4> K(3, 2, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(2, 3, 5, 5);
+    etl::dyn_matrix<T, 4> c(2, 3, 5, 5);
+
+    ref = 0;
+
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            for (size_t cc = 0; cc < 2; ++cc) {
+                ref(i)(k) += etl::conv_2d_valid_flipped(I(i)(k * 2 + cc), K(k)(cc), 2, 2, 1, 1);
+            }
+        }
+    }
+
+    c = etl::conv_4d_valid_grouped_flipped(I, K, 3, 2, 2, 1, 1);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/grouped/single_group", "[conv][conv4][grouped]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 3, 10, 8);
+    etl::dyn_matrix<T, 4> K(4, 3, 5, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(2, 4, 8, 8);
+    etl::dyn_matrix<T, 4> c(2, 4, 8, 8);
+
+    ref = etl::conv_4d_valid(I, K, 1, 1, 1, 1);
+    c   = etl::conv_4d_valid_grouped(I, K, 1, 1, 1, 1, 1);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/depthwise/valid", "[conv][conv4][grouped][depthwise]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 3, 9, 11);
+    etl::dyn_matrix<T, 4> K(6, 1, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(2, 6, 9, 11);
+    etl::dyn_matrix<T, 4> c(2, 6, 9, 11);
+    etl::dyn_matrix<T, 4> ref_f(2, 6, 9, 11);
+    etl::dyn_matrix<T, 4> c_f(2, 6, 9, 11);
+
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t k = 0; k < 6; ++k) {
+            ref(i)(k)   = etl::conv_2d_valid(I(i)(k / 2), K(k)(0), 1, 1, 1, 1);
+            ref_f(i)(k) = etl::conv_2d_valid_flipped(I(i)(k / 2), K(k)(0), 1, 1, 1, 1);
+        }
+    }
+
+    c   = etl::conv_4d_valid_depthwise(I, K, 1, 1, 1, 1);
+    c_f = etl::conv_4d_valid_depthwise_flipped(I, K, 1, 1, 1, 1);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/grouped/back", "[conv][conv4][grouped][back]", T, float, double) {
+    etl::dyn_matrix<T, 4> E(2, 4, 7, 7);
+    etl::dyn_matrix<T, 4> K(4, 3, 3, 3);
+
+    E = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(2, 6, 7, 7);
+    etl::dyn_matrix<T, 4> c(2, 6, 7, 7);
+    etl::dyn_matrix<T, 4> ref_f(2, 6, 7, 7);
+    etl::dyn_matrix<T, 4> c_f(2, 6, 7, 7);
+
+    ref   = 0;
+    ref_f = 0;
+
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t cc = 0; cc < 6; ++cc) {
+            for (size_t k = 0; k < 2; ++k) {
+                ref(i)(cc) += etl::conv_2d_valid(E(i)((cc / 3) * 2 + k), K((cc / 3) * 2 + k)(cc % 3), 1, 1, 1, 1);
+                ref_f(i)(cc) += etl::conv_2d_valid_flipped(E(i)((cc / 3) * 2 + k), K((cc / 3) * 2 + k)(cc % 3), 1, 1, 1, 1);
+            }
+        }
+    }
+
+    c   = etl::conv_4d_valid_grouped_back(E, K, 2, 1, 1, 1, 1);
+    c_f = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid_grouped_back_flipped(E, K, 2, 1, 1, 1, 1));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/depthwise/back", "[conv][conv4][grouped][depthwise][back]", T, float, double) {
+    etl::dyn_matrix<T, 4> E(3, 5, 8, 6);
+    etl::dyn_matrix<T, 4> K(5, 1, 3, 3);
+
+    E = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(3, 5, 8, 6);
+    etl::dyn_matrix<T, 4> c(3, 5, 8, 6);
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t k = 0; k < 5; ++k) {
+            ref(i)(k) = etl::conv_2d_valid_flipped(E(i)(k), K(k)(0), 1, 1, 1, 1);
+        }
+    }
+
+    c = etl::conv_4d_valid_depthwise_back_flipped(E, K, 1, 1, 1, 1);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/grouped/filter", "[conv][conv4][grouped][filter]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(3, 4, 8, 8);
+    etl::dyn_matrix<T, 4> E(3, 6, 6, 6);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    E = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(6, 2, 3, 3);
+    etl::dyn_matrix<T, 4> c(6, 2, 3, 3);
+    etl::dyn_matrix<T, 4> ref_f(6, 2, 3, 3);
+    etl::dyn_matrix<T, 4> c_f(6, 2, 3, 3);
+
+    ref   = 0;
+    ref_f = 0;
+
+    for (size_t k = 0; k < 6; ++k) {
+        for (size_t cc = 0; cc < 2; ++cc) {
+            for (size_t i = 0; i < 3; ++i) {
+                ref(k)(cc) += etl::conv_2d_valid(I(i)((k / 3) * 2 + cc), E(i)(k), 1, 1, 0, 0);
+                ref_f(k)(cc) += etl::conv_2d_valid_flipped(I(i)((k / 3) * 2 + cc), E(i)(k), 1, 1, 0, 0);
+            }
+        }
+    }
+
+    c   = etl::conv_4d_valid_grouped_filter(I, E, 2);
+    c_f = etl::conv_4d_valid_grouped_filter_flipped(I, E, 2);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/depthwise/filter", "[conv][conv4][grouped][depthwise][filter]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(4, 3, 9, 9);
+    etl::dyn_matrix<T, 4> E(4, 3, 5, 5);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    E = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(3, 1, 4, 4);
+    etl::dyn_matrix<T, 4> c(3, 1, 4, 4);
+    etl::dyn_matrix<T, 4> c_std(3, 1, 4, 4);
+
+    ref = 0;
+
+    for (size_t k = 0; k < 3; ++k) {
+        for (size_t i = 0; i < 4; ++i) {
+            ref(k)(0) += etl::conv_2d_valid_flipped(I(i)(k), E(i)(k), 2, 2, 1, 1);
+        }
+    }
+
+    c     = etl::conv_4d_valid_depthwise_filter_flipped(I, E, 2, 2, 1, 1);
+    c_std = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid_depthwise_filter_flipped(I, E, 2, 2, 1, 1));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+    }
+}
@@ -0,0 +1,148 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+// Note: When vectorization is not available, the forced selection falls back to
+// the default implementation, the results must still be correct
+
+TEMPLATE_TEST_CASE_2("conv_4d/winograd/valid_1", "[conv][conv4][winograd]", T, float, double) {
+    etl::fast_matrix<T, 3, 4, 6, 6> I;
+    etl::fast_matrix<T, 5, 4, 3, 3> K;
+
+    I = etl::sequence_generator(-10.0) * 0.04;
+    K = etl::sequence_generator(-2.0) * 0.15;
+
+    etl::fast_matrix<T, 3, 5, 4, 4> ref;
+    etl::fast_matrix<T, 3, 5, 4, 4> c;
+
+    ref = selected_helper(etl::conv4_impl::STD, (etl::conv_4d_valid(I, K)));
+    c   = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid(I, K)));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/winograd/valid_2", "[conv][conv4][winograd]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 3, 19, 13);
+    etl::dyn_matrix<T, 4> K(6, 3, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(2, 6, 19, 13);
+    etl::dyn_matrix<T, 4> c(2, 6, 19, 13);
+
+    ref = selected_helper(etl::conv4_impl::STD, (etl::conv_4d_valid(I, K, 1, 1, 1, 1)));
+    c   = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid(I, K, 1, 1, 1, 1)));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/winograd/valid_flipped", "[conv][conv4][winograd]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(3, 2, 17, 21);
+    etl::dyn_matrix<T, 4> K(4, 2, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(3, 4, 15, 19);
+    etl::dyn_matrix<T, 4> c(3, 4, 15, 19);
+
+    ref = selected_helper(etl::conv4_impl::STD, (etl::conv_4d_valid_flipped<1, 1, 0, 0>(I, K)));
+    c   = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_flipped<1, 1, 0, 0>(I, K)));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/winograd/full", "[conv][conv4][winograd]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 5, 9, 11);
+    etl::dyn_matrix<T, 4> K(5, 3, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(2, 3, 11, 13);
+    etl::dyn_matrix<T, 4> c(2, 3, 11, 13);
+    etl::dyn_matrix<T, 4> ref_f(2, 3, 11, 13);
+    etl::dyn_matrix<T, 4> c_f(2, 3, 11, 13);
+
+    ref   = selected_helper(etl::conv4_impl::STD, etl::conv_4d_full(I, K));
+    c     = selected_helper(etl::conv4_impl::WINOGRAD, etl::conv_4d_full(I, K));
+    ref_f = selected_helper(etl::conv4_impl::STD, etl::conv_4d_full_flipped(I, K));
+    c_f   = selected_helper(etl::conv4_impl::WINOGRAD, etl::conv_4d_full_flipped(I, K));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/winograd/valid_filter", "[conv][conv4][winograd]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(3, 2, 12, 10);
+    etl::dyn_matrix<T, 4> K(3, 4, 12, 10);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(4, 2, 3, 3);
+    etl::dyn_matrix<T, 4> c(4, 2, 3, 3);
+    etl::dyn_matrix<T, 4> ref_f(4, 2, 3, 3);
+    etl::dyn_matrix<T, 4> c_f(4, 2, 3, 3);
+
+    ref   = selected_helper(etl::conv4_impl::STD, (etl::conv_4d_valid_filter(I, K, 1, 1, 1, 1)));
+    c     = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_filter(I, K, 1, 1, 1, 1)));
+    ref_f = selected_helper(etl::conv4_impl::STD, (etl::conv_4d_valid_filter_flipped(I, K, 1, 1, 1, 1)));
+    c_f   = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_filter_flipped(I, K, 1, 1, 1, 1)));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/winograd/valid_filter_small", "[conv][conv4][winograd]", T, float, double) {
+    etl::fast_matrix<T, 2, 3, 7, 7> I;
+    etl::fast_matrix<T, 2, 2, 5, 5> K;
+
+    I = etl::sequence_generator(1.0) * 0.01;
+    K = etl::sequence_generator(-3.0) * 0.02;
+
+    etl::fast_matrix<T, 2, 3, 3, 3> ref;
+    etl::fast_matrix<T, 2, 3, 3, 3> c;
+
+    ref = selected_helper(etl::conv4_impl::STD, (etl::conv_4d_valid_filter_flipped<1, 1, 0, 0>(I, K)));
+    c   = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid_filter_flipped<1, 1, 0, 0>(I, K)));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/winograd/stride", "[conv][conv4][winograd]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 2, 9, 9);
+    etl::dyn_matrix<T, 4> K(3, 2, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<T, 4> ref(2, 3, 4, 4);
+    etl::dyn_matrix<T, 4> c(2, 3, 4, 4);
+
+    // Not possible with Winograd, must fall back to another implementation
+    ref = selected_helper(etl::conv4_impl::STD, (etl::conv_4d_valid(I, K, 2, 2, 0, 0)));
+    c   = selected_helper(etl::conv4_impl::WINOGRAD, (etl::conv_4d_valid(I, K, 2, 2, 0, 0)));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
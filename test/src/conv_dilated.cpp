@@ -0,0 +1,304 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+// The results are compared with the convolution by the zero-stuffed kernels
+
+namespace {
+
+template <typename K>
+etl::dyn_matrix<etl::value_t<K>, 2> dilate_2d(const K& kernel, size_t d1, size_t d2) {
+    const size_t k1 = etl::dim<0>(kernel);
+    const size_t k2 = etl::dim<1>(kernel);
+
+    etl::dyn_matrix<etl::value_t<K>, 2> dilated((k1 - 1) * d1 + 1, (k2 - 1) * d2 + 1);
+
+    dilated = 0;
+
+    for (size_t i = 0; i < k1; ++i) {
+        for (size_t j = 0; j < k2; ++j) {
+            dilated(i * d1, j * d2) = kernel(i, j);
+        }
+    }
+
+    return dilated;
+}
+
+template <typename K>
+etl::dyn_matrix<etl::value_t<K>, 4> dilate_4d(const K& kernel, size_t d1, size_t d2) {
+    const size_t k1 = etl::dim<2>(kernel);
+    const size_t k2 = etl::dim<3>(kernel);
+
+    etl::dyn_matrix<etl::value_t<K>, 4> dilated(etl::dim<0>(kernel), etl::dim<1>(kernel), (k1 - 1) * d1 + 1, (k2 - 1) * d2 + 1);
+
+    for (size_t i = 0; i < etl::dim<0>(kernel); ++i) {
+        for (size_t j = 0; j < etl::dim<1>(kernel); ++j) {
+            dilated(i)(j) = dilate_2d(kernel(i)(j), d1, d2);
+        }
+    }
+
+    return dilated;
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("conv_2d/dilated/valid_1", "[conv][conv2][dilated]", T, float, double) {
+    etl::dyn_matrix<T, 2> I(11, 21);
+    etl::dyn_matrix<T, 2> K(3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    auto KD = dilate_2d(K, 2, 2);
+
+    etl::dyn_matrix<T, 2> ref(7, 17);
+    etl::dyn_matrix<T, 2> ref_f(7, 17);
+    etl::dyn_matrix<T, 2> c(7, 17);
+    etl::dyn_matrix<T, 2> c_f(7, 17);
+    etl::dyn_matrix<T, 2> c_std(7, 17);
+
+    ref   = etl::conv_2d_valid(I, KD, 1, 1, 0, 0);
+    ref_f = etl::conv_2d_valid_flipped(I, KD, 1, 1, 0, 0);
+    c     = etl::conv_2d_valid_dilated(I, K, 2, 2);
+    c_f   = etl::conv_2d_valid_dilated_flipped(I, K, 2, 2);
+    c_std = selected_helper(etl::conv_impl::STD, etl::conv_2d_valid_dilated(I, K, 2, 2));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_2d/dilated/valid_2", "[conv][conv2][dilated]", T, float, double) {
+    etl::dyn_matrix<T, 2> I(17, 33);
+    etl::dyn_matrix<T, 2> K(3, 4);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    auto KD = dilate_2d(K, 2, 3);
+
+    etl::dyn_matrix<T, 2> ref(8, 34);
+    etl::dyn_matrix<T, 2> c(8, 34);
+    etl::dyn_matrix<T, 2> ref_s(8, 14);
+    etl::dyn_matrix<T, 2> c_s(8, 14);
+
+    ref   = etl::conv_2d_valid_flipped(I, KD, 2, 1, 1, 5);
+    c     = etl::conv_2d_valid_dilated_flipped(I, K, 2, 3, 2, 1, 1, 5);
+    ref_s = etl::conv_2d_valid(I, KD, 2, 2, 1, 2);
+    c_s   = etl::conv_2d_valid_dilated(I, K, 2, 3, 2, 2, 1, 2);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+
+    for (size_t i = 0; i < ref_s.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c_s[i], ref_s[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_2d/dilated/full", "[conv][conv2][dilated]", T, float, double) {
+    etl::dyn_matrix<T, 2> I(9, 20);
+    etl::dyn_matrix<T, 2> K(3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    auto KD = dilate_2d(K, 3, 2);
+
+    etl::dyn_matrix<T, 2> ref(15, 24);
+    etl::dyn_matrix<T, 2> ref_f(15, 24);
+    etl::dyn_matrix<T, 2> c(15, 24);
+    etl::dyn_matrix<T, 2> c_f(15, 24);
+
+    ref   = etl::conv_2d_full(I, KD);
+    ref_f = etl::conv_2d_full_flipped(I, KD);
+    c     = etl::conv_2d_full_dilated(I, K, 3, 2);
+    c_f   = etl::conv_2d_full_dilated_flipped(I, K, 3, 2);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/dilated/valid", "[conv][conv4][dilated]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 3, 14, 18);
+    etl::dyn_matrix<T, 4> K(4, 3, 3, 3);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    auto KD = dilate_4d(K, 2, 2);
+
+    etl::dyn_matrix<T, 4> ref(2, 4, 14, 18);
+    etl::dyn_matrix<T, 4> c(2, 4, 14, 18);
+    etl::dyn_matrix<T, 4> c_vec(2, 4, 14, 18);
+    etl::dyn_matrix<T, 4> c_blas(2, 4, 14, 18);
+    etl::dyn_matrix<T, 4> c_std(2, 4, 14, 18);
+
+    ref    = etl::conv_4d_valid(I, KD, 1, 1, 2, 2);
+    c      = etl::conv_4d_valid_dilated(I, K, 2, 2, 1, 1, 2, 2);
+    c_vec  = selected_helper(etl::conv4_impl::VEC, etl::conv_4d_valid_dilated(I, K, 2, 2, 1, 1, 2, 2));
+    c_blas = selected_helper(etl::conv4_impl::BLAS_VEC, etl::conv_4d_valid_dilated(I, K, 2, 2, 1, 1, 2, 2));
+    c_std  = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid_dilated(I, K, 2, 2, 1, 1, 2, 2));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_vec[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_blas[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/dilated/valid_flipped", "[conv][conv4][dilated]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(3, 2, 19, 23);
+    etl::dyn_matrix<T, 4> K(3, 2, 3, 2);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    auto KD = dilate_4d(K, 3, 4);
+
+    etl::dyn_matrix<T, 4> ref(3, 3, 8, 11);
+    etl::dyn_matrix<T, 4> c_vec(3, 3, 8, 11);
+    etl::dyn_matrix<T, 4> c_blas(3, 3, 8, 11);
+
+    ref    = etl::conv_4d_valid_flipped(I, KD, 2, 2, 1, 1);
+    c_vec  = selected_helper(etl::conv4_impl::VEC, etl::conv_4d_valid_dilated_flipped(I, K, 3, 4, 2, 2, 1, 1));
+    c_blas = selected_helper(etl::conv4_impl::BLAS_VEC, etl::conv_4d_valid_dilated_flipped(I, K, 3, 4, 2, 2, 1, 1));
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c_vec[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_blas[i], ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/dilated/back", "[conv][conv4][dilated]", T, float, double) {
+    etl::dyn_matrix<T, 4> E(2, 4, 12, 20);
+    etl::dyn_matrix<T, 4> K(4, 3, 3, 3);
+
+    E = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    auto KD = dilate_4d(K, 2, 2);
+
+    etl::dyn_matrix<T, 4> ref(2, 3, 12, 20);
+    etl::dyn_matrix<T, 4> ref_f(2, 3, 12, 20);
+    etl::dyn_matrix<T, 4> c_vec(2, 3, 12, 20);
+    etl::dyn_matrix<T, 4> c_blas(2, 3, 12, 20);
+    etl::dyn_matrix<T, 4> c_std(2, 3, 12, 20);
+    etl::dyn_matrix<T, 4> c_f(2, 3, 12, 20);
+
+    ref    = etl::conv_4d_valid_back(E, KD, 1, 1, 2, 2);
+    ref_f  = etl::conv_4d_valid_back_flipped(E, KD, 1, 1, 2, 2);
+    c_vec  = selected_helper(etl::conv4_impl::VEC, etl::conv_4d_valid_back_dilated(E, K, 2, 2, 1, 1, 2, 2));
+    c_blas = selected_helper(etl::conv4_impl::BLAS_VEC, etl::conv_4d_valid_back_dilated(E, K, 2, 2, 1, 1, 2, 2));
+    c_std  = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid_back_dilated(E, K, 2, 2, 1, 1, 2, 2));
+    c_f    = etl::conv_4d_valid_back_dilated_flipped(E, K, 2, 2, 1, 1, 2, 2);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c_vec[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_blas[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/dilated/full", "[conv][conv4][dilated]", T, float, double) {
+    etl::dyn_matrix<T, 4> E(2, 3, 8, 10);
+    etl::dyn_matrix<T, 4> K(3, 2, 3, 3);
+
+    E = etl::uniform_generator(-1.0, 1.0);
+    K = etl::uniform_generator(-1.0, 1.0);
+
+    auto KD = dilate_4d(K, 2, 3);
+
+    etl::dyn_matrix<T, 4> ref(2, 2, 12, 16);
+    etl::dyn_matrix<T, 4> ref_f(2, 2, 12, 16);
+    etl::dyn_matrix<T, 4> c(2, 2, 12, 16);
+    etl::dyn_matrix<T, 4> c_f(2, 2, 12, 16);
+
+    ref   = etl::conv_4d_full(E, KD);
+    ref_f = etl::conv_4d_full_flipped(E, KD);
+    c     = etl::conv_4d_full_dilated(E, K, 2, 3);
+    c_f   = etl::conv_4d_full_dilated_flipped(E, K, 2, 3);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/dilated/filter", "[conv][conv4][dilated]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(3, 2, 13, 21);
+    etl::dyn_matrix<T, 4> E(3, 4, 5, 8);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    E = etl::uniform_generator(-1.0, 1.0);
+
+    auto ED = dilate_4d(E, 2, 2);
+
+    etl::dyn_matrix<T, 4> ref(4, 2, 5, 7);
+    etl::dyn_matrix<T, 4> ref_f(4, 2, 5, 7);
+    etl::dyn_matrix<T, 4> c_vec(4, 2, 5, 7);
+    etl::dyn_matrix<T, 4> c_blas(4, 2, 5, 7);
+    etl::dyn_matrix<T, 4> c_std(4, 2, 5, 7);
+    etl::dyn_matrix<T, 4> c_f(4, 2, 5, 7);
+
+    ref    = etl::conv_4d_valid_filter(I, ED, 1, 1, 0, 0);
+    ref_f  = etl::conv_4d_valid_filter_flipped(I, ED, 1, 1, 0, 0);
+    c_vec  = selected_helper(etl::conv4_impl::VEC, etl::conv_4d_valid_filter_dilated(I, E, 2, 2));
+    c_blas = selected_helper(etl::conv4_impl::BLAS_VEC, etl::conv_4d_valid_filter_dilated(I, E, 2, 2));
+    c_std  = selected_helper(etl::conv4_impl::STD, etl::conv_4d_valid_filter_dilated(I, E, 2, 2));
+    c_f    = etl::conv_4d_valid_filter_dilated_flipped(I, E, 2, 2);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c_vec[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_blas[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_std[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_f[i], ref_f[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("conv_4d/dilated/filter_gradient", "[conv][conv4][dilated]", T, float, double) {
+    etl::dyn_matrix<T, 4> I(2, 3, 15, 17);
+    etl::dyn_matrix<T, 4> E(2, 2, 5, 6);
+
+    I = etl::uniform_generator(-1.0, 1.0);
+    E = etl::uniform_generator(-1.0, 1.0);
+
+    // Filter gradients of conv_4d_valid_dilated_flipped(I, K, 3, 3, 2, 2), with 3x3 kernels
+    etl::dyn_matrix<T, 4> ref(2, 3, 3, 3);
+    etl::dyn_matrix<T, 4> c(2, 3, 3, 3);
+
+    ref = 0;
+
+    for (size_t n = 0; n < 2; ++n) {
+        for (size_t k = 0; k < 2; ++k) {
+            for (size_t cc = 0; cc < 3; ++cc) {
+                for (size_t a = 0; a < 3; ++a) {
+                    for (size_t b = 0; b < 3; ++b) {
+                        for (size_t i = 0; i < 5; ++i) {
+                            for (size_t j = 0; j < 6; ++j) {
+                                ref(k, cc, a, b) += I(n, cc, i * 2 + a * 3, j * 2 + b * 3) * E(n, k, i, j);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    c = etl::conv_4d_valid_filter_dilated_flipped(I, E, 2, 2, 3, 3);
+
+    for (size_t i = 0; i < ref.size(); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
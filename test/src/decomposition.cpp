@@ -41,6 +41,41 @@ TEMPLATE_TEST_CASE_2("globals/lu/2", "[globals][LU]", Z, float, double) {
     REQUIRE_DIRECT(approx_equals(PA, LU, base_eps_etl));
 }
 
+TEMPLATE_TEST_CASE_2("globals/lu/3", "[globals][LU]", Z, float, double) {
+    // Large enough for several panels, with pivoting at each step
+    const size_t n = 150;
+
+    etl::dyn_matrix<Z> A(n, n);
+    etl::dyn_matrix<Z> L(n, n);
+    etl::dyn_matrix<Z> U(n, n);
+    etl::dyn_matrix<Z> P(n, n);
+
+    A = etl::uniform_generator(-1.0, 1.0);
+
+    for (size_t i = 0; i < n; ++i) {
+        A(i, n - 1 - i) += Z(n);
+    }
+
+    REQUIRE_DIRECT(etl::lu(A, L, U, P));
+
+    REQUIRE_DIRECT(L.is_lower_triangular());
+    REQUIRE_DIRECT(U.is_upper_triangular());
+    REQUIRE_DIRECT(etl::is_permutation_matrix(P));
+
+    etl::dyn_matrix<Z> PA(n, n);
+    etl::dyn_matrix<Z> LU(n, n);
+    PA = P * A;
+    LU = L * U;
+
+    for (size_t i = 0; i < n; ++i) {
+        REQUIRE_EQUALS(L(i, i), Z(1));
+
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(LU(i, j), PA(i, j), base_eps_etl_large);
+        }
+    }
+}
+
 /* QR */
 
 TEMPLATE_TEST_CASE_2("globals/qr/1", "[globals][QR]", Z, float, double) {
@@ -57,3 +92,634 @@ TEMPLATE_TEST_CASE_2("globals/qr/1", "[globals][QR]", Z, float, double) {
     // and the large difference in computation around zero
     REQUIRE_DIRECT(approx_equals(QR, A, 100 * base_eps_etl));
 }
+
+TEMPLATE_TEST_CASE_2("globals/qr/2", "[globals][QR]", Z, float, double) {
+    const size_t m = 93;
+    const size_t n = 81;
+
+    etl::dyn_matrix<Z> A(m, n);
+    etl::dyn_matrix<Z> Q(m, m);
+    etl::dyn_matrix<Z> R(m, n);
+    etl::dyn_matrix<Z> QR(m, n);
+    etl::dyn_matrix<Z> QtQ(m, m);
+
+    A = etl::uniform_generator(-1.0, 1.0);
+
+    etl::qr(A, Q, R);
+
+    QR  = Q * R;
+    QtQ = etl::transpose(Q) * Q;
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QR(i, j), A(i, j), base_eps_etl_large);
+
+            if (i > j) {
+                REQUIRE_EQUALS(R(i, j), Z(0));
+            }
+        }
+
+        for (size_t j = 0; j < m; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QtQ(i, j), i == j ? Z(1) : Z(0), base_eps_etl_large);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("qr/1", "[QR]", Z, float, double) {
+    const size_t m = 211;
+    const size_t n = 77;
+
+    etl::dyn_matrix<Z> A(m, n);
+    A = etl::uniform_generator(-1.0, 1.0);
+
+    auto decomposition = etl::qr(A);
+
+    etl::dyn_matrix<Z> Q(m, n);
+    etl::dyn_matrix<Z> R(n, n);
+    etl::dyn_matrix<Z> QR(m, n);
+    etl::dyn_matrix<Z> QtQ(n, n);
+
+    Q   = decomposition.q();
+    R   = decomposition.r();
+    QR  = Q * R;
+    QtQ = etl::transpose(Q) * Q;
+
+    REQUIRE_DIRECT(R.is_upper_triangular());
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QR(i, j), A(i, j), base_eps_etl_large);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QtQ(i, j), i == j ? Z(1) : Z(0), base_eps_etl_large);
+        }
+    }
+
+    // Q^T * A = [R; 0], computed with an implicit Q
+    etl::dyn_matrix_cm<Z> QtA(m, n);
+    QtA = A;
+
+    decomposition.apply_qt(QtA);
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QtA(i, j), i < n ? R(i, j) : Z(0), base_eps_etl_large);
+        }
+    }
+
+    // Q * (Q^T * b) = b
+    etl::dyn_vector<Z> b(m);
+    etl::dyn_vector<Z> b_ref(m);
+
+    b     = etl::uniform_generator(-1.0, 1.0);
+    b_ref = b;
+
+    decomposition.apply_qt(b);
+    decomposition.apply_q(b);
+
+    for (size_t i = 0; i < m; ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i], b_ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("qr/2", "[QR]", Z, float, double) {
+    const size_t m = 50;
+    const size_t n = 71;
+
+    etl::dyn_matrix<Z> A(m, n);
+    A = etl::uniform_generator(-1.0, 1.0);
+
+    auto decomposition = etl::qr(A);
+
+    etl::dyn_matrix<Z> Q(m, m);
+    etl::dyn_matrix<Z> R(m, n);
+    etl::dyn_matrix<Z> QR(m, n);
+
+    Q  = decomposition.q();
+    R  = decomposition.r();
+    QR = Q * R;
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QR(i, j), A(i, j), base_eps_etl_large);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("qr/3", "[QR]", Z, float, double) {
+    etl::dyn_matrix<Z> A(3, 2, etl::values(1, 2, 3, 4, 5, 6));
+
+    auto decomposition = etl::qr(A);
+
+    // Copies must not go through the decomposition of an expression
+    etl::qr_decomposition<Z> copy(decomposition);
+
+    etl::dyn_matrix<Z> R(2, 2);
+    etl::dyn_matrix<Z> R_copy(2, 2);
+
+    R      = decomposition.r();
+    R_copy = copy.r();
+
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 2; ++j) {
+            REQUIRE_EQUALS(R_copy(i, j), R(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("tsqr/1", "[QR]", Z, float, double) {
+    const size_t m = 403;
+    const size_t n = 37;
+
+    etl::dyn_matrix<Z> A(m, n);
+    etl::dyn_vector<Z> x_ref(n);
+    etl::dyn_vector<Z> b(m);
+
+    A     = etl::uniform_generator(-1.0, 1.0);
+    x_ref = etl::uniform_generator(-1.0, 1.0);
+    b     = A * x_ref;
+
+    auto decomposition = etl::tsqr(A, 5);
+
+    etl::dyn_matrix<Z> Q(m, n);
+    etl::dyn_matrix<Z> R(n, n);
+    etl::dyn_matrix<Z> QR(m, n);
+    etl::dyn_matrix<Z> QtQ(n, n);
+
+    Q   = decomposition.q();
+    R   = decomposition.r();
+    QR  = Q * R;
+    QtQ = etl::transpose(Q) * Q;
+
+    REQUIRE_DIRECT(R.is_upper_triangular());
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QR(i, j), A(i, j), base_eps_etl_large);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(QtQ(i, j), i == j ? Z(1) : Z(0), base_eps_etl_large);
+        }
+    }
+
+    // The system is consistent, the least squares solution is exact
+    etl::dyn_vector<Z> x(n);
+    etl::dyn_vector<Z> x_qr(n);
+
+    x    = decomposition.solve(b);
+    x_qr = etl::qr(A).solve(b);
+
+    for (size_t i = 0; i < n; ++i) {
+        REQUIRE_EQUALS_APPROX_E(x[i], x_ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(x_qr[i], x_ref[i], base_eps_etl_large);
+    }
+}
+
+/* Solve */
+
+TEMPLATE_TEST_CASE_2("solve/1", "[solve]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{2, 1, 1, 4, -6, 0, -2, 7, 2};
+    etl::fast_vector<Z, 3> b{5, -2, 9};
+    etl::fast_vector<Z, 3> x;
+
+    x = etl::solve(A, b);
+
+    REQUIRE_EQUALS_APPROX(x[0], Z(1));
+    REQUIRE_EQUALS_APPROX(x[1], Z(1));
+    REQUIRE_EQUALS_APPROX(x[2], Z(2));
+
+    // A must not be modified
+    REQUIRE_EQUALS(A(0, 0), Z(2));
+    REQUIRE_EQUALS(A(2, 1), Z(7));
+}
+
+TEMPLATE_TEST_CASE_2("solve/2", "[solve]", Z, float, double) {
+    const size_t n = 137;
+    const size_t m = 19;
+
+    etl::dyn_matrix<Z> A(n, n);
+    etl::dyn_matrix<Z> X_ref(n, m);
+    etl::dyn_matrix<Z> B(n, m);
+
+    A     = etl::uniform_generator(-1.0, 1.0);
+    X_ref = etl::uniform_generator(-1.0, 1.0);
+
+    for (size_t i = 0; i < n; ++i) {
+        A(i, (i * 7) % n) += Z(n);
+    }
+
+    B = A * X_ref;
+
+    etl::dyn_matrix<Z> X(n, m);
+    etl::dyn_matrix_cm<Z> X_cm(n, m);
+
+    X    = etl::solve(A, B);
+    X_cm = etl::solve(A, B);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < m; ++j) {
+            REQUIRE_EQUALS_APPROX_E(X(i, j), X_ref(i, j), base_eps_etl_large);
+            REQUIRE_EQUALS_APPROX_E(X_cm(i, j), X_ref(i, j), base_eps_etl_large);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("solve/3", "[solve]", Z, float, double) {
+    const size_t n = 71;
+
+    etl::dyn_matrix_cm<Z> A(n, n);
+    etl::dyn_vector<Z> x_ref(n);
+    etl::dyn_vector<Z> b(n);
+
+    A     = etl::uniform_generator(-1.0, 1.0);
+    x_ref = etl::uniform_generator(-1.0, 1.0);
+
+    for (size_t i = 0; i < n; ++i) {
+        A(i, n - 1 - i) += Z(n);
+    }
+
+    b = A * x_ref;
+
+    // The solution can be stored in the right-hand side
+    b = etl::solve(A, b);
+
+    for (size_t i = 0; i < n; ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i], x_ref[i], base_eps_etl_large);
+    }
+}
+
+/* Cholesky */
+
+TEMPLATE_TEST_CASE_2("cholesky/1", "[cholesky]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{4, 12, -16, 12, 37, -43, -16, -43, 98};
+    etl::fast_matrix<Z, 3, 3> L;
+
+    L = etl::cholesky(A);
+
+    REQUIRE_EQUALS_APPROX(L(0, 0), Z(2));
+    REQUIRE_EQUALS_APPROX(L(1, 0), Z(6));
+    REQUIRE_EQUALS_APPROX(L(1, 1), Z(1));
+    REQUIRE_EQUALS_APPROX(L(2, 0), Z(-8));
+    REQUIRE_EQUALS_APPROX(L(2, 1), Z(5));
+    REQUIRE_EQUALS_APPROX(L(2, 2), Z(3));
+
+    REQUIRE_EQUALS(L(0, 1), Z(0));
+    REQUIRE_EQUALS(L(0, 2), Z(0));
+    REQUIRE_EQUALS(L(1, 2), Z(0));
+}
+
+TEMPLATE_TEST_CASE_2("cholesky/2", "[cholesky]", Z, float, double) {
+    const size_t n = 141;
+
+    etl::dyn_matrix<Z> X(n, n);
+    etl::dyn_matrix<Z> A(n, n);
+
+    X = etl::uniform_generator(-1.0, 1.0);
+    A = X * etl::transpose(X);
+
+    for (size_t i = 0; i < n; ++i) {
+        A(i, i) += Z(n);
+    }
+
+    etl::dyn_matrix<Z> L(n, n);
+    etl::lower_matrix<etl::dyn_matrix<Z>> L_adapted(n);
+    etl::dyn_matrix<Z> LLt(n, n);
+
+    L         = etl::cholesky(A);
+    L_adapted = etl::cholesky(A);
+    LLt       = L * etl::transpose(L);
+
+    REQUIRE_DIRECT(L.is_lower_triangular());
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(LLt(i, j), A(i, j), base_eps_etl_large);
+            REQUIRE_EQUALS(L_adapted(i, j), L(i, j));
+        }
+    }
+}
+
+/* Triangular solves */
+
+TEMPLATE_TEST_CASE_2("trsm/1", "[trsm]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> L{2, 0, 0, 1, 4, 0, -1, 2, 1};
+    etl::fast_matrix<Z, 3, 3> U{2, 1, -1, 0, 4, 2, 0, 0, 1};
+    etl::fast_vector<Z, 3> b{2, 9, 2};
+    etl::fast_vector<Z, 3> x;
+
+    x = etl::trsv(L, b);
+
+    REQUIRE_EQUALS_APPROX(x[0], Z(1));
+    REQUIRE_EQUALS_APPROX(x[1], Z(2));
+    REQUIRE_EQUALS_APPROX(x[2], Z(-1));
+
+    x = etl::trsv(U, b);
+
+    REQUIRE_EQUALS_APPROX(x[2], Z(2));
+    REQUIRE_EQUALS_APPROX(x[1], Z(1.25));
+    REQUIRE_EQUALS_APPROX(x[0], Z(1.375));
+}
+
+TEMPLATE_TEST_CASE_2("trsm/2", "[trsm]", Z, float, double) {
+    const size_t n = 133;
+    const size_t m = 11;
+
+    etl::lower_matrix<etl::dyn_matrix<Z>> L(n);
+    etl::upper_matrix<etl::dyn_matrix<Z>> U(n);
+    etl::uni_lower_matrix<etl::dyn_matrix<Z>> UL(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            L(i, j)  = Z(((i + j) % 5) - 2.0) / Z(n);
+            U(j, i)  = Z(((i * j) % 7) - 3.0) / Z(n);
+            UL(i, j) = Z(((i + 2 * j) % 3) - 1.0) / Z(n);
+        }
+
+        L(i, i) = Z(1.5) + Z(i % 3);
+        U(i, i) = Z(-2.0) - Z(i % 4);
+    }
+
+    etl::dyn_matrix<Z> X_ref(n, m);
+    etl::dyn_matrix<Z> B(n, m);
+    etl::dyn_matrix<Z> X(n, m);
+    etl::dyn_matrix_cm<Z> X_cm(n, m);
+
+    X_ref = etl::uniform_generator(-1.0, 1.0);
+
+    B = L * X_ref;
+    X = etl::trsm(L, B);
+
+    for (size_t i = 0; i < n * m; ++i) {
+        REQUIRE_EQUALS_APPROX_E(X[i], X_ref[i], base_eps_etl_large);
+    }
+
+    B    = U * X_ref;
+    X_cm = etl::solve(U, B);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < m; ++j) {
+            REQUIRE_EQUALS_APPROX_E(X_cm(i, j), X_ref(i, j), base_eps_etl_large);
+        }
+    }
+
+    B = UL * X_ref;
+    B = etl::trsm(UL, B);
+
+    for (size_t i = 0; i < n * m; ++i) {
+        REQUIRE_EQUALS_APPROX_E(B[i], X_ref[i], base_eps_etl_large);
+    }
+}
+
+/* SPD Solve */
+
+TEMPLATE_TEST_CASE_2("solve_spd/1", "[solve]", Z, float, double) {
+    const size_t n = 129;
+    const size_t m = 7;
+
+    etl::dyn_matrix<Z> X(n, n);
+    etl::dyn_matrix<Z> XXt(n, n);
+    etl::symmetric_matrix<etl::dyn_matrix<Z>> A(n);
+
+    X   = etl::uniform_generator(-1.0, 1.0);
+    XXt = X * etl::transpose(X);
+    A   = Z(0.5) * (XXt + etl::transpose(XXt));
+
+    for (size_t i = 0; i < n; ++i) {
+        A(i, i) += Z(n);
+    }
+
+    etl::dyn_matrix<Z> S_ref(n, m);
+    etl::dyn_matrix<Z> B(n, m);
+    etl::dyn_matrix<Z> S(n, m);
+
+    S_ref = etl::uniform_generator(-1.0, 1.0);
+    B     = A * S_ref;
+    S     = etl::solve_spd(A, B);
+
+    for (size_t i = 0; i < n * m; ++i) {
+        REQUIRE_EQUALS_APPROX_E(S[i], S_ref[i], base_eps_etl_large);
+    }
+
+    // With a vector, from the factor itself
+
+    etl::dyn_matrix<Z> L(n, n);
+    etl::dyn_vector<Z> x_ref(n);
+    etl::dyn_vector<Z> y(n);
+    etl::dyn_vector<Z> b(n);
+
+    x_ref = etl::uniform_generator(-1.0, 1.0);
+    b     = A * x_ref;
+    L     = etl::cholesky(A);
+
+    y = etl::trsv(L, b);
+    b = etl::trsv(etl::transpose(L), y);
+
+    for (size_t i = 0; i < n; ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i], x_ref[i], base_eps_etl_large);
+    }
+
+    b = A * x_ref;
+    b = etl::solve_spd(A, b);
+
+    for (size_t i = 0; i < n; ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i], x_ref[i], base_eps_etl_large);
+    }
+}
+
+/* Symmetric eigendecomposition */
+
+TEMPLATE_TEST_CASE_2("eigh/1", "[eigh]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 3> A{2, -1, 0, -1, 2, -1, 0, -1, 2};
+    etl::fast_vector<Z, 3> w;
+    etl::fast_matrix<Z, 3, 3> V;
+
+    REQUIRE(etl::eigh(A, w, V));
+
+    REQUIRE_EQUALS_APPROX(w[0], Z(2.0 - std::sqrt(2.0)));
+    REQUIRE_EQUALS_APPROX(w[1], Z(2.0));
+    REQUIRE_EQUALS_APPROX(w[2], Z(2.0 + std::sqrt(2.0)));
+
+    etl::fast_matrix<Z, 3, 3> AV;
+    AV = A * V;
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            REQUIRE_EQUALS_APPROX(AV(i, j), V(i, j) * w[j]);
+        }
+    }
+
+    etl::fast_vector<Z, 2> w_bad;
+    REQUIRE(!etl::eigh(A, w_bad));
+}
+
+TEMPLATE_TEST_CASE_2("eigh/2", "[eigh]", Z, float, double) {
+    const size_t n = 97;
+
+    etl::dyn_matrix<Z> X(n, n);
+    etl::symmetric_matrix<etl::dyn_matrix<Z>> A(n);
+
+    X = etl::uniform_generator(-1.0, 1.0);
+    A = Z(0.5) * (X + etl::transpose(X));
+
+    etl::dyn_vector<Z> w(n);
+    etl::dyn_vector<Z> w_only(n);
+    etl::dyn_matrix<Z> V(n, n);
+
+    REQUIRE(etl::eigh(A, w, V));
+    REQUIRE(etl::eigh(A, w_only));
+
+    etl::dyn_matrix<Z> AV(n, n);
+    etl::dyn_matrix<Z> VtV(n, n);
+
+    AV  = A * V;
+    VtV = etl::transpose(V) * V;
+
+    for (size_t j = 0; j < n; ++j) {
+        REQUIRE_EQUALS_APPROX_E(w_only[j], w[j], base_eps_etl_large);
+
+        if (j) {
+            REQUIRE(w[j - 1] <= w[j]);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(AV(i, j), V(i, j) * w[j], base_eps_etl_large);
+            REQUIRE_EQUALS_APPROX_E(VtV(i, j), Z(i == j ? 1 : 0), base_eps_etl_large);
+        }
+    }
+}
+
+/* Singular value decomposition */
+
+TEMPLATE_TEST_CASE_2("svd/1", "[svd]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 2> A{3, 0, 0, 4, 0, 0};
+    etl::fast_matrix<Z, 3, 2> U;
+    etl::fast_vector<Z, 2> s;
+    etl::fast_matrix<Z, 2, 2> V;
+
+    REQUIRE(etl::svd(A, U, s, V));
+
+    REQUIRE_EQUALS_APPROX(s[0], Z(4));
+    REQUIRE_EQUALS_APPROX(s[1], Z(3));
+
+    REQUIRE_EQUALS_APPROX(std::abs(U(1, 0)), Z(1));
+    REQUIRE_EQUALS_APPROX(std::abs(V(1, 0)), Z(1));
+    REQUIRE_EQUALS_APPROX(std::abs(U(0, 1)), Z(1));
+    REQUIRE_EQUALS_APPROX(std::abs(V(0, 1)), Z(1));
+
+    etl::fast_vector<Z, 3> s_bad;
+    REQUIRE(!etl::svd(A, s_bad));
+}
+
+TEMPLATE_TEST_CASE_2("svd/2", "[svd]", Z, float, double) {
+    // Tall, square and wide matrices
+    const size_t sizes[3][2] = {{151, 47}, {64, 64}, {31, 80}};
+
+    for (auto& size : sizes) {
+        const size_t m = size[0];
+        const size_t n = size[1];
+        const size_t k = std::min(m, n);
+
+        etl::dyn_matrix<Z> A(m, n);
+        etl::dyn_matrix<Z> U(m, k);
+        etl::dyn_vector<Z> s(k);
+        etl::dyn_vector<Z> s_only(k);
+        etl::dyn_matrix<Z> V(n, k);
+
+        A = etl::uniform_generator(-1.0, 1.0);
+
+        REQUIRE(etl::svd(A, U, s, V));
+        REQUIRE(etl::svd(A, s_only));
+
+        for (size_t j = 0; j < k; ++j) {
+            REQUIRE_EQUALS_APPROX_E(s_only[j], s[j], base_eps_etl_large);
+
+            if (j) {
+                REQUIRE(s[j - 1] >= s[j]);
+            }
+        }
+
+        etl::dyn_matrix<Z> US(m, k);
+
+        for (size_t i = 0; i < m; ++i) {
+            for (size_t j = 0; j < k; ++j) {
+                US(i, j) = U(i, j) * s[j];
+            }
+        }
+
+        etl::dyn_matrix<Z> R(m, n);
+        etl::dyn_matrix<Z> UtU(k, k);
+        etl::dyn_matrix<Z> VtV(k, k);
+
+        R   = US * etl::transpose(V);
+        UtU = etl::transpose(U) * U;
+        VtV = etl::transpose(V) * V;
+
+        for (size_t i = 0; i < m * n; ++i) {
+            REQUIRE_EQUALS_APPROX_E(R[i], A[i], base_eps_etl_large);
+        }
+
+        for (size_t i = 0; i < k; ++i) {
+            for (size_t j = 0; j < k; ++j) {
+                REQUIRE_EQUALS_APPROX_E(UtU(i, j), Z(i == j ? 1 : 0), base_eps_etl_large);
+                REQUIRE_EQUALS_APPROX_E(VtV(i, j), Z(i == j ? 1 : 0), base_eps_etl_large);
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("svd_truncated/1", "[svd]", Z, float, double) {
+    const size_t m = 203;
+    const size_t n = 119;
+    const size_t k = 5;
+
+    // A matrix whose singular values decay quickly
+
+    etl::dyn_matrix<Z> X(m, n);
+    etl::dyn_matrix<Z> A(m, n);
+    etl::dyn_matrix<Z> U_f(m, n);
+    etl::dyn_vector<Z> s_f(n);
+    etl::dyn_matrix<Z> V_f(n, n);
+
+    X = etl::uniform_generator(-1.0, 1.0);
+
+    REQUIRE(etl::svd(X, U_f, s_f, V_f));
+
+    for (size_t j = 0; j < n; ++j) {
+        s_f[j] = Z(10) * std::pow(Z(0.6), Z(j));
+
+        for (size_t i = 0; i < m; ++i) {
+            U_f(i, j) *= s_f[j];
+        }
+    }
+
+    A = U_f * etl::transpose(V_f);
+
+    etl::dyn_matrix<Z> U(m, k);
+    etl::dyn_vector<Z> s(k);
+    etl::dyn_matrix<Z> V(n, k);
+
+    REQUIRE(etl::svd_truncated(A, U, s, V));
+
+    for (size_t j = 0; j < k; ++j) {
+        REQUIRE_EQUALS_APPROX_E(s[j], s_f[j], base_eps_etl_large);
+    }
+
+    // A * V = U * diag(s)
+
+    etl::dyn_matrix<Z> AV(m, k);
+    AV = A * V;
+
+    for (size_t i = 0; i < m; ++i) {
+        for (size_t j = 0; j < k; ++j) {
+            REQUIRE_EQUALS_APPROX_E(AV(i, j), U(i, j) * s[j], base_eps_etl_large);
+        }
+    }
+}
@@ -213,3 +213,180 @@ TEMPLATE_TEST_CASE_2("batch_embedding_gradients/0", "[batch_embedding_gradients]
     REQUIRE_EQUALS(c(7, 1), 0);
     REQUIRE_EQUALS(c(7, 2), 0);
 }
+
+TEMPLATE_TEST_CASE_2("embedding_lookup/2", "[embedding_lookup]", T, float, double) {
+    const size_t V = 97;
+    const size_t I = 513;
+    const size_t D = 33;
+
+    etl::dyn_matrix<T, 1> a(I);
+    etl::dyn_matrix<T, 2> b(V, D);
+    etl::dyn_matrix<T, 2> c(I, D);
+
+    for (size_t i = 0; i < I; ++i) {
+        a(i) = T((i * 31) % V);
+    }
+
+    b = etl::sequence_generator(T(1)) * T(0.01);
+
+    c = embedding_lookup(a, b);
+
+    for (size_t i = 0; i < I; ++i) {
+        for (size_t d = 0; d < D; ++d) {
+            REQUIRE_EQUALS(c(i, d), b(size_t(a(i)), d));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_embedding_lookup/1", "[batch_embedding_lookup]", T, float, double) {
+    const size_t V = 97;
+    const size_t B = 5;
+    const size_t I = 129;
+    const size_t D = 33;
+
+    etl::dyn_matrix<T, 2> a(B, I);
+    etl::dyn_matrix<T, 2> b(V, D);
+    etl::dyn_matrix<T, 3> c(B, I, D);
+
+    for (size_t bb = 0; bb < B; ++bb) {
+        for (size_t i = 0; i < I; ++i) {
+            a(bb, i) = T((bb * 7 + i * 31) % V);
+        }
+    }
+
+    b = etl::sequence_generator(T(1)) * T(0.01);
+
+    c = batch_embedding_lookup(a, b);
+
+    for (size_t bb = 0; bb < B; ++bb) {
+        for (size_t i = 0; i < I; ++i) {
+            for (size_t d = 0; d < D; ++d) {
+                REQUIRE_EQUALS(c(bb, i, d), b(size_t(a(bb, i)), d));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("embedding_gradients/1", "[embedding_gradients]", T, float, double) {
+    const size_t V = 97;
+    const size_t I = 513;
+    const size_t D = 33;
+
+    etl::dyn_matrix<T, 1> a(I);
+    etl::dyn_matrix<T, 2> b(I, D);
+    etl::dyn_matrix<T, 2> c(V, D);
+    etl::dyn_matrix<T, 2> ref(V, D);
+
+    for (size_t i = 0; i < I; ++i) {
+        a(i) = T((i * i) % V);
+    }
+
+    b = etl::sequence_generator(T(1)) * T(0.001);
+
+    c = embedding_gradients(a, b, c);
+
+    ref = 0;
+
+    for (size_t i = 0; i < I; ++i) {
+        for (size_t d = 0; d < D; ++d) {
+            ref(size_t(a(i)), d) += b(i, d);
+        }
+    }
+
+    for (size_t k = 0; k < V * D; ++k) {
+        REQUIRE_EQUALS_APPROX(c[k], ref[k]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_embedding_gradients/0", "[embedding_gradients]", T, float, double) {
+    etl::fast_matrix<T, 6> a({1, 2, 3, 2, 6, 0});
+    etl::fast_matrix<T, 6, 3> b{ 1, 2, 3,  4, 5, 6,  0.1, 0.2, 0.3,  -1.0, -1.0, 0.0,  1, 1, 1,  2, 2, 2 };
+
+    etl::fast_matrix<T, 8, 3> c;
+    c = embedding_gradients(a, b, c);
+
+    auto gradients = etl::sparse_embedding_gradients(a, b);
+
+    REQUIRE_EQUALS(gradients.rows(), 5UL);
+    REQUIRE_EQUALS(etl::dim<0>(gradients.values), 5UL);
+    REQUIRE_EQUALS(etl::dim<1>(gradients.values), 3UL);
+
+    REQUIRE_EQUALS(gradients.ids[0], 0UL);
+    REQUIRE_EQUALS(gradients.ids[1], 1UL);
+    REQUIRE_EQUALS(gradients.ids[2], 2UL);
+    REQUIRE_EQUALS(gradients.ids[3], 3UL);
+    REQUIRE_EQUALS(gradients.ids[4], 6UL);
+
+    for (size_t r = 0; r < gradients.rows(); ++r) {
+        for (size_t d = 0; d < 3; ++d) {
+            REQUIRE_EQUALS(gradients.values(r, d), c(gradients.ids[r], d));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("batch_sparse_embedding_gradients/0", "[embedding_gradients]", T, float, double) {
+    const size_t V = 997;
+    const size_t B = 7;
+    const size_t I = 65;
+    const size_t D = 17;
+
+    etl::dyn_matrix<T, 2> a(B, I);
+    etl::dyn_matrix<T, 3> b(B, I, D);
+    etl::dyn_matrix<T, 2> c(V, D);
+
+    for (size_t bb = 0; bb < B; ++bb) {
+        for (size_t i = 0; i < I; ++i) {
+            a(bb, i) = T((bb * 13 + i * i) % V);
+        }
+    }
+
+    b = etl::sequence_generator(T(1)) * T(0.001);
+
+    c = batch_embedding_gradients(a, b, c);
+
+    auto gradients = etl::batch_sparse_embedding_gradients(a, b);
+
+    size_t used = 0;
+
+    for (size_t v = 0; v < V; ++v) {
+        bool referenced = false;
+
+        for (size_t k = 0; k < B * I; ++k) {
+            referenced = referenced || size_t(a[k]) == v;
+        }
+
+        used += referenced;
+    }
+
+    REQUIRE_EQUALS(gradients.rows(), used);
+
+    for (size_t r = 0; r < gradients.rows(); ++r) {
+        if (r) {
+            REQUIRE_DIRECT(gradients.ids[r - 1] < gradients.ids[r]);
+        }
+
+        for (size_t d = 0; d < D; ++d) {
+            REQUIRE_EQUALS_APPROX(gradients.values(r, d), c(gradients.ids[r], d));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("embedding_scatter_add/0", "[embedding_gradients]", T, float, double) {
+    etl::fast_matrix<T, 6> a({1, 2, 3, 2, 6, 0});
+    etl::fast_matrix<T, 6, 3> b{ 1, 2, 3,  4, 5, 6,  0.1, 0.2, 0.3,  -1.0, -1.0, 0.0,  1, 1, 1,  2, 2, 2 };
+
+    etl::fast_matrix<T, 8, 3> c;
+    c = embedding_gradients(a, b, c);
+
+    etl::fast_matrix<T, 8, 3> vocab;
+    etl::fast_matrix<T, 8, 3> ref;
+
+    vocab = etl::sequence_generator(T(1));
+    ref   = vocab - T(0.5) * c;
+
+    etl::embedding_scatter_add(vocab, etl::sparse_embedding_gradients(a, b), T(-0.5));
+
+    for (size_t k = 0; k < 8 * 3; ++k) {
+        REQUIRE_EQUALS_APPROX(vocab[k], ref[k]);
+    }
+}
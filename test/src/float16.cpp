@@ -0,0 +1,173 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+// Tests for the scalar conversions
+
+ETL_TEST_CASE("bfloat16/convert/0", "[float16]") {
+    REQUIRE_EQUALS(etl::bfloat16(1.0f).bits, 0x3F80);
+    REQUIRE_EQUALS(etl::bfloat16(-2.0f).bits, 0xC000);
+    REQUIRE_EQUALS(etl::bfloat16(0.0f).bits, 0x0000);
+
+    // Round to nearest even
+    REQUIRE_EQUALS(etl::bfloat16(1.00390625f).bits, 0x3F80);
+    REQUIRE_EQUALS(etl::bfloat16(1.01171875f).bits, 0x3F82);
+    REQUIRE_EQUALS(etl::bfloat16(1.005f).bits, 0x3F81);
+
+    REQUIRE_EQUALS(etl::bfloat16(std::numeric_limits<float>::infinity()).bits, 0x7F80);
+    REQUIRE_DIRECT(std::isnan(float(etl::bfloat16(std::numeric_limits<float>::quiet_NaN()))));
+
+    REQUIRE_EQUALS(float(etl::bfloat16(3.140625f)), 3.140625f);
+}
+
+ETL_TEST_CASE("half/convert/0", "[float16]") {
+    REQUIRE_EQUALS(etl::half(1.0f).bits, 0x3C00);
+    REQUIRE_EQUALS(etl::half(-2.0f).bits, 0xC000);
+    REQUIRE_EQUALS(etl::half(65504.0f).bits, 0x7BFF);
+    REQUIRE_EQUALS(etl::half(1e6f).bits, 0x7C00);
+    REQUIRE_EQUALS(etl::half(5.9604645e-8f).bits, 0x0001);
+
+    // Round to nearest even
+    REQUIRE_EQUALS(etl::half(1.00048828125f).bits, 0x3C00);
+    REQUIRE_EQUALS(etl::half(1.00146484375f).bits, 0x3C02);
+
+    REQUIRE_DIRECT(std::isnan(float(etl::half(std::numeric_limits<float>::quiet_NaN()))));
+
+    REQUIRE_EQUALS(float(etl::half::from_bits(0x0001)), 5.9604645e-8f);
+    REQUIRE_EQUALS(float(etl::half::from_bits(0x3555)), 0.33325195f);
+}
+
+// Tests for the (vectorized) conversions of containers
+
+TEMPLATE_TEST_CASE_2("float16/assign/0", "[float16]", Z, etl::bfloat16, etl::half) {
+    etl::dyn_vector<float> a(37);
+    etl::dyn_vector<Z> b(37);
+    etl::dyn_vector<float> c(37);
+
+    a = etl::sequence_generator(-10.0f) * 0.25f;
+
+    b = a;
+    c = b;
+
+    for (size_t i = 0; i < 37; ++i) {
+        REQUIRE_EQUALS(b[i].bits, Z(a[i]).bits);
+        REQUIRE_EQUALS(c[i], a[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("float16/assign/1", "[float16]", Z, etl::bfloat16, etl::half) {
+    etl::dyn_matrix<float, 2> a(13, 11);
+    etl::dyn_matrix<Z, 2> b(13, 11);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = std::sin(float(i)) * 3.0f;
+    }
+
+    a[5]  = std::numeric_limits<float>::infinity();
+    a[17] = std::numeric_limits<float>::quiet_NaN();
+
+    b = a;
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        if (i == 17) {
+            REQUIRE_DIRECT(std::isnan(float(b[i])));
+        } else {
+            REQUIRE_EQUALS(b[i].bits, Z(a[i]).bits);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("float16/expr/0", "[float16]", Z, etl::bfloat16, etl::half) {
+    etl::fast_matrix<Z, 2, 3> a{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+    etl::fast_matrix<Z, 2, 3> b{0.5f, 0.5f, 1.5f, 2.0f, -1.0f, 0.0f};
+    etl::fast_matrix<Z, 2, 3> c;
+
+    c = a + (b >> a);
+
+    REQUIRE_EQUALS(float(c(0, 0)), 1.5f);
+    REQUIRE_EQUALS(float(c(0, 1)), 3.0f);
+    REQUIRE_EQUALS(float(c(0, 2)), 7.5f);
+    REQUIRE_EQUALS(float(c(1, 0)), 12.0f);
+    REQUIRE_EQUALS(float(c(1, 1)), 0.0f);
+    REQUIRE_EQUALS(float(c(1, 2)), 6.0f);
+
+    c += a;
+
+    REQUIRE_EQUALS(float(c(0, 0)), 2.5f);
+    REQUIRE_EQUALS(float(c(1, 2)), 12.0f);
+}
+
+// Tests for the accumulations in single precision
+
+TEMPLATE_TEST_CASE_2("float16/sum/0", "[float16]", Z, etl::bfloat16, etl::half) {
+    etl::dyn_vector<Z> a(4096);
+
+    // In 16-bit accumulation, the sum would stop at 64 (bfloat16) or 512 (half)
+    a = 0.25f;
+
+    REQUIRE_EQUALS(float(etl::sum(a)), 1024.0f);
+    REQUIRE_EQUALS(float(etl::asum(-a)), 1024.0f);
+}
+
+TEMPLATE_TEST_CASE_2("float16/dot/0", "[float16]", Z, etl::bfloat16, etl::half) {
+    etl::dyn_vector<Z> a(1000);
+    etl::dyn_vector<Z> b(1000);
+
+    a = 0.5f;
+    b = 2.0f;
+
+    REQUIRE_EQUALS(float(etl::dot(a, b)), 1000.0f);
+}
+
+// Tests for the GEMM in single precision
+
+TEMPLATE_TEST_CASE_2("float16/gemm/0", "[float16][gemm]", Z, etl::bfloat16, etl::half) {
+    etl::dyn_matrix<float, 2> fa(9, 300);
+    etl::dyn_matrix<float, 2> fb(300, 7);
+
+    fa = etl::sequence_generator(0.0f) * 0.001f;
+    fb = 0.25f;
+
+    etl::dyn_matrix<Z, 2> a(9, 300);
+    etl::dyn_matrix<Z, 2> b(300, 7);
+
+    a = fa;
+    b = fb;
+
+    etl::dyn_matrix<float, 2> c(9, 7);
+    etl::dyn_matrix<Z, 2> d(9, 7);
+
+    c = a * b;
+    d = a * b;
+
+    for (size_t i = 0; i < 9; ++i) {
+        float ref = 0.0f;
+
+        for (size_t k = 0; k < 300; ++k) {
+            ref += float(a(i, k)) * 0.25f;
+        }
+
+        for (size_t j = 0; j < 7; ++j) {
+            REQUIRE_EQUALS_APPROX_E(c(i, j), ref, 1e-3);
+            REQUIRE_EQUALS(d(i, j).bits, Z(c(i, j)).bits);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("float16/gemm/1", "[float16][gemm]", Z, etl::bfloat16, etl::half) {
+    etl::fast_matrix<Z, 3, 2> a{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+    etl::fast_matrix<Z, 3, 2> b{7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f};
+    etl::fast_matrix<Z, 2, 2> c;
+
+    c = trans(a) * b;
+
+    REQUIRE_EQUALS(float(c(0, 0)), 89.0f);
+    REQUIRE_EQUALS(float(c(0, 1)), 98.0f);
+    REQUIRE_EQUALS(float(c(1, 0)), 116.0f);
+    REQUIRE_EQUALS(float(c(1, 1)), 128.0f);
+}
@@ -234,3 +234,177 @@ TEMPLATE_TEST_CASE_2("gpu/mmul_3", "[gemm]", Z, float, double) {
 }
 
 #endif //ETL_CUDA
+
+// Fused epilogues
+
+TEMPLATE_TEST_CASE_2("gemm/bias/1", "[gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> a(9, 13);
+    etl::dyn_matrix<Z> b(13, 21);
+    etl::dyn_vector<Z> bias(21);
+
+    a    = etl::uniform_generator(-1.0, 1.0);
+    b    = etl::uniform_generator(-1.0, 1.0);
+    bias = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> ref(9, 21);
+    ref = a * b;
+    ref = etl::bias_add_2d(ref, bias);
+
+    etl::dyn_matrix<Z> c(9, 21);
+    c = etl::bias_add_2d(a * b, bias);
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("gemm/bias/relu/1", "[gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> a(33, 150);
+    etl::dyn_matrix<Z> b(150, 130);
+    etl::dyn_vector<Z> bias(130);
+
+    a    = etl::uniform_generator(-1.0, 1.0);
+    b    = etl::uniform_generator(-1.0, 1.0);
+    bias = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> ref(33, 130);
+    ref = Z(0.5) * (a * b);
+    ref = etl::bias_add_2d(ref, bias);
+    ref = etl::relu(ref);
+
+    etl::dyn_matrix<Z> c(33, 130);
+    c = etl::relu(etl::bias_add_2d(Z(0.5) * (a * b), bias));
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("gemm/bias/sigmoid/1", "[gemm]", Z, float, double) {
+    etl::fast_matrix<Z, 7, 11> a;
+    etl::fast_matrix<Z, 11, 19> b;
+    etl::fast_vector<Z, 19> bias;
+
+    a    = etl::uniform_generator(-1.0, 1.0);
+    b    = etl::uniform_generator(-1.0, 1.0);
+    bias = etl::uniform_generator(-1.0, 1.0);
+
+    etl::fast_matrix<Z, 7, 19> ref;
+    ref = a * b;
+    ref = etl::bias_add_2d(ref, bias);
+    ref = etl::sigmoid(ref);
+
+    etl::fast_matrix<Z, 7, 19> c;
+    c = etl::sigmoid(etl::bias_add_2d(a * b, bias));
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("gemm/bias/tanh/1", "[gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> a(21, 420);
+    etl::dyn_matrix<Z> b(420, 410);
+    etl::dyn_vector<Z> bias(410);
+
+    a    = etl::uniform_generator(-0.1, 0.1);
+    b    = etl::uniform_generator(-0.1, 0.1);
+    bias = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> ref(21, 410);
+    ref = a * b;
+    ref = etl::bias_add_2d(ref, bias);
+    ref = etl::tanh(ref);
+
+    etl::dyn_matrix<Z> c(21, 410);
+    c = etl::tanh(etl::bias_add_2d(a * b, bias));
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("gemm/bias/tanh/2", "[gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> a(13, 37);
+    etl::dyn_matrix<Z> b(37, 29);
+    etl::dyn_vector<Z> bias(29);
+
+    a    = etl::uniform_generator(-0.1, 0.1);
+    b    = etl::uniform_generator(-0.1, 0.1);
+    bias = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> ref(13, 29);
+    ref = a * b;
+    ref = etl::bias_add_2d(ref, bias);
+    ref = etl::tanh(ref);
+
+    auto e        = etl::bias_add_2d(a * b, bias);
+    const auto ce = etl::bias_add_2d(a * b, bias);
+
+    static_assert(!etl::is_unary_expr<decltype(etl::tanh(e))>, "tanh must be fused for lvalues");
+    static_assert(!etl::is_unary_expr<decltype(etl::tanh(ce))>, "tanh must be fused for const lvalues");
+    static_assert(!etl::is_unary_expr<decltype(etl::tanh(etl::bias_add_2d(a * b, bias)))>, "tanh must be fused for temporaries");
+
+    etl::dyn_matrix<Z> c(13, 29);
+
+    c = etl::tanh(e);
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+
+    c = etl::tanh(ce);
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("gemm/add/1", "[gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> a(17, 150);
+    etl::dyn_matrix<Z> b(150, 131);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> c(17, 131);
+    c = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> t(17, 131);
+    t = Z(2) * (a * b);
+
+    etl::dyn_matrix<Z> ref(17, 131);
+    ref = c + t;
+
+    c += Z(2) * (a * b);
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("gemm/add/2", "[gemm]", Z, float, double) {
+    etl::fast_matrix<Z, 5, 5> a;
+    etl::fast_matrix<Z, 5, 5> c;
+
+    a = etl::uniform_generator(-1.0, 1.0);
+    c = etl::uniform_generator(-1.0, 1.0);
+
+    etl::fast_matrix<Z, 5, 5> t;
+    t = c * a;
+
+    etl::fast_matrix<Z, 5, 5> ref;
+    ref = c + t;
+
+    c += c * a;
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("gemm/bias/add/1", "[gemm]", Z, float, double) {
+    etl::dyn_matrix<Z> a(9, 13);
+    etl::dyn_matrix<Z> b(13, 23);
+    etl::dyn_vector<Z> bias(23);
+
+    a    = etl::uniform_generator(-1.0, 1.0);
+    b    = etl::uniform_generator(-1.0, 1.0);
+    bias = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> c(9, 23);
+    c = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> t(9, 23);
+    t = a * b;
+    t = etl::bias_add_2d(t, bias);
+
+    etl::dyn_matrix<Z> ref(9, 23);
+    ref = c + t;
+
+    c += etl::bias_add_2d(a * b, bias);
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+}
@@ -614,6 +614,61 @@ ETL_TEST_CASE("globals/determinant/3", "[globals]") {
     REQUIRE_EQUALS_APPROX(determinant(b), 45.5);
 }
 
+ETL_TEST_CASE("globals/determinant/4", "[globals]") {
+    const size_t n = 97;
+
+    etl::dyn_matrix<double> l(n, n, 0.0);
+    etl::dyn_matrix<double> u(n, n, 0.0);
+    etl::dyn_matrix<double> a(n, n);
+
+    // det(L * U) is the product of the diagonal of U
+
+    double ref = 1.0;
+
+    for (size_t i = 0; i < n; ++i) {
+        l(i, i) = 1.0;
+        u(i, i) = i % 3 ? 1.25 : -0.75;
+
+        ref *= u(i, i);
+
+        for (size_t j = 0; j < i; ++j) {
+            l(i, j) = double((i + 2 * j) % 7) / 7.0;
+            u(j, i) = double((3 * i + j) % 5) / 5.0;
+        }
+    }
+
+    a = l * u;
+
+    REQUIRE_EQUALS_APPROX(determinant(a), ref);
+
+    // Swapping two rows changes the sign
+
+    for (size_t j = 0; j < n; ++j) {
+        std::swap(a(0, j), a(n - 1, j));
+    }
+
+    REQUIRE_EQUALS_APPROX(determinant(a), -ref);
+}
+
+ETL_TEST_CASE("globals/determinant/5", "[globals]") {
+    etl::upper_matrix<etl::dyn_matrix<double>> a(3UL);
+    etl::diagonal_matrix<etl::fast_matrix<double, 3, 3>> b;
+
+    a(0, 0) = 2.0;
+    a(0, 1) = 5.0;
+    a(0, 2) = -1.0;
+    a(1, 1) = -3.0;
+    a(1, 2) = 4.0;
+    a(2, 2) = 0.5;
+
+    b(0, 0) = 1.5;
+    b(1, 1) = 2.0;
+    b(2, 2) = -4.0;
+
+    REQUIRE_EQUALS_APPROX(determinant(a), -3.0);
+    REQUIRE_EQUALS_APPROX(determinant(b), -12.0);
+}
+
 ETL_TEST_CASE("globals/shuffle/1", "[globals]") {
     etl::fast_matrix<double, 5> a{0, 1, 2, 3, 4};
 
@@ -121,3 +121,94 @@ ETL_TEST_CASE("inv/7", "[inv]") {
     REQUIRE_EQUALS_APPROX(c[7], 1.0);
     REQUIRE_EQUALS_APPROX(c[8], -1.33333);
 }
+
+ETL_TEST_CASE("inv/8", "[inv]") {
+    const size_t n = 133;
+
+    etl::dyn_matrix<double> a(n, n);
+    etl::dyn_matrix<double> c(n, n);
+    etl::dyn_matrix<double> r(n, n);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    for (size_t i = 0; i < n; ++i) {
+        a(i, n - 1 - i) += double(n);
+    }
+
+    c = inv(a);
+    r = a * c;
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(r(i, j), i == j ? 1.0 : 0.0, base_eps_etl);
+        }
+    }
+}
+
+ETL_TEST_CASE("inv/9", "[inv]") {
+    const size_t n = 67;
+
+    etl::lower_matrix<etl::dyn_matrix<double>> a(n);
+    etl::dyn_matrix<double> c(n, n);
+    etl::dyn_matrix<double> r(n, n);
+
+    for (size_t i = 0; i < n; ++i) {
+        a(i, i) = i % 2 ? 2.0 : -1.5;
+
+        for (size_t j = 0; j < i; ++j) {
+            a(i, j) = double((i + 3 * j) % 5) / 10.0;
+        }
+    }
+
+    c = inv(a);
+    r = a * c;
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            REQUIRE_EQUALS_APPROX_E(r(i, j), i == j ? 1.0 : 0.0, base_eps_etl);
+        }
+    }
+
+    REQUIRE_DIRECT(etl::is_lower_triangular(c));
+}
+
+ETL_TEST_CASE("inv/10", "[inv]") {
+    etl::diagonal_matrix<etl::fast_matrix<double, 3, 3>> a;
+    etl::uni_upper_matrix<etl::fast_matrix<double, 3, 3>> b;
+
+    etl::fast_matrix<double, 3, 3> c;
+    etl::fast_matrix<double, 3, 3> d;
+
+    a(0, 0) = 2.0;
+    a(1, 1) = -4.0;
+    a(2, 2) = 0.5;
+
+    b(0, 1) = 2.0;
+    b(0, 2) = 3.0;
+    b(1, 2) = 4.0;
+
+    c = inv(a);
+    d = inv(b);
+
+    REQUIRE_EQUALS_APPROX(c(0, 0), 0.5);
+    REQUIRE_EQUALS_APPROX(c(1, 1), -0.25);
+    REQUIRE_EQUALS_APPROX(c(2, 2), 2.0);
+    REQUIRE_DIRECT(etl::is_diagonal(c));
+
+    REQUIRE_EQUALS_APPROX(d(0, 0), 1.0);
+    REQUIRE_EQUALS_APPROX(d(0, 1), -2.0);
+    REQUIRE_EQUALS_APPROX(d(0, 2), 5.0);
+    REQUIRE_EQUALS_APPROX(d(1, 1), 1.0);
+    REQUIRE_EQUALS_APPROX(d(1, 2), -4.0);
+    REQUIRE_EQUALS_APPROX(d(2, 2), 1.0);
+    REQUIRE_DIRECT(etl::is_uni_upper_triangular(d));
+}
+
+#if !defined(NDEBUG) && defined(CPP_UTILS_ASSERT_EXCEPTION)
+ETL_TEST_CASE("inv/singular/0", "[inv][assert]") {
+    etl::fast_matrix<double, 3, 3> a = {1.0, 2.0, 3.0, 2.0, 4.0, 6.0, 1.0, 0.0, 1.0};
+    etl::fast_matrix<double, 3, 3> c;
+
+    REQUIRE_THROWS(c = inv(a));
+}
+#endif
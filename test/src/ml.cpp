@@ -135,6 +135,87 @@ TEMPLATE_TEST_CASE_2("ml/bce/error/2", "[ml]", Z, double, float) {
     REQUIRE_EQUALS_APPROX(both.second, Z(error));
 }
 
+TEMPLATE_TEST_CASE_2("ml/mse/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> o(67, 9);
+    etl::dyn_matrix<Z> l(67, 9);
+
+    o = etl::uniform_generator(-1.0, 1.0);
+    l = etl::uniform_generator(-1.0, 1.0);
+
+    Z ref_loss  = Z(0.5) * etl::sum((o - l) >> (o - l));
+    Z ref_error = Z(0.1) * etl::asum(l - o);
+
+    REQUIRE_EQUALS_APPROX(etl::ml::mse_loss(o, l, Z(0.5)), ref_loss);
+    REQUIRE_EQUALS_APPROX(etl::ml::mse_error(o, l, Z(0.1)), ref_error);
+
+    auto both = etl::ml::mse(o, l, Z(0.5), Z(0.1));
+    REQUIRE_EQUALS_APPROX(both.first, ref_loss);
+    REQUIRE_EQUALS_APPROX(both.second, ref_error);
+}
+
+TEMPLATE_TEST_CASE_2("ml/cce/both/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> o(67, 11);
+    etl::dyn_matrix<Z> l(67, 11);
+
+    o = etl::uniform_generator(0.1, 1.0);
+    l = etl::uniform_generator(0.0, 1.0);
+
+    Z ref_loss  = Z(-0.1) * etl::sum(log(o) >> l);
+    Z ref_error = Z(0.1) * etl::sum(min(abs(etl::argmax(l) - etl::argmax(o)), 1.0));
+
+    auto both = etl::ml::cce(o, l, Z(-0.1), Z(0.1));
+    REQUIRE_EQUALS_APPROX(both.first, ref_loss);
+    REQUIRE_EQUALS_APPROX(both.second, ref_error);
+}
+
+TEMPLATE_TEST_CASE_2("ml/softmax_cross_entropy/1", "[ml]", Z, double, float) {
+    etl::dyn_matrix<Z> x(13, 37);
+    etl::dyn_matrix<Z> l(13, 37);
+    etl::dyn_matrix<Z> g(13, 37);
+
+    x = etl::uniform_generator(-5.0, 5.0);
+    l = 0.0;
+
+    for (size_t i = 0; i < 13; ++i) {
+        l(i, (i * 7) % 37) = 1.0;
+    }
+
+    etl::dyn_matrix<Z> p(13, 37);
+    p = etl::softmax(x);
+
+    Z ref_loss = Z(-1.0 / 13) * etl::sum(log(p) >> l);
+
+    etl::dyn_matrix<Z> ref_g(13, 37);
+    ref_g = p - l;
+
+    auto loss = etl::ml::softmax_cross_entropy(x, l, g, Z(-1.0 / 13));
+
+    REQUIRE_EQUALS_APPROX(loss, ref_loss);
+    REQUIRE_DIRECT(approx_equals(g, ref_g, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("ml/softmax_cross_entropy/2", "[ml]", Z, double, float) {
+    etl::dyn_vector<Z> x(19);
+    etl::dyn_vector<Z> l(19);
+    etl::dyn_vector<Z> g(19);
+
+    x = etl::uniform_generator(-5.0, 5.0);
+    l = etl::uniform_generator(0.0, 0.1);
+
+    etl::dyn_vector<Z> p(19);
+    p = etl::softmax(x);
+
+    Z ref_loss = Z(-1.0) * etl::sum(log(p) >> l);
+
+    etl::dyn_vector<Z> ref_g(19);
+    ref_g = p - l;
+
+    auto loss = etl::ml::softmax_cross_entropy(x, l, g, Z(-1.0));
+
+    REQUIRE_EQUALS_APPROX(loss, ref_loss);
+    REQUIRE_DIRECT(approx_equals(g, ref_g, base_eps_etl_large));
+}
+
 TEMPLATE_TEST_CASE_2("ml/pool/max/0", "[ml]", Z, double, float) {
     etl::fast_matrix<Z, 4, 4> a({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0, 15.0, 16.0});
     etl::fast_matrix<Z, 2, 2> b;
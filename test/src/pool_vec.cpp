@@ -0,0 +1,206 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+// Compare the vectorized pooling implementation with the standard one
+
+TEMPLATE_TEST_CASE_2("pool_vec/max/2x2/1", "[pooling]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 4, 10, 12> input;
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::fast_matrix<Z, 3, 4, 5, 6> ref;
+    etl::fast_matrix<Z, 3, 4, 5, 6> output;
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::max_pool_2d<2, 2>(input)));
+    output = selected_helper(etl::pool_impl::VEC, (etl::max_pool_2d<2, 2>(input)));
+
+    REQUIRE_DIRECT(approx_equals(output, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/avg/2x2/1", "[pooling]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 4, 10, 38> input;
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::fast_matrix<Z, 3, 4, 5, 19> ref;
+    etl::fast_matrix<Z, 3, 4, 5, 19> output;
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::avg_pool_2d<2, 2>(input)));
+    output = selected_helper(etl::pool_impl::VEC, (etl::avg_pool_2d<2, 2>(input)));
+
+    REQUIRE_DIRECT(approx_equals(output, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/max/3x3/1", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> input(5, 11, 37);
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<Z, 3> ref(5, 5, 18);
+    etl::dyn_matrix<Z, 3> output(5, 5, 18);
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::max_pool_2d(input, 3, 3, 2, 2)));
+    output = selected_helper(etl::pool_impl::VEC, (etl::max_pool_2d(input, 3, 3, 2, 2)));
+
+    REQUIRE_DIRECT(approx_equals(output, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/avg/3x3/1", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> input(5, 11, 37);
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<Z, 3> ref(5, 5, 18);
+    etl::dyn_matrix<Z, 3> output(5, 5, 18);
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::avg_pool_2d(input, 3, 3, 2, 2)));
+    output = selected_helper(etl::pool_impl::VEC, (etl::avg_pool_2d(input, 3, 3, 2, 2)));
+
+    REQUIRE_DIRECT(approx_equals(output, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/max/overlap/1", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 2> input(17, 41);
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<Z, 2> ref(15, 40);
+    etl::dyn_matrix<Z, 2> output(15, 40);
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::max_pool_2d(input, 3, 2, 1, 1)));
+    output = selected_helper(etl::pool_impl::VEC, (etl::max_pool_2d(input, 3, 2, 1, 1)));
+
+    REQUIRE_DIRECT(approx_equals(output, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/avg/overlap/1", "[pooling]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 17, 41> input;
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::fast_matrix<Z, 2, 8, 13> ref;
+    etl::fast_matrix<Z, 2, 8, 13> output;
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::avg_pool_2d<3, 5, 2, 3>(input)));
+    output = selected_helper(etl::pool_impl::VEC, (etl::avg_pool_2d<3, 5, 2, 3>(input)));
+
+    REQUIRE_DIRECT(approx_equals(output, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/max/padding/1", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> input(3, 8, 8);
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<Z, 3> ref(3, 5, 5);
+    etl::dyn_matrix<Z, 3> output(3, 5, 5);
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::max_pool_2d(input, 2, 2, 2, 2, 1, 1)));
+    output = selected_helper(etl::pool_impl::VEC, (etl::max_pool_2d(input, 2, 2, 2, 2, 1, 1)));
+
+    REQUIRE_DIRECT(approx_equals(output, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/max_derivative/1", "[pooling]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 3, 8, 20> input;
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::fast_matrix<Z, 2, 3, 4, 10> output;
+    output = etl::max_pool_2d<2, 2>(input);
+
+    etl::fast_matrix<Z, 2, 3, 8, 20> ref;
+    etl::fast_matrix<Z, 2, 3, 8, 20> result;
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::max_pool_derivative_2d<2, 2>(input, output)));
+    result = selected_helper(etl::pool_impl::VEC, (etl::max_pool_derivative_2d<2, 2>(input, output)));
+
+    REQUIRE_DIRECT(approx_equals(result, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/max_derivative/2", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 3> input(4, 9, 11);
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<Z, 3> output(4, 4, 5);
+    output = etl::max_pool_2d(input, 3, 3, 2, 2);
+
+    etl::dyn_matrix<Z, 3> ref(4, 9, 11);
+    etl::dyn_matrix<Z, 3> result(4, 9, 11);
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::max_pool_derivative_2d(input, output, 3, 3, 2, 2, 0, 0)));
+    result = selected_helper(etl::pool_impl::VEC, (etl::max_pool_derivative_2d(input, output, 3, 3, 2, 2, 0, 0)));
+
+    REQUIRE_DIRECT(approx_equals(result, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/avg_derivative/1", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> input(2, 3, 9, 12);
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<Z, 4> output(2, 3, 3, 4);
+    output = etl::avg_pool_2d(input, 3, 3);
+
+    etl::dyn_matrix<Z, 4> ref(2, 3, 9, 12);
+    etl::dyn_matrix<Z, 4> result(2, 3, 9, 12);
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::avg_pool_derivative_2d(input, output, 3, 3)));
+    result = selected_helper(etl::pool_impl::VEC, (etl::avg_pool_derivative_2d(input, output, 3, 3)));
+
+    REQUIRE_DIRECT(approx_equals(result, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/max_upsample/1", "[pooling]", Z, float, double) {
+    etl::dyn_matrix<Z, 4> input(2, 3, 8, 20);
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<Z, 4> errors(2, 3, 4, 10);
+    errors = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<Z, 4> output(2, 3, 4, 10);
+    output = etl::max_pool_2d(input, 2, 2);
+
+    etl::dyn_matrix<Z, 4> ref(2, 3, 8, 20);
+    etl::dyn_matrix<Z, 4> result(2, 3, 8, 20);
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::max_pool_upsample_2d(input, output, errors, 2, 2)));
+    result = selected_helper(etl::pool_impl::VEC, (etl::max_pool_upsample_2d(input, output, errors, 2, 2)));
+
+    REQUIRE_DIRECT(approx_equals(result, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/max_upsample/2", "[pooling]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 9, 11> input;
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::fast_matrix<Z, 3, 4, 5> errors;
+    errors = etl::uniform_generator(-10.0, 10.0);
+
+    etl::fast_matrix<Z, 3, 4, 5> output;
+    output = etl::max_pool_2d<3, 3, 2, 2>(input);
+
+    etl::fast_matrix<Z, 3, 9, 11> ref;
+    etl::fast_matrix<Z, 3, 9, 11> result;
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::max_pool_upsample_2d<3, 3, 2, 2>(input, output, errors)));
+    result = selected_helper(etl::pool_impl::VEC, (etl::max_pool_upsample_2d<3, 3, 2, 2>(input, output, errors)));
+
+    REQUIRE_DIRECT(approx_equals(result, ref, base_eps_etl));
+}
+
+TEMPLATE_TEST_CASE_2("pool_vec/avg_upsample/1", "[pooling]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 3, 8, 20> input;
+    input = etl::uniform_generator(-10.0, 10.0);
+
+    etl::fast_matrix<Z, 2, 3, 4, 5> errors;
+    errors = etl::uniform_generator(-10.0, 10.0);
+
+    etl::fast_matrix<Z, 2, 3, 4, 5> output;
+    output = etl::avg_pool_2d<2, 4>(input);
+
+    etl::fast_matrix<Z, 2, 3, 8, 20> ref;
+    etl::fast_matrix<Z, 2, 3, 8, 20> result;
+
+    ref    = selected_helper(etl::pool_impl::STD, (etl::avg_pool_upsample_2d<2, 4>(input, output, errors)));
+    result = selected_helper(etl::pool_impl::VEC, (etl::avg_pool_upsample_2d<2, 4>(input, output, errors)));
+
+    REQUIRE_DIRECT(approx_equals(result, ref, base_eps_etl));
+}
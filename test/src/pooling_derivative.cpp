@@ -192,3 +192,51 @@ TEMPLATE_TEST_CASE_2("pool_derivative/deep/max3/1", "[pooling]", Z, float, doubl
     REQUIRE_EQUALS(c(1, 1, 1, 0), 0.0);
     REQUIRE_EQUALS(c(1, 1, 1, 1), 1.0);
 }
+
+TEMPLATE_TEST_CASE_2("pool_derivative/deep/max3/2", "[pooling]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 4, 4> A({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0, 15.0, 16.0, 17.0, 18.0, 19.0, 20.0, 21.0, 22.0, 23.0, 24.0, 25.0, 26.0, 27.0, 28.0, 29.0, 30.0, 31.0, 32.0});
+    etl::fast_matrix<Z, 2, 2, 2, 4, 4> a;
+    a(0)(0) = A;
+    a(0)(1) = A;
+    a(1)(0) = A;
+    a(1)(1) = A;
+
+    etl::fast_matrix<Z, 2, 2, 1, 2, 2> b;
+    etl::fast_matrix<Z, 2, 2, 2, 4, 4> c;
+
+    b = etl::max_pool_3d<2, 2, 2>(a);
+    c = etl::max_pool_derivative_3d<2, 2, 2>(a, b);
+
+    REQUIRE_EQUALS(c(0, 0, 0, 0, 0), 0.0);
+    REQUIRE_EQUALS(c(0, 1, 0, 1, 1), 0.0);
+    REQUIRE_EQUALS(c(0, 1, 1, 1, 1), 1.0);
+    REQUIRE_EQUALS(c(1, 0, 1, 1, 1), 1.0);
+    REQUIRE_EQUALS(c(1, 1, 1, 3, 3), 1.0);
+    REQUIRE_EQUALS(c(1, 1, 0, 3, 3), 0.0);
+
+    c = etl::max_pool_derivative_3d(a, b, 2, 2, 2);
+
+    REQUIRE_EQUALS(c(0, 0, 0, 0, 0), 0.0);
+    REQUIRE_EQUALS(c(0, 1, 1, 1, 1), 1.0);
+    REQUIRE_EQUALS(c(1, 1, 1, 3, 3), 1.0);
+    REQUIRE_EQUALS(c(1, 1, 0, 3, 3), 0.0);
+}
+
+TEMPLATE_TEST_CASE_2("pool_derivative/deep/avg3/2", "[pooling]", Z, float, double) {
+    etl::fast_matrix<Z, 2, 2, 2, 4, 4> a;
+    etl::fast_matrix<Z, 2, 2, 1, 2, 2> b;
+    etl::fast_matrix<Z, 2, 2, 2, 4, 4> c;
+
+    a = etl::sequence_generator(1.0);
+
+    b = etl::avg_pool_3d<2, 2, 2>(a);
+    c = etl::avg_pool_derivative_3d<2, 2, 2>(a, b);
+
+    REQUIRE_EQUALS(c(0, 0, 0, 0, 0), 0.125);
+    REQUIRE_EQUALS(c(1, 1, 1, 3, 3), 0.125);
+
+    c = etl::avg_pool_derivative_3d(a, b, 2, 2, 2);
+
+    REQUIRE_EQUALS(c(0, 1, 0, 2, 1), 0.125);
+    REQUIRE_EQUALS(c(1, 0, 1, 3, 3), 0.125);
+}
@@ -0,0 +1,195 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+namespace {
+
+template <typename A>
+void qgemm_fill(A& a, size_t seed) {
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        a[i] = int8_t(int((i * 37 + seed * 11) % 256) - 128);
+    }
+}
+
+template <typename A, typename B>
+int32_t qgemm_ref(const A& a, const B& b, size_t i, size_t j) {
+    const size_t K = etl::dim<1>(a);
+
+    int32_t acc = 0;
+
+    for (size_t k = 0; k < K; ++k) {
+        if constexpr (etl::is_2d<B>) {
+            acc += int32_t(a(i, k)) * int32_t(b(k, j));
+        } else {
+            acc += int32_t(a(i, k)) * int32_t(b(k));
+        }
+    }
+
+    return acc;
+}
+
+} // end of anonymous namespace
+
+// Tests for quantize / dequantize
+
+TEMPLATE_TEST_CASE_2("quantize/0", "[quantize]", T, float, double) {
+    etl::fast_vector<T, 6> a{T(1.0), T(-0.5), T(0.26), T(100.0), T(-100.0), T(0.0)};
+    etl::fast_vector<int8_t, 6> b;
+
+    b = etl::quantize(a, T(0.5), 3);
+
+    REQUIRE_EQUALS(b[0], int8_t(5));
+    REQUIRE_EQUALS(b[1], int8_t(2));
+    REQUIRE_EQUALS(b[2], int8_t(4));
+    REQUIRE_EQUALS(b[3], int8_t(127));
+    REQUIRE_EQUALS(b[4], int8_t(-128));
+    REQUIRE_EQUALS(b[5], int8_t(3));
+}
+
+TEMPLATE_TEST_CASE_2("dequantize/0", "[quantize]", T, float, double) {
+    etl::dyn_matrix<T, 2> a(7, 9);
+    etl::dyn_matrix<int8_t, 2> q(7, 9);
+    etl::dyn_matrix<T, 2> b(7, 9);
+
+    a = etl::sequence_generator(T(-3)) * T(0.1);
+
+    q = etl::quantize(a, T(0.05), -10);
+    b = etl::dequantize<T>(q, T(0.05), -10);
+
+    for (size_t i = 0; i < etl::size(a); ++i) {
+        REQUIRE_EQUALS_APPROX_E(b[i], a[i], 0.026);
+    }
+}
+
+// Tests for qmul
+
+ETL_TEST_CASE("qmul/0", "[qgemm]") {
+    etl::fast_matrix<int8_t, 2, 3> a{1, -2, 3, 4, 5, -6};
+    etl::fast_matrix<int8_t, 3, 2> b{7, 8, -9, 10, 11, 12};
+    etl::fast_matrix<int32_t, 2, 2> c;
+
+    c = etl::qmul(a, b);
+
+    REQUIRE_EQUALS(c(0, 0), 58);
+    REQUIRE_EQUALS(c(0, 1), 24);
+    REQUIRE_EQUALS(c(1, 0), -83);
+    REQUIRE_EQUALS(c(1, 1), 10);
+}
+
+ETL_TEST_CASE("qmul/1", "[qgemm]") {
+    etl::dyn_matrix<int8_t, 2> a(37, 131);
+    etl::dyn_matrix<int8_t, 2> b(131, 23);
+    etl::dyn_matrix<int32_t, 2> c(37, 23);
+
+    qgemm_fill(a, 1);
+    qgemm_fill(b, 2);
+
+    c = etl::qmul(a, b);
+
+    for (size_t i = 0; i < 37; ++i) {
+        for (size_t j = 0; j < 23; ++j) {
+            REQUIRE_EQUALS(c(i, j), qgemm_ref(a, b, i, j));
+        }
+    }
+}
+
+ETL_TEST_CASE("qmul/2", "[qgemm]") {
+    etl::dyn_matrix<int8_t, 2> a(16, 128);
+    etl::dyn_matrix<int8_t, 2> b(128, 8);
+    etl::dyn_matrix<int32_t, 2> c(16, 8);
+
+    a = int8_t(-128);
+    b = int8_t(-128);
+
+    c = etl::qmul(a, b);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS(c[i], 128 * 128 * 128);
+    }
+}
+
+ETL_TEST_CASE("qmul/3", "[qgemm]") {
+    etl::dyn_matrix_cm<int8_t, 2> a(13, 41);
+    etl::dyn_matrix_cm<int8_t, 2> b(41, 11);
+    etl::dyn_matrix_cm<int32_t, 2> c(13, 11);
+
+    qgemm_fill(a, 11);
+    qgemm_fill(b, 12);
+
+    c = etl::qmul(a, b);
+
+    for (size_t i = 0; i < 13; ++i) {
+        for (size_t j = 0; j < 11; ++j) {
+            REQUIRE_EQUALS(c(i, j), qgemm_ref(a, b, i, j));
+        }
+    }
+}
+
+ETL_TEST_CASE("qmul/gemv/0", "[qgemm]") {
+    etl::dyn_matrix<int8_t, 2> a(29, 200);
+    etl::dyn_vector<int8_t> b(200);
+    etl::dyn_vector<int32_t> c(29);
+
+    qgemm_fill(a, 3);
+    qgemm_fill(b, 4);
+
+    c = etl::qmul(a, b);
+
+    for (size_t i = 0; i < 29; ++i) {
+        REQUIRE_EQUALS(c(i), qgemm_ref(a, b, i, 0));
+    }
+}
+
+TEMPLATE_TEST_CASE_2("qmul_dequantize/0", "[qgemm]", T, float, double) {
+    etl::dyn_matrix<int8_t, 2> a(19, 70);
+    etl::dyn_matrix<int8_t, 2> b(70, 13);
+    etl::dyn_matrix<T, 2> c(19, 13);
+
+    qgemm_fill(a, 5);
+    qgemm_fill(b, 6);
+
+    c = etl::qmul_dequantize<T>(a, b, 0.001f);
+
+    for (size_t i = 0; i < 19; ++i) {
+        for (size_t j = 0; j < 13; ++j) {
+            REQUIRE_EQUALS_APPROX(c(i, j), T(0.001f) * T(qgemm_ref(a, b, i, j)));
+        }
+    }
+}
+
+ETL_TEST_CASE("qmul_requantize/0", "[qgemm]") {
+    etl::dyn_matrix<int8_t, 2> a(21, 64);
+    etl::dyn_matrix<int8_t, 2> b(64, 9);
+    etl::dyn_matrix<int8_t, 2> c(21, 9);
+
+    qgemm_fill(a, 7);
+    qgemm_fill(b, 8);
+
+    c = etl::qmul_requantize(a, b, 1.0f / 2048.0f, 5);
+
+    for (size_t i = 0; i < 21; ++i) {
+        for (size_t j = 0; j < 9; ++j) {
+            REQUIRE_EQUALS(c(i, j), etl::saturate_quantized<int8_t>(float(qgemm_ref(a, b, i, j)) / 2048.0f, 5));
+        }
+    }
+}
+
+ETL_TEST_CASE("qmul_requantize/gemv/0", "[qgemm]") {
+    etl::dyn_matrix<int8_t, 2> a(33, 96);
+    etl::dyn_vector<int8_t> b(96);
+    etl::dyn_vector<int8_t> c(33);
+
+    qgemm_fill(a, 9);
+    qgemm_fill(b, 10);
+
+    c = etl::qmul_requantize(a, b, 1.0f / 4096.0f);
+
+    for (size_t i = 0; i < 33; ++i) {
+        REQUIRE_EQUALS(c(i), etl::saturate_quantized<int8_t>(float(qgemm_ref(a, b, i, 0)) / 4096.0f, 0));
+    }
+}
@@ -0,0 +1,580 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+namespace {
+
+template <typename T>
+T sigmoid_ref(T x) {
+    return T(1) / (T(1) + std::exp(-x));
+}
+
+/*!
+ * \brief Reference LSTM cell, with the gates in the (i, f, g, o) order
+ */
+template <typename X, typename HP, typename CP, typename WX, typename WH, typename B, typename H, typename C>
+void lstm_cell_reference(const X& x, const HP& h_prev, const CP& c_prev, const WX& w_x, const WH& w_h, const B& b, H& h, C& c) {
+    using T = etl::value_t<X>;
+
+    const size_t N  = etl::dim<0>(x);
+    const size_t I  = etl::dim<1>(x);
+    const size_t HH = etl::dim<1>(h_prev);
+
+    std::vector<T> g(4 * HH);
+
+    for (size_t s = 0; s < N; ++s) {
+        for (size_t k = 0; k < 4 * HH; ++k) {
+            g[k] = b(k);
+
+            for (size_t i = 0; i < I; ++i) {
+                g[k] += x(s, i) * w_x(i, k);
+            }
+
+            for (size_t j = 0; j < HH; ++j) {
+                g[k] += h_prev(s, j) * w_h(j, k);
+            }
+        }
+
+        for (size_t j = 0; j < HH; ++j) {
+            c(s, j) = sigmoid_ref(g[HH + j]) * c_prev(s, j) + sigmoid_ref(g[j]) * std::tanh(g[2 * HH + j]);
+            h(s, j) = sigmoid_ref(g[3 * HH + j]) * std::tanh(c(s, j));
+        }
+    }
+}
+
+/*!
+ * \brief Reference GRU cell, with the gates in the (r, z, n) order
+ */
+template <typename X, typename HP, typename WX, typename WH, typename BX, typename BH, typename H>
+void gru_cell_reference(const X& x, const HP& h_prev, const WX& w_x, const WH& w_h, const BX& b_x, const BH& b_h, H& h) {
+    using T = etl::value_t<X>;
+
+    const size_t N  = etl::dim<0>(x);
+    const size_t I  = etl::dim<1>(x);
+    const size_t HH = etl::dim<1>(h_prev);
+
+    std::vector<T> gx(3 * HH);
+    std::vector<T> gh(3 * HH);
+
+    for (size_t s = 0; s < N; ++s) {
+        for (size_t k = 0; k < 3 * HH; ++k) {
+            gx[k] = b_x(k);
+            gh[k] = b_h(k);
+
+            for (size_t i = 0; i < I; ++i) {
+                gx[k] += x(s, i) * w_x(i, k);
+            }
+
+            for (size_t j = 0; j < HH; ++j) {
+                gh[k] += h_prev(s, j) * w_h(j, k);
+            }
+        }
+
+        for (size_t j = 0; j < HH; ++j) {
+            const T r = sigmoid_ref(gx[j] + gh[j]);
+            const T z = sigmoid_ref(gx[HH + j] + gh[HH + j]);
+            const T n = std::tanh(gx[2 * HH + j] + r * gh[2 * HH + j]);
+
+            h(s, j) = (T(1) - z) * n + z * h_prev(s, j);
+        }
+    }
+}
+
+/*!
+ * \brief Compare the given gradients with the central differences of the
+ * loss with respect to each element of m
+ */
+template <typename M, typename G, typename L>
+void check_gradients(M& m, const G& grad, L loss) {
+    const double eps = 1e-6;
+
+    for (size_t i = 0; i < etl::size(m); ++i) {
+        const double save = m[i];
+
+        m[i]            = save + eps;
+        const double lp = loss();
+
+        m[i]            = save - eps;
+        const double lm = loss();
+
+        m[i] = save;
+
+        REQUIRE_EQUALS_APPROX_E(grad[i], (lp - lm) / (2.0 * eps), 1e-6);
+    }
+}
+
+} // end of anonymous namespace
+
+// LSTM
+
+TEMPLATE_TEST_CASE_2("lstm/cell_forward/0", "[rnn][lstm]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 5> x;
+    etl::fast_matrix<Z, 3, 11> h_prev;
+    etl::fast_matrix<Z, 3, 11> c_prev;
+    etl::fast_matrix<Z, 5, 44> w_x;
+    etl::fast_matrix<Z, 11, 44> w_h;
+    etl::fast_matrix<Z, 44> b;
+
+    x      = etl::uniform_generator(-1.0, 1.0);
+    h_prev = etl::uniform_generator(-1.0, 1.0);
+    c_prev = etl::uniform_generator(-1.0, 1.0);
+    w_x    = etl::uniform_generator(-0.5, 0.5);
+    w_h    = etl::uniform_generator(-0.5, 0.5);
+    b      = etl::uniform_generator(-0.5, 0.5);
+
+    etl::fast_matrix<Z, 3, 11> h;
+    etl::fast_matrix<Z, 3, 11> c;
+    etl::fast_matrix<Z, 3, 44> gates;
+
+    etl::fast_matrix<Z, 3, 11> ref_h;
+    etl::fast_matrix<Z, 3, 11> ref_c;
+
+    h = etl::lstm_cell_forward(x, h_prev, c_prev, w_x, w_h, b, c, gates);
+
+    lstm_cell_reference(x, h_prev, c_prev, w_x, w_h, b, ref_h, ref_c);
+
+    for (size_t i = 0; i < etl::size(h); ++i) {
+        REQUIRE_EQUALS_APPROX(h[i], ref_h[i]);
+        REQUIRE_EQUALS_APPROX(c[i], ref_c[i]);
+    }
+
+    for (size_t s = 0; s < 3; ++s) {
+        for (size_t j = 0; j < 11; ++j) {
+            REQUIRE_EQUALS_APPROX(gates(s, 3 * 11 + j) * std::tanh(c(s, j)), h(s, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("lstm/forward/0", "[rnn][lstm]", Z, float, double) {
+    const size_t T = 4;
+    const size_t B = 3;
+    const size_t I = 7;
+    const size_t H = 9;
+
+    etl::dyn_matrix<Z, 3> xs(T, B, I);
+    etl::dyn_matrix<Z, 2> h0(B, H);
+    etl::dyn_matrix<Z, 2> c0(B, H);
+    etl::dyn_matrix<Z, 2> w_x(I, 4 * H);
+    etl::dyn_matrix<Z, 2> w_h(H, 4 * H);
+    etl::dyn_vector<Z> b(4 * H);
+
+    xs  = etl::uniform_generator(-1.0, 1.0);
+    h0  = etl::uniform_generator(-1.0, 1.0);
+    c0  = etl::uniform_generator(-1.0, 1.0);
+    w_x = etl::uniform_generator(-0.5, 0.5);
+    w_h = etl::uniform_generator(-0.5, 0.5);
+    b   = etl::uniform_generator(-0.5, 0.5);
+
+    etl::dyn_matrix<Z, 3> hs(T, B, H);
+    etl::dyn_matrix<Z, 3> cs(T, B, H);
+    etl::dyn_matrix<Z, 3> gates(T, B, 4 * H);
+
+    hs = etl::lstm_forward(xs, h0, c0, w_x, w_h, b, cs, gates);
+
+    etl::dyn_matrix<Z, 2> h(h0);
+    etl::dyn_matrix<Z, 2> c(c0);
+    etl::dyn_matrix<Z, 2> h_next(B, H);
+    etl::dyn_matrix<Z, 2> c_next(B, H);
+    etl::dyn_matrix<Z, 2> g(B, 4 * H);
+
+    for (size_t t = 0; t < T; ++t) {
+        h_next = etl::lstm_cell_forward(xs(t), h, c, w_x, w_h, b, c_next, g);
+
+        for (size_t i = 0; i < B * H; ++i) {
+            REQUIRE_EQUALS_APPROX(hs(t)[i], h_next[i]);
+            REQUIRE_EQUALS_APPROX(cs(t)[i], c_next[i]);
+        }
+
+        for (size_t i = 0; i < B * 4 * H; ++i) {
+            REQUIRE_EQUALS_APPROX(gates(t)[i], g[i]);
+        }
+
+        h = h_next;
+        c = c_next;
+    }
+}
+
+ETL_TEST_CASE("lstm/cell_backward/0", "[rnn][lstm]") {
+    const size_t B = 2;
+    const size_t I = 3;
+    const size_t H = 5;
+
+    etl::dyn_matrix<double, 2> x(B, I);
+    etl::dyn_matrix<double, 2> h_prev(B, H);
+    etl::dyn_matrix<double, 2> c_prev(B, H);
+    etl::dyn_matrix<double, 2> w_x(I, 4 * H);
+    etl::dyn_matrix<double, 2> w_h(H, 4 * H);
+    etl::dyn_vector<double> b(4 * H);
+
+    etl::dyn_matrix<double, 2> dh(B, H);
+    etl::dyn_matrix<double, 2> dc(B, H);
+
+    x      = etl::uniform_generator(-1.0, 1.0);
+    h_prev = etl::uniform_generator(-1.0, 1.0);
+    c_prev = etl::uniform_generator(-1.0, 1.0);
+    w_x    = etl::uniform_generator(-0.5, 0.5);
+    w_h    = etl::uniform_generator(-0.5, 0.5);
+    b      = etl::uniform_generator(-0.5, 0.5);
+    dh     = etl::uniform_generator(-1.0, 1.0);
+    dc     = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<double, 2> h(B, H);
+    etl::dyn_matrix<double, 2> c(B, H);
+    etl::dyn_matrix<double, 2> gates(B, 4 * H);
+
+    h = etl::lstm_cell_forward(x, h_prev, c_prev, w_x, w_h, b, c, gates);
+
+    etl::dyn_matrix<double, 2> dx(B, I);
+    etl::dyn_matrix<double, 2> dh_prev(B, H);
+    etl::dyn_matrix<double, 2> dc_prev(B, H);
+    etl::dyn_matrix<double, 2> dw_x(I, 4 * H);
+    etl::dyn_matrix<double, 2> dw_h(H, 4 * H);
+    etl::dyn_vector<double> db(4 * H);
+
+    dw_x = 0.0;
+    dw_h = 0.0;
+    db   = 0.0;
+
+    dx = etl::lstm_cell_backward(x, h_prev, c_prev, c, gates, dh, dc, w_x, w_h, dh_prev, dc_prev, dw_x, dw_h, db);
+
+    // The loss is the projection of the outputs on their gradients
+    auto loss = [&]() {
+        etl::dyn_matrix<double, 2> lh(B, H);
+        etl::dyn_matrix<double, 2> lc(B, H);
+
+        lstm_cell_reference(x, h_prev, c_prev, w_x, w_h, b, lh, lc);
+
+        return etl::sum(lh >> dh) + etl::sum(lc >> dc);
+    };
+
+    check_gradients(x, dx, loss);
+    check_gradients(h_prev, dh_prev, loss);
+    check_gradients(c_prev, dc_prev, loss);
+    check_gradients(w_x, dw_x, loss);
+    check_gradients(w_h, dw_h, loss);
+    check_gradients(b, db, loss);
+}
+
+TEMPLATE_TEST_CASE_2("lstm/backward/0", "[rnn][lstm]", Z, float, double) {
+    const size_t T = 3;
+    const size_t B = 2;
+    const size_t I = 5;
+    const size_t H = 10;
+
+    etl::dyn_matrix<Z, 3> xs(T, B, I);
+    etl::dyn_matrix<Z, 2> h0(B, H);
+    etl::dyn_matrix<Z, 2> c0(B, H);
+    etl::dyn_matrix<Z, 2> w_x(I, 4 * H);
+    etl::dyn_matrix<Z, 2> w_h(H, 4 * H);
+    etl::dyn_vector<Z> b(4 * H);
+
+    etl::dyn_matrix<Z, 3> dhs(T, B, H);
+    etl::dyn_matrix<Z, 2> dc(B, H);
+
+    xs  = etl::uniform_generator(-1.0, 1.0);
+    h0  = etl::uniform_generator(-1.0, 1.0);
+    c0  = etl::uniform_generator(-1.0, 1.0);
+    w_x = etl::uniform_generator(-0.5, 0.5);
+    w_h = etl::uniform_generator(-0.5, 0.5);
+    b   = etl::uniform_generator(-0.5, 0.5);
+    dhs = etl::uniform_generator(-1.0, 1.0);
+    dc  = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z, 3> hs(T, B, H);
+    etl::dyn_matrix<Z, 3> cs(T, B, H);
+    etl::dyn_matrix<Z, 3> gates(T, B, 4 * H);
+
+    hs = etl::lstm_forward(xs, h0, c0, w_x, w_h, b, cs, gates);
+
+    etl::dyn_matrix<Z, 3> dxs(T, B, I);
+    etl::dyn_matrix<Z, 2> dh0(B, H);
+    etl::dyn_matrix<Z, 2> dc0(B, H);
+    etl::dyn_matrix<Z, 2> dw_x(I, 4 * H);
+    etl::dyn_matrix<Z, 2> dw_h(H, 4 * H);
+    etl::dyn_vector<Z> db(4 * H);
+
+    dw_x = 0.0;
+    dw_h = 0.0;
+    db   = 0.0;
+
+    dxs = etl::lstm_backward(xs, h0, c0, hs, cs, gates, dhs, dc, w_x, w_h, dh0, dc0, dw_x, dw_h, db);
+
+    // Backpropagation through time with the cell expressions
+
+    etl::dyn_matrix<Z, 2> ref_dx(B, I);
+    etl::dyn_matrix<Z, 2> ref_dh(B, H);
+    etl::dyn_matrix<Z, 2> ref_dc(dc);
+    etl::dyn_matrix<Z, 2> ref_dh_prev(B, H);
+    etl::dyn_matrix<Z, 2> ref_dc_prev(B, H);
+    etl::dyn_matrix<Z, 2> ref_dw_x(I, 4 * H);
+    etl::dyn_matrix<Z, 2> ref_dw_h(H, 4 * H);
+    etl::dyn_vector<Z> ref_db(4 * H);
+
+    ref_dh   = 0.0;
+    ref_dw_x = 0.0;
+    ref_dw_h = 0.0;
+    ref_db   = 0.0;
+
+    for (size_t tt = T; tt > 0; --tt) {
+        const size_t t = tt - 1;
+
+        ref_dh += dhs(t);
+
+        if (t == 0) {
+            ref_dx = etl::lstm_cell_backward(xs(t), h0, c0, cs(t), gates(t), ref_dh, ref_dc, w_x, w_h, ref_dh_prev, ref_dc_prev, ref_dw_x, ref_dw_h, ref_db);
+        } else {
+            ref_dx = etl::lstm_cell_backward(xs(t), hs(t - 1), cs(t - 1), cs(t), gates(t), ref_dh, ref_dc, w_x, w_h, ref_dh_prev, ref_dc_prev, ref_dw_x, ref_dw_h, ref_db);
+        }
+
+        for (size_t i = 0; i < B * I; ++i) {
+            REQUIRE_EQUALS_APPROX(dxs(t)[i], ref_dx[i]);
+        }
+
+        ref_dh = ref_dh_prev;
+        ref_dc = ref_dc_prev;
+    }
+
+    for (size_t i = 0; i < B * H; ++i) {
+        REQUIRE_EQUALS_APPROX(dh0[i], ref_dh[i]);
+        REQUIRE_EQUALS_APPROX(dc0[i], ref_dc[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(dw_x); ++i) {
+        REQUIRE_EQUALS_APPROX(dw_x[i], ref_dw_x[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(dw_h); ++i) {
+        REQUIRE_EQUALS_APPROX(dw_h[i], ref_dw_h[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(db); ++i) {
+        REQUIRE_EQUALS_APPROX(db[i], ref_db[i]);
+    }
+}
+
+// GRU
+
+TEMPLATE_TEST_CASE_2("gru/cell_forward/0", "[rnn][gru]", Z, float, double) {
+    etl::fast_matrix<Z, 3, 5> x;
+    etl::fast_matrix<Z, 3, 11> h_prev;
+    etl::fast_matrix<Z, 5, 33> w_x;
+    etl::fast_matrix<Z, 11, 33> w_h;
+    etl::fast_matrix<Z, 33> b_x;
+    etl::fast_matrix<Z, 33> b_h;
+
+    x      = etl::uniform_generator(-1.0, 1.0);
+    h_prev = etl::uniform_generator(-1.0, 1.0);
+    w_x    = etl::uniform_generator(-0.5, 0.5);
+    w_h    = etl::uniform_generator(-0.5, 0.5);
+    b_x    = etl::uniform_generator(-0.5, 0.5);
+    b_h    = etl::uniform_generator(-0.5, 0.5);
+
+    etl::fast_matrix<Z, 3, 11> h;
+    etl::fast_matrix<Z, 3, 44> gates;
+
+    etl::fast_matrix<Z, 3, 11> ref_h;
+
+    h = etl::gru_cell_forward(x, h_prev, w_x, w_h, b_x, b_h, gates);
+
+    gru_cell_reference(x, h_prev, w_x, w_h, b_x, b_h, ref_h);
+
+    for (size_t i = 0; i < etl::size(h); ++i) {
+        REQUIRE_EQUALS_APPROX(h[i], ref_h[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("gru/forward/0", "[rnn][gru]", Z, float, double) {
+    const size_t T = 5;
+    const size_t B = 2;
+    const size_t I = 6;
+    const size_t H = 13;
+
+    etl::dyn_matrix<Z, 3> xs(T, B, I);
+    etl::dyn_matrix<Z, 2> h0(B, H);
+    etl::dyn_matrix<Z, 2> w_x(I, 3 * H);
+    etl::dyn_matrix<Z, 2> w_h(H, 3 * H);
+    etl::dyn_vector<Z> b_x(3 * H);
+    etl::dyn_vector<Z> b_h(3 * H);
+
+    xs  = etl::uniform_generator(-1.0, 1.0);
+    h0  = etl::uniform_generator(-1.0, 1.0);
+    w_x = etl::uniform_generator(-0.5, 0.5);
+    w_h = etl::uniform_generator(-0.5, 0.5);
+    b_x = etl::uniform_generator(-0.5, 0.5);
+    b_h = etl::uniform_generator(-0.5, 0.5);
+
+    etl::dyn_matrix<Z, 3> hs(T, B, H);
+    etl::dyn_matrix<Z, 3> gates(T, B, 4 * H);
+
+    hs = etl::gru_forward(xs, h0, w_x, w_h, b_x, b_h, gates);
+
+    etl::dyn_matrix<Z, 2> h(h0);
+    etl::dyn_matrix<Z, 2> h_next(B, H);
+
+    for (size_t t = 0; t < T; ++t) {
+        gru_cell_reference(xs(t), h, w_x, w_h, b_x, b_h, h_next);
+
+        for (size_t i = 0; i < B * H; ++i) {
+            REQUIRE_EQUALS_APPROX(hs(t)[i], h_next[i]);
+        }
+
+        h = h_next;
+    }
+}
+
+ETL_TEST_CASE("gru/cell_backward/0", "[rnn][gru]") {
+    const size_t B = 2;
+    const size_t I = 3;
+    const size_t H = 5;
+
+    etl::dyn_matrix<double, 2> x(B, I);
+    etl::dyn_matrix<double, 2> h_prev(B, H);
+    etl::dyn_matrix<double, 2> w_x(I, 3 * H);
+    etl::dyn_matrix<double, 2> w_h(H, 3 * H);
+    etl::dyn_vector<double> b_x(3 * H);
+    etl::dyn_vector<double> b_h(3 * H);
+
+    etl::dyn_matrix<double, 2> dh(B, H);
+
+    x      = etl::uniform_generator(-1.0, 1.0);
+    h_prev = etl::uniform_generator(-1.0, 1.0);
+    w_x    = etl::uniform_generator(-0.5, 0.5);
+    w_h    = etl::uniform_generator(-0.5, 0.5);
+    b_x    = etl::uniform_generator(-0.5, 0.5);
+    b_h    = etl::uniform_generator(-0.5, 0.5);
+    dh     = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<double, 2> h(B, H);
+    etl::dyn_matrix<double, 2> gates(B, 4 * H);
+
+    h = etl::gru_cell_forward(x, h_prev, w_x, w_h, b_x, b_h, gates);
+
+    etl::dyn_matrix<double, 2> dx(B, I);
+    etl::dyn_matrix<double, 2> dh_prev(B, H);
+    etl::dyn_matrix<double, 2> dw_x(I, 3 * H);
+    etl::dyn_matrix<double, 2> dw_h(H, 3 * H);
+    etl::dyn_vector<double> db_x(3 * H);
+    etl::dyn_vector<double> db_h(3 * H);
+
+    dw_x = 0.0;
+    dw_h = 0.0;
+    db_x = 0.0;
+    db_h = 0.0;
+
+    dx = etl::gru_cell_backward(x, h_prev, gates, dh, w_x, w_h, dh_prev, dw_x, dw_h, db_x, db_h);
+
+    // The loss is the projection of the output on its gradients
+    auto loss = [&]() {
+        etl::dyn_matrix<double, 2> lh(B, H);
+
+        gru_cell_reference(x, h_prev, w_x, w_h, b_x, b_h, lh);
+
+        return etl::sum(lh >> dh);
+    };
+
+    check_gradients(x, dx, loss);
+    check_gradients(h_prev, dh_prev, loss);
+    check_gradients(w_x, dw_x, loss);
+    check_gradients(w_h, dw_h, loss);
+    check_gradients(b_x, db_x, loss);
+    check_gradients(b_h, db_h, loss);
+}
+
+TEMPLATE_TEST_CASE_2("gru/backward/0", "[rnn][gru]", Z, float, double) {
+    const size_t T = 3;
+    const size_t B = 3;
+    const size_t I = 4;
+    const size_t H = 9;
+
+    etl::dyn_matrix<Z, 3> xs(T, B, I);
+    etl::dyn_matrix<Z, 2> h0(B, H);
+    etl::dyn_matrix<Z, 2> w_x(I, 3 * H);
+    etl::dyn_matrix<Z, 2> w_h(H, 3 * H);
+    etl::dyn_vector<Z> b_x(3 * H);
+    etl::dyn_vector<Z> b_h(3 * H);
+
+    etl::dyn_matrix<Z, 3> dhs(T, B, H);
+
+    xs  = etl::uniform_generator(-1.0, 1.0);
+    h0  = etl::uniform_generator(-1.0, 1.0);
+    w_x = etl::uniform_generator(-0.5, 0.5);
+    w_h = etl::uniform_generator(-0.5, 0.5);
+    b_x = etl::uniform_generator(-0.5, 0.5);
+    b_h = etl::uniform_generator(-0.5, 0.5);
+    dhs = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z, 3> hs(T, B, H);
+    etl::dyn_matrix<Z, 3> gates(T, B, 4 * H);
+
+    hs = etl::gru_forward(xs, h0, w_x, w_h, b_x, b_h, gates);
+
+    etl::dyn_matrix<Z, 3> dxs(T, B, I);
+    etl::dyn_matrix<Z, 2> dh0(B, H);
+    etl::dyn_matrix<Z, 2> dw_x(I, 3 * H);
+    etl::dyn_matrix<Z, 2> dw_h(H, 3 * H);
+    etl::dyn_vector<Z> db_x(3 * H);
+    etl::dyn_vector<Z> db_h(3 * H);
+
+    dw_x = 0.0;
+    dw_h = 0.0;
+    db_x = 0.0;
+    db_h = 0.0;
+
+    dxs = etl::gru_backward(xs, h0, hs, gates, dhs, w_x, w_h, dh0, dw_x, dw_h, db_x, db_h);
+
+    // Backpropagation through time with the cell expressions
+
+    etl::dyn_matrix<Z, 2> ref_dx(B, I);
+    etl::dyn_matrix<Z, 2> ref_dh(B, H);
+    etl::dyn_matrix<Z, 2> ref_dh_prev(B, H);
+    etl::dyn_matrix<Z, 2> ref_dw_x(I, 3 * H);
+    etl::dyn_matrix<Z, 2> ref_dw_h(H, 3 * H);
+    etl::dyn_vector<Z> ref_db_x(3 * H);
+    etl::dyn_vector<Z> ref_db_h(3 * H);
+
+    ref_dh   = 0.0;
+    ref_dw_x = 0.0;
+    ref_dw_h = 0.0;
+    ref_db_x = 0.0;
+    ref_db_h = 0.0;
+
+    for (size_t tt = T; tt > 0; --tt) {
+        const size_t t = tt - 1;
+
+        ref_dh += dhs(t);
+
+        if (t == 0) {
+            ref_dx = etl::gru_cell_backward(xs(t), h0, gates(t), ref_dh, w_x, w_h, ref_dh_prev, ref_dw_x, ref_dw_h, ref_db_x, ref_db_h);
+        } else {
+            ref_dx = etl::gru_cell_backward(xs(t), hs(t - 1), gates(t), ref_dh, w_x, w_h, ref_dh_prev, ref_dw_x, ref_dw_h, ref_db_x, ref_db_h);
+        }
+
+        for (size_t i = 0; i < B * I; ++i) {
+            REQUIRE_EQUALS_APPROX(dxs(t)[i], ref_dx[i]);
+        }
+
+        ref_dh = ref_dh_prev;
+    }
+
+    for (size_t i = 0; i < B * H; ++i) {
+        REQUIRE_EQUALS_APPROX(dh0[i], ref_dh[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(dw_x); ++i) {
+        REQUIRE_EQUALS_APPROX(dw_x[i], ref_dw_x[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(dw_h); ++i) {
+        REQUIRE_EQUALS_APPROX(dw_h[i], ref_dw_h[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(db_x); ++i) {
+        REQUIRE_EQUALS_APPROX(db_x[i], ref_db_x[i]);
+        REQUIRE_EQUALS_APPROX(db_h[i], ref_db_h[i]);
+    }
+}
@@ -106,3 +106,42 @@ TEMPLATE_TEST_CASE_2("stable_softmax/2", "fast_vector::softmax", Z, float, doubl
         REQUIRE_EQUALS_APPROX(c[i], c_ref[i]);
     }
 }
+
+TEMPLATE_TEST_CASE_2("softmax/vec/1", "[softmax]", Z, float, double) {
+    etl::dyn_matrix<Z> a(7, 37);
+    a = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_matrix<Z> ref(7, 37);
+    etl::dyn_matrix<Z> c(7, 37);
+
+    ref = selected_helper(etl::batch_softmax_impl::STD, etl::softmax(a));
+    c   = selected_helper(etl::batch_softmax_impl::VEC, etl::softmax(a));
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("softmax/vec/2", "[softmax]", Z, float, double) {
+    etl::dyn_vector<Z> a(101);
+    a = etl::uniform_generator(-10.0, 10.0);
+
+    etl::dyn_vector<Z> ref(101);
+    etl::dyn_vector<Z> c(101);
+
+    ref = selected_helper(etl::batch_softmax_impl::STD, etl::softmax(a));
+    c   = selected_helper(etl::batch_softmax_impl::VEC, etl::softmax(a));
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+}
+
+TEMPLATE_TEST_CASE_2("stable_softmax/vec/1", "[softmax]", Z, float, double) {
+    etl::fast_matrix<Z, 4, 3, 5> a;
+    a = etl::uniform_generator(-10.0, 10.0);
+
+    etl::fast_matrix<Z, 4, 3, 5> ref;
+    etl::fast_matrix<Z, 4, 3, 5> c;
+
+    ref = selected_helper(etl::batch_softmax_impl::STD, etl::stable_softmax(a));
+    c   = selected_helper(etl::batch_softmax_impl::VEC, etl::stable_softmax(a));
+
+    REQUIRE_DIRECT(approx_equals(c, ref, base_eps_etl_large));
+}
@@ -0,0 +1,123 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test_light.hpp"
+
+TEMPLATE_TEST_CASE_2("sparse_builder/0", "[sparse][builder]", Z, double, float) {
+    etl::sparse_builder<Z> builder(3, 4);
+
+    builder.insert(2, 3, 5.0);
+    builder.insert(0, 1, 1.0);
+    builder.insert(2, 0, 3.0);
+    builder.insert(0, 1, 2.0);
+    builder.insert(1, 2, 4.0);
+    builder.insert(1, 2, -4.0);
+
+    REQUIRE_EQUALS(builder.size(), 6UL);
+
+    auto a = builder.build();
+
+    REQUIRE_DIRECT(etl::is_sparse_matrix<decltype(a)>);
+    REQUIRE_EQUALS(a.rows(), 3UL);
+    REQUIRE_EQUALS(a.columns(), 4UL);
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+
+    REQUIRE_EQUALS(a.get(0, 1), Z(3.0));
+    REQUIRE_EQUALS(a.get(1, 2), Z(0.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 3), Z(5.0));
+
+    // The duplicates have been merged
+    REQUIRE_EQUALS(builder.size(), 3UL);
+
+    auto b = builder.template build<etl::sparse_storage::COO>();
+    auto c = builder.template build<etl::sparse_storage::CSC>();
+
+    REQUIRE_EQUALS(b.non_zeros(), 3UL);
+    REQUIRE_EQUALS(c.non_zeros(), 3UL);
+
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            REQUIRE_EQUALS(b.get(i, j), a.get(i, j));
+            REQUIRE_EQUALS(c.get(i, j), a.get(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_builder/1", "[sparse][builder]", Z, double, float) {
+    etl::sparse_builder<Z, uint32_t> builder(5, 3);
+
+    std::vector<std::tuple<size_t, size_t, Z>> triplets{{4, 2, 1.0}, {0, 0, 2.0}, {4, 2, 1.5}, {3, 1, 3.0}};
+
+    builder.insert_range(triplets.begin(), triplets.begin() + 2);
+    builder.insert_range(triplets.begin() + 2, triplets.end());
+
+    auto a = builder.template build<etl::sparse_storage::CSR>();
+
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+    REQUIRE_EQUALS(a.get(0, 0), Z(2.0));
+    REQUIRE_EQUALS(a.get(3, 1), Z(3.0));
+    REQUIRE_EQUALS(a.get(4, 2), Z(2.5));
+
+    // The builder can still be filled after a build
+    builder.insert(4, 2, -2.5);
+    builder.insert(1, 1, 1.0);
+
+    a = builder.template build<etl::sparse_storage::CSR>();
+
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+    REQUIRE_EQUALS(a.get(1, 1), Z(1.0));
+    REQUIRE_EQUALS(a.get(4, 2), Z(0.0));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_builder/2", "[sparse][builder]", Z, double, float) {
+    const size_t M = 211;
+    const size_t N = 157;
+
+    etl::sparse_builder<Z> builder(M, N);
+    etl::dyn_matrix<Z> ref(M, N);
+
+    ref = 0;
+
+    std::mt19937_64 g(42);
+    std::uniform_int_distribution<size_t> row_dist(0, M - 1);
+    std::uniform_int_distribution<size_t> col_dist(0, N - 1);
+    std::uniform_int_distribution<int> value_dist(-4, 4);
+
+    for (size_t n = 0; n < 10000; ++n) {
+        const size_t i = row_dist(g);
+        const size_t j = col_dist(g);
+        const Z v      = value_dist(g);
+
+        builder.insert(i, j, v);
+        ref(i, j) += v;
+    }
+
+    auto a = builder.template build<etl::sparse_storage::CSR>();
+    auto b = builder.template build<etl::sparse_storage::CSC>();
+    auto c = builder.template build<etl::sparse_storage::COO>();
+
+    etl::dyn_matrix<Z> d_a(M, N);
+    etl::dyn_matrix<Z> d_b(M, N);
+    etl::dyn_matrix<Z> d_c(M, N);
+
+    d_a = a;
+    d_b = b;
+    d_c = c;
+
+    const size_t nnz = std::count_if(ref.begin(), ref.end(), [](Z v) { return v != Z(0); });
+
+    REQUIRE_EQUALS(a.non_zeros(), nnz);
+    REQUIRE_EQUALS(b.non_zeros(), nnz);
+    REQUIRE_EQUALS(c.non_zeros(), nnz);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS(d_a[i], ref[i]);
+        REQUIRE_EQUALS(d_b[i], ref[i]);
+        REQUIRE_EQUALS(d_c[i], ref[i]);
+    }
+}
@@ -0,0 +1,266 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test_light.hpp"
+
+TEMPLATE_TEST_CASE_2("csr_matrix/init/0", "[mat][init][sparse][csr]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 3, std::initializer_list<Z>({1.0, 0.0, 2.0, 0.0, 0.0, 0.0, 0.0, 3.0, 4.0}));
+
+    REQUIRE_DIRECT(etl::is_sparse_matrix<decltype(a)>);
+    REQUIRE_EQUALS(a.rows(), 3UL);
+    REQUIRE_EQUALS(a.columns(), 3UL);
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+
+    REQUIRE_EQUALS(a.outer_index()[0], 0UL);
+    REQUIRE_EQUALS(a.outer_index()[1], 2UL);
+    REQUIRE_EQUALS(a.outer_index()[2], 2UL);
+    REQUIRE_EQUALS(a.outer_index()[3], 4UL);
+
+    REQUIRE_EQUALS(a.inner_index()[0], 0UL);
+    REQUIRE_EQUALS(a.inner_index()[1], 2UL);
+    REQUIRE_EQUALS(a.inner_index()[2], 1UL);
+    REQUIRE_EQUALS(a.inner_index()[3], 2UL);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(1.0));
+    REQUIRE_EQUALS(a.get(0, 1), Z(0.0));
+    REQUIRE_EQUALS(a.get(0, 2), Z(2.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(0.0));
+    REQUIRE_EQUALS(a.get(2, 1), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 2), Z(4.0));
+}
+
+TEMPLATE_TEST_CASE_2("csc_matrix/init/0", "[mat][init][sparse][csc]", Z, double, float) {
+    etl::csc_matrix<Z, uint32_t> a(3, 3, etl::values(1.0, 0.0, 2.0, 0.0, 0.0, 0.0, 0.0, 3.0, 4.0));
+
+    REQUIRE_EQUALS(sizeof(typename decltype(a)::index_type), 4UL);
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+
+    REQUIRE_EQUALS(a.outer_index()[0], 0U);
+    REQUIRE_EQUALS(a.outer_index()[1], 1U);
+    REQUIRE_EQUALS(a.outer_index()[2], 2U);
+    REQUIRE_EQUALS(a.outer_index()[3], 4U);
+
+    REQUIRE_EQUALS(a.inner_index()[0], 0U);
+    REQUIRE_EQUALS(a.inner_index()[1], 2U);
+    REQUIRE_EQUALS(a.inner_index()[2], 0U);
+    REQUIRE_EQUALS(a.inner_index()[3], 2U);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(1.0));
+    REQUIRE_EQUALS(a.get(0, 2), Z(2.0));
+    REQUIRE_EQUALS(a.get(2, 1), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 2), Z(4.0));
+    REQUIRE_EQUALS(a.get(1, 2), Z(0.0));
+}
+
+TEMPLATE_TEST_CASE_2("csr_matrix/set/0", "[mat][set][sparse][csr]", Z, double, float) {
+    etl::csr_matrix<Z, uint32_t> a(13, 17);
+    etl::dyn_matrix<Z> ref(13, 17);
+
+    ref = 0;
+
+    std::mt19937_64 g(42);
+    std::uniform_int_distribution<size_t> row_dist(0, 12);
+    std::uniform_int_distribution<size_t> col_dist(0, 16);
+    std::uniform_int_distribution<int> value_dist(-3, 3);
+
+    for (size_t n = 0; n < 500; ++n) {
+        const size_t i = row_dist(g);
+        const size_t j = col_dist(g);
+        const Z v      = value_dist(g);
+
+        a.set(i, j, v);
+        ref(i, j) = v;
+    }
+
+    size_t nnz = 0;
+
+    for (size_t i = 0; i < 13; ++i) {
+        for (size_t j = 0; j < 17; ++j) {
+            REQUIRE_EQUALS(a.get(i, j), ref(i, j));
+
+            if (ref(i, j) != Z(0)) {
+                ++nnz;
+            }
+        }
+    }
+
+    REQUIRE_EQUALS(a.non_zeros(), nnz);
+
+    a.erase(0, 0);
+    a.erase(12, 16);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(0));
+    REQUIRE_EQUALS(a.get(12, 16), Z(0));
+}
+
+TEMPLATE_TEST_CASE_2("csr_matrix/reference/0", "[mat][reference][sparse][csr]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 3);
+
+    a(1, 1) = 42;
+    a(0, 0) = 1.0;
+    a(2, 2) = 2.0;
+    a(2, 0) = 3.0;
+
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+
+    a(1, 1) += Z(1.0);
+    a(2, 2) -= Z(2.0);
+    a(0, 0) *= Z(3.0);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(3.0));
+    REQUIRE_EQUALS(a.get(1, 1), Z(43.0));
+    REQUIRE_EQUALS(a.get(2, 0), Z(3.0));
+    REQUIRE_EQUALS(a.get(2, 2), Z(0.0));
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+
+    REQUIRE_DIRECT(a[0] == Z(3.0));
+    REQUIRE_DIRECT(a[4] == Z(43.0));
+    REQUIRE_DIRECT(a[6] == Z(3.0));
+}
+
+TEMPLATE_TEST_CASE_2("csr_matrix/convert/0", "[mat][sparse][csr]", Z, double, float) {
+    etl::dyn_matrix<Z> d(5, 7);
+
+    d = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.7);
+
+    etl::csr_matrix<Z> a(d);
+    etl::sparse_matrix<Z> b;
+    etl::csc_matrix<Z, uint32_t> c;
+    etl::csr_matrix<Z, uint32_t> e;
+
+    b = a;
+    c = b;
+    e = c;
+
+    etl::dyn_matrix<Z> d_a(5, 7);
+    etl::dyn_matrix<Z> d_b(5, 7);
+    etl::dyn_matrix<Z> d_c(5, 7);
+    etl::dyn_matrix<Z, 2> d_e(5, 7);
+    etl::dyn_matrix_cm<Z> d_cm(5, 7);
+
+    d_a  = a;
+    d_b  = b;
+    d_c  = c;
+    d_e  = e;
+    d_cm = c;
+
+    REQUIRE_EQUALS(b.non_zeros(), a.non_zeros());
+    REQUIRE_EQUALS(c.non_zeros(), a.non_zeros());
+    REQUIRE_EQUALS(e.non_zeros(), a.non_zeros());
+
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            REQUIRE_EQUALS(a.get(i, j), d(i, j));
+            REQUIRE_EQUALS(b.get(i, j), d(i, j));
+            REQUIRE_EQUALS(c.get(i, j), d(i, j));
+            REQUIRE_EQUALS(e.get(i, j), d(i, j));
+
+            REQUIRE_EQUALS(d_a(i, j), d(i, j));
+            REQUIRE_EQUALS(d_b(i, j), d(i, j));
+            REQUIRE_EQUALS(d_c(i, j), d(i, j));
+            REQUIRE_EQUALS(d_e(i, j), d(i, j));
+            REQUIRE_EQUALS(d_cm(i, j), d(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("csr_matrix/expr/0", "[mat][sparse][csr]", Z, double, float) {
+    etl::dyn_matrix<Z> d(4, 3, etl::values(1, 0, 2, 0, 0, 0, 3, 0, 0, 0, 4, 5));
+    etl::dyn_matrix_cm<Z> d_cm(4, 3);
+
+    d_cm = d;
+
+    etl::csr_matrix<Z> a;
+
+    a = Z(2) * d;
+
+    REQUIRE_EQUALS(a.non_zeros(), 5UL);
+    REQUIRE_EQUALS(a.get(0, 2), Z(4));
+    REQUIRE_EQUALS(a.get(3, 2), Z(10));
+
+    etl::csc_matrix<Z> b;
+
+    b = d_cm;
+
+    REQUIRE_EQUALS(b.non_zeros(), 5UL);
+    REQUIRE_EQUALS(b.get(2, 0), Z(3));
+    REQUIRE_EQUALS(b.get(3, 1), Z(4));
+
+    // The matrix is read before being replaced
+    a = a + d;
+
+    REQUIRE_EQUALS(a.non_zeros(), 5UL);
+    REQUIRE_EQUALS(a.get(0, 0), Z(3));
+    REQUIRE_EQUALS(a.get(3, 2), Z(15));
+}
+
+TEMPLATE_TEST_CASE_2("csr_matrix/entries/0", "[mat][sparse][csr]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 4, etl::values(1, 0, 2, 0, 0, 0, 0, 0, 0, 3, 4, 5));
+
+    REQUIRE_EQUALS(a.row_entries(0).size(), 2UL);
+    REQUIRE_EQUALS(a.row_entries(1).size(), 0UL);
+    REQUIRE_EQUALS(a.row_entries(2).size(), 3UL);
+
+    size_t n = 0;
+    Z sum    = 0;
+
+    for (auto [j, v] : a.row_entries(2)) {
+        REQUIRE_EQUALS(j, n + 1);
+        sum += v;
+        ++n;
+    }
+
+    REQUIRE_EQUALS(n, 3UL);
+    REQUIRE_EQUALS(sum, Z(12));
+
+    // The values can be modified in place
+    for (auto [j, v] : a.row_entries(0)) {
+        v *= Z(j + 1);
+    }
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(1));
+    REQUIRE_EQUALS(a.get(0, 2), Z(6));
+
+    etl::csc_matrix<Z> b;
+
+    b = a;
+
+    auto column = b.column_entries(2);
+
+    REQUIRE_EQUALS(column.size(), 2UL);
+    REQUIRE_EQUALS(column.index(0), 0UL);
+    REQUIRE_EQUALS(column.index(1), 2UL);
+    REQUIRE_EQUALS(column.value(0), Z(6));
+    REQUIRE_EQUALS(column.value(1), Z(4));
+}
+
+TEMPLATE_TEST_CASE_2("csr_matrix/copy/0", "[mat][sparse][csr]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 3);
+
+    a(1, 1) = 42;
+    a(0, 0) = 1.0;
+
+    etl::csr_matrix<Z> b(a);
+
+    a(2, 2) = 2.0;
+
+    REQUIRE_EQUALS(a.non_zeros(), 3UL);
+    REQUIRE_EQUALS(b.non_zeros(), 2UL);
+    REQUIRE_EQUALS(b.get(1, 1), Z(42));
+    REQUIRE_EQUALS(b.get(2, 2), Z(0));
+
+    b = a;
+
+    REQUIRE_EQUALS(b.non_zeros(), 3UL);
+    REQUIRE_EQUALS(b.get(2, 2), Z(2));
+
+    etl::csr_matrix<Z> c(std::move(a));
+
+    REQUIRE_EQUALS(c.non_zeros(), 3UL);
+    REQUIRE_EQUALS(c.get(1, 1), Z(42));
+    REQUIRE_EQUALS(c.get(2, 2), Z(2));
+}
@@ -344,3 +344,34 @@ TEMPLATE_TEST_CASE_2("sparse_matrix/copy/1", "[mat][reference][sparse]", Z, doub
     REQUIRE_EQUALS(b.get(2, 2), 2.0);
     REQUIRE_EQUALS(b.non_zeros(), 3UL);
 }
+
+TEMPLATE_TEST_CASE_2("sparse_matrix/copy/2", "[mat][reference][sparse]", Z, double, float) {
+    etl::sparse_matrix<Z> a(20, 20);
+
+    // Insertions in reverse order, with reallocations
+    for (size_t i = 0; i < 20; ++i) {
+        a.set(19 - i, 19 - i, Z(i + 1));
+        a.set(19 - i, 0, Z(1));
+    }
+
+    REQUIRE_EQUALS(a.non_zeros(), 39UL);
+
+    etl::sparse_matrix<Z> b(a);
+
+    a.erase(5, 5);
+    a.set(0, 0, 0.0);
+
+    REQUIRE_EQUALS(a.non_zeros(), 37UL);
+    REQUIRE_EQUALS(b.non_zeros(), 39UL);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(0));
+    REQUIRE_EQUALS(b.get(0, 0), Z(1));
+
+    for (size_t i = 1; i < 20; ++i) {
+        REQUIRE_EQUALS(b.get(i, i), Z(20 - i));
+        REQUIRE_EQUALS(a.get(i, i), i == 5 ? Z(0) : Z(20 - i));
+
+        REQUIRE_EQUALS(a.get(i, 0), Z(1));
+        REQUIRE_EQUALS(b.get(i, 0), Z(1));
+    }
+}
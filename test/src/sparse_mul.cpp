@@ -0,0 +1,251 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("sparse_mul/mm/0", "[mul][sparse]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 4, etl::values(1, 0, 2, 0, 0, 0, 0, 0, 0, 3, 0, 4));
+    etl::dyn_matrix<Z> b(4, 2, etl::values(1, 2, 3, 4, 5, 6, 7, 8));
+    etl::dyn_matrix<Z> c(3, 2);
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0, 0), Z(11));
+    REQUIRE_EQUALS(c(0, 1), Z(14));
+    REQUIRE_EQUALS(c(1, 0), Z(0));
+    REQUIRE_EQUALS(c(1, 1), Z(0));
+    REQUIRE_EQUALS(c(2, 0), Z(37));
+    REQUIRE_EQUALS(c(2, 1), Z(44));
+
+    etl::csc_matrix<Z, uint32_t> a_csc;
+    etl::sparse_matrix<Z> a_coo;
+
+    a_csc = a;
+    a_coo = a;
+
+    c = 0;
+    c = a_csc * b;
+
+    REQUIRE_EQUALS(c(0, 0), Z(11));
+    REQUIRE_EQUALS(c(2, 1), Z(44));
+
+    c = 0;
+    c = etl::mul(a_coo, b);
+
+    REQUIRE_EQUALS(c(0, 1), Z(14));
+    REQUIRE_EQUALS(c(2, 0), Z(37));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/mm/1", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> d(67, 45);
+    etl::dyn_matrix<Z> b(45, 33);
+    etl::dyn_matrix<Z> bt(33, 67);
+
+    d  = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.8);
+    b  = etl::uniform_generator(-1.0, 1.0);
+    bt = etl::uniform_generator(-1.0, 1.0);
+
+    etl::csr_matrix<Z> a_csr(d);
+    etl::csc_matrix<Z> a_csc(d);
+
+    etl::dyn_matrix<Z> ref(67, 33);
+    etl::dyn_matrix<Z> ref_t(45, 33);
+
+    ref   = d * b;
+    ref_t = trans(d) * trans(bt);
+
+    etl::dyn_matrix<Z> c(67, 33);
+    etl::dyn_matrix_cm<Z> c_cm(67, 33);
+    etl::dyn_matrix<Z> c_csc(67, 33);
+    etl::dyn_matrix<Z> c_t(45, 33);
+    etl::dyn_matrix<Z> c_csc_t(45, 33);
+
+    c       = a_csr * b;
+    c_cm    = a_csr * b;
+    c_csc   = a_csc * b;
+    c_t     = trans(a_csr) * trans(bt);
+    c_csc_t = trans(a_csc) * trans(bt);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX(c[i], ref[i]);
+        REQUIRE_EQUALS_APPROX(c_cm(i / 33, i % 33), ref[i]);
+        REQUIRE_EQUALS_APPROX(c_csc[i], ref[i]);
+    }
+
+    for (size_t i = 0; i < etl::size(ref_t); ++i) {
+        REQUIRE_EQUALS_APPROX(c_t[i], ref_t[i]);
+        REQUIRE_EQUALS_APPROX(c_csc_t[i], ref_t[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/mm/2", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> d(129, 257);
+    etl::dyn_matrix<Z> b(257, 65);
+
+    d = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.5);
+    b = etl::uniform_generator(-1.0, 1.0);
+
+    etl::csr_matrix<Z, uint32_t> a_csr(d);
+    etl::csc_matrix<Z, uint32_t> a_csc(d);
+
+    etl::dyn_matrix<Z> ref(129, 65);
+
+    ref = d * b;
+
+    etl::dyn_matrix<Z> c(129, 65);
+    etl::dyn_matrix<Z> c_csc(129, 65);
+
+    c     = a_csr * b;
+    c_csc = a_csc * b;
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c_csc[i], ref[i], base_eps_etl_large);
+    }
+
+    // Compound and expressions
+    c += a_csr * (Z(2) * b);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], Z(3) * ref[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/mv/0", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> d(37, 23);
+    etl::dyn_vector<Z> b(23);
+    etl::dyn_vector<Z> bt(37);
+
+    d  = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.7);
+    b  = etl::uniform_generator(-1.0, 1.0);
+    bt = etl::uniform_generator(-1.0, 1.0);
+
+    etl::csr_matrix<Z> a_csr(d);
+    etl::csc_matrix<Z> a_csc(d);
+    etl::sparse_matrix<Z> a_coo;
+
+    a_coo = d;
+
+    etl::dyn_vector<Z> ref(37);
+    etl::dyn_vector<Z> ref_t(23);
+
+    ref   = d * b;
+    ref_t = trans(d) * bt;
+
+    etl::dyn_vector<Z> c_csr(37);
+    etl::dyn_vector<Z> c_csc(37);
+    etl::dyn_vector<Z> c_coo(37);
+    etl::dyn_vector<Z> c_csr_t(23);
+    etl::dyn_vector<Z> c_csc_t(23);
+
+    c_csr   = a_csr * b;
+    c_csc   = a_csc * b;
+    c_coo   = a_coo * b;
+    c_csr_t = trans(a_csr) * bt;
+    c_csc_t = trans(a_csc) * bt;
+
+    for (size_t i = 0; i < 37; ++i) {
+        REQUIRE_EQUALS_APPROX(c_csr[i], ref[i]);
+        REQUIRE_EQUALS_APPROX(c_csc[i], ref[i]);
+        REQUIRE_EQUALS_APPROX(c_coo[i], ref[i]);
+    }
+
+    for (size_t i = 0; i < 23; ++i) {
+        REQUIRE_EQUALS_APPROX(c_csr_t[i], ref_t[i]);
+        REQUIRE_EQUALS_APPROX(c_csc_t[i], ref_t[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/dense_sparse/0", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> d(31, 19);
+    etl::dyn_matrix<Z> a(11, 31);
+    etl::dyn_vector<Z> v(31);
+    etl::dyn_vector<Z> vt(19);
+
+    d  = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.7);
+    a  = etl::uniform_generator(-1.0, 1.0);
+    v  = etl::uniform_generator(-1.0, 1.0);
+    vt = etl::uniform_generator(-1.0, 1.0);
+
+    etl::csr_matrix<Z> b_csr(d);
+    etl::csc_matrix<Z> b_csc(d);
+
+    etl::dyn_matrix<Z> ref(11, 19);
+    etl::dyn_vector<Z> ref_v(19);
+    etl::dyn_vector<Z> ref_vt(31);
+
+    ref    = a * d;
+    ref_v  = v * d;
+    ref_vt = vt * trans(d);
+
+    etl::dyn_matrix<Z> c_csr(11, 19);
+    etl::dyn_matrix<Z> c_csc(11, 19);
+
+    c_csr = a * b_csr;
+    c_csc = a * b_csc;
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX(c_csr[i], ref[i]);
+        REQUIRE_EQUALS_APPROX(c_csc[i], ref[i]);
+    }
+
+    etl::dyn_vector<Z> c_v_csr(19);
+    etl::dyn_vector<Z> c_v_csc(19);
+    etl::dyn_vector<Z> c_vt_csr(31);
+    etl::dyn_vector<Z> c_vt_csc(31);
+
+    c_v_csr  = v * b_csr;
+    c_v_csc  = v * b_csc;
+    c_vt_csr = vt * trans(b_csr);
+    c_vt_csc = vt * trans(b_csc);
+
+    for (size_t i = 0; i < 19; ++i) {
+        REQUIRE_EQUALS_APPROX(c_v_csr[i], ref_v[i]);
+        REQUIRE_EQUALS_APPROX(c_v_csc[i], ref_v[i]);
+    }
+
+    for (size_t i = 0; i < 31; ++i) {
+        REQUIRE_EQUALS_APPROX(c_vt_csr[i], ref_vt[i]);
+        REQUIRE_EQUALS_APPROX(c_vt_csc[i], ref_vt[i]);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_mul/transposed_dense/0", "[mul][sparse]", Z, double, float) {
+    etl::dyn_matrix<Z> d(13, 13);
+    etl::dyn_matrix<Z> x(13, 13);
+
+    d = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.6);
+    x = etl::uniform_generator(-1.0, 1.0);
+
+    etl::csr_matrix<Z> s_csr(d);
+    etl::csc_matrix<Z> s_csc(d);
+
+    etl::dyn_matrix<Z> ref_l(13, 13);
+    etl::dyn_matrix<Z> ref_r(13, 13);
+
+    ref_l = trans(x) * d;
+    ref_r = d * trans(x);
+
+    etl::dyn_matrix<Z> c_csr(13, 13);
+    etl::dyn_matrix<Z> c_csc(13, 13);
+
+    c_csr = trans(x) * s_csr;
+    c_csc = trans(x) * s_csc;
+
+    for (size_t i = 0; i < etl::size(ref_l); ++i) {
+        REQUIRE_EQUALS_APPROX(c_csr[i], ref_l[i]);
+        REQUIRE_EQUALS_APPROX(c_csc[i], ref_l[i]);
+    }
+
+    c_csr = s_csr * trans(x);
+    c_csc = s_csc * trans(x);
+
+    for (size_t i = 0; i < etl::size(ref_r); ++i) {
+        REQUIRE_EQUALS_APPROX(c_csr[i], ref_r[i]);
+        REQUIRE_EQUALS_APPROX(c_csc[i], ref_r[i]);
+    }
+}
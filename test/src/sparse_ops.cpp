@@ -0,0 +1,164 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("sparse_ops/scalar/0", "[sparse][structural]", Z, double, float) {
+    etl::csr_matrix<Z> a(3, 4, etl::values(1, 0, -2, 0, 0, 0, 0, 0, 0, 3, 0, -4));
+    etl::csr_matrix<Z> c;
+
+    c = Z(2) * a;
+
+    REQUIRE_EQUALS(c.non_zeros(), 4UL);
+    REQUIRE_EQUALS(c.get(0, 0), Z(2));
+    REQUIRE_EQUALS(c.get(0, 2), Z(-4));
+    REQUIRE_EQUALS(c.get(2, 1), Z(6));
+    REQUIRE_EQUALS(c.get(2, 3), Z(-8));
+
+    c = a / Z(2);
+
+    REQUIRE_EQUALS(c.non_zeros(), 4UL);
+    REQUIRE_EQUALS(c.get(0, 0), Z(0.5));
+    REQUIRE_EQUALS(c.get(2, 3), Z(-2));
+
+    etl::sparse_matrix<Z> c_coo;
+    etl::csc_matrix<Z> c_csc;
+
+    c_coo = -(a * Z(3));
+    c_csc = abs(a);
+
+    REQUIRE_EQUALS(c_coo.non_zeros(), 4UL);
+    REQUIRE_EQUALS(c_coo.get(0, 2), Z(6));
+    REQUIRE_EQUALS(c_coo.get(2, 1), Z(-9));
+
+    REQUIRE_EQUALS(c_csc.non_zeros(), 4UL);
+    REQUIRE_EQUALS(c_csc.get(0, 2), Z(2));
+    REQUIRE_EQUALS(c_csc.get(2, 3), Z(4));
+}
+
+TEMPLATE_TEST_CASE_2("sparse_ops/merge/0", "[sparse][structural]", Z, double, float) {
+    etl::dyn_matrix<Z> da(37, 29);
+    etl::dyn_matrix<Z> db(37, 29);
+
+    da = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.6);
+    db = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.6);
+
+    etl::csr_matrix<Z> a(da);
+    etl::csc_matrix<Z> b(db);
+    etl::sparse_matrix<Z> b_coo;
+
+    b_coo = db;
+
+    etl::dyn_matrix<Z> ref_add(37, 29);
+    etl::dyn_matrix<Z> ref_sub(37, 29);
+    etl::dyn_matrix<Z> ref_mul(37, 29);
+
+    ref_add = da + Z(2) * db;
+    ref_sub = da - db;
+    ref_mul = da >> db;
+
+    etl::csr_matrix<Z> c_add;
+    etl::sparse_matrix<Z> c_sub;
+    etl::csc_matrix<Z> c_mul;
+
+    c_add = a + Z(2) * b;
+    c_sub = a - b_coo;
+    c_mul = a >> b;
+
+    size_t nnz_add = 0;
+    size_t nnz_mul = 0;
+
+    for (size_t i = 0; i < 37; ++i) {
+        for (size_t j = 0; j < 29; ++j) {
+            REQUIRE_EQUALS_APPROX(c_add.get(i, j), ref_add(i, j));
+            REQUIRE_EQUALS_APPROX(c_sub.get(i, j), ref_sub(i, j));
+            REQUIRE_EQUALS_APPROX(c_mul.get(i, j), ref_mul(i, j));
+
+            nnz_add += ref_add(i, j) != Z(0);
+            nnz_mul += ref_mul(i, j) != Z(0);
+        }
+    }
+
+    // The merges only store the non-zeros
+
+    REQUIRE_EQUALS(c_add.non_zeros(), nnz_add);
+    REQUIRE_EQUALS(c_mul.non_zeros(), nnz_mul);
+
+    c_sub = a - a;
+
+    REQUIRE_EQUALS(c_sub.non_zeros(), 0UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_ops/alias/0", "[sparse][structural]", Z, double, float) {
+    etl::sparse_matrix<Z> a(3, 2, std::initializer_list<Z>({1.0, 0.0, 0.0, 2.0, 3.0, 0.0}));
+    etl::csr_matrix<Z> b(3, 2, etl::values(2.0, 1.0, 0.0, 3.0, 0.0, 0.0));
+
+    a = a + b;
+    b = Z(2) * (b >> a);
+
+    REQUIRE_EQUALS(a.get(0, 0), Z(3));
+    REQUIRE_EQUALS(a.get(0, 1), Z(1));
+    REQUIRE_EQUALS(a.get(1, 1), Z(5));
+    REQUIRE_EQUALS(a.get(2, 0), Z(3));
+    REQUIRE_EQUALS(a.non_zeros(), 4UL);
+
+    REQUIRE_EQUALS(b.get(0, 0), Z(12));
+    REQUIRE_EQUALS(b.get(0, 1), Z(2));
+    REQUIRE_EQUALS(b.get(1, 1), Z(30));
+    REQUIRE_EQUALS(b.non_zeros(), 3UL);
+}
+
+TEMPLATE_TEST_CASE_2("sparse_ops/dense/0", "[sparse][structural]", Z, double, float) {
+    etl::dyn_matrix<Z> da(23, 31);
+    etl::dyn_matrix<Z> db(23, 31);
+
+    da = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.7);
+    db = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.7);
+
+    etl::csr_matrix<Z> a(da);
+    etl::csc_matrix<Z> b(db);
+
+    etl::dyn_matrix<Z> ref(23, 31);
+
+    ref = Z(3) * da - abs(db);
+
+    etl::dyn_matrix<Z> c(23, 31);
+    etl::dyn_matrix_cm<Z> c_cm(23, 31);
+
+    c    = 1.0;
+    c    = Z(3) * a - abs(b);
+    c_cm = Z(3) * a - abs(b);
+
+    for (size_t i = 0; i < 23; ++i) {
+        for (size_t j = 0; j < 31; ++j) {
+            REQUIRE_EQUALS_APPROX(c(i, j), ref(i, j));
+            REQUIRE_EQUALS_APPROX(c_cm(i, j), ref(i, j));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE_2("sparse_ops/reduce/0", "[sparse][structural]", Z, double, float) {
+    etl::dyn_matrix<Z> da(41, 17);
+    etl::dyn_matrix<Z> db(41, 17);
+
+    da = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.8);
+    db = etl::uniform_generator(-1.0, 1.0) >> etl::dropout_mask(0.8);
+
+    etl::sparse_matrix<Z> a;
+    etl::csc_matrix<Z> b(db);
+
+    a = da;
+
+    REQUIRE_EQUALS_APPROX(etl::sum(a), etl::sum(da));
+    REQUIRE_EQUALS_APPROX(etl::asum(a), etl::asum(da));
+    REQUIRE_EQUALS_APPROX(etl::mean(b), etl::mean(db));
+    REQUIRE_EQUALS_APPROX(etl::amean(b), etl::amean(db));
+
+    REQUIRE_EQUALS_APPROX(etl::sum(a + Z(2) * b), etl::sum(da + Z(2) * db));
+    REQUIRE_EQUALS_APPROX(etl::asum(a >> b), etl::asum(da >> db));
+    REQUIRE_EQUALS_APPROX(etl::mean(-a), etl::mean(-da));
+}
@@ -0,0 +1,153 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+namespace {
+
+template <typename Z, typename S, typename W>
+etl::dyn_matrix<std::complex<Z>> stft_reference(const S& signal, const W& window, size_t frame, size_t hop) {
+    const size_t frames = (etl::size(signal) - frame) / hop + 1;
+
+    etl::dyn_matrix<std::complex<Z>> ref(frames, frame / 2 + 1);
+
+    etl::dyn_vector<Z> windowed(frame);
+    etl::dyn_vector<std::complex<Z>> spectrum(frame);
+
+    for (size_t f = 0; f < frames; ++f) {
+        for (size_t i = 0; i < frame; ++i) {
+            windowed[i] = window[i] * signal[f * hop + i];
+        }
+
+        spectrum = etl::fft_1d(windowed);
+
+        for (size_t k = 0; k < frame / 2 + 1; ++k) {
+            ref(f, k) = spectrum[k];
+        }
+    }
+
+    return ref;
+}
+
+} // end of anonymous namespace
+
+TEMPLATE_TEST_CASE_2("stft/0", "[stft]", Z, float, double) {
+    etl::dyn_vector<Z> signal(64);
+    etl::dyn_vector<Z> window(16);
+
+    for (size_t i = 0; i < 64; ++i) {
+        signal[i] = std::sin(Z(0.3) * i) + Z(0.5) * std::cos(Z(1.7) * i);
+    }
+
+    for (size_t i = 0; i < 16; ++i) {
+        window[i] = Z(0.5) - Z(0.5) * std::cos(Z(2.0 * M_PI) * i / Z(16));
+    }
+
+    etl::dyn_matrix<std::complex<Z>> c;
+    c = etl::stft(signal, window, 16, 4);
+
+    auto ref = stft_reference<Z>(signal, window, 16, 4);
+
+    REQUIRE_EQUALS(etl::dim<0>(c), 13UL);
+    REQUIRE_EQUALS(etl::dim<1>(c), 9UL);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i].real(), ref[i].real(), base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c[i].imag(), ref[i].imag(), base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("stft/1", "[stft]", Z, float, double) {
+    etl::dyn_vector<Z> signal(50);
+    etl::dyn_vector<Z> window(12);
+
+    for (size_t i = 0; i < 50; ++i) {
+        signal[i] = Z(i % 7) - Z(3.0);
+    }
+
+    window = 1.0;
+
+    etl::dyn_matrix<std::complex<Z>> c;
+    c = etl::stft(signal, window, 12, 5);
+
+    auto ref = stft_reference<Z>(signal, window, 12, 5);
+
+    REQUIRE_EQUALS(etl::dim<0>(c), 8UL);
+    REQUIRE_EQUALS(etl::dim<1>(c), 7UL);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i].real(), ref[i].real(), base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(c[i].imag(), ref[i].imag(), base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("stft/magnitude", "[stft]", Z, float, double) {
+    etl::dyn_vector<Z> signal(40);
+    etl::dyn_vector<Z> window(8);
+
+    for (size_t i = 0; i < 40; ++i) {
+        signal[i] = std::sin(Z(0.9) * i);
+    }
+
+    window = 0.5;
+
+    etl::dyn_matrix<Z> c;
+    etl::dyn_matrix<Z> d;
+
+    c = etl::stft_magnitude(signal, window, 8, 3);
+    d = etl::stft_power(signal, window, 8, 3);
+
+    auto ref = stft_reference<Z>(signal, window, 8, 3);
+
+    REQUIRE_EQUALS(etl::dim<0>(c), 11UL);
+    REQUIRE_EQUALS(etl::dim<1>(c), 5UL);
+
+    for (size_t i = 0; i < etl::size(c); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], std::abs(ref[i]), base_eps_etl_large);
+        REQUIRE_EQUALS_APPROX_E(d[i], std::norm(ref[i]), base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("stft/stream", "[stft]", Z, float, double) {
+    etl::dyn_vector<Z> signal(100);
+    etl::dyn_vector<Z> window(16);
+
+    for (size_t i = 0; i < 100; ++i) {
+        signal[i] = std::cos(Z(0.21) * i) * Z(i % 5);
+    }
+
+    for (size_t i = 0; i < 16; ++i) {
+        window[i] = Z(0.54) - Z(0.46) * std::cos(Z(2.0 * M_PI) * i / Z(15));
+    }
+
+    etl::dyn_matrix<Z> ref;
+    ref = etl::stft_power(signal, window, 16, 6);
+
+    etl::stft_stream<Z, etl::stft_mode::POWER> stream(window, 6);
+
+    etl::dyn_matrix<Z> out(4, 9);
+    etl::dyn_matrix<Z> all(etl::dim<0>(ref), 9);
+
+    size_t f = 0;
+
+    for (size_t i = 0; i < 100; i += 10) {
+        stream.push(etl::slice(signal, i, i + 10));
+
+        while (size_t n = stream.pop(out)) {
+            for (size_t j = 0; j < n; ++j) {
+                all(f++) = out(j);
+            }
+        }
+    }
+
+    REQUIRE_EQUALS(f, etl::dim<0>(ref));
+    REQUIRE_EQUALS(stream.frames(), 0UL);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(all[i], ref[i], base_eps_etl_large);
+    }
+}
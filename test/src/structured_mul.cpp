@@ -0,0 +1,243 @@
+//=======================================================================
+// Copyright (c) 2014-2020 Baptiste Wicht
+// Distributed under the terms of the MIT License.
+// (See accompanying file LICENSE or copy at
+//  http://opensource.org/licenses/MIT)
+//=======================================================================
+
+#include "test.hpp"
+
+TEMPLATE_TEST_CASE_2("structured_mul/diagonal/0", "[mul][diagonal]", Z, double, float) {
+    etl::diagonal_matrix<etl::dyn_matrix<Z>> a(3UL);
+    etl::dyn_matrix<Z> b(3, 2, etl::values(1, 2, 3, 4, 5, 6));
+    etl::dyn_matrix<Z> bt(2, 3, etl::values(1, 2, 3, 4, 5, 6));
+    etl::dyn_matrix<Z> c(3, 2);
+    etl::dyn_matrix<Z> ct(2, 3);
+
+    a(0, 0) = 2.0;
+    a(1, 1) = -1.0;
+    a(2, 2) = 3.0;
+
+    c  = a * b;
+    ct = bt * a;
+
+    REQUIRE_EQUALS(c(0, 0), Z(2));
+    REQUIRE_EQUALS(c(0, 1), Z(4));
+    REQUIRE_EQUALS(c(1, 0), Z(-3));
+    REQUIRE_EQUALS(c(1, 1), Z(-4));
+    REQUIRE_EQUALS(c(2, 0), Z(15));
+    REQUIRE_EQUALS(c(2, 1), Z(18));
+
+    REQUIRE_EQUALS(ct(0, 0), Z(2));
+    REQUIRE_EQUALS(ct(0, 1), Z(-2));
+    REQUIRE_EQUALS(ct(0, 2), Z(9));
+    REQUIRE_EQUALS(ct(1, 0), Z(8));
+    REQUIRE_EQUALS(ct(1, 1), Z(-5));
+    REQUIRE_EQUALS(ct(1, 2), Z(18));
+}
+
+TEMPLATE_TEST_CASE_2("structured_mul/lower/0", "[mul][lower]", Z, double, float) {
+    etl::lower_matrix<etl::dyn_matrix<Z>> a(3UL);
+    etl::dyn_matrix<Z> b(3, 2, etl::values(1, 2, 3, 4, 5, 6));
+    etl::dyn_matrix<Z> c(3, 2);
+
+    a = etl::dyn_matrix<Z>(3, 3, etl::values(1, 0, 0, 2, 3, 0, 4, 5, 6));
+
+    c = a * b;
+
+    REQUIRE_EQUALS(c(0, 0), Z(1));
+    REQUIRE_EQUALS(c(0, 1), Z(2));
+    REQUIRE_EQUALS(c(1, 0), Z(11));
+    REQUIRE_EQUALS(c(1, 1), Z(16));
+    REQUIRE_EQUALS(c(2, 0), Z(49));
+    REQUIRE_EQUALS(c(2, 1), Z(64));
+
+    c = trans(a) * b;
+
+    REQUIRE_EQUALS(c(0, 0), Z(27));
+    REQUIRE_EQUALS(c(0, 1), Z(34));
+    REQUIRE_EQUALS(c(1, 0), Z(34));
+    REQUIRE_EQUALS(c(1, 1), Z(42));
+    REQUIRE_EQUALS(c(2, 0), Z(30));
+    REQUIRE_EQUALS(c(2, 1), Z(36));
+}
+
+TEMPLATE_TEST_CASE_2("structured_mul/triangular/1", "[mul][lower][upper]", Z, double, float) {
+    etl::dyn_matrix<Z> r(137, 137);
+    etl::dyn_matrix<Z> lo(137, 137);
+    etl::dyn_matrix<Z> up(137, 137);
+
+    r = etl::uniform_generator(-1.0, 1.0);
+
+    for (size_t i = 0; i < 137; ++i) {
+        for (size_t j = 0; j < 137; ++j) {
+            lo(i, j) = j <= i ? r(i, j) : Z(0);
+            up(i, j) = j >= i ? r(i, j) : Z(0);
+        }
+    }
+
+    etl::lower_matrix<etl::dyn_matrix<Z>> l(137UL);
+    etl::upper_matrix<etl::dyn_matrix<Z>> u(137UL);
+
+    l = lo;
+    u = up;
+
+    etl::dyn_matrix<Z> b(137, 33);
+    etl::dyn_matrix<Z> bt(33, 137);
+
+    b  = etl::uniform_generator(-1.0, 1.0);
+    bt = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> c(137, 33);
+    etl::dyn_matrix<Z> ref(137, 33);
+    etl::dyn_matrix_cm<Z> c_cm(137, 33);
+
+    c   = l * b;
+    ref = lo * b;
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+
+    c_cm = l * b;
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c_cm(i / 33, i % 33), ref[i], base_eps_etl_large);
+    }
+
+    c   = u * b;
+    ref = up * b;
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+
+    c   = trans(l) * b;
+    ref = trans(lo) * b;
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+
+    c   = trans(u) * b;
+    ref = trans(up) * b;
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+
+    etl::dyn_matrix<Z> ct(33, 137);
+    etl::dyn_matrix<Z> ref_t(33, 137);
+
+    ct    = bt * l;
+    ref_t = bt * lo;
+
+    for (size_t i = 0; i < etl::size(ref_t); ++i) {
+        REQUIRE_EQUALS_APPROX_E(ct[i], ref_t[i], base_eps_etl_large);
+    }
+
+    ct    = bt * u;
+    ref_t = bt * up;
+
+    for (size_t i = 0; i < etl::size(ref_t); ++i) {
+        REQUIRE_EQUALS_APPROX_E(ct[i], ref_t[i], base_eps_etl_large);
+    }
+
+    ct    = bt * trans(l);
+    ref_t = bt * trans(lo);
+
+    for (size_t i = 0; i < etl::size(ref_t); ++i) {
+        REQUIRE_EQUALS_APPROX_E(ct[i], ref_t[i], base_eps_etl_large);
+    }
+
+    etl::dyn_matrix<Z> k(137, 137);
+    etl::dyn_matrix<Z> ref_k(137, 137);
+
+    k     = l * u;
+    ref_k = lo * up;
+
+    for (size_t i = 0; i < etl::size(ref_k); ++i) {
+        REQUIRE_EQUALS_APPROX_E(k[i], ref_k[i], base_eps_etl_large);
+    }
+
+    // The result can be one of the operands
+    k     = r;
+    k     = l * k;
+    ref_k = lo * r;
+
+    for (size_t i = 0; i < etl::size(ref_k); ++i) {
+        REQUIRE_EQUALS_APPROX_E(k[i], ref_k[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("structured_mul/symmetric/0", "[mul][symmetric]", Z, double, float) {
+    etl::dyn_matrix<Z> r(67, 67);
+    etl::dyn_matrix<Z> sy(67, 67);
+
+    r = etl::uniform_generator(-1.0, 1.0);
+
+    for (size_t i = 0; i < 67; ++i) {
+        for (size_t j = 0; j < 67; ++j) {
+            sy(i, j) = r(std::max(i, j), std::min(i, j));
+        }
+    }
+
+    etl::symmetric_matrix<etl::dyn_matrix<Z>> s(67UL);
+
+    s = sy;
+
+    etl::dyn_matrix<Z> b(67, 33);
+    etl::dyn_matrix<Z> bt(33, 67);
+
+    b  = etl::uniform_generator(-1.0, 1.0);
+    bt = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> c(67, 33);
+    etl::dyn_matrix<Z> ref(67, 33);
+    etl::dyn_matrix<Z> ct(33, 67);
+    etl::dyn_matrix<Z> ref_t(33, 67);
+
+    c   = trans(s) * b;
+    ref = sy * b;
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+
+    ct    = bt * trans(s);
+    ref_t = bt * sy;
+
+    for (size_t i = 0; i < etl::size(ref_t); ++i) {
+        REQUIRE_EQUALS_APPROX_E(ct[i], ref_t[i], base_eps_etl_large);
+    }
+}
+
+TEMPLATE_TEST_CASE_2("structured_mul/syrk/0", "[mul][syrk]", Z, double, float) {
+    etl::dyn_matrix<Z> a(141, 37);
+    etl::dyn_matrix<Z> c(141, 141);
+    etl::dyn_matrix<Z> ref(141, 141);
+
+    a = etl::uniform_generator(-1.0, 1.0);
+
+    etl::dyn_matrix<Z> a2(a);
+
+    c   = a * trans(a);
+    ref = a * trans(a2);
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+
+    for (size_t i = 0; i < 141; ++i) {
+        for (size_t j = 0; j < 141; ++j) {
+            REQUIRE_EQUALS(c(i, j), c(j, i));
+        }
+    }
+
+    c   = Z(2) * (a * trans(a));
+    ref = Z(2) * ref;
+
+    for (size_t i = 0; i < etl::size(ref); ++i) {
+        REQUIRE_EQUALS_APPROX_E(c[i], ref[i], base_eps_etl_large);
+    }
+}
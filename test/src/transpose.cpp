@@ -250,6 +250,22 @@ TEMPLATE_TEST_CASE_2("transpose/expr_1", "transpose", Z, float, double) {
     REQUIRE_EQUALS(a(2, 2, 2), 9.0);
 }
 
+TEMPLATE_TEST_CASE_2("transpose/expr_2", "transpose", Z, float, double) {
+    // Leftover columns of the 16x16 and 4x4 blocks
+    etl::dyn_matrix<Z> a(23, 7);
+    etl::dyn_matrix<Z> b(7, 23);
+
+    a = etl::sequence_generator(1.0);
+
+    b = etl::transpose(a);
+
+    for (size_t i = 0; i < 23; ++i) {
+        for (size_t j = 0; j < 7; ++j) {
+            REQUIRE_EQUALS(b(j, i), a(i, j));
+        }
+    }
+}
+
 TEMPLATE_TEST_CASE_2("deep_transpose/1", "[dyn][trans]", Z, float, double) {
     etl::dyn_matrix<Z, 3> a(2, 3, 3, etl::values<Z>(1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 5, 6, 7, 8, 9));
 